@@ -8,6 +8,7 @@
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Render/UI/Widget/Public/SkeletalMeshComponentWidget.h"
 #include "Runtime/Engine/Public/SkeletalMesh.h"
+#include "Runtime/Engine/Public/AnimSequence.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
 #include "Core/Public/ObjectIterator.h"
@@ -18,6 +19,12 @@ USkeletalMeshComponent::USkeletalMeshComponent()
 	: bPoseDirty(false)
 	, bSkinningDirty(false)
 	, bNormalMapEnabled(false)
+	, SkinningMethod(ESkinningMethod::LinearBlend)
+	, AnimSequence(nullptr)
+	, AnimationPosition(0.0f)
+	, PlayRate(1.0f)
+	, bPlayingAnimation(false)
+	, bLoopingAnimation(true)
 {
 	FName DefaultFbxPath = "Data/DefaultSkeletalMesh.fbx";
 	LoadSkeletalMeshAsset(DefaultFbxPath);
@@ -48,10 +55,16 @@ UObject* USkeletalMeshComponent::Duplicate()
 
 	SkeletalMeshComponent->bPoseDirty = true;
 	SkeletalMeshComponent->bNormalMapEnabled = bNormalMapEnabled;
+	SkeletalMeshComponent->SkinningMethod = SkinningMethod;
+
+	SkeletalMeshComponent->AnimSequence = AnimSequence;
+	SkeletalMeshComponent->AnimationPosition = AnimationPosition;
+	SkeletalMeshComponent->PlayRate = PlayRate;
+	SkeletalMeshComponent->bPlayingAnimation = bPlayingAnimation;
+	SkeletalMeshComponent->bLoopingAnimation = bLoopingAnimation;
 
 	SkeletalMeshComponent->SkinnedVertices.SetNum(SkinnedVertices.Num());
 	SkeletalMeshComponent->SkinningMatrices.SetNum(SkinningMatrices.Num());
-	SkeletalMeshComponent->InvTransSkinningMatrices.SetNum(SkinningMatrices.Num());
 
 	// VertexBuffer와 IndexBuffer는 새로 생성: CPU SKinning을 하므로.
 	UStaticMesh* StaticMesh = SkeletalMeshAsset->GetStaticMesh();
@@ -133,6 +146,23 @@ void USkeletalMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandl
 
 		FJsonSerializer::ReadBool(InOutHandle, "bNormalMapEnabled", bNormalMapEnabled, false);
 
+		uint32 SkinningMethodValue = static_cast<uint32>(ESkinningMethod::LinearBlend);
+		FJsonSerializer::ReadUint32(InOutHandle, "SkinningMethod", SkinningMethodValue, 0, false);
+		SkinningMethod = static_cast<ESkinningMethod>(SkinningMethodValue);
+
+		FString AnimSequenceName;
+		FJsonSerializer::ReadString(InOutHandle, "AnimSequence", AnimSequenceName, "", false);
+		FJsonSerializer::ReadFloat(InOutHandle, "PlayRate", PlayRate, 1.0f, false);
+		FJsonSerializer::ReadBool(InOutHandle, "bLoopingAnimation", bLoopingAnimation, true, false);
+
+		bool bLoadedPlaying = false;
+		FJsonSerializer::ReadBool(InOutHandle, "bPlayingAnimation", bLoadedPlaying, false, false);
+		if (!AnimSequenceName.IsEmpty() && SkeletalMeshAsset)
+		{
+			AnimSequence = SkeletalMeshAsset->FindAnimSequence(FName(AnimSequenceName));
+		}
+		bPlayingAnimation = bLoadedPlaying && AnimSequence != nullptr;
+
 		JSON BoneTransformsArray;
 		if (FJsonSerializer::ReadArray(InOutHandle, "BoneSpaceTransforms", BoneTransformsArray, nullptr, false))
 		{
@@ -192,6 +222,15 @@ void USkeletalMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandl
 			}
 
 			InOutHandle["bNormalMapEnabled"] = bNormalMapEnabled;
+			InOutHandle["SkinningMethod"] = static_cast<uint32>(SkinningMethod);
+
+			if (AnimSequence)
+			{
+				InOutHandle["AnimSequence"] = AnimSequence->GetSequenceName().ToString();
+				InOutHandle["PlayRate"] = PlayRate;
+				InOutHandle["bLoopingAnimation"] = bLoopingAnimation;
+				InOutHandle["bPlayingAnimation"] = bPlayingAnimation;
+			}
 
 			if (BoneSpaceTransforms.Num() > 0)
 			{
@@ -254,14 +293,12 @@ void USkeletalMeshComponent::RefreshBoneTransformsCustom(const TArray<FTransform
 		return;
 	}
 
-	UE_LOG("USkeletalMeshComponent::RefreshBoneTransformsCustom - 본 트랜스폼 갱신 중...");
-
 	/** @note LOD 시스템이 없으므로 모든 본을 사용한다. */
 	TArray<FBoneIndexType> FillComponentSpaceTransformsRequiredBones(GetSkeletalMeshAsset()->GetRefSkeleton().GetRawBoneNum());
 	std::iota(FillComponentSpaceTransformsRequiredBones.begin(), FillComponentSpaceTransformsRequiredBones.end(), 0);
 	TArray<FTransform>& EditableSpaceBases = GetEditableComponentSpaceTransform();
 
-	/** 현재는 애니메이션 시스템이 없으므로 FillComponentSpaceTransforms를 직접 호출한다. */
+	/** TickPose가 샘플링한(또는 뷰어에서 편집한) 본 로컬 포즈를 컴포넌트 공간으로 누적한다. */
 	SkeletalMeshAsset->FillComponentSpaceTransforms(
 		InBoneSpaceTransforms,
 		FillComponentSpaceTransformsRequiredBones,
@@ -276,7 +313,6 @@ void USkeletalMeshComponent::RefreshBoneTransformsCustom(const TArray<FTransform
 
 		/** 스키닝 행렬 = (모델 공간 -> 본 공간) * (본 공간 -> 포즈 모델 공간) */
 		SkinningMatrices[BoneIndex] = InvBindMatrices[BoneIndex] * EditableSpaceBases[BoneIndex].ToMatrixWithScale();
-		InvTransSkinningMatrices[BoneIndex] = SkinningMatrices[BoneIndex].Inverse().Transpose();
 	}
 
 	InbPoseDirty = false;
@@ -287,7 +323,31 @@ void USkeletalMeshComponent::TickPose(float DeltaTime)
 {
 	Super::TickPose(DeltaTime);
 
-	// @todo TickAnimation
+	if (!bPlayingAnimation || !AnimSequence)
+	{
+		return;
+	}
+
+	AnimationPosition += DeltaTime * PlayRate;
+
+	const float PlayLength = AnimSequence->GetPlayLength();
+	if (!bLoopingAnimation && (AnimationPosition >= PlayLength || AnimationPosition <= 0.0f))
+	{
+		AnimationPosition = std::clamp(AnimationPosition, 0.0f, PlayLength);
+		bPlayingAnimation = false;
+	}
+	else if (bLoopingAnimation && PlayLength > 0.0f)
+	{
+		// 오래 재생해도 float 정밀도가 떨어지지 않도록 감싼다
+		AnimationPosition = std::fmod(AnimationPosition, PlayLength);
+		if (AnimationPosition < 0.0f)
+		{
+			AnimationPosition += PlayLength;
+		}
+	}
+
+	AnimSequence->SamplePose(AnimationPosition, bLoopingAnimation, BoneSpaceTransforms);
+	bPoseDirty = true;
 }
 
 USkeletalMesh* USkeletalMeshComponent::GetSkeletalMeshAsset() const
@@ -306,6 +366,11 @@ void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* NewMesh)
 	SafeRelease(VertexBuffer);
 	SafeRelease(IndexBuffer);
 
+	// 애니메이션은 스켈레톤에 종속되므로 메시가 바뀌면 재생을 해제한다
+	AnimSequence = nullptr;
+	AnimationPosition = 0.0f;
+	bPlayingAnimation = false;
+
 	// 부모 클래스의 멤버(SkinnedAsset)에 에셋을 설정
 	SetSkinnedAsset(NewMesh);
 	SkeletalMeshAsset = NewMesh;
@@ -321,7 +386,6 @@ void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* NewMesh)
 		BoneSpaceTransforms = RefSkeleton.GetRawRefBonePose();
 		SkinnedVertices.SetNum(NewNumVertices);
 		SkinningMatrices.SetNum(NewNumBones);
-		InvTransSkinningMatrices.SetNum(NewNumVertices);
 		GetEditableComponentSpaceTransform().SetNum(NewNumBones);
 		GetEditableBoneVisibilityStates().SetNum(NewNumBones);
 
@@ -414,55 +478,26 @@ void USkeletalMeshComponent::UpdateSkinnedVertices()
 
 	FSkeletalMeshRenderData* RenderData = SkeletalMeshAsset->GetSkeletalMeshRenderData();
 	const TArray<FNormalVertex>& Vertices = GetSkeletalMeshAsset()->GetStaticMesh()->GetVertices();
-	const TArray<FRawSkinWeight>& SkinWeights = RenderData->SkinWeightVertices;
 
-	for (int32 VertexIndex = 0; VertexIndex < Vertices.Num(); ++VertexIndex)
+	if (!RenderData->SkinWeightStream.IsEmpty() && SkinningMethod == ESkinningMethod::DualQuaternion)
 	{
-		const FNormalVertex& Vertex = Vertices[VertexIndex];
-		const FRawSkinWeight& SkinWeight = SkinWeights[VertexIndex];
-
-		FVector FinalPosition(0.0f, 0.0f, 0.0f);
-		FVector FinalNormal(0.0f, 0.0f, 0.0f);
-		FVector FinalTangent(0.0f, 0.0f, 0.0f);
-
-		uint32 TotalWeight = 0;
-		for (int32 InfluenceIndex = 0; InfluenceIndex < FRawSkinWeight::MAX_TOTAL_INFLUENCES; ++InfluenceIndex)
+		FCpuSkinning::BuildDualQuatPalette(SkinningMatrices, DualQuatPalette);
+		FCpuSkinning::SkinVerticesDualQuat(RenderData->SkinWeightStream, DualQuatPalette, Vertices, SkinnedVertices, true);
+	}
+	else if (!RenderData->SkinWeightStream.IsEmpty())
+	{
+		FCpuSkinning::BuildMatrixPalette(SkinningMatrices, SkinningPalette);
+		FCpuSkinning::SkinVertices(RenderData->SkinWeightStream, SkinningPalette, Vertices, SkinnedVertices, true);
+	}
+	else
+	{
+		// 역전치 행렬은 스칼라 경로만 읽으므로 이 경로로 올 때만 계산한다
+		InvTransSkinningMatrices.SetNum(SkinningMatrices.Num());
+		for (int32 BoneIndex = 0; BoneIndex < SkinningMatrices.Num(); ++BoneIndex)
 		{
-			const FBoneIndexType BoneIndex = SkinWeight.InfluenceBones[InfluenceIndex];
-			if (BoneIndex == static_cast<FBoneIndexType>(-1))
-			{
-				continue;
-			}
-			const uint16 Weight = SkinWeight.InfluenceWeights[InfluenceIndex];
-			TotalWeight += Weight;
-
-			if (Weight == 0)
-			{
-				continue;
-			}
-
-			const FMatrix& FinalMatrix = SkinningMatrices[BoneIndex];
-			const FMatrix& FinalInvTransMatrix = InvTransSkinningMatrices[BoneIndex];
-
-			FinalPosition += FinalMatrix.TransformPosition(Vertex.Position) * Weight;
-			FinalNormal += FinalInvTransMatrix.TransformVector(Vertex.Normal) * Weight;
-			FinalTangent += FinalMatrix.TransformVector(FVector(Vertex.Tangent)) * Weight;
+			InvTransSkinningMatrices[BoneIndex] = SkinningMatrices[BoneIndex].Inverse().Transpose();
 		}
-		FinalPosition = FinalPosition / TotalWeight;
-
-		FinalNormal = FinalNormal / TotalWeight;
-		FinalNormal.Normalize();
-
-		FinalTangent = FinalTangent / TotalWeight;
-		FinalTangent = FinalTangent - (FinalNormal.Dot(FinalTangent)) * FinalNormal;
-		FinalTangent.Normalize();
-
-		FNormalVertex& ResultVertex = SkinnedVertices[VertexIndex];
-		ResultVertex.Position = FinalPosition;
-		ResultVertex.Normal = FinalNormal;
-		ResultVertex.Tangent = FVector4(FinalTangent, Vertex.Tangent.W);
-		ResultVertex.Color = Vertex.Color;
-		ResultVertex.TexCoord = Vertex.TexCoord;
+		FCpuSkinning::SkinVerticesReference(RenderData->SkinWeightVertices, SkinningMatrices, InvTransSkinningMatrices, Vertices, SkinnedVertices);
 	}
 
 	FRenderResourceFactory::UpdateVertexBufferData(VertexBuffer, SkinnedVertices);
@@ -484,3 +519,44 @@ bool USkeletalMeshComponent::IsNormalMapEnabled() const
 {
 	return bNormalMapEnabled;
 }
+
+void USkeletalMeshComponent::SetSkinningMethod(ESkinningMethod InSkinningMethod)
+{
+	if (SkinningMethod != InSkinningMethod)
+	{
+		SkinningMethod = InSkinningMethod;
+		bSkinningDirty = true;
+	}
+}
+
+void USkeletalMeshComponent::PlayAnimation(UAnimSequence* InAnimSequence, bool bInLooping)
+{
+	// 다른 스켈레톤에서 임포트한 애니메이션은 본 인덱스가 맞지 않는다
+	if (InAnimSequence && InAnimSequence->GetNumBones() != GetNumBones())
+	{
+		UE_LOG_WARNING("USkeletalMeshComponent::PlayAnimation - 본 수가 다른 애니메이션입니다: %s", InAnimSequence->GetSequenceName().ToString().c_str());
+		return;
+	}
+
+	AnimSequence = InAnimSequence;
+	bLoopingAnimation = bInLooping;
+	AnimationPosition = 0.0f;
+	bPlayingAnimation = AnimSequence != nullptr;
+}
+
+void USkeletalMeshComponent::StopAnimation()
+{
+	bPlayingAnimation = false;
+}
+
+void USkeletalMeshComponent::SetAnimationPosition(float InPosition)
+{
+	if (!AnimSequence)
+	{
+		return;
+	}
+
+	AnimationPosition = std::clamp(InPosition, 0.0f, AnimSequence->GetPlayLength());
+	AnimSequence->SamplePose(AnimationPosition, false, BoneSpaceTransforms);
+	bPoseDirty = true;
+}
@@ -1,11 +1,15 @@
 #include "pch.h" // 프로젝트의 Precompiled Header
 #include "Source/Component/Mesh/Public/StaticMesh.h" // UStaticMesh 클래스 자신의 헤더
+#include "Manager/Asset/Public/VertexQuantizer.h"
 
 // FStaticMesh 구조체에 대한 정의가 UStaticMesh.h에 이미 포함되어 있다고 가정합니다.
 
 // 클래스 구현 매크로
 IMPLEMENT_CLASS(UStaticMesh, UObject)
 
+std::atomic<uint64> UStaticMesh::TotalVertexBytes = 0;
+std::atomic<uint64> UStaticMesh::TotalDiskVertexBytes = 0;
+
 UStaticMesh::UStaticMesh()
 	: StaticMeshAsset(nullptr) // 멤버 변수를 nullptr로 명시적 초기화
 {
@@ -14,7 +18,8 @@ UStaticMesh::UStaticMesh()
 UStaticMesh::~UStaticMesh()
 {
 	// 이 클래스는 FStaticMesh 데이터의 소유자가 아닙니다.
-	// 실제 데이터는 AssetManager가 관리하므로, 여기서는 아무것도 하지 않습니다.
+	// 실제 데이터는 AssetManager가 관리하므로, 정점 크기 합계에서만 빼 줍니다.
+	UpdateVertexByteTotals(-1);
 
 	// 임시로 할당된 Material 해제 -> 이후 GUObject에서 관리 예정
 	for (UMaterial* Material : Materials)
@@ -30,7 +35,27 @@ UStaticMesh::~UStaticMesh()
 
 void UStaticMesh::SetStaticMeshAsset(FStaticMesh* InStaticMeshAsset)
 {
+	UpdateVertexByteTotals(-1);
 	this->StaticMeshAsset = InStaticMeshAsset;
+	UpdateVertexByteTotals(1);
+}
+
+void UStaticMesh::UpdateVertexByteTotals(int64 InSign) const
+{
+	if (!StaticMeshAsset)
+	{
+		return;
+	}
+
+	const uint32 VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.Num());
+	const uint64 VertexBytes = static_cast<uint64>(VertexCount) * sizeof(FNormalVertex);
+	const uint64 DiskVertexBytes = StaticMeshAsset->bQuantizedVertices
+		? FVertexQuantizer::GetCompressedSize(VertexCount, StaticMeshAsset->VertexQuantization.bHasVertexColors)
+		: VertexBytes;
+
+	// 부호 없는 값끼리의 덧셈으로 빼기도 처리한다
+	TotalVertexBytes.fetch_add(static_cast<uint64>(InSign) * VertexBytes, std::memory_order_relaxed);
+	TotalDiskVertexBytes.fetch_add(static_cast<uint64>(InSign) * DiskVertexBytes, std::memory_order_relaxed);
 }
 
 const FName& UStaticMesh::GetAssetPathFileName() const
@@ -108,3 +133,53 @@ const TArray<FMeshSection>& UStaticMesh::GetSections() const
 	static const TArray<FMeshSection> EmptySections;
 	return EmptySections;
 }
+
+int32 UStaticMesh::GetNumLODs() const
+{
+	return StaticMeshAsset ? StaticMeshAsset->LODs.Num() + 1 : 1;
+}
+
+int32 UStaticMesh::GetLODForScreenSize(float InScreenSize) const
+{
+	if (!StaticMeshAsset)
+	{
+		return 0;
+	}
+
+	int32 LODIndex = 0;
+	for (int32 i = 0; i < StaticMeshAsset->LODs.Num() && InScreenSize <= StaticMeshAsset->LODs[i].ScreenSize; ++i)
+	{
+		LODIndex = i + 1;
+	}
+	return LODIndex;
+}
+
+const TArray<FMeshSection>& UStaticMesh::GetLODSections(int32 InLODIndex) const
+{
+	if (StaticMeshAsset && InLODIndex > 0 && InLODIndex <= StaticMeshAsset->LODs.Num())
+	{
+		return StaticMeshAsset->LODs[InLODIndex - 1].Sections;
+	}
+	return GetSections();
+}
+
+void UStaticMesh::GetLODIndexRange(int32 InLODIndex, uint32& OutStartIndex, uint32& OutIndexCount) const
+{
+	if (StaticMeshAsset && InLODIndex > 0 && InLODIndex <= StaticMeshAsset->LODs.Num())
+	{
+		OutStartIndex = StaticMeshAsset->LODs[InLODIndex - 1].StartIndex;
+		OutIndexCount = StaticMeshAsset->LODs[InLODIndex - 1].IndexCount;
+		return;
+	}
+	OutStartIndex = 0;
+	OutIndexCount = static_cast<uint32>(GetIndices().Num());
+}
+
+TArray<uint32> FStaticMesh::GetRenderIndices() const
+{
+	TArray<uint32> RenderIndices;
+	RenderIndices.Reserve(Indices.Num() + LODIndices.Num());
+	RenderIndices.Append(Indices);
+	RenderIndices.Append(LODIndices);
+	return RenderIndices;
+}
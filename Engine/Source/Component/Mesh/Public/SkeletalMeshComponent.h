@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Runtime/Engine/Public/SkeletalMesh.h"
+#include "Runtime/Engine/Public/CpuSkinning.h"
 #include "SkinnedMeshComponent.h"
 #include "Manager/Asset/Public/AssetManager.h"
 
 // class USkeletalMesh;
+class UAnimSequence;
 
 UCLASS()
 class USkeletalMeshComponent : public USkinnedMeshComponent
@@ -93,6 +95,62 @@ public:
 
 	bool IsNormalMapEnabled() const;
 
+	/** @brief 정점 스키닝 방식을 설정한다. 다음 UpdateSkinnedVertices()에서 다시 스키닝된다. */
+	void SetSkinningMethod(ESkinningMethod InSkinningMethod);
+
+	ESkinningMethod GetSkinningMethod() const
+	{
+		return SkinningMethod;
+	}
+
+	/*-----------------------------------------------------------------------------
+		애니메이션 재생
+	 -----------------------------------------------------------------------------*/
+public:
+	/** @brief 애니메이션을 처음부터 재생한다. TickPose에서 포즈를 샘플링해 BoneSpaceTransforms를 덮어쓴다. */
+	void PlayAnimation(UAnimSequence* InAnimSequence, bool bInLooping);
+
+	/** @brief 재생을 멈춘다. 현재 포즈는 유지된다. */
+	void StopAnimation();
+
+	bool IsPlayingAnimation() const
+	{
+		return bPlayingAnimation;
+	}
+
+	UAnimSequence* GetAnimSequence() const
+	{
+		return AnimSequence;
+	}
+
+	/** @brief 재생 위치(초)를 옮기고 즉시 그 포즈를 샘플링한다. */
+	void SetAnimationPosition(float InPosition);
+
+	float GetAnimationPosition() const
+	{
+		return AnimationPosition;
+	}
+
+	void SetPlayRate(float InPlayRate)
+	{
+		PlayRate = InPlayRate;
+	}
+
+	float GetPlayRate() const
+	{
+		return PlayRate;
+	}
+
+	void SetLoopingAnimation(bool bInLooping)
+	{
+		bLoopingAnimation = bInLooping;
+	}
+
+	bool IsLoopingAnimation() const
+	{
+		return bLoopingAnimation;
+	}
+
 	bool IsSkinningDirty() const
 	{
 		return bSkinningDirty;
@@ -105,9 +163,15 @@ private:
 	/** 스키닝용 행렬 (InvBindMatrix * ComponentSpaceTransform) */
 	TArray<FMatrix> SkinningMatrices;
 
-	/** 노말 스키닝용 행렬 (역전치 행렬) */
+	/** 노말 스키닝용 행렬 (역전치 행렬, SkinVerticesReference로 스키닝할 때만 채운다) */
 	TArray<FMatrix> InvTransSkinningMatrices;
 
+	/** SIMD 스키닝용 3x4 행렬 팔레트 (SkinningMatrices를 전치해서 보관) */
+	TArray<FSkinMatrix3x4> SkinningPalette;
+
+	/** 듀얼 쿼터니언 스키닝용 팔레트 */
+	TArray<FSkinDualQuat> DualQuatPalette;
+
 	/** CPU 스키닝을 적용한 이후의 정점 정보 */
 	TArray<FNormalVertex> SkinnedVertices;
 
@@ -122,4 +186,20 @@ private:
 
 	/** 노말맵 활성화 여부 */
 	bool bNormalMapEnabled;
+
+	/** 정점 스키닝 방식 */
+	ESkinningMethod SkinningMethod;
+
+	/** 재생 중인 애니메이션 (SkeletalMeshAsset이 소유) */
+	TObjectPtr<UAnimSequence> AnimSequence;
+
+	/** 애니메이션 재생 위치 (초) */
+	float AnimationPosition;
+
+	/** 재생 속도 배율 */
+	float PlayRate;
+
+	bool bPlayingAnimation;
+
+	bool bLoopingAnimation;
 };
@@ -12,6 +12,19 @@ struct FMeshSection
 	uint32 MaterialSlot;
 };
 
+/**
+ * @brief 단순화된 LOD (LOD1부터). 정점 버퍼는 LOD0과 공유하고 인덱스만 따로 가진다.
+ * @note StartIndex는 GPU 인덱스 버퍼 기준이다. GPU 인덱스 버퍼는 Indices(LOD0) 뒤에 LODIndices가 이어진 형태이다.
+ */
+struct FStaticMeshLOD
+{
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+	float ScreenSize = 0.0f;  // 화면 크기(투영된 반경 / 화면 높이의 절반)가 이 값 이하이면 사용
+	float Error = 0.0f;       // LOD0 대비 최대 오차 (메시 반경에 대한 비율)
+	TArray<FMeshSection> Sections;
+};
+
 /**
 * @brief 스태틱 메시 Cooked Data.
 * @note 엔진 내부 관점에서 Static Mesh Asset은 이 구조체를 의미합니다.
@@ -33,6 +46,23 @@ struct FStaticMesh
 	// --- 3. 연결 정보 (Sections) ---
 	// 각 재질을 어떤 기하 구간에 칠할지에 대한 지시서
 	TArray<FMeshSection> Sections;
+
+	// --- 4. LOD (쿠킹 시 생성) ---
+	TArray<FStaticMeshLOD> LODs;  // LOD1부터, 거칠어지는 순서
+	TArray<uint32> LODIndices;    // 모든 LOD의 인덱스를 이어 붙인 배열
+
+	// --- 5. 정점 압축 (쿠킹 시 생성) ---
+	// bQuantizedVertices이면 Vertices는 FCompressedVertex로 압축했다 푼 값이고, 쿠킹 파일에는 압축된 형태로 저장된다
+	FVertexQuantization VertexQuantization;
+	bool bQuantizedVertices = false;
+
+	// --- 6. 오클루더 (쿠킹 시 생성) ---
+	// 소프트웨어 오클루전 컬링에 쓰는 위치 전용 단순화 메시. 비어 있으면 오클루더로 쓰지 않는다
+	TArray<FVector> OccluderVertices;
+	TArray<uint32> OccluderIndices;
+
+	//@brief GPU 인덱스 버퍼에 올릴 인덱스 (Indices 뒤에 LODIndices)
+	TArray<uint32> GetRenderIndices() const;
 };
 
 
@@ -77,10 +107,29 @@ public:
 	int32 GetNumMaterials() const;
 	const TArray<FMeshSection>& GetSections() const;
 
+	// LOD Data (0은 원본)
+	int32 GetNumLODs() const;
+	//@brief 화면 크기(투영된 반경 / 화면 높이의 절반)에 맞는 가장 거친 LOD
+	int32 GetLODForScreenSize(float InScreenSize) const;
+	const TArray<FMeshSection>& GetLODSections(int32 InLODIndex) const;
+	//@brief GPU 인덱스 버퍼에서 해당 LOD 전체가 차지하는 범위
+	void GetLODIndexRange(int32 InLODIndex, uint32& OutStartIndex, uint32& OutIndexCount) const;
+
 	// 유효성 검사
 	bool IsValid() const { return StaticMeshAsset != nullptr; }
 
+	// 로드된 모든 스태틱 메시의 정점 크기 합계 (SetStaticMeshAsset/소멸 시 갱신되므로 매 프레임 순회할 필요가 없다)
+	//@brief 메모리에 풀린 FNormalVertex 크기
+	static uint64 GetTotalVertexBytes() { return TotalVertexBytes.load(std::memory_order_relaxed); }
+	//@brief 쿠킹 파일에 저장되는 정점 스트림 크기 (압축했으면 FCompressedVertex, 아니면 FNormalVertex)
+	static uint64 GetTotalDiskVertexBytes() { return TotalDiskVertexBytes.load(std::memory_order_relaxed); }
+
 private:
+	void UpdateVertexByteTotals(int64 InSign) const;
+
+	static std::atomic<uint64> TotalVertexBytes;
+	static std::atomic<uint64> TotalDiskVertexBytes;
+
 	// 실제 데이터 본체(FStaticMesh)에 대한 비소유(non-owning) 포인터.
 	// 이 데이터의 실제 소유권 및 생명주기는 AssetManager가 책임집니다.
 	FStaticMesh* StaticMeshAsset;
@@ -199,6 +199,7 @@ void UPrimitiveComponent::MarkAsDirty()
 		if (Level)
 		{
 			Level->UpdatePrimitiveInOctree(this);
+			Level->MarkPrimitiveOverlapMoved(this);
 		}
 	}
 
@@ -206,6 +207,27 @@ void UPrimitiveComponent::MarkAsDirty()
 	// called once per frame in World::Tick()
 }
 
+void UPrimitiveComponent::SetGenerateOverlapEvents(bool bGenerate)
+{
+	if (bGenerateOverlapEvents == bGenerate)
+	{
+		return;
+	}
+	bGenerateOverlapEvents = bGenerate;
+	bNeedsOverlapUpdate = true;
+
+	// 등록된 컴포넌트라면 Level의 overlap broadphase에 추가/제거
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->GetOuter())
+	{
+		ULevel* Level = Cast<ULevel>(Owner->GetOuter());
+		if (Level)
+		{
+			Level->UpdatePrimitiveOverlapProxy(this);
+		}
+	}
+}
+
 
 UObject* UPrimitiveComponent::Duplicate()
 {
@@ -54,7 +54,7 @@ public:
 
 	// === Overlap Events Control ===
 	bool GetGenerateOverlapEvents() const { return bGenerateOverlapEvents; }
-	void SetGenerateOverlapEvents(bool bGenerate) { bGenerateOverlapEvents = bGenerate; }
+	void SetGenerateOverlapEvents(bool bGenerate);
 
 	// === Mobility Control ===
 	EComponentMobility GetMobility() const { return Mobility; }
@@ -104,9 +104,8 @@ public:
 	// 데칼에 덮일 수 있는가
 	bool bReceivesDecals = true;
 
-	// 다른 곳에서 사용할 인덱스
-	mutable int32 CachedAABBIndex = -1;
-	mutable uint32 CachedFrame = 0;
+	// Level overlap broadphase의 proxy 인덱스 (-1이면 등록되지 않음)
+	int32 OverlapProxyIndex = -1;
 
 protected:
 	const TArray<FNormalVertex>* Vertices = nullptr;
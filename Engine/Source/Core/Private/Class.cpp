@@ -1,9 +1,15 @@
 #include "pch.h"
 #include "Core/Public/Class.h"
 #include "Core/Public/Object.h"
+#include "Core/Public/ObjectPool.h"
 
 using std::stringstream;
 
+/**
+ * @brief 클래스를 등록하고 클래스 트리 번호를 다시 매긴다
+ * UClass 생성자에서 한 번 호출된다. 부모의 StaticClass()가 생성자 인자에서 먼저 평가되므로 부모가 항상 먼저 등록된다.
+ * 대부분 정적 초기화 중에 끝나지만, 늦게 등록되는 클래스도 트리 전체를 다시 매기므로 IsChildOf 결과가 항상 맞다.
+ */
 void UClass::SignUpClass(UClass* InClass)
 {
 	if (InClass)
@@ -13,10 +19,57 @@ void UClass::SignUpClass(UClass* InClass)
 			if (Class == InClass) return;
 		}
 		GetAllClasses().Emplace(InClass);
+		RebuildClassTree();
 		UE_LOG("UClass: Class registered: %s (Total: %d)", InClass->GetName().ToString().data(), GetAllClasses().Num());
 	}
 }
 
+/**
+ * @brief 등록된 클래스 트리를 전위 순회하며 ClassTreeIndex / ClassTreeLastIndex를 매긴다
+ * 한 클래스의 하위 클래스들은 전위 순회에서 연속된 번호를 받으므로 IsChildOf가 구간 비교 두 번으로 끝난다.
+ * 부모가 등록되지 않은 클래스는 별도의 루트로 취급한다.
+ */
+void UClass::RebuildClassTree()
+{
+	const TArray<UClass*>& AllClasses = GetAllClasses();
+
+	TFlatMap<const UClass*, TArray<UClass*>> Children(AllClasses.Num());
+	TArray<UClass*> Roots;
+	for (UClass* Class : AllClasses)
+	{
+		Children.FindOrAdd(Class);
+	}
+
+	for (UClass* Class : AllClasses)
+	{
+		TArray<UClass*>* Siblings = (Class->SuperClass && Class->SuperClass != Class) ? Children.Find(Class->SuperClass) : nullptr;
+		if (Siblings)
+		{
+			Siblings->Add(Class);
+		}
+		else
+		{
+			Roots.Add(Class);
+		}
+	}
+
+	int32 NextIndex = 0;
+	auto AssignIndex = [&Children, &NextIndex](auto& Self, UClass* InClass) -> void
+	{
+		InClass->ClassTreeIndex = NextIndex++;
+		for (UClass* Child : *Children.Find(InClass))
+		{
+			Self(Self, Child);
+		}
+		InClass->ClassTreeLastIndex = NextIndex - 1;
+	};
+
+	for (UClass* Root : Roots)
+	{
+		AssignIndex(AssignIndex, Root);
+	}
+}
+
 UClass* UClass::FindClass(const FName& InClassName)
 {
 	for (UClass* Class : GetAllClasses())
@@ -57,44 +110,14 @@ TArray<UClass*>& UClass::GetAllClasses()
  * @param InSuperClass Parent Class
  * @param InClassSize Class Size
  * @param InConstructor 생성자 함수 포인터
+ * @note 생성할 수 있는 클래스만 ClassSize 크기의 객체 풀을 가진다. 풀은 의도적으로 해제하지 않는다 (FObjectPool 참고)
  */
 UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
 	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
+	, ObjectPool((InConstructor && !InIsAbstract) ? new FObjectPool(InClassSize) : nullptr)
 {
 	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
-}
-
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
-	{
-		return true;
-	}
-
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
-	{
-		if (CurrentClass->ClassName == InClass->ClassName)
-		{
-			return true;
-		}
-
-		CurrentClass = CurrentClass->SuperClass;
-	}
-
-	return false;
+	SignUpClass(this);
 }
 
 /**
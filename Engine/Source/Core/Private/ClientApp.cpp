@@ -11,6 +11,8 @@
 #include "Render/Renderer/Public/SceneView.h"
 #include "Render/UI/Viewport/Public/GameViewportClient.h"
 #include "Render/UI/Viewport/Public/Viewport.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+#include "Runtime/Core/Public/Memory/FrameMemory.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 
 #if WITH_EDITOR
@@ -103,6 +105,9 @@ int FClientApp::InitializeSystem() const
 	// 현재 시간을 랜덤 시드로 설정
 	srand(static_cast<unsigned int>(time(NULL)));
 
+	// 다른 시스템이 초기화 중에 태스크를 사용할 수 있도록 가장 먼저 시작
+	FTaskScheduler::GetInstance().Startup();
+
 	// Initialize By Get Instance
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance();
@@ -165,6 +170,10 @@ void FClientApp::UpdateSystem() const
 		TIME_PROFILE(InputManager)
 		InputManager.Update(Window);
 	}
+	{
+		TIME_PROFILE(MainThreadTasks)
+		FTaskScheduler::GetInstance().ProcessMainThreadTasks();
+	}
 
 #if WITH_EDITOR
 	{
@@ -258,6 +267,9 @@ void FClientApp::MainLoop()
 		// Game System Update
 		UpdateSystem();
 
+		// 이번 프레임의 TFrameArray 메모리를 한꺼번에 회수
+		FFrameMemory::GetInstance().EndFrame();
+
 		UTimeManager::GetInstance().SetDeltaTime(static_cast<float>(CycleCounter.Finish()) / 1000.0f);
 	}
 }
@@ -268,6 +280,9 @@ void FClientApp::MainLoop()
  */
 void FClientApp::ShutdownSystem() const
 {
+	// 실행 중인 태스크가 해제될 시스템에 접근하지 않도록 가장 먼저 종료
+	FTaskScheduler::GetInstance().Shutdown();
+
 #if WITH_EDITOR
 	UStatOverlay::GetInstance().Release();
 	UUIManager::GetInstance().Shutdown();
@@ -1,7 +1,7 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+#include <charconv> // for std::to_chars
+#include <new>      // for placement new
 
 FName::FName()
     : ComparisonIndex(0),
@@ -18,8 +18,13 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str))
+FName::FName(const char* Str)
 {
+    // 이미 등록된 이름이면 임시 FString 없이 찾는다
+    TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(std::string_view(Str));
+    ComparisonIndex = Indices.first;
+    DisplayIndex = Indices.second;
+    Number = -1;
 }
 
 /**
@@ -60,12 +65,23 @@ int32 FName::Compare(const FName& Other) const
 
 FString FName::ToString() const
 {
-    FString BaseName = FNameTable::GetInstance().GetDisplayString(DisplayIndex);
-    if (Number >= 0)
+    const std::string_view BaseName = FNameTable::GetInstance().GetDisplayView(DisplayIndex);
+
+    FString Result;
+    if (Number < 0)
     {
-        return BaseName + "_" + to_string(Number);
+        Result.assign(BaseName);
+        return Result;
     }
-    return BaseName;
+
+    // 중간 문자열 없이 한 번만 할당한다
+    char NumberBuffer[16];
+    const char* NumberEnd = std::to_chars(NumberBuffer, NumberBuffer + sizeof(NumberBuffer), Number).ptr;
+    Result.reserve(BaseName.size() + 1 + (NumberEnd - NumberBuffer));
+    Result.append(BaseName);
+    Result.push_back('_');
+    Result.append(NumberBuffer, static_cast<size_t>(NumberEnd - NumberBuffer));
+    return Result;
 }
 
 FString FName::ToBaseNameString() const
@@ -80,86 +96,334 @@ FName FName::GetNone()
 
 const FName FName::None(0, 0, -1);
 
-// FNameTable
-/**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
-*/
-FNameTable::FNameTable()
+// FNamePool
+namespace
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    constexpr uint32 NAME_SLOT_INITIAL_CAPACITY = 1024;
+
+    uint8 ToLowerAscii(uint8 C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<uint8>(C + ('a' - 'A')) : C;
+    }
 }
 
-FNameTable::~FNameTable() = default;
+FNamePool::FNamePool(bool bInCaseSensitive)
+    : bCaseSensitive(bInCaseSensitive),
+      EntryCount(0)
+{
+    FSlotArray* InitialSlots = CreateSlotArray(NAME_SLOT_INITIAL_CAPACITY);
+    CurrentSlots.store(InitialSlots, std::memory_order_release);
+}
 
-FNameTable& FNameTable::GetInstance()
+FNamePool::~FNamePool()
 {
-    static FNameTable Instance;
-    return Instance;
+    for (FSlotArray* SlotArray : AllSlotArrays)
+    {
+        delete[] SlotArray->Slots;
+        delete SlotArray;
+    }
+
+    for (FNameEntry** Chunk : EntryChunks)
+    {
+        delete[] Chunk;
+    }
+
+    // FNameEntry는 자명하게 소멸 가능하므로 블록만 돌려준다
+    for (uint8* Block : Blocks)
+    {
+        ::operator delete(Block);
+    }
+}
+
+uint32 FNamePool::Hash(std::string_view InString) const
+{
+    uint32 HashValue = 2166136261u;
+    for (const char C : InString)
+    {
+        const uint8 Byte = bCaseSensitive ? static_cast<uint8>(C) : ToLowerAscii(static_cast<uint8>(C));
+        HashValue ^= Byte;
+        HashValue *= 16777619u;
+    }
+    return HashValue;
 }
 
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+int32 FNamePool::Find(std::string_view InString, uint32 InHash) const
 {
-    FString LowerStr = ToLower(Str);
+    const FSlotArray* SlotArray = CurrentSlots.load(std::memory_order_acquire);
+    return FindInSlots(*SlotArray, InString, InHash);
+}
+
+/**
+ * @brief 없으면 InsertMutex 안에서 다시 확인한 뒤 추가한다
+ * @note 항목 포인터와 EntryCount를 먼저 기록하고 슬롯을 release로 게시하므로,
+ * 슬롯에서 인덱스를 읽은 스레드는 항상 완성된 항목을 본다
+ */
+int32 FNamePool::FindOrAdd(std::string_view InString, uint32 InHash, int32 InComparisonIndex)
+{
+    const int32 FoundIndex = Find(InString, InHash);
+    if (FoundIndex >= 0)
+    {
+        return FoundIndex;
+    }
 
-    int32 ComparisonIndex;
-    int32* FoundCompIndexPtr = ComparisonMap.Find(LowerStr);
+    std::lock_guard<std::mutex> Lock(InsertMutex);
+
+    FSlotArray* SlotArray = CurrentSlots.load(std::memory_order_relaxed);
+    const int32 RecheckedIndex = FindInSlots(*SlotArray, InString, InHash);
+    if (RecheckedIndex >= 0)
+    {
+        return RecheckedIndex;
+    }
 
-    if (FoundCompIndexPtr)
+    const int32 NewIndex = EntryCount.load(std::memory_order_relaxed);
+    if (NewIndex >= ENTRIES_PER_CHUNK * MAX_ENTRY_CHUNKS)
     {
-        ComparisonIndex = *FoundCompIndexPtr;
+        // 더 이상 추가할 수 없으면 None으로 대체
+        return 0;
     }
-    else
+
+    FNameEntry* Entry = AllocateEntry(InString, InHash);
+    Entry->ComparisonIndex = InComparisonIndex >= 0 ? InComparisonIndex : NewIndex;
+
+    FNameEntry**& Chunk = EntryChunks[NewIndex / ENTRIES_PER_CHUNK];
+    if (!Chunk)
     {
-        ComparisonIndex = ComparisonStringPool.Num();
-        ComparisonStringPool.Add(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        Chunk = new FNameEntry*[ENTRIES_PER_CHUNK];
     }
+    Chunk[NewIndex % ENTRIES_PER_CHUNK] = Entry;
+    EntryCount.store(NewIndex + 1, std::memory_order_release);
 
-    int32 DisplayIndex;
-    int32* FoundDisplayIndexPtr = DisplayMap.Find(Str);
-    if (FoundDisplayIndexPtr)
+    // 부하율 0.5를 넘으면 두 배로 키운다. 새 배열을 다 채운 뒤에 교체한다
+    const bool bGrow = static_cast<uint32>(NewIndex + 1) * 2 > SlotArray->Mask + 1;
+    if (bGrow)
     {
-        DisplayIndex = *FoundDisplayIndexPtr;
+        FSlotArray* GrownArray = CreateSlotArray((SlotArray->Mask + 1) * 2);
+        for (uint32 i = 0; i <= SlotArray->Mask; ++i)
+        {
+            const uint64 SlotValue = SlotArray->Slots[i].load(std::memory_order_relaxed);
+            if (SlotValue != 0)
+            {
+                InsertSlot(*GrownArray, static_cast<uint32>(SlotValue >> 32), static_cast<int32>(SlotValue & 0xFFFFFFFFu) - 1);
+            }
+        }
+        SlotArray = GrownArray;
     }
-    else
+
+    InsertSlot(*SlotArray, InHash, NewIndex);
+
+    if (bGrow)
     {
-        DisplayIndex = DisplayStringPool.Num();
-        DisplayStringPool.Add(Str);
-        DisplayMap[Str] = DisplayIndex;
+        CurrentSlots.store(SlotArray, std::memory_order_release);
     }
 
+    return NewIndex;
+}
+
+const FNameEntry* FNamePool::GetEntry(int32 InIndex) const
+{
+    if (InIndex < 0 || InIndex >= EntryCount.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    return EntryChunks[InIndex / ENTRIES_PER_CHUNK][InIndex % ENTRIES_PER_CHUNK];
+}
+
+bool FNamePool::IsEqual(const FNameEntry& InEntry, std::string_view InString) const
+{
+    if (InEntry.Length != InString.size())
+    {
+        return false;
+    }
+
+    const char* EntryData = InEntry.GetData();
+    if (bCaseSensitive)
+    {
+        return memcmp(EntryData, InString.data(), InString.size()) == 0;
+    }
+
+    for (size_t i = 0; i < InString.size(); ++i)
+    {
+        if (ToLowerAscii(static_cast<uint8>(EntryData[i])) != ToLowerAscii(static_cast<uint8>(InString[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32 FNamePool::FindInSlots(const FSlotArray& InSlots, std::string_view InString, uint32 InHash) const
+{
+    uint32 SlotIndex = InHash & InSlots.Mask;
+    while (true)
+    {
+        const uint64 SlotValue = InSlots.Slots[SlotIndex].load(std::memory_order_acquire);
+        if (SlotValue == 0)
+        {
+            return -1;
+        }
+
+        if (static_cast<uint32>(SlotValue >> 32) == InHash)
+        {
+            const int32 EntryIndex = static_cast<int32>(SlotValue & 0xFFFFFFFFu) - 1;
+            const FNameEntry* Entry = GetEntry(EntryIndex);
+            if (Entry && IsEqual(*Entry, InString))
+            {
+                return EntryIndex;
+            }
+        }
+
+        SlotIndex = (SlotIndex + 1) & InSlots.Mask;
+    }
+}
+
+FNameEntry* FNamePool::AllocateEntry(std::string_view InString, uint32 InHash)
+{
+    constexpr size_t Alignment = alignof(FNameEntry);
+    const size_t EntrySize = (sizeof(FNameEntry) + InString.size() + 1 + Alignment - 1) & ~(Alignment - 1);
+
+    if (static_cast<size_t>(BlockEnd - BlockCursor) < EntrySize)
+    {
+        // 블록보다 긴 문자열은 전용 블록을 받는다
+        const size_t NewBlockSize = std::max(BLOCK_SIZE, EntrySize);
+        BlockCursor = static_cast<uint8*>(::operator new(NewBlockSize));
+        BlockEnd = BlockCursor + NewBlockSize;
+        Blocks.Add(BlockCursor);
+    }
+
+    FNameEntry* Entry = new (BlockCursor) FNameEntry();
+    Entry->Hash = InHash;
+    Entry->Length = static_cast<uint32>(InString.size());
+    Entry->ComparisonIndex = -1;
+    Entry->NextNumber.store(0, std::memory_order_relaxed);
+
+    char* EntryData = reinterpret_cast<char*>(Entry + 1);
+    memcpy(EntryData, InString.data(), InString.size());
+    EntryData[InString.size()] = '\0';
+
+    BlockCursor += EntrySize;
+    return Entry;
+}
+
+FNamePool::FSlotArray* FNamePool::CreateSlotArray(uint32 InCapacity)
+{
+    FSlotArray* SlotArray = new FSlotArray();
+    SlotArray->Mask = InCapacity - 1;
+    SlotArray->Slots = new std::atomic<uint64>[InCapacity]();
+    AllSlotArrays.Add(SlotArray);
+    return SlotArray;
+}
+
+void FNamePool::InsertSlot(FSlotArray& InSlots, uint32 InHash, int32 InIndex)
+{
+    const uint64 SlotValue = (static_cast<uint64>(InHash) << 32) | static_cast<uint32>(InIndex + 1);
+
+    uint32 SlotIndex = InHash & InSlots.Mask;
+    while (InSlots.Slots[SlotIndex].load(std::memory_order_relaxed) != 0)
+    {
+        SlotIndex = (SlotIndex + 1) & InSlots.Mask;
+    }
+    InSlots.Slots[SlotIndex].store(SlotValue, std::memory_order_release);
+}
+
+// FNameTable
+FNameTable::FNameTable()
+    : ComparisonPool(false),
+      DisplayPool(true)
+{
+    // 기본 생성된 FName과 FName::None이 인덱스 0을 쓰므로 두 풀 모두 "None"을 가장 먼저 등록한다
+    FindOrAddName("None");
+}
+
+FNameTable::~FNameTable() = default;
+
+FNameTable& FNameTable::GetInstance()
+{
+    static FNameTable Instance;
+    return Instance;
+}
+
+/**
+* @brief 문자열을 풀에서 찾고 없으면 등록
+* @param Str FName으로 등록되었는지 확인할 문자열
+* @return ComparisonIndex, DisplayIndex
+* @note 이미 등록된 표시용 문자열은 락과 할당 없이 찾는다
+*/
+TPair<int32, int32> FNameTable::FindOrAddName(std::string_view Str)
+{
+    const uint32 DisplayHash = DisplayPool.Hash(Str);
+    const int32 FoundDisplayIndex = DisplayPool.Find(Str, DisplayHash);
+    if (FoundDisplayIndex >= 0)
+    {
+        return { DisplayPool.GetEntry(FoundDisplayIndex)->ComparisonIndex, FoundDisplayIndex };
+    }
+
+    const int32 ComparisonIndex = ComparisonPool.FindOrAdd(Str, ComparisonPool.Hash(Str), -1);
+    const int32 DisplayIndex = DisplayPool.FindOrAdd(Str, DisplayHash, ComparisonIndex);
     return { ComparisonIndex, DisplayIndex };
 }
 
-FName FNameTable::GetUniqueName(const FString& BaseStr)
+bool FNameTable::FindName(std::string_view Str, TPair<int32, int32>& OutIndices) const
 {
-    TPair<int32, int32> Indices = FindOrAddName(BaseStr);
-    int32 DisplayIndex = Indices.second;
-    int32 ComparisonIndex = Indices.first;
+    const int32 DisplayIndex = DisplayPool.Find(Str, DisplayPool.Hash(Str));
+    if (DisplayIndex >= 0)
+    {
+        OutIndices = { DisplayPool.GetEntry(DisplayIndex)->ComparisonIndex, DisplayIndex };
+        return true;
+    }
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+    // 표기만 다른 이름은 비교용 풀에 있어도 표시용 항목이 없으므로 대표 표기로 돌려준다
+    const int32 ComparisonIndex = ComparisonPool.Find(Str, ComparisonPool.Hash(Str));
+    if (ComparisonIndex >= 0)
+    {
+        const FNameEntry* ComparisonEntry = ComparisonPool.GetEntry(ComparisonIndex);
+        const int32 RepresentativeIndex = DisplayPool.Find(ComparisonEntry->GetView(), DisplayPool.Hash(ComparisonEntry->GetView()));
+        if (RepresentativeIndex >= 0)
+        {
+            OutIndices = { ComparisonIndex, RepresentativeIndex };
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* @brief 비교용 항목마다 가진 원자적 카운터로 번호를 매기므로 여러 스레드에서 동시에 불러도 이름이 겹치지 않는다
+* @note 번호는 대소문자를 무시한 이름 단위로 매겨서, 표기만 다른 두 이름이 같은 FName이 되지 않는다
+*/
+FName FNameTable::GetUniqueName(std::string_view BaseStr)
+{
+    const TPair<int32, int32> Indices = FindOrAddName(BaseStr);
+    const int32 ComparisonIndex = Indices.first;
+    const int32 DisplayIndex = Indices.second;
 
+    const int32 Number = ComparisonPool.GetEntry(ComparisonIndex)->NextNumber.fetch_add(1, std::memory_order_relaxed);
     return FName(DisplayIndex, ComparisonIndex, Number);
 }
 
-FString FNameTable::GetDisplayString(int32 Idx) const
+FName FNameTable::GetUniqueNameFromBase(const FName& BaseName)
 {
-    if (Idx >= 0 && Idx < DisplayStringPool.Num())
+    if (BaseName.GetUniqueNumber() >= 0 || !ComparisonPool.GetEntry(BaseName.GetComparisonIndex()))
     {
-        return DisplayStringPool[Idx];
+        return GetUniqueName(std::string_view(BaseName.ToString()));
     }
-    static const FString EmptyString = "None";
-    return EmptyString;
+
+    const int32 Number = ComparisonPool.GetEntry(BaseName.GetComparisonIndex())->NextNumber.fetch_add(1, std::memory_order_relaxed);
+    return FName(BaseName.GetDisplayIndex(), BaseName.GetComparisonIndex(), Number);
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+FString FNameTable::GetDisplayString(int32 Idx) const
 {
-    FString LowerStr = Str;
-    std::ranges::transform(LowerStr, LowerStr.begin(),
-                           [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
+    FString Result;
+    Result.assign(GetDisplayView(Idx));
+    return Result;
+}
+
+std::string_view FNameTable::GetDisplayView(int32 Idx) const
+{
+    const FNameEntry* Entry = DisplayPool.GetEntry(Idx);
+    if (Entry)
+    {
+        return Entry->GetView();
+    }
+    return "None";
 }
@@ -4,6 +4,7 @@
 #include "Core/Public/EngineStatics.h"
 #include "Core/Public/Name.h"
 #include "Core/Public/NewObject.h"
+#include "Core/Public/ObjectPool.h"
 
 uint32 UEngineStatics::NextUUID = 0;
 
@@ -60,6 +61,27 @@ UObject::~UObject()
 	}
 }
 
+void* UObject::operator new(size_t InSize)
+{
+	return FObjectPool::AllocateObject(InSize, nullptr);
+}
+
+void* UObject::operator new(size_t InSize, UClass* InClass)
+{
+	return FObjectPool::AllocateObject(InSize, InClass ? InClass->GetObjectPool() : nullptr);
+}
+
+void UObject::operator delete(void* InMemory)
+{
+	FObjectPool::FreeObject(InMemory);
+}
+
+// 생성자가 예외를 던졌을 때 new (Class)와 짝을 이루는 해제 함수
+void UObject::operator delete(void* InMemory, UClass* InClass)
+{
+	FObjectPool::FreeObject(InMemory);
+}
+
 uint32 UObject::GetSerialNumber() const
 {
 	if (static_cast<int32>(InternalIndex) < GetUObjectArray().Num())
@@ -157,22 +179,6 @@ void UObject::PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta)
 	}
 }
 
-/**
- * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
- * 내부적으로 재귀를 활용해서 부모를 계속 탐색한 뒤 결과를 반환한다
- * @param InClass 판정할 Class
- * @return 판정 결과
- */
-bool UObject::IsA(UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	return GetClass()->IsChildOf(InClass);
-}
-
 /**
  * @brief 해당 클래스가 현재 내 클래스와 동일한지 판단하는 함수
  * @return 판정 결과
@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "Core/Public/ObjectPool.h"
+
+FObjectPool::FObjectPool(size_t InObjectSize)
+	: ObjectSize(InObjectSize)
+{
+	SlotSize = (sizeof(FObjectMemoryHeader) + InObjectSize + SLOT_ALIGNMENT - 1) & ~(SLOT_ALIGNMENT - 1);
+	SlotsPerSlab = std::max(MIN_SLOTS_PER_SLAB, static_cast<uint32>(SLAB_SIZE / SlotSize));
+}
+
+FObjectMemoryHeader* FObjectPool::AllocateSlot()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	if (!FreeList)
+	{
+		AddSlab();
+	}
+
+	FFreeSlot* Slot = FreeList;
+	FreeList = Slot->Next;
+
+	const uint32 NewLiveCount = LiveCount.load(std::memory_order_relaxed) + 1;
+	LiveCount.store(NewLiveCount, std::memory_order_relaxed);
+	if (NewLiveCount > PeakCount.load(std::memory_order_relaxed))
+	{
+		PeakCount.store(NewLiveCount, std::memory_order_relaxed);
+	}
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	return reinterpret_cast<FObjectMemoryHeader*>(Slot);
+}
+
+void FObjectPool::FreeSlot(FObjectMemoryHeader* InHeader)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	// 방금 해제한 슬롯을 먼저 내주므로 스폰/파괴 반복은 캐시에 남아 있는 슬롯을 다시 쓴다
+	FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(InHeader);
+	Slot->Next = FreeList;
+	FreeList = Slot;
+
+	LiveCount.store(LiveCount.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+}
+
+FObjectPoolStats FObjectPool::GetStats() const
+{
+	FObjectPoolStats Stats;
+	Stats.LiveCount = LiveCount.load(std::memory_order_relaxed);
+	Stats.PeakCount = PeakCount.load(std::memory_order_relaxed);
+	Stats.TotalAllocationCount = TotalAllocationCount.load(std::memory_order_relaxed);
+	Stats.SlabCount = SlabCount.load(std::memory_order_relaxed);
+	Stats.SlotSize = static_cast<uint32>(SlotSize);
+	Stats.SlotsPerSlab = SlotsPerSlab;
+	return Stats;
+}
+
+/**
+ * @brief 슬랩을 하나 확보해 모든 슬롯을 free list에 넣는다 (주소 순서대로 나가도록 뒤에서부터 넣음)
+ * @note Mutex를 잡은 상태에서 호출
+ */
+void FObjectPool::AddSlab()
+{
+	uint8* Slab = static_cast<uint8*>(::operator new(SlotSize * SlotsPerSlab, std::align_val_t(SLOT_ALIGNMENT)));
+	SlabCount.fetch_add(1, std::memory_order_relaxed);
+
+	for (uint32 SlotIndex = SlotsPerSlab; SlotIndex > 0; --SlotIndex)
+	{
+		FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(Slab + static_cast<size_t>(SlotIndex - 1) * SlotSize);
+		Slot->Next = FreeList;
+		FreeList = Slot;
+	}
+}
+
+void* FObjectPool::AllocateObject(size_t InSize, FObjectPool* InPool)
+{
+	FObjectMemoryHeader* Header;
+	if (InPool && InSize <= InPool->GetObjectSize())
+	{
+		Header = InPool->AllocateSlot();
+		Header->Pool = InPool;
+	}
+	else
+	{
+		// 풀이 없거나, 파생 클래스가 DECLARE_CLASS 없이 부모의 UClass를 쓰는 경우 등
+		Header = static_cast<FObjectMemoryHeader*>(::operator new(sizeof(FObjectMemoryHeader) + InSize, std::align_val_t(SLOT_ALIGNMENT)));
+		Header->Pool = nullptr;
+	}
+	return Header + 1;
+}
+
+void FObjectPool::FreeObject(void* InMemory)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	FObjectMemoryHeader* Header = static_cast<FObjectMemoryHeader*>(InMemory) - 1;
+	if (Header->Pool)
+	{
+		Header->Pool->FreeSlot(Header);
+	}
+	else
+	{
+		::operator delete(Header, std::align_val_t(SLOT_ALIGNMENT));
+	}
+}
@@ -2,6 +2,7 @@
 #include "Name.h"
 
 class UObject;
+class FObjectPool;
 /**
  * @brief UClass Metadata System
  * Runtime에 컴파일 시에 다양한 클래스 정보를 제공하기 위해 만들어진 클래스
@@ -21,6 +22,7 @@ public:
     static TArray<UClass*> FindClasses(UClass* SuperClass);
 private:
     static TArray<UClass*>& GetAllClasses();
+    static void RebuildClassTree();
     
 public:
     UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract = false);
@@ -30,17 +32,33 @@ public:
     UClass* GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
     
-    bool IsChildOf(UClass* InClass) const;
+    /**
+     * @brief 이 클래스가 지정된 클래스이거나 그 하위 클래스인지 확인
+     * 클래스 트리의 전위 순회 번호로 판정한다. InClass의 서브트리는 [InClass 번호, 서브트리 마지막 번호] 구간을 차지한다.
+     */
+    bool IsChildOf(const UClass* InClass) const
+    {
+        return InClass && ClassTreeIndex >= InClass->ClassTreeIndex && ClassTreeIndex <= InClass->ClassTreeLastIndex;
+    }
+
     UObject* CreateDefaultObject() const;
 
     bool IsAbstract() const { return bIsAbstract; }
 
+    // 이 클래스 객체를 담는 슬랩 풀 (추상/싱글톤 클래스는 nullptr)
+    FObjectPool* GetObjectPool() const { return ObjectPool; }
+
 private:
     FName ClassName;
     UClass* SuperClass;
     size_t ClassSize;
     ClassConstructorType Constructor;
     bool bIsAbstract;
+    FObjectPool* ObjectPool;
+
+    // 클래스 트리 전위 순회 번호와 서브트리의 마지막 번호 (등록될 때마다 다시 매김)
+    int32 ClassTreeIndex = -1;
+    int32 ClassTreeLastIndex = -2;
 };
 
 /**
@@ -77,7 +95,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -86,7 +103,7 @@ UClass* ClassName::GetClass() const \
     } \
 UObject* ClassName::CreateDefaultObject##ClassName() \
     { \
-        return new ClassName(); \
+        return new (ClassName::StaticClass()) ClassName(); \
     } \
 static bool bIsRegistered_##ClassName = [](){ ClassName::StaticClass(); return true; }();
 
@@ -101,7 +118,6 @@ UClass* ClassName::StaticClass() \
         nullptr, \
         true \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -142,7 +158,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -172,7 +187,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -181,6 +195,6 @@ UClass* ClassName::GetClass() const \
 } \
 UObject* ClassName::CreateDefaultObject##ClassName() \
 { \
-    return new ClassName(); \
+    return new (ClassName::StaticClass()) ClassName(); \
 }\
 static bool bIsRegistered_##ClassName = [](){ ClassName::StaticClass(); return true; }();
\ No newline at end of file
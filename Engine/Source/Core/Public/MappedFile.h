@@ -0,0 +1,35 @@
+#pragma once
+
+#include <filesystem>
+
+/**
+ * @brief 읽기 전용 메모리 매핑 파일
+ * 파일 내용을 복사하지 않고 가상 메모리에 매핑하므로, 실제로 접근한 페이지만 디스크에서 읽힌다.
+ * @note 매핑된 메모리는 Close() 또는 소멸 시점까지 유효하다.
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	~FMappedFile();
+
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	/**
+	 * @brief 파일 전체를 읽기 전용으로 매핑
+	 * @return 파일이 없거나 비어 있으면 false
+	 */
+	bool Open(const std::filesystem::path& InFilePath);
+	void Close();
+
+	bool IsOpen() const { return Data != nullptr; }
+	const uint8* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+	const uint8* Data = nullptr;
+	size_t Size = 0;
+};
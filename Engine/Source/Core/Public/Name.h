@@ -56,6 +56,79 @@ namespace std {
 }
 
 
+/**
+ * @brief FNamePool에 저장되는 문자열 항목. 널 종료된 문자열이 헤더 바로 뒤에 이어진다
+ * @param ComparisonIndex 표시용 항목이 가리키는 비교용 항목의 인덱스
+ * @param NextNumber GetUniqueName이 다음에 붙일 번호 (비교용 항목만 사용)
+ */
+struct FNameEntry
+{
+	uint32 Hash;
+	uint32 Length;
+	int32 ComparisonIndex;
+	mutable std::atomic<int32> NextNumber;
+
+	const char* GetData() const { return reinterpret_cast<const char*>(this + 1); }
+	std::string_view GetView() const { return { GetData(), Length }; }
+};
+
+/**
+ * @brief 문자열을 영구 인덱스로 바꾸는 추가 전용 풀
+ * @note 항목은 고정 크기 블록에 이어 붙이고 옮기거나 지우지 않으므로 인덱스와 포인터가 항상 유효하다.
+ * 조회는 원자적 슬롯(해시 << 32 | 인덱스 + 1)을 선형 탐사하여 락 없이 끝나고, 새 문자열을 추가할 때만 InsertMutex를 잡는다.
+ * 슬롯 배열을 키워도 이전 배열은 소멸 전까지 해제하지 않아서 이전 배열을 읽던 스레드가 안전하다.
+ */
+class FNamePool
+{
+public:
+	explicit FNamePool(bool bInCaseSensitive);
+	~FNamePool();
+	FNamePool(const FNamePool&) = delete;
+	FNamePool& operator=(const FNamePool&) = delete;
+
+	//@brief 대소문자 구분 여부에 맞춘 FNV-1a 해시. 소문자 복사본을 만들지 않고 글자마다 변환한다
+	uint32 Hash(std::string_view InString) const;
+	//@return 항목 인덱스, 없으면 -1
+	int32 Find(std::string_view InString, uint32 InHash) const;
+	//@param InComparisonIndex 새 항목에 기록할 비교용 인덱스 (-1이면 새 항목 자신의 인덱스)
+	int32 FindOrAdd(std::string_view InString, uint32 InHash, int32 InComparisonIndex);
+	//@return 범위 밖이면 nullptr
+	const FNameEntry* GetEntry(int32 InIndex) const;
+	int32 Num() const { return EntryCount.load(std::memory_order_acquire); }
+
+private:
+	struct FSlotArray
+	{
+		uint32 Mask;
+		std::atomic<uint64>* Slots;
+	};
+
+	static constexpr int32 ENTRIES_PER_CHUNK = 4096;
+	static constexpr int32 MAX_ENTRY_CHUNKS = 1024;
+	static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+	bool IsEqual(const FNameEntry& InEntry, std::string_view InString) const;
+	int32 FindInSlots(const FSlotArray& InSlots, std::string_view InString, uint32 InHash) const;
+	FNameEntry* AllocateEntry(std::string_view InString, uint32 InHash);
+	FSlotArray* CreateSlotArray(uint32 InCapacity);
+	void InsertSlot(FSlotArray& InSlots, uint32 InHash, int32 InIndex);
+
+	const bool bCaseSensitive;
+
+	std::atomic<FSlotArray*> CurrentSlots;
+	TArray<FSlotArray*> AllSlotArrays;
+
+	// 인덱스 -> 항목. 청크는 필요할 때 할당하며, 포인터는 슬롯을 release로 게시하기 전에 기록한다
+	FNameEntry** EntryChunks[MAX_ENTRY_CHUNKS] = {};
+	std::atomic<int32> EntryCount;
+
+	TArray<uint8*> Blocks;
+	uint8* BlockCursor = nullptr;
+	uint8* BlockEnd = nullptr;
+
+	std::mutex InsertMutex;
+};
+
 class FNameTable
 {
 public:
@@ -64,18 +137,22 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
-	TPair<int32, int32> FindOrAddName(const FString& Str);
-	FName GetUniqueName(const FString& BaseStr);
+	//@return ComparisonIndex, DisplayIndex
+	TPair<int32, int32> FindOrAddName(std::string_view Str);
+	//@brief 이미 등록된 이름만 찾는다. 등록되지 않았으면 false
+	bool FindName(std::string_view Str, TPair<int32, int32>& OutIndices) const;
+
+	//@brief BaseStr 뒤에 대소문자 무시 기준으로 겹치지 않는 번호를 붙인 이름
+	FName GetUniqueName(std::string_view BaseStr);
+	//@brief GetUniqueName과 같지만 번호가 없는 BaseName이면 문자열을 다시 찾지 않고 인덱스를 그대로 쓴다
+	FName GetUniqueNameFromBase(const FName& BaseName);
 
 	FString GetDisplayString(int32 Idx) const;
+	//@brief 복사 없이 표시용 문자열을 본다. 항목은 옮겨지지 않으므로 반환된 뷰는 프로그램이 끝날 때까지 유효하다
+	std::string_view GetDisplayView(int32 Idx) const;
 
 private:
-	FString ToLower(const FString& Str) const;
-
-	TArray<FString> ComparisonStringPool;
-	TArray<FString> DisplayStringPool;
-
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
+	// 에셋 로딩 태스크가 워커 스레드에서 FName을 만들 수 있으므로 두 풀 모두 스레드 안전하다
+	FNamePool ComparisonPool;  // 대소문자 무시, 인덱스 0은 "None"
+	FNamePool DisplayPool;     // 대소문자 구분, 인덱스 0은 "None"
 };
\ No newline at end of file
@@ -62,6 +62,18 @@ public:
 	virtual UObject* Duplicate();
 	virtual UObject* DuplicateForEditor();
 
+	/**
+	 * @brief 객체 메모리는 FObjectPool 헤더를 앞에 붙여 할당한다
+	 * NewObject/CreateDefaultObject는 new (Class)로 클래스별 풀을 쓰고, 그 밖의 new는 힙을 쓴다.
+	 * delete는 헤더를 보고 알맞은 곳으로 돌려보낸다.
+	 */
+	static void* operator new(size_t InSize);
+	static void* operator new(size_t InSize, UClass* InClass);
+	static void* operator new(size_t InSize, void* InPlace) noexcept { return InPlace; }
+	static void operator delete(void* InMemory);
+	static void operator delete(void* InMemory, UClass* InClass);
+	static void operator delete(void* InMemory, void* InPlace) noexcept {}
+
 	// Comparison operators (for sol3 Lua binding)
 	bool operator==(const UObject& Other) const { return this == &Other; }
 	bool operator!=(const UObject& Other) const { return this != &Other; }
@@ -88,6 +100,11 @@ private:
 	void PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta);
 };
 
+inline bool UObject::IsA(UClass* InClass) const
+{
+	return GetClass()->IsChildOf(InClass);
+}
+
 /**
  * @brief 안전한 타입 캐스팅 함수 (원시 포인터용)
  * UClass::IsChildOf를 사용한 런타임 타입 체크
@@ -5,7 +5,7 @@ template<typename TObject>
 class TObjectIterator
 {
 public:
-	TObjectIterator() : UObjectArray(GetUObjectArray())
+	TObjectIterator() : UObjectArray(GetUObjectArray()), TargetClass(TObject::StaticClass())
 	{
 		CurrentIndex = 0;
 		AdvanceToNextValidObject();
@@ -56,9 +56,9 @@ private:
 		while (CurrentIndex < UObjectArray.Num())
 		{
 			UObject* Obj = UObjectArray[CurrentIndex].Object;  // FUObjectItem에서 Object 필드 접근
-			if (Obj && Obj->IsA(TObject::StaticClass()))
+			if (Obj && Obj->IsA(TargetClass))
 			{
-				CurrentObject = Cast<TObject>(Obj);
+				CurrentObject = static_cast<TObject*>(Obj);
 				return;
 			}
 			++CurrentIndex;
@@ -68,4 +68,5 @@ private:
 	int32 CurrentIndex;
 	TObject* CurrentObject = nullptr;
 	TArray<FUObjectItem>& UObjectArray;  // FUObjectItem 배열로 변경
+	UClass* TargetClass;  // 객체마다 StaticClass()를 부르지 않도록 한 번만 조회
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @brief 클래스별 객체 풀의 통계
+ * @param LiveCount 지금 살아 있는 객체 수
+ * @param PeakCount LiveCount의 최댓값
+ * @param TotalAllocationCount 누적 할당 수 (해제해도 줄지 않음)
+ * @param SlabCount 확보한 슬랩 수 (풀은 슬랩을 돌려주지 않음)
+ * @param SlotSize 헤더를 포함한 슬롯 하나의 크기
+ */
+struct FObjectPoolStats
+{
+	uint32 LiveCount = 0;
+	uint32 PeakCount = 0;
+	uint64 TotalAllocationCount = 0;
+	uint32 SlabCount = 0;
+	uint32 SlotSize = 0;
+	uint32 SlotsPerSlab = 0;
+};
+
+/**
+ * @brief UObject 메모리 앞에 붙는 헤더. 해제할 때 어느 풀로 돌려보낼지 알려준다
+ * 풀 밖에서 만든 객체(new로 직접 만든 객체, 풀에 맞지 않는 크기)는 Pool이 nullptr이다.
+ * 16바이트로 맞춰 객체 정렬을 해치지 않는다.
+ */
+struct alignas(16) FObjectMemoryHeader
+{
+	class FObjectPool* Pool;
+};
+
+/**
+ * @brief UClass 하나의 객체를 위한 슬랩 할당자
+ * 같은 크기의 슬롯을 슬랩(연속된 메모리 덩어리) 단위로 확보하고, 해제된 슬롯은 free list로 재사용한다.
+ * 스폰/파괴가 몰려도 힙에 객체 크기별 조각이 흩어지지 않고, 같은 클래스 객체가 메모리에 모인다.
+ * @note 풀은 UClass와 달리 프로그램이 끝날 때까지 파괴하지 않는다.
+ * 정적 소멸 순서상 UClass가 먼저 사라진 뒤에도 객체가 해제될 수 있기 때문이다.
+ */
+class FObjectPool
+{
+public:
+	static constexpr size_t SLOT_ALIGNMENT = 16;
+	static constexpr size_t SLAB_SIZE = 64 * 1024;
+	static constexpr uint32 MIN_SLOTS_PER_SLAB = 4;
+
+	explicit FObjectPool(size_t InObjectSize);
+
+	FObjectPool(const FObjectPool&) = delete;
+	FObjectPool& operator=(const FObjectPool&) = delete;
+
+	/**
+	 * @brief 객체 메모리를 할당한다. 헤더는 호출자가 채운다
+	 * @return 헤더 위치 (객체는 헤더 바로 뒤)
+	 */
+	FObjectMemoryHeader* AllocateSlot();
+	void FreeSlot(FObjectMemoryHeader* InHeader);
+
+	size_t GetObjectSize() const { return ObjectSize; }
+	FObjectPoolStats GetStats() const;
+
+	/**
+	 * @brief UObject::operator new가 쓰는 할당 함수
+	 * @param InSize 만들 객체의 크기
+	 * @param InPool 객체 클래스의 풀. nullptr이거나 InSize가 풀 슬롯보다 크면 힙에서 할당한다
+	 * @return 객체 메모리 (헤더 뒤)
+	 */
+	static void* AllocateObject(size_t InSize, FObjectPool* InPool);
+	static void FreeObject(void* InMemory);
+
+private:
+	struct FFreeSlot
+	{
+		FFreeSlot* Next;
+	};
+
+	void AddSlab();
+
+	size_t ObjectSize;
+	size_t SlotSize;
+	uint32 SlotsPerSlab;
+
+	std::mutex Mutex;
+	FFreeSlot* FreeList = nullptr;
+
+	// 오버레이가 락 없이 읽는다
+	std::atomic<uint32> SlabCount = 0;
+	std::atomic<uint32> LiveCount = 0;
+	std::atomic<uint32> PeakCount = 0;
+	std::atomic<uint64> TotalAllocationCount = 0;
+};
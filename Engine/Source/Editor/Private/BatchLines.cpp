@@ -480,17 +480,16 @@ void UBatchLines::TraverseOctree(const FOctree* InNode)
 {
 	if (!InNode) { return; }
 
-	UBoundingBoxLines BoxLines;
-	BoxLines.UpdateVertices(&InNode->GetBoundingBox());
-	OctreeLines.Add(BoxLines);
-
-	if (!InNode->IsLeafNode())
-	{
-		for (const auto& Child : InNode->GetChildren())
+	// 원소가 있는 노드의 loose 경계만 표시 (빈 서브트리는 Traverse가 방문하지 않음)
+	InNode->Traverse(
+		[this](const FAABB& NodeBounds)
 		{
-			TraverseOctree(Child);
-		}
-	}
+			UBoundingBoxLines BoxLines;
+			BoxLines.UpdateVertices(&NodeBounds);
+			OctreeLines.Add(BoxLines);
+			return EOctreeVisit::Visit;
+		},
+		[](UPrimitiveComponent*, const FAABB&, bool) {});
 }
 
 void UBatchLines::UpdateVertexBuffer()
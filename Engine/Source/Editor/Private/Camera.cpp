@@ -170,10 +170,9 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
     ULevel* CurrentLevel = GWorld->GetLevel();
     if (CurrentLevel)
     {
-        TArray<UPrimitiveComponent*> DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
         ViewVolumeCuller.Cull(
             CurrentLevel->GetStaticOctree(),
-            DynamicPrimitives,
+            CurrentLevel->GetDynamicPrimitiveTree(),
             CameraConstants
         );
     }
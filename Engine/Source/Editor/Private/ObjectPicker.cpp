@@ -399,7 +399,33 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
 	FRay ModelRay = GetModelRay(WorldRay, Primitive);
-	
+
+	// 평탄화된 BVH를 가진 Static Mesh는 closest-hit 순회로 가장 가까운 삼각형 하나만 정밀 검사
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		UStaticMesh* StaticMeshAsset = StaticMeshComp->GetStaticMesh();
+		FStaticMesh* StaticMesh = StaticMeshAsset ? StaticMeshAsset->GetStaticMeshAsset() : nullptr;
+		if (StaticMesh && StaticMesh->BVH.IsFlattened() && Indices)
+		{
+			FBVHRayHit Hit;
+			if (!StaticMesh->BVH.RaycastClosest(ModelRay, Hit))
+			{
+				return false;
+			}
+
+			const int32 TriIndex = Hit.TriangleIndex;
+			const FVector& V0 = (*Vertices)[(*Indices)[TriIndex * 3 + 0]].Position;
+			const FVector& V1 = (*Vertices)[(*Indices)[TriIndex * 3 + 1]].Position;
+			const FVector& V2 = (*Vertices)[(*Indices)[TriIndex * 3 + 2]].Position;
+			if (IsRayTriangleCollided(InActiveCamera, ModelRay, V0, V1, V2, ModelMatrix, &Distance))
+			{
+				*ShortestDistance = std::min(*ShortestDistance, Distance);
+				return true;
+			}
+			// 가장 가까운 교차점이 near/far 범위 밖이면 아래에서 모든 후보 삼각형을 검사
+		}
+	}
+
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
 	TArray<int32> CandidateTriangleIndices;
@@ -520,31 +546,28 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
  * 레이와 충돌하는 후보 노드들을 찾아 그 안의 프리미티브들을 OutCandidate에 담습니다.
  * @return 후보를 찾았으면 true, 못 찾았으면 false를 반환합니다.
  */
-bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
+bool UObjectPicker::FindCandidateFromOctree(FOctree* Octree, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
 {
 	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
-
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingBox()) == false) { return false; }
-
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.IsEmpty())
-	{
-		OutCandidate.Append(Node->GetPrimitives());
-	}
+	if (!Octree) { return false; }
 
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
-	{
-		for (FOctree* Child : Node->GetChildren())
+	const int32 PrevCandidateCount = OutCandidate.Num();
+	Octree->Traverse(
+		[&WorldRay](const FAABB& NodeBounds)
 		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
-		}
-	}
+			// 1. 레이가 노드와 겹치지 않으면 자손 노드까지 검사 생략.
+			return CheckIntersectionRayBox(WorldRay, NodeBounds) ? EOctreeVisit::Visit : EOctreeVisit::Skip;
+		},
+		[&WorldRay, &OutCandidate](UPrimitiveComponent* Primitive, const FAABB& Bounds, bool bAcceptedByNode)
+		{
+			// 2. 노드에 캐시된 AABB로 레이와 겹치는 프리미티브만 후보에 추가합니다.
+			if (CheckIntersectionRayBox(WorldRay, Bounds))
+			{
+				OutCandidate.Add(Primitive);
+			}
+		});
 
-	return true;
+	return OutCandidate.Num() > PrevCandidateCount;
 }
 
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
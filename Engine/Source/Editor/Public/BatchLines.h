@@ -10,7 +10,7 @@ class FOctree;
 class UDecalSpotLightComponent;
 class USkeletalMeshComponent;
 
-class UBatchLines : UObject
+class UBatchLines : public UObject
 {
 	DECLARE_CLASS(UBatchLines, UObject)
 public:
@@ -2,7 +2,7 @@
 #include "Core/Public/Object.h"
 #include "Physics/Public/AABB.h"
 
-class UBoundingBoxLines : UObject
+class UBoundingBoxLines : public UObject
 {
 public:
 	UBoundingBoxLines();
@@ -2,6 +2,416 @@
 #include "Global/BVH.h"
 
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+#include <emmintrin.h>
+
+namespace
+{
+	constexpr int32 SAH_BIN_COUNT = 16;
+	constexpr int32 MIN_LEAF_TRIANGLES = 2;         // 이 개수 이하이면 무조건 leaf
+	constexpr int32 MAX_LEAF_TRIANGLES = 8;         // SAH가 leaf를 선호하더라도 이 개수를 넘으면 분할
+	constexpr int32 MAX_BUILD_DEPTH = 48;           // 순회 스택 크기(64)보다 작게 유지
+	constexpr int32 TRAVERSAL_STACK_SIZE = 64;
+	constexpr float SAH_TRAVERSAL_COST = 1.0f;
+	constexpr float SAH_INTERSECTION_COST = 1.0f;
+
+	// Ray-삼각형 교차 판정의 determinant 하한 (UObjectPicker::IsRayTriangleCollided와 같은 기준)
+	constexpr float RAY_TRIANGLE_DET_EPSILON = 0.0001f;
+	// TriangleSoA 스트림 순서: V0.xyz, Edge1.xyz, Edge2.xyz
+	constexpr int32 SOA_STREAM_COUNT = 9;
+
+	// 병렬 빌드: 상위 몇 단계의 큰 서브트리만 태스크로 분기 (최대 2^MAX_DEPTH개)
+	constexpr int32 PARALLEL_BUILD_MIN_TRIANGLES = 32 * 1024;
+	constexpr int32 PARALLEL_BUILD_MAX_DEPTH = 3;
+
+	/** @brief 빌드 중에만 사용하는 가벼운 AABB (FAABB는 가상 함수 테이블을 가지므로 사용하지 않음) */
+	struct FBuildBounds
+	{
+		FVector Min{ FLT_MAX, FLT_MAX, FLT_MAX };
+		FVector Max{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		void Grow(const FVector& Point)
+		{
+			Min = FVector(std::min(Min.X, Point.X), std::min(Min.Y, Point.Y), std::min(Min.Z, Point.Z));
+			Max = FVector(std::max(Max.X, Point.X), std::max(Max.Y, Point.Y), std::max(Max.Z, Point.Z));
+		}
+
+		void Grow(const FBuildBounds& Other)
+		{
+			Min = FVector(std::min(Min.X, Other.Min.X), std::min(Min.Y, Other.Min.Y), std::min(Min.Z, Other.Min.Z));
+			Max = FVector(std::max(Max.X, Other.Max.X), std::max(Max.Y, Other.Max.Y), std::max(Max.Z, Other.Max.Z));
+		}
+
+		bool IsValid() const { return Min.X <= Max.X; }
+
+		float GetSurfaceArea() const
+		{
+			if (!IsValid())
+			{
+				return 0.0f;
+			}
+			const FVector Extent = Max - Min;
+			return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+		}
+	};
+
+	float GetAxis(const FVector& Vector, int32 Axis)
+	{
+		return (Axis == 0) ? Vector.X : (Axis == 1) ? Vector.Y : Vector.Z;
+	}
+
+	/** @brief SAH 빌드에 필요한 삼각형별 사전 계산 데이터 */
+	struct FSAHBuildContext
+	{
+		TArray<FBuildBounds> TriangleBounds;
+		TArray<FVector> Centroids;
+		TArray<int32>* TriangleIndices = nullptr;
+	};
+
+	struct FSAHBin
+	{
+		FBuildBounds Bounds;
+		int32 Count = 0;
+	};
+
+	/** @brief 병렬로 빌드된 서브트리를 부모 배열에 이어 붙이며 오른쪽 자식 인덱스를 보정 */
+	void AppendFlatSubtree(TArray<FFlatBVHNode>& OutNodes, const TArray<FFlatBVHNode>& Subtree)
+	{
+		const int32 Base = OutNodes.Num();
+		OutNodes.Append(Subtree);
+		for (int32 i = Base; i < OutNodes.Num(); ++i)
+		{
+			if (!OutNodes[i].IsLeaf())
+			{
+				OutNodes[i].Offset += Base;
+			}
+		}
+	}
+
+	void BuildSAHSubtree(FSAHBuildContext& Context, int32 Begin, int32 End, int32 Depth, TArray<FFlatBVHNode>& OutNodes)
+	{
+		TArray<int32>& Triangles = *Context.TriangleIndices;
+
+		const int32 NodeIndex = OutNodes.Add(FFlatBVHNode{});
+		const int32 Count = End - Begin;
+
+		// 1. 노드 AABB와 centroid AABB 계산
+		FBuildBounds NodeBounds;
+		FBuildBounds CentroidBounds;
+		for (int32 i = Begin; i < End; ++i)
+		{
+			NodeBounds.Grow(Context.TriangleBounds[Triangles[i]]);
+			CentroidBounds.Grow(Context.Centroids[Triangles[i]]);
+		}
+
+		auto MakeLeaf = [&]()
+		{
+			FFlatBVHNode& Leaf = OutNodes[NodeIndex];
+			Leaf.BoundsMin = NodeBounds.Min;
+			Leaf.BoundsMax = NodeBounds.Max;
+			Leaf.Offset = Begin;
+			Leaf.TriangleCount = Count;
+		};
+
+		if (Count <= MIN_LEAF_TRIANGLES || Depth >= MAX_BUILD_DEPTH)
+		{
+			MakeLeaf();
+			return;
+		}
+
+		// 2. 세 축 모두에 대해 binning 후 최소 SAH 비용의 분할 평면 탐색
+		float BestCost = FLT_MAX;
+		int32 BestAxis = -1;
+		int32 BestSplit = -1;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float AxisMin = GetAxis(CentroidBounds.Min, Axis);
+			const float AxisExtent = GetAxis(CentroidBounds.Max, Axis) - AxisMin;
+			if (AxisExtent <= MATH_EPSILON)
+			{
+				continue;
+			}
+
+			FSAHBin Bins[SAH_BIN_COUNT];
+			const float BinScale = SAH_BIN_COUNT / AxisExtent;
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const int32 Triangle = Triangles[i];
+				const int32 BinIndex = std::min(SAH_BIN_COUNT - 1,
+					static_cast<int32>((GetAxis(Context.Centroids[Triangle], Axis) - AxisMin) * BinScale));
+				Bins[BinIndex].Count++;
+				Bins[BinIndex].Bounds.Grow(Context.TriangleBounds[Triangle]);
+			}
+
+			// 왼쪽/오른쪽 누적 스윕으로 각 분할 평면의 면적과 개수를 O(Bin) 에 계산
+			float LeftArea[SAH_BIN_COUNT - 1];
+			int32 LeftCount[SAH_BIN_COUNT - 1];
+			FBuildBounds Accumulated;
+			int32 AccumulatedCount = 0;
+			for (int32 Split = 0; Split < SAH_BIN_COUNT - 1; ++Split)
+			{
+				Accumulated.Grow(Bins[Split].Bounds);
+				AccumulatedCount += Bins[Split].Count;
+				LeftArea[Split] = Accumulated.GetSurfaceArea();
+				LeftCount[Split] = AccumulatedCount;
+			}
+
+			Accumulated = FBuildBounds();
+			AccumulatedCount = 0;
+			for (int32 Split = SAH_BIN_COUNT - 2; Split >= 0; --Split)
+			{
+				Accumulated.Grow(Bins[Split + 1].Bounds);
+				AccumulatedCount += Bins[Split + 1].Count;
+				if (LeftCount[Split] == 0 || AccumulatedCount == 0)
+				{
+					continue;
+				}
+
+				const float SplitCost = LeftArea[Split] * LeftCount[Split] + Accumulated.GetSurfaceArea() * AccumulatedCount;
+				if (SplitCost < BestCost)
+				{
+					BestCost = SplitCost;
+					BestAxis = Axis;
+					BestSplit = Split;
+				}
+			}
+		}
+
+		// 3. Leaf 비용과 비교 (부모 면적으로 정규화)
+		const float NodeArea = NodeBounds.GetSurfaceArea();
+		const float LeafCost = SAH_INTERSECTION_COST * Count;
+		const float SplitCost = (NodeArea > 0.0f && BestAxis != -1)
+			? SAH_TRAVERSAL_COST + SAH_INTERSECTION_COST * BestCost / NodeArea
+			: FLT_MAX;
+		if (LeafCost <= SplitCost && Count <= MAX_LEAF_TRIANGLES)
+		{
+			MakeLeaf();
+			return;
+		}
+
+		// 4. 분할 평면 기준으로 삼각형 파티션
+		int32 Mid = Begin;
+		if (BestAxis != -1)
+		{
+			const float AxisMin = GetAxis(CentroidBounds.Min, BestAxis);
+			const float BinScale = SAH_BIN_COUNT / (GetAxis(CentroidBounds.Max, BestAxis) - AxisMin);
+			auto* MidIter = std::partition(Triangles.GetData() + Begin, Triangles.GetData() + End, [&](int32 Triangle)
+			{
+				const int32 BinIndex = std::min(SAH_BIN_COUNT - 1,
+					static_cast<int32>((GetAxis(Context.Centroids[Triangle], BestAxis) - AxisMin) * BinScale));
+				return BinIndex <= BestSplit;
+			});
+			Mid = static_cast<int32>(MidIter - Triangles.GetData());
+		}
+
+		// centroid가 모두 겹쳐 유효한 분할이 없는 경우 개수 기준으로 반으로 나눔
+		if (Mid == Begin || Mid == End)
+		{
+			Mid = Begin + Count / 2;
+		}
+
+		// 5. 자식 서브트리 빌드 (왼쪽 자식은 바로 다음 인덱스에 위치)
+		int32 RightIndex;
+		FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+		if (Depth < PARALLEL_BUILD_MAX_DEPTH && Count >= PARALLEL_BUILD_MIN_TRIANGLES && Scheduler.IsRunning())
+		{
+			// 왼쪽 서브트리는 워커가 가져가고 오른쪽은 이 스레드에서 빌드. Wait는 기다리는 동안 다른 태스크를 실행한다
+			TArray<FFlatBVHNode> LeftNodes;
+			TArray<FFlatBVHNode> RightNodes;
+			const FTaskRef LeftTask = Scheduler.Dispatch([&]()
+			{
+				BuildSAHSubtree(Context, Begin, Mid, Depth + 1, LeftNodes);
+			});
+			BuildSAHSubtree(Context, Mid, End, Depth + 1, RightNodes);
+			Scheduler.Wait(LeftTask);
+
+			AppendFlatSubtree(OutNodes, LeftNodes);
+			RightIndex = OutNodes.Num();
+			AppendFlatSubtree(OutNodes, RightNodes);
+		}
+		else
+		{
+			BuildSAHSubtree(Context, Begin, Mid, Depth + 1, OutNodes);
+			RightIndex = OutNodes.Num();
+			BuildSAHSubtree(Context, Mid, End, Depth + 1, OutNodes);
+		}
+
+		FFlatBVHNode& Internal = OutNodes[NodeIndex];
+		Internal.BoundsMin = NodeBounds.Min;
+		Internal.BoundsMax = NodeBounds.Max;
+		Internal.Offset = RightIndex;
+		Internal.TriangleCount = 0;
+	}
+
+	/** @brief 역방향 벡터를 미리 계산해 둔 Ray-AABB slab 검사 */
+	bool IntersectRayBounds(const FVector& Origin, const FVector& InvDirection, const FVector& BoundsMin, const FVector& BoundsMax)
+	{
+		float T1 = (BoundsMin.X - Origin.X) * InvDirection.X;
+		float T2 = (BoundsMax.X - Origin.X) * InvDirection.X;
+		float TMin = std::min(T1, T2);
+		float TMax = std::max(T1, T2);
+
+		T1 = (BoundsMin.Y - Origin.Y) * InvDirection.Y;
+		T2 = (BoundsMax.Y - Origin.Y) * InvDirection.Y;
+		TMin = std::max(TMin, std::min(T1, T2));
+		TMax = std::min(TMax, std::max(T1, T2));
+
+		T1 = (BoundsMin.Z - Origin.Z) * InvDirection.Z;
+		T2 = (BoundsMax.Z - Origin.Z) * InvDirection.Z;
+		TMin = std::max(TMin, std::min(T1, T2));
+		TMax = std::min(TMax, std::max(T1, T2));
+
+		return TMax >= TMin && TMax >= 0.0f;
+	}
+
+	float SafeInverse(float Value)
+	{
+		// 축에 평행한 Ray의 0 나눗셈(NaN) 방지
+		if (fabs(Value) < MATH_EPSILON)
+		{
+			return Value < 0.0f ? -1e30f : 1e30f;
+		}
+		return 1.0f / Value;
+	}
+
+	// --- SSE 순회 보조 함수들 ---
+
+	/** @brief x, y, z lane의 최대/최소값 (노드를 그대로 로드하면 w lane에는 Offset/TriangleCount가 들어 있으므로 무시) */
+	float HorizontalMax3(__m128 Value)
+	{
+		const __m128 XY = _mm_max_ss(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 1, 1, 1)));
+		return _mm_cvtss_f32(_mm_max_ss(XY, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 2, 2, 2))));
+	}
+
+	float HorizontalMin3(__m128 Value)
+	{
+		const __m128 XY = _mm_min_ss(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 1, 1, 1)));
+		return _mm_cvtss_f32(_mm_min_ss(XY, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 2, 2, 2))));
+	}
+
+	/** @brief 세 축의 slab을 한 번에 계산하는 Ray-AABB 검사. 교차하면 진입 거리를 OutEntry에 기록 */
+	bool IntersectRayNodeSSE(const FFlatBVHNode& Node, __m128 Origin, __m128 InvDirection, float MaxDistance, float& OutEntry)
+	{
+		const __m128 T1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&Node.BoundsMin.X), Origin), InvDirection);
+		const __m128 T2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&Node.BoundsMax.X), Origin), InvDirection);
+		OutEntry = std::max(HorizontalMax3(_mm_min_ps(T1, T2)), 0.0f);
+		const float Exit = std::min(HorizontalMin3(_mm_max_ps(T1, T2)), MaxDistance);
+		return OutEntry <= Exit;
+	}
+
+	__m128 Select(__m128 Mask, __m128 A, __m128 B)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+	}
+
+	/** @brief lane마다 Ray 또는 삼각형이 하나씩 들어 있는 4-wide 데이터 */
+	struct FRay4
+	{
+		__m128 OriginX, OriginY, OriginZ;
+		__m128 DirectionX, DirectionY, DirectionZ;
+	};
+
+	struct FTriangle4
+	{
+		__m128 V0X, V0Y, V0Z;
+		__m128 Edge1X, Edge1Y, Edge1Z;
+		__m128 Edge2X, Edge2Y, Edge2Z;
+	};
+
+	/**
+	* @brief 4-wide Möller–Trumbore 교차 검사 (양면). lane끼리 독립적이므로
+	*        Ray 하나 vs 삼각형 4개, Ray 4개 vs 삼각형 하나 모두 같은 커널을 사용한다.
+	* @return [0, MaxDistance) 안에서 교차한 lane의 마스크
+	*/
+	__m128 IntersectRayTriangle4(const FRay4& Ray, const FTriangle4& Tri, __m128 MaxDistance, __m128& OutDistance, __m128& OutU, __m128& OutV)
+	{
+		// P = D x Edge2
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(Ray.DirectionY, Tri.Edge2Z), _mm_mul_ps(Ray.DirectionZ, Tri.Edge2Y));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(Ray.DirectionZ, Tri.Edge2X), _mm_mul_ps(Ray.DirectionX, Tri.Edge2Z));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(Ray.DirectionX, Tri.Edge2Y), _mm_mul_ps(Ray.DirectionY, Tri.Edge2X));
+
+		const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Tri.Edge1X, PX), _mm_mul_ps(Tri.Edge1Y, PY)), _mm_mul_ps(Tri.Edge1Z, PZ));
+		const __m128 AbsDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), Det);
+		const __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+		// T = O - V0
+		const __m128 TX = _mm_sub_ps(Ray.OriginX, Tri.V0X);
+		const __m128 TY = _mm_sub_ps(Ray.OriginY, Tri.V0Y);
+		const __m128 TZ = _mm_sub_ps(Ray.OriginZ, Tri.V0Z);
+		const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(TX, PX), _mm_mul_ps(TY, PY)), _mm_mul_ps(TZ, PZ)), InvDet);
+
+		// Q = T x Edge1
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(TY, Tri.Edge1Z), _mm_mul_ps(TZ, Tri.Edge1Y));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(TZ, Tri.Edge1X), _mm_mul_ps(TX, Tri.Edge1Z));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(TX, Tri.Edge1Y), _mm_mul_ps(TY, Tri.Edge1X));
+		const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ray.DirectionX, QX), _mm_mul_ps(Ray.DirectionY, QY)), _mm_mul_ps(Ray.DirectionZ, QZ)), InvDet);
+		const __m128 Distance = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Tri.Edge2X, QX), _mm_mul_ps(Tri.Edge2Y, QY)), _mm_mul_ps(Tri.Edge2Z, QZ)), InvDet);
+
+		const __m128 Zero = _mm_setzero_ps();
+		__m128 Mask = _mm_cmpgt_ps(AbsDet, _mm_set1_ps(RAY_TRIANGLE_DET_EPSILON));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(U, Zero));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(V, Zero));
+		Mask = _mm_and_ps(Mask, _mm_cmple_ps(_mm_add_ps(U, V), _mm_set1_ps(1.0f)));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(Distance, Zero));
+		Mask = _mm_and_ps(Mask, _mm_cmplt_ps(Distance, MaxDistance));
+
+		OutDistance = Distance;
+		OutU = U;
+		OutV = V;
+		return Mask;
+	}
+
+	FRay4 SplatRay(const FRay& Ray)
+	{
+		return FRay4{
+			_mm_set1_ps(Ray.Origin.X), _mm_set1_ps(Ray.Origin.Y), _mm_set1_ps(Ray.Origin.Z),
+			_mm_set1_ps(Ray.Direction.X), _mm_set1_ps(Ray.Direction.Y), _mm_set1_ps(Ray.Direction.Z)
+		};
+	}
+
+	/** @brief 같은 기준의 스칼라 Möller–Trumbore (평탄화되지 않은 트리용) */
+	bool IntersectRayTriangle(const FRay& Ray, const FVector& P0, const FVector& P1, const FVector& P2, float MaxDistance, FBVHRayHit& OutHit)
+	{
+		const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+		const FVector Direction(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+		const FVector Edge1 = P1 - P0;
+		const FVector Edge2 = P2 - P0;
+
+		const FVector P = Direction.Cross(Edge2);
+		const float Det = Edge1.Dot(P);
+		if (fabs(Det) <= RAY_TRIANGLE_DET_EPSILON)
+		{
+			return false;
+		}
+		const float InvDet = 1.0f / Det;
+
+		const FVector T = Origin - P0;
+		const float U = T.Dot(P) * InvDet;
+		if (U < 0.0f || U > 1.0f)
+		{
+			return false;
+		}
+
+		const FVector Q = T.Cross(Edge1);
+		const float V = Direction.Dot(Q) * InvDet;
+		if (V < 0.0f || U + V > 1.0f)
+		{
+			return false;
+		}
+
+		const float Distance = Edge2.Dot(Q) * InvDet;
+		if (Distance < 0.0f || Distance >= MaxDistance)
+		{
+			return false;
+		}
+
+		OutHit.Distance = Distance;
+		OutHit.U = U;
+		OutHit.V = V;
+		return true;
+	}
+}
 
 FBVH::FBVH(FStaticMesh* InMesh)
 {
@@ -24,6 +434,10 @@ void FBVH::Clear()
 {
 	Mesh = nullptr;
 	Nodes.Empty();
+	FlatNodes.Empty();
+	TriangleIndices.Empty();
+	TriangleSoA.Empty();
+	SoAStride = 0;
 	RootIndex = -1;
 	Cost = 0.0f;
 }
@@ -313,6 +727,29 @@ void FBVH::RefitAncestors(int32 RefitStartIndex)
 
 bool FBVH::CheckValidity() const
 {
+	// 평탄화된 트리: 자식 인덱스와 leaf 구간이 유효하고, 모든 삼각형이 정확히 한 번씩 포함되는지 확인
+	if (IsFlattened())
+	{
+		int32 LeafTriangleCount = 0;
+		for (int32 i = 0; i < FlatNodes.Num(); ++i)
+		{
+			const FFlatBVHNode& Node = FlatNodes[i];
+			if (Node.IsLeaf())
+			{
+				if (Node.Offset < 0 || Node.Offset + Node.TriangleCount > TriangleIndices.Num())
+				{
+					return false;
+				}
+				LeafTriangleCount += Node.TriangleCount;
+			}
+			else if (Node.Offset <= i + 1 || Node.Offset >= FlatNodes.Num())
+			{
+				return false;
+			}
+		}
+		return LeafTriangleCount == TriangleIndices.Num() && Nodes.IsEmpty();
+	}
+
 	// 1. 루트의 인덱스가 유효한지 확인
 	if ((RootIndex < 0 && !Nodes.IsEmpty()) || RootIndex >= static_cast<int32>(Nodes.Num()))
 	{
@@ -402,6 +839,11 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 {
 	OutTriangleIndices.Empty();
 
+	if (IsFlattened())
+	{
+		return TraverseRayFlat(Ray, OutTriangleIndices);
+	}
+
 	// 빈 트리이거나 루트가 유효하지 않은 경우
 	if (RootIndex < 0 || RootIndex >= Nodes.Num())
 	{
@@ -462,6 +904,103 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 	Clear();
 	Mesh = InMesh;
+
+	const int32 TriangleCount = Mesh->Indices.Num() / 3;
+	if (TriangleCount == 0)
+	{
+		return;
+	}
+
+	// 1. 삼각형별 AABB와 centroid를 미리 계산 (빌드 중 버텍스 버퍼 재참조 방지)
+	FSAHBuildContext Context;
+	Context.TriangleBounds.SetNum(TriangleCount);
+	Context.Centroids.SetNum(TriangleCount);
+	TriangleIndices.SetNum(TriangleCount);
+	for (int32 i = 0; i < TriangleCount; ++i)
+	{
+		const FVector& P0 = Mesh->Vertices[Mesh->Indices[i * 3 + 0]].Position;
+		const FVector& P1 = Mesh->Vertices[Mesh->Indices[i * 3 + 1]].Position;
+		const FVector& P2 = Mesh->Vertices[Mesh->Indices[i * 3 + 2]].Position;
+
+		FBuildBounds& Bounds = Context.TriangleBounds[i];
+		Bounds.Grow(P0);
+		Bounds.Grow(P1);
+		Bounds.Grow(P2);
+		Context.Centroids[i] = (Bounds.Min + Bounds.Max) * 0.5f;
+		TriangleIndices[i] = i;
+	}
+	Context.TriangleIndices = &TriangleIndices;
+
+	// 2. Top-down 빌드 (노드 수는 최대 2N - 1)
+	FlatNodes.Reserve(TriangleCount * 2);
+	BuildSAHSubtree(Context, 0, TriangleCount, 0, FlatNodes);
+	FlatNodes.Shrink();
+
+	// 3. Closest-hit 순회용 SoA 삼각형 데이터
+	BuildTriangleSoA();
+
+	// 전체 비용 계산
+	Cost = GetFlatCost();
+	// 유효성 검사
+	if (!CheckValidity())
+	{
+		std::cerr << "FBVH::Build: BVH structure is invalid after build." << '\n';
+	}
+}
+
+bool FBVH::BuildFromFlat(FStaticMesh* InMesh, const FFlatBVHNode* InNodes, int32 InNodeCount, const int32* InTriangleIndices, int32 InTriangleCount)
+{
+	Clear();
+	if (!InMesh || InTriangleCount != InMesh->Indices.Num() / 3)
+	{
+		return false;
+	}
+	if (InTriangleCount == 0)
+	{
+		Mesh = InMesh;
+		return true;
+	}
+
+	// 순회 중 범위 검사를 하지 않으므로 파일에서 온 값은 여기서 한 번 검증한다
+	for (int32 i = 0; i < InNodeCount; ++i)
+	{
+		const FFlatBVHNode& Node = InNodes[i];
+		const bool bValid = Node.IsLeaf()
+			? (Node.Offset >= 0 && Node.Offset + Node.TriangleCount <= InTriangleCount)
+			: (Node.Offset > i + 1 && Node.Offset < InNodeCount);
+		if (!bValid)
+		{
+			return false;
+		}
+	}
+	for (int32 i = 0; i < InTriangleCount; ++i)
+	{
+		if (InTriangleIndices[i] < 0 || InTriangleIndices[i] >= InTriangleCount)
+		{
+			return false;
+		}
+	}
+
+	Mesh = InMesh;
+	FlatNodes.SetNum(InNodeCount);
+	memcpy(FlatNodes.GetData(), InNodes, sizeof(FFlatBVHNode) * InNodeCount);
+	TriangleIndices.SetNum(InTriangleCount);
+	memcpy(TriangleIndices.GetData(), InTriangleIndices, sizeof(int32) * InTriangleCount);
+
+	BuildTriangleSoA();
+	Cost = GetFlatCost();
+	return true;
+}
+
+void FBVH::BuildIncremental(FStaticMesh* InMesh)
+{
+	if (!InMesh)
+	{
+		std::cerr << "FBVH::BuildIncremental: Input mesh is null." << '\n';
+		return;
+	}
+	Clear();
+	Mesh = InMesh;
 	// 모든 삼각형에 대해 Leaf 노드 삽입
 	int32 TriangleCount = Mesh->Indices.Num() / 3;
 	for (int32 i = 0; i < TriangleCount; ++i)
@@ -474,7 +1013,547 @@ void FBVH::Build(FStaticMesh* InMesh)
 	// 유효성 검사
 	if (!CheckValidity())
 	{
-		std::cerr << "FBVH::Build: BVH structure is invalid after build." << '\n';
+		std::cerr << "FBVH::BuildIncremental: BVH structure is invalid after build." << '\n';
+	}
+}
+
+
+
+float FBVH::GetFlatCost(bool bInternalOnly) const
+{
+	float TotalCost = 0.0f;
+	for (const FFlatBVHNode& Node : FlatNodes)
+	{
+		if (bInternalOnly && Node.IsLeaf())
+		{
+			continue;
+		}
+		const FVector Extent = Node.BoundsMax - Node.BoundsMin;
+		TotalCost += 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+	}
+	return TotalCost;
+}
+
+float FBVH::GetSAHCost() const
+{
+	const auto GetSurfaceArea = [](const FVector& InMin, const FVector& InMax)
+	{
+		const FVector Extent = InMax - InMin;
+		return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+	};
+
+	float RootArea = 0.0f;
+	float WeightedCost = 0.0f;
+	if (!FlatNodes.IsEmpty())
+	{
+		RootArea = GetSurfaceArea(FlatNodes[0].BoundsMin, FlatNodes[0].BoundsMax);
+		for (const FFlatBVHNode& Node : FlatNodes)
+		{
+			const float Area = GetSurfaceArea(Node.BoundsMin, Node.BoundsMax);
+			WeightedCost += Node.IsLeaf() ? Area * SAH_INTERSECTION_COST * Node.TriangleCount : Area * SAH_TRAVERSAL_COST;
+		}
+	}
+	else if (RootIndex >= 0 && RootIndex < Nodes.Num())
+	{
+		RootArea = Nodes[RootIndex].Box.GetSurfaceArea();
+		TArray<int32> NodeStack;
+		NodeStack.Add(RootIndex);
+		while (!NodeStack.IsEmpty())
+		{
+			const FNode& Node = Nodes[NodeStack.Last()];
+			NodeStack.Pop();
+
+			const float Area = Node.Box.GetSurfaceArea();
+			if (Node.bIsLeaf)
+			{
+				WeightedCost += Area * SAH_INTERSECTION_COST;
+				continue;
+			}
+			WeightedCost += Area * SAH_TRAVERSAL_COST;
+			NodeStack.Add(Node.Child1);
+			NodeStack.Add(Node.Child2);
+		}
+	}
+
+	return RootArea > 0.0f ? WeightedCost / RootArea : 0.0f;
+}
+
+bool FBVH::TraverseRayFlat(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
+{
+	const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+	const FVector InvDirection(SafeInverse(Ray.Direction.X), SafeInverse(Ray.Direction.Y), SafeInverse(Ray.Direction.Z));
+
+	// 빌드 시 깊이를 제한하므로 고정 크기 스택으로 충분
+	int32 NodeStack[TRAVERSAL_STACK_SIZE];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const int32 CurrentNodeIndex = NodeStack[--StackSize];
+		const FFlatBVHNode& CurrentNode = FlatNodes[CurrentNodeIndex];
+
+		if (!IntersectRayBounds(Origin, InvDirection, CurrentNode.BoundsMin, CurrentNode.BoundsMax))
+		{
+			continue;
+		}
+
+		if (CurrentNode.IsLeaf())
+		{
+			// 평탄화된 트리는 Triangle ordinal을 직접 저장하므로 변환 없이 반환
+			for (int32 i = 0; i < CurrentNode.TriangleCount; ++i)
+			{
+				OutTriangleIndices.Add(TriangleIndices[CurrentNode.Offset + i]);
+			}
+		}
+		else
+		{
+			assert(StackSize + 2 <= TRAVERSAL_STACK_SIZE);
+			NodeStack[StackSize++] = CurrentNode.Offset;      // 오른쪽 자식
+			NodeStack[StackSize++] = CurrentNodeIndex + 1;    // 왼쪽 자식 (implicit)
+		}
+	}
+
+	return true;
+}
+
+int32 FBVH::InsertTriangle(int32 InTriangleBaseIndex)
+{
+	if (IsFlattened())
+	{
+		ConvertFlatToDynamic();
+	}
+
+	const int32 LeafIndex = InsertLeaf(InTriangleBaseIndex);
+	Cost = GetCost(RootIndex);
+	return LeafIndex;
+}
+
+void FBVH::ConvertFlatToDynamic()
+{
+	Nodes.Empty();
+	Nodes.Reserve(TriangleIndices.Num() * 2);
+	RootIndex = ConvertFlatSubtree(0, -1);
+
+	FlatNodes.Empty();
+	TriangleIndices.Empty();
+	TriangleSoA.Empty();
+	SoAStride = 0;
+	Cost = GetCost(RootIndex);
+}
+
+int32 FBVH::ConvertFlatSubtree(int32 FlatIndex, int32 ParentIndex)
+{
+	const FFlatBVHNode& FlatNode = FlatNodes[FlatIndex];
+	if (FlatNode.IsLeaf())
+	{
+		return ConvertFlatLeafRange(FlatNode.Offset, FlatNode.TriangleCount, ParentIndex);
+	}
+
+	// Nodes.Add로 재할당이 일어날 수 있으므로 참조 대신 인덱스로 접근
+	FNode Internal;
+	Internal.ObjectIndex = Nodes.Num();
+	Internal.ParentIndex = ParentIndex;
+	Internal.bIsLeaf = false;
+	Internal.Box = FAABB(FlatNode.BoundsMin, FlatNode.BoundsMax);
+	Internal.TriangleBaseIndex = -1;
+	const int32 NodeIndex = Nodes.Add(Internal);
+
+	const int32 RightFlatIndex = FlatNode.Offset;
+	const int32 Child1 = ConvertFlatSubtree(FlatIndex + 1, NodeIndex);
+	const int32 Child2 = ConvertFlatSubtree(RightFlatIndex, NodeIndex);
+	Nodes[NodeIndex].Child1 = Child1;
+	Nodes[NodeIndex].Child2 = Child2;
+	return NodeIndex;
+}
+
+int32 FBVH::ConvertFlatLeafRange(int32 First, int32 Count, int32 ParentIndex)
+{
+	// 삼각형 하나짜리 leaf
+	if (Count == 1)
+	{
+		const int32 TriangleBaseIndex = TriangleIndices[First] * 3;
+
+		FNode Leaf;
+		Leaf.ObjectIndex = Nodes.Num();
+		Leaf.ParentIndex = ParentIndex;
+		Leaf.Child1 = -1;
+		Leaf.Child2 = -1;
+		Leaf.bIsLeaf = true;
+		Leaf.Box = GetTriangleAABB(
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex]],
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 1]],
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 2]]);
+		Leaf.TriangleBaseIndex = TriangleBaseIndex;
+		return Nodes.Add(Leaf);
+	}
+
+	// 여러 삼각형을 가진 leaf는 반으로 나눠 이진 서브트리로 변환
+	FNode Internal;
+	Internal.ObjectIndex = Nodes.Num();
+	Internal.ParentIndex = ParentIndex;
+	Internal.bIsLeaf = false;
+	Internal.TriangleBaseIndex = -1;
+	const int32 NodeIndex = Nodes.Add(Internal);
+
+	const int32 HalfCount = Count / 2;
+	const int32 Child1 = ConvertFlatLeafRange(First, HalfCount, NodeIndex);
+	const int32 Child2 = ConvertFlatLeafRange(First + HalfCount, Count - HalfCount, NodeIndex);
+	Nodes[NodeIndex].Child1 = Child1;
+	Nodes[NodeIndex].Child2 = Child2;
+	Nodes[NodeIndex].Box = Union(Nodes[Child1].Box, Nodes[Child2].Box);
+	return NodeIndex;
+}
+
+void FBVH::BuildTriangleSoA()
+{
+	const int32 TriangleCount = TriangleIndices.Num();
+
+	// 마지막 leaf에서도 4개 단위 비정렬 로드가 범위를 벗어나지 않도록 스트림마다 여유 공간을 둔다
+	SoAStride = TriangleCount + (BVH_RAY_PACKET_WIDTH - 1);
+	TriangleSoA.SetNum(SoAStride * SOA_STREAM_COUNT);
+
+	float* Streams = TriangleSoA.GetData();
+	for (int32 Slot = 0; Slot < TriangleCount; ++Slot)
+	{
+		const int32 TriangleBaseIndex = TriangleIndices[Slot] * 3;
+		const FVector& P0 = Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 0]].Position;
+		const FVector Edge1 = Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 1]].Position - P0;
+		const FVector Edge2 = Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 2]].Position - P0;
+
+		const float Values[SOA_STREAM_COUNT] = { P0.X, P0.Y, P0.Z, Edge1.X, Edge1.Y, Edge1.Z, Edge2.X, Edge2.Y, Edge2.Z };
+		for (int32 Stream = 0; Stream < SOA_STREAM_COUNT; ++Stream)
+		{
+			Streams[Stream * SoAStride + Slot] = Values[Stream];
+		}
+	}
+	for (int32 Slot = TriangleCount; Slot < SoAStride; ++Slot)
+	{
+		for (int32 Stream = 0; Stream < SOA_STREAM_COUNT; ++Stream)
+		{
+			Streams[Stream * SoAStride + Slot] = 0.0f;
+		}
+	}
+}
+
+bool FBVH::RaycastClosest(const FRay& Ray, FBVHRayHit& OutHit, float MaxDistance) const
+{
+	OutHit = FBVHRayHit();
+
+	// 동적 트리(편집 중 삼각형 삽입 등)는 후보 삼각형을 모은 뒤 스칼라로 검사
+	if (!IsFlattened())
+	{
+		if (!Mesh)
+		{
+			return false;
+		}
+
+		TArray<int32> Candidates;
+		TraverseRay(Ray, Candidates);
+		OutHit.Distance = MaxDistance;
+		for (int32 TriangleIndex : Candidates)
+		{
+			const int32 TriangleBaseIndex = TriangleIndex * 3;
+			FBVHRayHit Hit;
+			if (IntersectRayTriangle(Ray,
+				Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 0]].Position,
+				Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 1]].Position,
+				Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 2]].Position,
+				OutHit.Distance, Hit))
+			{
+				Hit.TriangleIndex = TriangleIndex;
+				OutHit = Hit;
+			}
+		}
+		return OutHit.IsHit();
+	}
+
+	const __m128 Origin = _mm_setr_ps(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 0.0f);
+	const __m128 InvDirection = _mm_setr_ps(SafeInverse(Ray.Direction.X), SafeInverse(Ray.Direction.Y), SafeInverse(Ray.Direction.Z), 0.0f);
+	const FRay4 Ray4 = SplatRay(Ray);
+	const __m128 LaneIndex = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	const float* Streams = TriangleSoA.GetData();
+
+	float BestDistance = MaxDistance;
+	int32 BestSlot = -1;
+
+	// 노드와 함께 진입 거리를 저장해 두고, 꺼낼 때 이미 찾은 교차보다 멀면 건너뛴다
+	int32 NodeStack[TRAVERSAL_STACK_SIZE];
+	float EntryStack[TRAVERSAL_STACK_SIZE];
+	int32 StackSize = 0;
+
+	float RootEntry;
+	if (!IntersectRayNodeSSE(FlatNodes[0], Origin, InvDirection, BestDistance, RootEntry))
+	{
+		return false;
+	}
+	NodeStack[StackSize] = 0;
+	EntryStack[StackSize++] = RootEntry;
+
+	while (StackSize > 0)
+	{
+		--StackSize;
+		if (EntryStack[StackSize] > BestDistance)
+		{
+			continue;
+		}
+
+		const int32 CurrentNodeIndex = NodeStack[StackSize];
+		const FFlatBVHNode& CurrentNode = FlatNodes[CurrentNodeIndex];
+
+		if (CurrentNode.IsLeaf())
+		{
+			// Leaf의 삼각형은 SoA 상에서 연속이므로 4개씩 로드해 한 번에 검사
+			for (int32 i = 0; i < CurrentNode.TriangleCount; i += BVH_RAY_PACKET_WIDTH)
+			{
+				const int32 Slot = CurrentNode.Offset + i;
+				const FTriangle4 Tri{
+					_mm_loadu_ps(Streams + 0 * SoAStride + Slot), _mm_loadu_ps(Streams + 1 * SoAStride + Slot), _mm_loadu_ps(Streams + 2 * SoAStride + Slot),
+					_mm_loadu_ps(Streams + 3 * SoAStride + Slot), _mm_loadu_ps(Streams + 4 * SoAStride + Slot), _mm_loadu_ps(Streams + 5 * SoAStride + Slot),
+					_mm_loadu_ps(Streams + 6 * SoAStride + Slot), _mm_loadu_ps(Streams + 7 * SoAStride + Slot), _mm_loadu_ps(Streams + 8 * SoAStride + Slot)
+				};
+
+				__m128 Distance, U, V;
+				__m128 HitMask = IntersectRayTriangle4(Ray4, Tri, _mm_set1_ps(BestDistance), Distance, U, V);
+				// leaf 범위를 벗어난 lane 제거
+				HitMask = _mm_and_ps(HitMask, _mm_cmplt_ps(LaneIndex, _mm_set1_ps(static_cast<float>(CurrentNode.TriangleCount - i))));
+
+				const int32 HitBits = _mm_movemask_ps(HitMask);
+				if (HitBits == 0)
+				{
+					continue;
+				}
+
+				alignas(16) float Distances[BVH_RAY_PACKET_WIDTH];
+				alignas(16) float Us[BVH_RAY_PACKET_WIDTH];
+				alignas(16) float Vs[BVH_RAY_PACKET_WIDTH];
+				_mm_store_ps(Distances, Distance);
+				_mm_store_ps(Us, U);
+				_mm_store_ps(Vs, V);
+				for (int32 Lane = 0; Lane < BVH_RAY_PACKET_WIDTH; ++Lane)
+				{
+					if ((HitBits & (1 << Lane)) && Distances[Lane] < BestDistance)
+					{
+						BestDistance = Distances[Lane];
+						BestSlot = Slot + Lane;
+						OutHit.U = Us[Lane];
+						OutHit.V = Vs[Lane];
+					}
+				}
+			}
+		}
+		else
+		{
+			const int32 LeftIndex = CurrentNodeIndex + 1;
+			const int32 RightIndex = CurrentNode.Offset;
+			float LeftEntry, RightEntry;
+			const bool bHitLeft = IntersectRayNodeSSE(FlatNodes[LeftIndex], Origin, InvDirection, BestDistance, LeftEntry);
+			const bool bHitRight = IntersectRayNodeSSE(FlatNodes[RightIndex], Origin, InvDirection, BestDistance, RightEntry);
+
+			// 가까운 자식이 먼저 pop되도록 먼 자식을 먼저 push
+			assert(StackSize + 2 <= TRAVERSAL_STACK_SIZE);
+			if (bHitLeft && bHitRight)
+			{
+				const bool bLeftFirst = LeftEntry <= RightEntry;
+				NodeStack[StackSize] = bLeftFirst ? RightIndex : LeftIndex;
+				EntryStack[StackSize++] = bLeftFirst ? RightEntry : LeftEntry;
+				NodeStack[StackSize] = bLeftFirst ? LeftIndex : RightIndex;
+				EntryStack[StackSize++] = bLeftFirst ? LeftEntry : RightEntry;
+			}
+			else if (bHitLeft)
+			{
+				NodeStack[StackSize] = LeftIndex;
+				EntryStack[StackSize++] = LeftEntry;
+			}
+			else if (bHitRight)
+			{
+				NodeStack[StackSize] = RightIndex;
+				EntryStack[StackSize++] = RightEntry;
+			}
+		}
+	}
+
+	if (BestSlot < 0)
+	{
+		return false;
+	}
+
+	OutHit.TriangleIndex = TriangleIndices[BestSlot];
+	OutHit.Distance = BestDistance;
+	return true;
+}
+
+bool FBVH::RaycastClosestPacket(const FRay* Rays, int32 NumRays, FBVHRayHit* OutHits) const
+{
+	if (!Rays || !OutHits || NumRays <= 0)
+	{
+		return false;
+	}
+
+	bool bAnyHit = false;
+	for (int32 First = 0; First < NumRays; First += BVH_RAY_PACKET_WIDTH)
+	{
+		const int32 PacketSize = std::min(BVH_RAY_PACKET_WIDTH, NumRays - First);
+		if (IsFlattened())
+		{
+			RaycastPacketFlat(Rays + First, PacketSize, OutHits + First);
+		}
+		else
+		{
+			for (int32 i = 0; i < PacketSize; ++i)
+			{
+				RaycastClosest(Rays[First + i], OutHits[First + i]);
+			}
+		}
+
+		for (int32 i = 0; i < PacketSize; ++i)
+		{
+			bAnyHit |= OutHits[First + i].IsHit();
+		}
 	}
+	return bAnyHit;
 }
 
+void FBVH::RaycastPacketFlat(const FRay* Rays, int32 NumRays, FBVHRayHit* OutHits) const
+{
+	// Ray 하나당 lane 하나. 비어 있는 lane은 첫 Ray를 복사하고 Active 마스크로 제외한다
+	alignas(16) float Lanes[9][BVH_RAY_PACKET_WIDTH];
+	for (int32 Lane = 0; Lane < BVH_RAY_PACKET_WIDTH; ++Lane)
+	{
+		const FRay& Ray = Rays[Lane < NumRays ? Lane : 0];
+		Lanes[0][Lane] = Ray.Origin.X;
+		Lanes[1][Lane] = Ray.Origin.Y;
+		Lanes[2][Lane] = Ray.Origin.Z;
+		Lanes[3][Lane] = Ray.Direction.X;
+		Lanes[4][Lane] = Ray.Direction.Y;
+		Lanes[5][Lane] = Ray.Direction.Z;
+		Lanes[6][Lane] = SafeInverse(Ray.Direction.X);
+		Lanes[7][Lane] = SafeInverse(Ray.Direction.Y);
+		Lanes[8][Lane] = SafeInverse(Ray.Direction.Z);
+	}
+
+	const FRay4 Ray4{
+		_mm_load_ps(Lanes[0]), _mm_load_ps(Lanes[1]), _mm_load_ps(Lanes[2]),
+		_mm_load_ps(Lanes[3]), _mm_load_ps(Lanes[4]), _mm_load_ps(Lanes[5])
+	};
+	const __m128 InvDirectionX = _mm_load_ps(Lanes[6]);
+	const __m128 InvDirectionY = _mm_load_ps(Lanes[7]);
+	const __m128 InvDirectionZ = _mm_load_ps(Lanes[8]);
+	const __m128 Active = _mm_cmplt_ps(_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f), _mm_set1_ps(static_cast<float>(NumRays)));
+	const float* Streams = TriangleSoA.GetData();
+
+	__m128 BestDistance = _mm_set1_ps(FLT_MAX);
+	__m128 BestU = _mm_setzero_ps();
+	__m128 BestV = _mm_setzero_ps();
+	__m128i BestSlot = _mm_set1_epi32(-1);
+
+	int32 NodeStack[TRAVERSAL_STACK_SIZE];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const int32 CurrentNodeIndex = NodeStack[--StackSize];
+		const FFlatBVHNode& CurrentNode = FlatNodes[CurrentNodeIndex];
+
+		// 4개 Ray의 slab 검사. 각 Ray의 현재 최단 거리보다 먼 노드는 해당 lane에서 제외된다
+		__m128 T1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMin.X), Ray4.OriginX), InvDirectionX);
+		__m128 T2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMax.X), Ray4.OriginX), InvDirectionX);
+		__m128 Entry = _mm_max_ps(_mm_min_ps(T1, T2), _mm_setzero_ps());
+		__m128 Exit = _mm_min_ps(_mm_max_ps(T1, T2), BestDistance);
+
+		T1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMin.Y), Ray4.OriginY), InvDirectionY);
+		T2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMax.Y), Ray4.OriginY), InvDirectionY);
+		Entry = _mm_max_ps(Entry, _mm_min_ps(T1, T2));
+		Exit = _mm_min_ps(Exit, _mm_max_ps(T1, T2));
+
+		T1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMin.Z), Ray4.OriginZ), InvDirectionZ);
+		T2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(CurrentNode.BoundsMax.Z), Ray4.OriginZ), InvDirectionZ);
+		Entry = _mm_max_ps(Entry, _mm_min_ps(T1, T2));
+		Exit = _mm_min_ps(Exit, _mm_max_ps(T1, T2));
+
+		const __m128 NodeMask = _mm_and_ps(_mm_cmple_ps(Entry, Exit), Active);
+		if (_mm_movemask_ps(NodeMask) == 0)
+		{
+			continue;
+		}
+
+		if (CurrentNode.IsLeaf())
+		{
+			// 삼각형 하나를 4개 lane에 복제해 4개 Ray와 동시에 검사
+			for (int32 i = 0; i < CurrentNode.TriangleCount; ++i)
+			{
+				const int32 Slot = CurrentNode.Offset + i;
+				const FTriangle4 Tri{
+					_mm_set1_ps(Streams[0 * SoAStride + Slot]), _mm_set1_ps(Streams[1 * SoAStride + Slot]), _mm_set1_ps(Streams[2 * SoAStride + Slot]),
+					_mm_set1_ps(Streams[3 * SoAStride + Slot]), _mm_set1_ps(Streams[4 * SoAStride + Slot]), _mm_set1_ps(Streams[5 * SoAStride + Slot]),
+					_mm_set1_ps(Streams[6 * SoAStride + Slot]), _mm_set1_ps(Streams[7 * SoAStride + Slot]), _mm_set1_ps(Streams[8 * SoAStride + Slot])
+				};
+
+				__m128 Distance, U, V;
+				const __m128 HitMask = _mm_and_ps(IntersectRayTriangle4(Ray4, Tri, BestDistance, Distance, U, V), NodeMask);
+				if (_mm_movemask_ps(HitMask) == 0)
+				{
+					continue;
+				}
+
+				BestDistance = Select(HitMask, Distance, BestDistance);
+				BestU = Select(HitMask, U, BestU);
+				BestV = Select(HitMask, V, BestV);
+				const __m128i HitMaskInt = _mm_castps_si128(HitMask);
+				BestSlot = _mm_or_si128(_mm_and_si128(HitMaskInt, _mm_set1_epi32(Slot)), _mm_andnot_si128(HitMaskInt, BestSlot));
+			}
+		}
+		else
+		{
+			// 두 자식 중심이 가장 많이 떨어진 축에서 Ray 방향 쪽에 있는 자식을 먼저 방문
+			const int32 LeftIndex = CurrentNodeIndex + 1;
+			const int32 RightIndex = CurrentNode.Offset;
+			const FFlatBVHNode& Left = FlatNodes[LeftIndex];
+			const FFlatBVHNode& Right = FlatNodes[RightIndex];
+			const FVector CenterDelta = (Right.BoundsMin + Right.BoundsMax) - (Left.BoundsMin + Left.BoundsMax);
+
+			int32 Axis = 0;
+			if (fabs(CenterDelta.Y) > fabs(GetAxis(CenterDelta, Axis)))
+			{
+				Axis = 1;
+			}
+			if (fabs(CenterDelta.Z) > fabs(GetAxis(CenterDelta, Axis)))
+			{
+				Axis = 2;
+			}
+			const int32 NodeBits = _mm_movemask_ps(NodeMask);
+			int32 FirstLane = 0;
+			while (!(NodeBits & (1 << FirstLane)))
+			{
+				++FirstLane;
+			}
+			const bool bLeftFirst = (GetAxis(CenterDelta, Axis) >= 0.0f) == (Lanes[3 + Axis][FirstLane] >= 0.0f);
+
+			assert(StackSize + 2 <= TRAVERSAL_STACK_SIZE);
+			NodeStack[StackSize++] = bLeftFirst ? RightIndex : LeftIndex;
+			NodeStack[StackSize++] = bLeftFirst ? LeftIndex : RightIndex;
+		}
+	}
+
+	alignas(16) float Distances[BVH_RAY_PACKET_WIDTH];
+	alignas(16) float Us[BVH_RAY_PACKET_WIDTH];
+	alignas(16) float Vs[BVH_RAY_PACKET_WIDTH];
+	alignas(16) int32 Slots[BVH_RAY_PACKET_WIDTH];
+	_mm_store_ps(Distances, BestDistance);
+	_mm_store_ps(Us, BestU);
+	_mm_store_ps(Vs, BestV);
+	_mm_store_si128(reinterpret_cast<__m128i*>(Slots), BestSlot);
+
+	for (int32 Lane = 0; Lane < NumRays; ++Lane)
+	{
+		OutHits[Lane] = FBVHRayHit();
+		if (Slots[Lane] >= 0)
+		{
+			OutHits[Lane].TriangleIndex = TriangleIndices[Slots[Lane]];
+			OutHits[Lane].Distance = Distances[Lane];
+			OutHits[Lane].U = Us[Lane];
+			OutHits[Lane].V = Vs[Lane];
+		}
+	}
+}
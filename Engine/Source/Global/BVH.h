@@ -16,6 +16,39 @@ struct FNode
 	int32 TriangleBaseIndex; // 인덱스 버퍼에서 삼각형의 시작 인덱스
 };
 
+/**
+* @brief SAH 빌더가 생성하는 평탄화(depth-first)된 BVH 노드 (32 bytes)
+* @note Internal 노드의 왼쪽 자식은 항상 (자신의 인덱스 + 1)에 위치하므로 오른쪽 자식 인덱스만 저장한다.
+*       Leaf 노드는 TriangleIndices 배열의 [Offset, Offset + TriangleCount) 구간에 있는 삼각형들을 가리킨다.
+*/
+struct FFlatBVHNode
+{
+	FVector BoundsMin;
+	int32 Offset;        // Internal: 오른쪽 자식 노드 인덱스, Leaf: TriangleIndices 내 시작 위치
+	FVector BoundsMax;
+	int32 TriangleCount; // 0이면 Internal 노드
+
+	bool IsLeaf() const { return TriangleCount > 0; }
+};
+static_assert(sizeof(FFlatBVHNode) == 32, "FFlatBVHNode must stay 32 bytes for cache-friendly traversal");
+
+/**
+* @brief Closest-hit Ray 순회 결과
+* @note Distance는 입력 Ray의 파라미터 t이므로 Direction이 정규화되어 있지 않으면 실제 거리와 다르다.
+*/
+struct FBVHRayHit
+{
+	int32 TriangleIndex = -1;  // Triangle ordinal, 교차가 없으면 -1
+	float Distance = FLT_MAX;
+	float U = 0.0f;            // 교차점의 barycentric 좌표 (V1 가중치)
+	float V = 0.0f;            // 교차점의 barycentric 좌표 (V2 가중치)
+
+	bool IsHit() const { return TriangleIndex >= 0; }
+};
+
+// RaycastClosestPacket이 한 번에 순회하는 Ray 수 (SSE lane 수)
+constexpr int32 BVH_RAY_PACKET_WIDTH = 4;
+
 //  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
 class FBVH
 {
@@ -23,7 +56,34 @@ public:
 	FBVH() = default;
 	explicit FBVH(FStaticMesh* InMesh);
 
+	/**
+	* @brief Binned SAH 기반 top-down 빌드. 결과는 평탄화된 노드 배열(FlatNodes)에 저장된다.
+	* @note 삼각형 수가 충분히 많으면 상위 서브트리들을 여러 스레드에서 병렬로 빌드한다.
+	*/
 	void Build(FStaticMesh* InMesh);
+
+	/**
+	* @brief 삼각형을 하나씩 삽입하는 기존 incremental 빌드. (비교 및 편집용)
+	*/
+	void BuildIncremental(FStaticMesh* InMesh);
+
+	/**
+	* @brief 미리 빌드해 둔(쿠킹된) 평탄화 트리로 초기화. SAH 빌드 없이 노드와 삼각형 목록을 그대로 복사한다.
+	* @return 노드/삼각형 인덱스가 메시 범위를 벗어나면 false (트리는 비워짐)
+	*/
+	bool BuildFromFlat(FStaticMesh* InMesh, const FFlatBVHNode* InNodes, int32 InNodeCount, const int32* InTriangleIndices, int32 InTriangleCount);
+
+	/**
+	* @brief 편집 등으로 삼각형을 트리에 추가. 평탄화된 트리라면 동적 트리로 변환한 뒤 삽입한다.
+	* @param InTriangleBaseIndex: 인덱스 버퍼에서 삼각형의 시작 인덱스
+	* @return 삽입된 leaf node의 인덱스, 실패 시 -1 반환
+	*/
+	int32 InsertTriangle(int32 InTriangleBaseIndex);
+
+	bool IsFlattened() const { return !FlatNodes.IsEmpty(); }
+	const TArray<FFlatBVHNode>& GetFlatNodes() const { return FlatNodes; }
+	const TArray<int32>& GetTriangleIndices() const { return TriangleIndices; }
+
 	int32 GetRootIndex() const { return RootIndex; }
 	int32 GetNodeCount() const { return Nodes.Num(); }
 	const FNode& GetNode(int32 Index) const;
@@ -38,6 +98,18 @@ public:
 	*/
 	float GetCost(int32 SubTreeRootIndex, bool bInternalOnly = false) const;
 
+	/**
+	* @brief 평탄화된 트리의 cost(노드가 가진 AABB의 표면적 합)를 계산. GetCost(RootIndex)와 같은 기준.
+	* @param bInternalOnly: true로 설정하면 leaf의 코스트는 포함 안시킴
+	*/
+	float GetFlatCost(bool bInternalOnly = false) const;
+
+	/**
+	* @brief 루트 표면적으로 정규화한 SAH 기대 비용 (Internal: 순회 비용, Leaf: 삼각형 수 * 교차 비용)
+	* @note 동적 트리(leaf당 삼각형 1개)와 평탄화된 트리(leaf당 여러 개)를 같은 기준으로 비교할 수 있다.
+	*/
+	float GetSAHCost() const;
+
 	/**
 	* @brief: 트리의 유효성 검사.
 	*/
@@ -51,6 +123,28 @@ public:
 	*/
 	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
 
+	/**
+	* @brief: Ray와 가장 가까운 삼각형 하나를 찾는 closest-hit 순회
+	* @note 평탄화된 트리에서는 가까운 자식부터 방문하고 현재 최단 거리보다 먼 노드는 건너뛰며,
+	*       Leaf의 삼각형들은 SSE로 4개씩 Möller–Trumbore 교차 검사한다.
+	* @param Ray: 교차 검사를 수행할 Ray (Local 좌표계)
+	* @param OutHit: 가장 가까운 교차 결과 (output)
+	* @param MaxDistance: 이보다 먼 교차는 무시
+	* @return: 교차하는 삼각형이 있으면 true, 없으면 false
+	*/
+	bool RaycastClosest(const FRay& Ray, FBVHRayHit& OutHit, float MaxDistance = FLT_MAX) const;
+
+	/**
+	* @brief: 여러 Ray를 BVH_RAY_PACKET_WIDTH개씩 묶어 한 번에 순회하는 closest-hit 검사
+	* @note 박스 선택이나 CPU 측 probe처럼 비슷한 방향의 Ray를 다수(예: 4x4 격자) 쏘는 경우를 위한 API.
+	*       평탄화되지 않은 트리에서는 Ray마다 RaycastClosest를 호출한다.
+	* @param Rays: 교차 검사를 수행할 Ray 배열 (Local 좌표계)
+	* @param NumRays: Ray 개수
+	* @param OutHits: Ray마다의 closest-hit 결과 (NumRays 크기, output)
+	* @return: 하나 이상의 Ray가 교차하면 true
+	*/
+	bool RaycastClosestPacket(const FRay* Rays, int32 NumRays, FBVHRayHit* OutHits) const;
+
 	/**
 	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
 	* @param CandidateIndex: 후보 형제 노드 인덱스
@@ -76,8 +170,25 @@ private:
 	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
 	void RefitAncestors(int32 RefitStartIndex);
 
+	// --- 평탄화된 트리 보조 메소드들 ---
+
+	//@brief 평탄화된 트리를 Ray로 순회
+	bool TraverseRayFlat(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
+	//@brief 평탄화된 트리를 최대 BVH_RAY_PACKET_WIDTH개의 Ray로 동시에 순회
+	void RaycastPacketFlat(const FRay* Rays, int32 NumRays, FBVHRayHit* OutHits) const;
+	//@brief Leaf 순서대로 정렬된 SoA 삼각형 데이터(TriangleSoA) 생성
+	void BuildTriangleSoA();
+	//@brief 평탄화된 트리를 incremental 삽입이 가능한 동적 트리(Nodes)로 변환
+	void ConvertFlatToDynamic();
+	int32 ConvertFlatSubtree(int32 FlatIndex, int32 ParentIndex);
+	int32 ConvertFlatLeafRange(int32 First, int32 Count, int32 ParentIndex);
+
 	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
 	TArray<FNode> Nodes;
+	TArray<FFlatBVHNode> FlatNodes;   // SAH 빌드 결과 (루트는 항상 0번)
+	TArray<int32> TriangleIndices;    // Leaf 구간이 가리키는 삼각형 번호(Triangle ordinal) 목록
+	TArray<float> TriangleSoA;        // TriangleIndices 순서의 V0, Edge1, Edge2 (xyz 9개 스트림, 각 스트림은 SoAStride 간격)
+	int32 SoAStride = 0;
 	int32 RootIndex = -1;
 	float Cost = 0.0f;
 };
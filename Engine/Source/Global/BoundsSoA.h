@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+
+constexpr int32 BOUNDS_SOA_BATCH = 4; // SSE 레지스터 하나에 들어가는 박스 수
+
+/**
+* @brief AABB의 중심과 반 크기를 축마다 따로 모은 배열 (Structure of Arrays)
+* @note 절두체 컬링이 박스 4개를 SSE 명령 하나로 검사할 수 있도록 FOctree와 FDynamicAABBTree가 원소 풀과 같은 인덱스로 유지한다.
+*       길이는 항상 BOUNDS_SOA_BATCH의 배수이므로 마지막 묶음도 범위를 넘지 않고 읽을 수 있다.
+*       슬롯이 사용 중인지는 이 배열이 아니라 소유한 트리가 판단한다.
+*/
+struct FBoundsSoA
+{
+	TArray<float> CenterX;
+	TArray<float> CenterY;
+	TArray<float> CenterZ;
+	TArray<float> ExtentX;
+	TArray<float> ExtentY;
+	TArray<float> ExtentZ;
+
+	int32 Num() const { return CenterX.Num(); }
+
+	//@brief 인덱스 InCount - 1까지 쓸 수 있도록 BOUNDS_SOA_BATCH 단위로 늘린다
+	void Grow(int32 InCount)
+	{
+		const int32 PaddedCount = (InCount + BOUNDS_SOA_BATCH - 1) / BOUNDS_SOA_BATCH * BOUNDS_SOA_BATCH;
+		if (PaddedCount <= Num())
+		{
+			return;
+		}
+
+		CenterX.SetNum(PaddedCount, 0.0f);
+		CenterY.SetNum(PaddedCount, 0.0f);
+		CenterZ.SetNum(PaddedCount, 0.0f);
+		ExtentX.SetNum(PaddedCount, 0.0f);
+		ExtentY.SetNum(PaddedCount, 0.0f);
+		ExtentZ.SetNum(PaddedCount, 0.0f);
+	}
+
+	void Set(int32 Index, const FAABB& InBounds)
+	{
+		CenterX[Index] = (InBounds.Min.X + InBounds.Max.X) * 0.5f;
+		CenterY[Index] = (InBounds.Min.Y + InBounds.Max.Y) * 0.5f;
+		CenterZ[Index] = (InBounds.Min.Z + InBounds.Max.Z) * 0.5f;
+		ExtentX[Index] = (InBounds.Max.X - InBounds.Min.X) * 0.5f;
+		ExtentY[Index] = (InBounds.Max.Y - InBounds.Min.Y) * 0.5f;
+		ExtentZ[Index] = (InBounds.Max.Z - InBounds.Min.Z) * 0.5f;
+	}
+
+	FAABB Get(int32 Index) const
+	{
+		const FVector Center(CenterX[Index], CenterY[Index], CenterZ[Index]);
+		const FVector Extent(ExtentX[Index], ExtentY[Index], ExtentZ[Index]);
+		return FAABB(Center - Extent, Center + Extent);
+	}
+
+	void Empty()
+	{
+		CenterX.Empty();
+		CenterY.Empty();
+		CenterZ.Empty();
+		ExtentX.Empty();
+		ExtentY.Empty();
+		ExtentZ.Empty();
+	}
+};
@@ -48,6 +48,31 @@ struct FNormalVertex
 	FVector4 Tangent;  // XYZ: Tangent, W: Handedness(+1/-1)
 };
 
+/**
+ * @brief 쿠킹 파일에 저장하는 압축 정점 (18 bytes, FNormalVertex는 80 bytes)
+ * @note FVertexQuantizer로 인코딩/디코딩한다. 정점 색은 별도 RGBA8 스트림에 두거나 모두 같으면 생략한다.
+ */
+struct FCompressedVertex
+{
+	uint16 Position[3];  // 메시 AABB 기준 UNORM16
+	uint16 TexCoord[2];  // 메시 UV 범위 기준 UNORM16
+	int16 Normal[2];     // octahedral SNORM16
+	int16 Tangent[2];    // octahedral SNORM16, Tangent[1]의 최하위 비트는 handedness (1이면 -1)
+};
+
+/**
+ * @brief FCompressedVertex를 풀기 위한 메시 단위 값
+ */
+struct FVertexQuantization
+{
+	FVector PositionMin;
+	FVector PositionStep;      // UNORM16 한 단계의 크기 (축마다 AABB 크기 / 65535)
+	FVector2 TexCoordMin;
+	FVector2 TexCoordStep;     // UV도 위치와 같이 메시의 UV 범위를 65535 단계로 나눈다
+	FVector4 ConstantColor;    // 정점 색 스트림을 생략했을 때 모든 정점의 색
+	uint32 bHasVertexColors = 0;
+};
+
 struct FRay
 {
 	FVector4 Origin;
@@ -0,0 +1,429 @@
+#include "pch.h"
+#include "Global/DynamicAABBTree.h"
+
+int32 FDynamicAABBTree::CreateProxy(UPrimitiveComponent* InPrimitive, const FAABB& InBounds)
+{
+	const int32 LeafIndex = AllocateNode();
+	FDynamicTreeNode& Leaf = Nodes[LeafIndex];
+	Leaf.Bounds = FattenBounds(InBounds);
+	Leaf.Primitive = InPrimitive;
+	Leaf.Height = 0;
+	ProxyBounds.Set(LeafIndex, InBounds);
+
+	InsertLeaf(LeafIndex);
+	++ProxyCount;
+	return LeafIndex;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+	assert(ProxyId >= 0 && ProxyId < Nodes.Num() && Nodes[ProxyId].IsLeaf() && Nodes[ProxyId].Height == 0);
+
+	RemoveLeaf(ProxyId);
+	FreeNode(ProxyId);
+	--ProxyCount;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FAABB& InBounds)
+{
+	assert(ProxyId >= 0 && ProxyId < Nodes.Num() && Nodes[ProxyId].IsLeaf() && Nodes[ProxyId].Height == 0);
+
+	// 트리 재배치 여부와 관계없이 컬링은 실제 AABB로 검사한다
+	ProxyBounds.Set(ProxyId, InBounds);
+
+	const FAABB& FatBounds = Nodes[ProxyId].Bounds;
+	if (FatBounds.IsContains(InBounds))
+	{
+		// 오브젝트가 크게 줄어든 경우 fat AABB가 불필요하게 커진 채로 남지 않도록 재삽입한다
+		const FVector HugeMargin = (FattenBounds(InBounds).Max - InBounds.Max) * DYNAMIC_TREE_HUGE_AABB_MULTIPLIER;
+		const FAABB HugeBounds(InBounds.Min - HugeMargin, InBounds.Max + HugeMargin);
+		if (HugeBounds.IsContains(FatBounds))
+		{
+			return false;
+		}
+	}
+
+	RemoveLeaf(ProxyId);
+	Nodes[ProxyId].Bounds = FattenBounds(InBounds);
+	InsertLeaf(ProxyId);
+	return true;
+}
+
+void FDynamicAABBTree::Clear()
+{
+	Nodes.Empty();
+	ProxyBounds.Empty();
+	RootIndex = -1;
+	FreeListHead = -1;
+	FreeNodeCount = 0;
+	ProxyCount = 0;
+}
+
+void FDynamicAABBTree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const
+{
+	if (RootIndex < 0)
+	{
+		return;
+	}
+
+	int32 NodeStack[DYNAMIC_TREE_MAX_STACK];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = RootIndex;
+
+	while (StackSize > 0)
+	{
+		const FDynamicTreeNode& Node = Nodes[NodeStack[--StackSize]];
+		if (!Node.Bounds.IsIntersected(QueryBox))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			OutResults.Add(Node.Primitive);
+		}
+		else
+		{
+			assert(StackSize + 2 <= DYNAMIC_TREE_MAX_STACK);
+			NodeStack[StackSize++] = Node.Child2;
+			NodeStack[StackSize++] = Node.Child1;
+		}
+	}
+}
+
+bool FDynamicAABBTree::CheckValidity() const
+{
+	if (RootIndex < 0)
+	{
+		return ProxyCount == 0;
+	}
+	if (Nodes[RootIndex].Parent != -1)
+	{
+		return false;
+	}
+
+	int32 FreeCount = 0;
+	for (int32 FreeIndex = FreeListHead; FreeIndex >= 0; FreeIndex = Nodes[FreeIndex].Parent)
+	{
+		++FreeCount;
+	}
+	if (FreeCount != FreeNodeCount)
+	{
+		return false;
+	}
+
+	return CheckSubtree(RootIndex);
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	if (FreeListHead < 0)
+	{
+		const int32 NodeIndex = Nodes.Add(FDynamicTreeNode());
+		ProxyBounds.Grow(Nodes.Num());
+		return NodeIndex;
+	}
+
+	const int32 NodeIndex = FreeListHead;
+	FreeListHead = Nodes[NodeIndex].Parent;
+	--FreeNodeCount;
+
+	Nodes[NodeIndex] = FDynamicTreeNode();
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeIndex)
+{
+	FDynamicTreeNode& Node = Nodes[NodeIndex];
+	Node.Primitive = nullptr;
+	Node.Child1 = -1;
+	Node.Child2 = -1;
+	Node.Height = -1;
+	Node.Parent = FreeListHead;
+	FreeListHead = NodeIndex;
+	++FreeNodeCount;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 LeafIndex)
+{
+	if (RootIndex < 0)
+	{
+		RootIndex = LeafIndex;
+		Nodes[LeafIndex].Parent = -1;
+		return;
+	}
+
+	// 새 leaf를 형제로 붙였을 때 증가하는 표면적이 가장 작은 노드를 찾는다
+	const FAABB LeafBounds = Nodes[LeafIndex].Bounds;
+	int32 Index = RootIndex;
+	while (!Nodes[Index].IsLeaf())
+	{
+		const FDynamicTreeNode& Node = Nodes[Index];
+		const float Area = Node.Bounds.GetSurfaceArea();
+		const float CombinedArea = Union(Node.Bounds, LeafBounds).GetSurfaceArea();
+
+		// 이 노드를 형제로 삼는 비용과, 더 내려갈 때 조상들이 떠안는 최소 비용
+		const float Cost = 2.0f * CombinedArea;
+		const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+		auto DescendCost = [&](int32 ChildIndex)
+		{
+			const FDynamicTreeNode& Child = Nodes[ChildIndex];
+			const float ChildCombinedArea = Union(Child.Bounds, LeafBounds).GetSurfaceArea();
+			if (Child.IsLeaf())
+			{
+				return ChildCombinedArea + InheritanceCost;
+			}
+			return ChildCombinedArea - Child.Bounds.GetSurfaceArea() + InheritanceCost;
+		};
+
+		const float Cost1 = DescendCost(Node.Child1);
+		const float Cost2 = DescendCost(Node.Child2);
+
+		if (Cost < Cost1 && Cost < Cost2)
+		{
+			break;
+		}
+		Index = (Cost1 < Cost2) ? Node.Child1 : Node.Child2;
+	}
+
+	const int32 SiblingIndex = Index;
+	const int32 OldParentIndex = Nodes[SiblingIndex].Parent;
+
+	// AllocateNode가 Nodes를 재할당할 수 있으므로 참조는 할당 이후에 얻는다
+	const int32 NewParentIndex = AllocateNode();
+	FDynamicTreeNode& NewParent = Nodes[NewParentIndex];
+	NewParent.Parent = OldParentIndex;
+	NewParent.Bounds = Union(LeafBounds, Nodes[SiblingIndex].Bounds);
+	NewParent.Height = Nodes[SiblingIndex].Height + 1;
+	NewParent.Child1 = SiblingIndex;
+	NewParent.Child2 = LeafIndex;
+	Nodes[SiblingIndex].Parent = NewParentIndex;
+	Nodes[LeafIndex].Parent = NewParentIndex;
+
+	if (OldParentIndex >= 0)
+	{
+		FDynamicTreeNode& OldParent = Nodes[OldParentIndex];
+		if (OldParent.Child1 == SiblingIndex)
+		{
+			OldParent.Child1 = NewParentIndex;
+		}
+		else
+		{
+			OldParent.Child2 = NewParentIndex;
+		}
+	}
+	else
+	{
+		RootIndex = NewParentIndex;
+	}
+
+	RefitAncestors(NewParentIndex);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 LeafIndex)
+{
+	if (LeafIndex == RootIndex)
+	{
+		RootIndex = -1;
+		return;
+	}
+
+	const int32 ParentIndex = Nodes[LeafIndex].Parent;
+	const int32 GrandParentIndex = Nodes[ParentIndex].Parent;
+	const int32 SiblingIndex = (Nodes[ParentIndex].Child1 == LeafIndex) ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+	// 부모 노드를 없애고 형제를 조부모에 직접 연결
+	if (GrandParentIndex >= 0)
+	{
+		FDynamicTreeNode& GrandParent = Nodes[GrandParentIndex];
+		if (GrandParent.Child1 == ParentIndex)
+		{
+			GrandParent.Child1 = SiblingIndex;
+		}
+		else
+		{
+			GrandParent.Child2 = SiblingIndex;
+		}
+		Nodes[SiblingIndex].Parent = GrandParentIndex;
+		FreeNode(ParentIndex);
+
+		RefitAncestors(GrandParentIndex);
+	}
+	else
+	{
+		RootIndex = SiblingIndex;
+		Nodes[SiblingIndex].Parent = -1;
+		FreeNode(ParentIndex);
+	}
+
+	Nodes[LeafIndex].Parent = -1;
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 NodeIndex)
+{
+	int32 Index = NodeIndex;
+	while (Index >= 0)
+	{
+		Index = Balance(Index);
+
+		FDynamicTreeNode& Node = Nodes[Index];
+		const FDynamicTreeNode& Child1 = Nodes[Node.Child1];
+		const FDynamicTreeNode& Child2 = Nodes[Node.Child2];
+		Node.Height = 1 + std::max(Child1.Height, Child2.Height);
+		Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+
+		Index = Node.Parent;
+	}
+}
+
+int32 FDynamicAABBTree::Balance(int32 NodeIndex)
+{
+	const int32 IndexA = NodeIndex;
+	FDynamicTreeNode& A = Nodes[IndexA];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return IndexA;
+	}
+
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	FDynamicTreeNode& B = Nodes[IndexB];
+	FDynamicTreeNode& C = Nodes[IndexC];
+
+	const int32 BalanceFactor = C.Height - B.Height;
+
+	// 회전으로 올라가는 노드(Up)가 A의 자리를 차지하도록 A 부모의 자식 링크를 갱신
+	auto ReplaceInParent = [this](int32 UpIndex, int32 OldIndex)
+	{
+		const int32 ParentIndex = Nodes[UpIndex].Parent;
+		if (ParentIndex < 0)
+		{
+			RootIndex = UpIndex;
+			return;
+		}
+
+		FDynamicTreeNode& Parent = Nodes[ParentIndex];
+		if (Parent.Child1 == OldIndex)
+		{
+			Parent.Child1 = UpIndex;
+		}
+		else
+		{
+			assert(Parent.Child2 == OldIndex);
+			Parent.Child2 = UpIndex;
+		}
+	};
+
+	// C를 위로 회전
+	if (BalanceFactor > 1)
+	{
+		const int32 IndexF = C.Child1;
+		const int32 IndexG = C.Child2;
+		FDynamicTreeNode& F = Nodes[IndexF];
+		FDynamicTreeNode& G = Nodes[IndexG];
+
+		C.Child1 = IndexA;
+		C.Parent = A.Parent;
+		A.Parent = IndexC;
+		ReplaceInParent(IndexC, IndexA);
+
+		// F, G 중 높은 쪽을 C에 남기고 낮은 쪽을 A로 내린다
+		if (F.Height > G.Height)
+		{
+			C.Child2 = IndexF;
+			A.Child2 = IndexG;
+			G.Parent = IndexA;
+			A.Bounds = Union(B.Bounds, G.Bounds);
+			C.Bounds = Union(A.Bounds, F.Bounds);
+			A.Height = 1 + std::max(B.Height, G.Height);
+			C.Height = 1 + std::max(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2 = IndexG;
+			A.Child2 = IndexF;
+			F.Parent = IndexA;
+			A.Bounds = Union(B.Bounds, F.Bounds);
+			C.Bounds = Union(A.Bounds, G.Bounds);
+			A.Height = 1 + std::max(B.Height, F.Height);
+			C.Height = 1 + std::max(A.Height, G.Height);
+		}
+		return IndexC;
+	}
+
+	// B를 위로 회전
+	if (BalanceFactor < -1)
+	{
+		const int32 IndexD = B.Child1;
+		const int32 IndexE = B.Child2;
+		FDynamicTreeNode& D = Nodes[IndexD];
+		FDynamicTreeNode& E = Nodes[IndexE];
+
+		B.Child1 = IndexA;
+		B.Parent = A.Parent;
+		A.Parent = IndexB;
+		ReplaceInParent(IndexB, IndexA);
+
+		if (D.Height > E.Height)
+		{
+			B.Child2 = IndexD;
+			A.Child1 = IndexE;
+			E.Parent = IndexA;
+			A.Bounds = Union(C.Bounds, E.Bounds);
+			B.Bounds = Union(A.Bounds, D.Bounds);
+			A.Height = 1 + std::max(C.Height, E.Height);
+			B.Height = 1 + std::max(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2 = IndexE;
+			A.Child1 = IndexD;
+			D.Parent = IndexA;
+			A.Bounds = Union(C.Bounds, D.Bounds);
+			B.Bounds = Union(A.Bounds, E.Bounds);
+			A.Height = 1 + std::max(C.Height, D.Height);
+			B.Height = 1 + std::max(A.Height, E.Height);
+		}
+		return IndexB;
+	}
+
+	return IndexA;
+}
+
+FAABB FDynamicAABBTree::FattenBounds(const FAABB& InBounds)
+{
+	const FVector Extent = InBounds.Max - InBounds.Min;
+	const FVector Margin(
+		std::max(Extent.X * DYNAMIC_TREE_AABB_MARGIN_RATIO, DYNAMIC_TREE_MIN_AABB_MARGIN),
+		std::max(Extent.Y * DYNAMIC_TREE_AABB_MARGIN_RATIO, DYNAMIC_TREE_MIN_AABB_MARGIN),
+		std::max(Extent.Z * DYNAMIC_TREE_AABB_MARGIN_RATIO, DYNAMIC_TREE_MIN_AABB_MARGIN)
+	);
+	return FAABB(InBounds.Min - Margin, InBounds.Max + Margin);
+}
+
+bool FDynamicAABBTree::CheckSubtree(int32 NodeIndex) const
+{
+	const FDynamicTreeNode& Node = Nodes[NodeIndex];
+	if (Node.IsLeaf())
+	{
+		return Node.Height == 0 && Node.Child2 < 0 && Node.Primitive != nullptr;
+	}
+
+	const FDynamicTreeNode& Child1 = Nodes[Node.Child1];
+	const FDynamicTreeNode& Child2 = Nodes[Node.Child2];
+	if (Child1.Parent != NodeIndex || Child2.Parent != NodeIndex)
+	{
+		return false;
+	}
+	if (Node.Height != 1 + std::max(Child1.Height, Child2.Height))
+	{
+		return false;
+	}
+	if (!Node.Bounds.IsContains(Child1.Bounds) || !Node.Bounds.IsContains(Child2.Bounds))
+	{
+		return false;
+	}
+
+	return CheckSubtree(Node.Child1) && CheckSubtree(Node.Child2);
+}
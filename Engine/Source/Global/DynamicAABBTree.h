@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+#include "Global/Octree.h"
+
+class UPrimitiveComponent;
+
+constexpr float DYNAMIC_TREE_AABB_MARGIN_RATIO = 0.1f;   // fat AABB 여유 = 축 길이 * 비율
+constexpr float DYNAMIC_TREE_MIN_AABB_MARGIN = 0.05f;    // 얇은 프리미티브를 위한 최소 여유
+constexpr float DYNAMIC_TREE_HUGE_AABB_MULTIPLIER = 4.0f; // fat AABB가 (여유 * 배수)보다 커지면 재삽입해 줄임
+constexpr int32 DYNAMIC_TREE_MAX_STACK = 256;
+
+/**
+* @brief FDynamicAABBTree의 노드
+* @note Leaf는 프리미티브 하나(proxy)를 가지며 Bounds는 여유를 둔 fat AABB이다.
+*       해제된 노드에서는 Parent가 free list의 다음 노드를 가리키고 Height는 -1이다.
+*/
+struct FDynamicTreeNode
+{
+	FAABB Bounds;
+	UPrimitiveComponent* Primitive = nullptr;
+	int32 Parent = -1;
+	int32 Child1 = -1;
+	int32 Child2 = -1;
+	int32 Height = -1;                 // leaf 0, 해제된 노드 -1
+
+	bool IsLeaf() const { return Child1 < 0; }
+};
+
+/**
+* @brief 움직이는 프리미티브를 위한 incremental AABB 트리 (Box2D b2DynamicTree 방식)
+* @note 각 프리미티브는 fat AABB를 가진 leaf(proxy)로 저장되며, 실제 AABB가 fat AABB를 벗어났을 때만
+*       leaf를 제거 후 재삽입한다. 삽입 위치는 표면적 비용으로 고르고, 회전(rotation)으로 높이 균형을 유지한다.
+*       Proxy ID는 leaf 노드 인덱스이며 프리미티브가 제거될 때까지 변하지 않는다.
+*/
+class FDynamicAABBTree
+{
+public:
+	FDynamicAABBTree() = default;
+	~FDynamicAABBTree() = default;
+
+	//@return 새 proxy ID
+	int32 CreateProxy(UPrimitiveComponent* InPrimitive, const FAABB& InBounds);
+	void DestroyProxy(int32 ProxyId);
+
+	/**
+	* @brief Proxy의 AABB를 갱신
+	* @return 실제 AABB가 fat AABB를 벗어나 트리에서 재배치되었으면 true
+	*/
+	bool MoveProxy(int32 ProxyId, const FAABB& InBounds);
+
+	void Clear();
+
+	UPrimitiveComponent* GetPrimitive(int32 ProxyId) const { return Nodes[ProxyId].Primitive; }
+	const FAABB& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+	// TFrameArray 등 다른 할당 정책의 배열로도 받을 수 있다
+	template <typename AllocatorType>
+	void GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const;
+	// 배열로 복사하지 않고 leaf 노드를 제자리에서 훑으며 Function(UPrimitiveComponent*) 호출
+	template <typename FunctionType>
+	void ForEachPrimitive(FunctionType&& Function) const;
+
+	// fat AABB가 QueryBox와 겹치는 프리미티브를 모두 추가
+	void QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const;
+
+	/**
+	* @brief FOctree::Traverse와 같은 형태의 가지치기 순회
+	* @param NodeVisitor: EOctreeVisit(const FAABB& NodeBounds), Internal 노드마다 호출
+	* @param ElementVisitor: void(UPrimitiveComponent* Primitive, const FAABB& FatBounds, bool bAcceptedByNode)
+	*/
+	template <typename NodeVisitorType, typename ElementVisitorType>
+	void Traverse(NodeVisitorType&& NodeVisitor, ElementVisitorType&& ElementVisitor) const;
+
+	/**
+	* @brief FOctree::ClassifyElements와 같이 여러 뷰의 노드 분류를 한 번의 순회로 수행하고 proxy ID마다 뷰 비트 마스크를 기록
+	* @param NodeClassifier: void(const FAABB& NodeBounds, uint32& InOutTestMask, uint32& InOutAcceptMask), Internal 노드마다 호출
+	*/
+	template <typename NodeClassifierType>
+	void ClassifyProxies(uint32 InViewMask, NodeClassifierType&& NodeClassifier,
+		TArray<uint32>& OutTestMasks, TArray<uint32>& OutAcceptMasks) const;
+
+	// proxy ID와 같은 인덱스의 실제 World AABB (fat AABB가 아님, SoA). leaf가 아닌 노드의 값은 의미가 없다
+	const FBoundsSoA& GetProxyBounds() const { return ProxyBounds; }
+
+	int32 GetProxyCount() const { return ProxyCount; }
+	int32 GetNodeCount() const { return Nodes.Num() - FreeNodeCount; }
+	// 루트의 높이 (leaf만 있으면 0, 비어 있으면 -1)
+	int32 GetHeight() const { return RootIndex < 0 ? -1 : Nodes[RootIndex].Height; }
+
+	/**
+	* @brief: 부모/자식 연결, 높이, AABB 포함 관계의 유효성 검사.
+	*/
+	bool CheckValidity() const;
+
+private:
+	int32 AllocateNode();
+	void FreeNode(int32 NodeIndex);
+
+	void InsertLeaf(int32 LeafIndex);
+	void RemoveLeaf(int32 LeafIndex);
+
+	//@brief 주어진 노드부터 루트까지 올라가며 회전으로 균형을 맞추고 AABB와 높이를 갱신
+	void RefitAncestors(int32 NodeIndex);
+	//@brief 자식 높이 차가 1보다 크면 높은 쪽 자식을 위로 회전. 서브트리의 새 루트 인덱스 반환
+	int32 Balance(int32 NodeIndex);
+
+	static FAABB FattenBounds(const FAABB& InBounds);
+
+	bool CheckSubtree(int32 NodeIndex) const;
+
+	TArray<FDynamicTreeNode> Nodes;
+	FBoundsSoA ProxyBounds;            // 마지막으로 받은 실제 AABB (컬링용)
+	int32 RootIndex = -1;
+	int32 FreeListHead = -1;
+	int32 FreeNodeCount = 0;
+	int32 ProxyCount = 0;
+};
+
+template <typename AllocatorType>
+void FDynamicAABBTree::GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const
+{
+	OutPrimitives.Reserve(OutPrimitives.Num() + ProxyCount);
+	ForEachPrimitive([&OutPrimitives](UPrimitiveComponent* Primitive) { OutPrimitives.Add(Primitive); });
+}
+
+template <typename FunctionType>
+void FDynamicAABBTree::ForEachPrimitive(FunctionType&& Function) const
+{
+	for (const FDynamicTreeNode& Node : Nodes)
+	{
+		if (Node.Height == 0)
+		{
+			Function(Node.Primitive);
+		}
+	}
+}
+
+template <typename NodeVisitorType, typename ElementVisitorType>
+void FDynamicAABBTree::Traverse(NodeVisitorType&& NodeVisitor, ElementVisitorType&& ElementVisitor) const
+{
+	if (RootIndex < 0)
+	{
+		return;
+	}
+
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		bool bAccepted;
+	};
+	FStackEntry NodeStack[DYNAMIC_TREE_MAX_STACK];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = { RootIndex, false };
+
+	while (StackSize > 0)
+	{
+		const FStackEntry Entry = NodeStack[--StackSize];
+		const FDynamicTreeNode& Node = Nodes[Entry.NodeIndex];
+
+		if (Node.IsLeaf())
+		{
+			ElementVisitor(Node.Primitive, Node.Bounds, Entry.bAccepted);
+			continue;
+		}
+
+		bool bAccepted = Entry.bAccepted;
+		if (!bAccepted)
+		{
+			const EOctreeVisit Visit = NodeVisitor(Node.Bounds);
+			if (Visit == EOctreeVisit::Skip)
+			{
+				continue;
+			}
+			bAccepted = (Visit == EOctreeVisit::VisitAll);
+		}
+
+		// 균형 트리이므로 높이가 스택 한도에 도달하는 일은 사실상 없다
+		assert(StackSize + 2 <= DYNAMIC_TREE_MAX_STACK);
+		NodeStack[StackSize++] = { Node.Child2, bAccepted };
+		NodeStack[StackSize++] = { Node.Child1, bAccepted };
+	}
+}
+
+template <typename NodeClassifierType>
+void FDynamicAABBTree::ClassifyProxies(uint32 InViewMask, NodeClassifierType&& NodeClassifier,
+	TArray<uint32>& OutTestMasks, TArray<uint32>& OutAcceptMasks) const
+{
+	OutTestMasks.SetNum(ProxyBounds.Num());
+	OutAcceptMasks.SetNum(ProxyBounds.Num());
+	std::fill(OutTestMasks.begin(), OutTestMasks.end(), 0u);
+	std::fill(OutAcceptMasks.begin(), OutAcceptMasks.end(), 0u);
+	if (InViewMask == 0 || RootIndex < 0)
+	{
+		return;
+	}
+
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		uint32 TestMask;
+		uint32 AcceptMask;
+	};
+	FStackEntry NodeStack[DYNAMIC_TREE_MAX_STACK];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = { RootIndex, InViewMask, 0u };
+
+	while (StackSize > 0)
+	{
+		FStackEntry Entry = NodeStack[--StackSize];
+		const FDynamicTreeNode& Node = Nodes[Entry.NodeIndex];
+
+		if (Node.IsLeaf())
+		{
+			OutTestMasks[Entry.NodeIndex] = Entry.TestMask;
+			OutAcceptMasks[Entry.NodeIndex] = Entry.AcceptMask;
+			continue;
+		}
+
+		if (Entry.TestMask != 0)
+		{
+			NodeClassifier(Node.Bounds, Entry.TestMask, Entry.AcceptMask);
+			if ((Entry.TestMask | Entry.AcceptMask) == 0)
+			{
+				continue;
+			}
+		}
+
+		assert(StackSize + 2 <= DYNAMIC_TREE_MAX_STACK);
+		NodeStack[StackSize++] = { Node.Child2, Entry.TestMask, Entry.AcceptMask };
+		NodeStack[StackSize++] = { Node.Child1, Entry.TestMask, Entry.AcceptMask };
+	}
+}
@@ -12,6 +12,7 @@ using std::memory_order_relaxed;
 
 atomic<uint32> TotalAllocationBytes = 0;
 atomic<uint32> TotalAllocationCount = 0;
+atomic<uint64> CumulativeAllocationCount = 0;
 
 #ifdef _DEBUG
 #include <unordered_map>
@@ -150,6 +151,7 @@ void ShutdownMemoryTracking()
 void* operator new(size_t InSize)
 {
 	TotalAllocationCount.fetch_add(1, memory_order_relaxed);
+	CumulativeAllocationCount.fetch_add(1, memory_order_relaxed);
 	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), memory_order_relaxed);
 
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
@@ -275,6 +277,7 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 	size_t Alignment = static_cast<size_t>(InAlignment);
 
 	TotalAllocationCount.fetch_add(1, memory_order_relaxed);
+	CumulativeAllocationCount.fetch_add(1, memory_order_relaxed);
 	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), memory_order_relaxed);
 
 	// 수동 정렬: [RawMemoryPtr ... void*(원본주소) ... AllocHeader ... padding ... AlignedDataPtr]
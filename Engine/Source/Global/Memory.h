@@ -4,6 +4,8 @@
 
 extern std::atomic<uint32> TotalAllocationBytes;
 extern std::atomic<uint32> TotalAllocationCount;
+// 누적 할당 횟수. 해제해도 줄지 않으므로 프레임 사이의 차이가 그 프레임의 힙 할당 수이다
+extern std::atomic<uint64> CumulativeAllocationCount;
 
 #ifdef _DEBUG
 constexpr int MAX_STACK_FRAMES = 32;
@@ -4,28 +4,18 @@
 #include "Component/Public/PrimitiveComponent.h"
 
 #include "Level/Public/Level.h"
-
-namespace
-{
-	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
-	{
-		FVector Min, Max;
-		InPrimitive->GetWorldAABB(Min, Max);
-
-		return FAABB(Min, Max);
-	}
-}
+#include "Global/DynamicAABBTree.h"
 
 FOctree::FOctree()
 	: BoundingBox(), Depth(0)
 {
-	Children.SetNum(8);
+	ResetRoot();
 }
 
 FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
 	: BoundingBox(InBoundingBox), Depth(InDepth)
 {
-	Children.SetNum(8);
+	ResetRoot();
 }
 
 FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
@@ -34,13 +24,23 @@ FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
 	const float HalfSize = InSize * 0.5f;
 	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
 	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
-	Children.SetNum(8);
+	ResetRoot();
 }
 
-FOctree::~FOctree()
+FOctree::~FOctree() = default;
+
+void FOctree::ResetRoot()
 {
-	Primitives.Empty();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	const FVector HalfExtent = (BoundingBox.Max - BoundingBox.Min) * 0.5f;
+
+	FOctreeNode Root;
+	Root.Center = BoundingBox.GetCenter();
+	Root.HalfSize = std::max({ HalfExtent.X, HalfExtent.Y, HalfExtent.Z });
+	Root.Depth = Depth;
+
+	Nodes.Empty();
+	Nodes.Add(Root);
+	FreeChildBlocks.Empty();
 }
 
 bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
@@ -48,40 +48,39 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
+	// World AABB는 삽입 시 한 번만 조회하여 원소에 캐시한다
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	const FAABB PrimitiveBounds(Min, Max);
+
 	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	// 이미 트리에 있던 프리미티브가 영역 밖으로 나갔다면 예전 위치에 남지 않도록 제거한다 (호출자는 동적 트리로 옮긴다)
+	if (BoundingBox.IsIntersected(PrimitiveBounds) == false)
+	{
+		Remove(InPrimitive);
+		return false;
+	}
 
-	if (IsLeaf())
+	// 이미 트리에 있는 프리미티브라면 기존 원소를 재사용해 다시 배치 (중복 삽입 방지)
+	int32 ElementIndex;
+	if (const int32* FoundIndex = ElementLookup.Find(InPrimitive))
 	{
-		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
-		if (Primitives.Num() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
-		{
-			Primitives.Add(InPrimitive); // 해당 객체를 추가한다
-			return true;
-		}
-		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
-		{
-			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
-			return true;
-		}
+		ElementIndex = *FoundIndex;
+		const int32 OldNodeIndex = Elements[ElementIndex].NodeIndex;
+		UnlinkElement(ElementIndex);
+		TryMerge(OldNodeIndex);
 	}
 	else
 	{
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingBox.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
-			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
-			}
-		}
-
-		Primitives.Add(InPrimitive);
-		return true;
+		ElementIndex = AllocateElement();
+		ElementLookup.Add(InPrimitive, ElementIndex);
 	}
 
-	return false;
+	Elements[ElementIndex].Primitive = InPrimitive;
+	Elements[ElementIndex].Bounds = PrimitiveBounds;
+	ElementBounds.Set(ElementIndex, PrimitiveBounds);
+	InsertElement(ElementIndex, 0);
+	return true;
 }
 
 bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
@@ -91,241 +90,345 @@ bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 		return false;
 	}
 
-	// 경계 검사를 수행하지 않고 바로 탐색 시작
+	// 트리 탐색 없이 back-pointer로 원소를 찾아 연결 리스트에서 제거
+	int32 ElementIndex;
+	if (!ElementLookup.RemoveAndCopyValue(InPrimitive, ElementIndex))
+	{
+		return false;
+	}
+
+	const int32 NodeIndex = Elements[ElementIndex].NodeIndex;
+	UnlinkElement(ElementIndex);
+
+	Elements[ElementIndex] = FOctreeElement();
+	Elements[ElementIndex].Next = FreeElementHead;
+	FreeElementHead = ElementIndex;
 
-	// 1-A. 리프 노드인 경우 (현재 노드만 검사하면 됨)
-	if (IsLeaf())
+	// 원소가 줄어든 서브트리를 합칠 수 있는지 검사
+	TryMerge(NodeIndex);
+	return true;
+}
+
+void FOctree::Clear()
+{
+	Elements.Empty();
+	ElementBounds.Empty();
+	FreeElementHead = -1;
+	ElementLookup.Empty();
+	ResetRoot();
+}
+
+TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+{
+	TArray<UPrimitiveComponent*> Candidates;
+	GWorld->GetLevel()->GetDynamicPrimitiveTree()->GetAllPrimitives(Candidates);
+	Candidates.Reserve(MaxPrimitiveCount);
+	if (Nodes[0].SubtreeElementCount == 0)
 	{
-		// O(N) 탐색을 통해 프리미티브 목록에서 제거를 시도합니다.
-		if (Primitives.RemoveSwap(InPrimitive))
-		{
-			return true;
-		}
-		return false; // 리프 노드에서 발견하지 못했으므로 탐색 종료
+		return Candidates;
 	}
 
-	// 1-B. 자식 노드가 있는 경우 (내부 노드)
-	else
+	FNodeQueue NodeQueue;
+	NodeQueue.push({ (Nodes[0].Center - FindPos).LengthSquared(), 0 });
+
+	while (!NodeQueue.empty() && Candidates.Num() < static_cast<int32>(MaxPrimitiveCount))
 	{
-		// 2. 현재 노드의 Primitives 목록에서 제거 시도 (선택 사항: 일부 트리는 내부 노드에도 프리미티브를 저장함)
-		if (Primitives.RemoveSwap(InPrimitive))
+		const int32 NodeIndex = NodeQueue.top().second;
+		NodeQueue.pop();
+
+		// Loose Octree는 내부 노드에도 원소가 저장되므로 모든 노드의 원소를 후보로 추가
+		const FOctreeNode& Node = Nodes[NodeIndex];
+		for (int32 ElementIndex = Node.FirstElement; ElementIndex >= 0; ElementIndex = Elements[ElementIndex].Next)
 		{
-			return true;
+			Candidates.Add(Elements[ElementIndex].Primitive);
 		}
 
-		// 3. 자식 노드 순회 (원래 등록되었을 위치를 재귀적으로 탐색)
-		bool bIsRemoved = false;
-
-		for (int Index = 0; Index < 8; ++Index)
+		if (!Node.IsLeaf())
 		{
-			// 💡 Children[Index]->Remove(InPrimitive) 호출 시,
-			//    자식 노드 내부에서 다시 경계 검사가 수행되지 않도록 보장해야 합니다.
-			if (Children[Index] && Children[Index]->Remove(InPrimitive))
+			for (int32 Index = 0; Index < 8; ++Index)
 			{
-				bIsRemoved = true;
-				break;
+				const int32 ChildIndex = Node.FirstChild + Index;
+				if (Nodes[ChildIndex].SubtreeElementCount > 0)
+				{
+					NodeQueue.push({ (Nodes[ChildIndex].Center - FindPos).LengthSquared(), ChildIndex });
+				}
 			}
 		}
+	}
 
-		// 4. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
-		if (bIsRemoved) { TryMerge(); }
+	return Candidates;
+}
 
-		return bIsRemoved;
+void FOctree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const
+{
+	Traverse(
+		[&QueryBox](const FAABB& NodeBounds)
+		{
+			if (!QueryBox.IsIntersected(NodeBounds)) { return EOctreeVisit::Skip; }
+			return QueryBox.IsContains(NodeBounds) ? EOctreeVisit::VisitAll : EOctreeVisit::Visit;
+		},
+		[&QueryBox, &OutResults](UPrimitiveComponent* Primitive, const FAABB& Bounds, bool bAcceptedByNode)
+		{
+			// 캐시된 AABB로 개별 검사하므로 GetWorldAABB를 다시 호출하지 않는다
+			if (bAcceptedByNode || QueryBox.IsIntersected(Bounds))
+			{
+				OutResults.Add(Primitive);
+			}
+		});
+}
+
+FAABB FOctree::GetNodeLooseBounds(int32 NodeIndex) const
+{
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	const float LooseHalfSize = Node.HalfSize * OCTREE_LOOSENESS;
+	const FVector Extent(LooseHalfSize, LooseHalfSize, LooseHalfSize);
+	return FAABB(Node.Center - Extent, Node.Center + Extent);
+}
+
+void FOctree::DeepCopy(FOctree* OutOctree) const
+{
+	if (!OutOctree)
+	{
+		return;
 	}
 
+	// 노드와 원소가 모두 인덱스로 연결되어 있으므로 풀을 그대로 복사하면 된다
+	OutOctree->BoundingBox = BoundingBox;
+	OutOctree->Depth = Depth;
+	OutOctree->Nodes = Nodes;
+	OutOctree->FreeChildBlocks = FreeChildBlocks;
+	OutOctree->Elements = Elements; // shallow copy of pointers
+	OutOctree->ElementBounds = ElementBounds;
+	OutOctree->FreeElementHead = FreeElementHead;
+	OutOctree->ElementLookup = ElementLookup;
 }
 
-void FOctree::Clear()
+int32 FOctree::AllocateElement()
 {
-	Primitives.Empty();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	if (FreeElementHead >= 0)
+	{
+		const int32 ElementIndex = FreeElementHead;
+		FreeElementHead = Elements[ElementIndex].Next;
+		Elements[ElementIndex].Next = -1;
+		return ElementIndex;
+	}
+
+	const int32 ElementIndex = Elements.Add(FOctreeElement());
+	ElementBounds.Grow(Elements.Num());
+	return ElementIndex;
 }
 
-void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+void FOctree::LinkElement(int32 ElementIndex, int32 NodeIndex)
 {
-	// 1. 현재 노드가 가진 프리미티브를 결과 배열에 추가합니다.
-	OutPrimitives.Append(Primitives);
+	FOctreeElement& Element = Elements[ElementIndex];
+	FOctreeNode& Node = Nodes[NodeIndex];
 
-	// 2. 리프 노드가 아니라면, 모든 자식 노드에 대해 재귀적으로 함수를 호출합니다.
-	if (!IsLeaf())
+	Element.NodeIndex = NodeIndex;
+	Element.Prev = -1;
+	Element.Next = Node.FirstElement;
+	if (Node.FirstElement >= 0)
 	{
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			if (Children[Index])
-			{
-				Children[Index]->GetAllPrimitives(OutPrimitives);
-			}
-		}
+		Elements[Node.FirstElement].Prev = ElementIndex;
 	}
+	Node.FirstElement = ElementIndex;
+	++Node.ElementCount;
+
+	AdjustSubtreeCount(NodeIndex, 1);
 }
 
-TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+void FOctree::UnlinkElement(int32 ElementIndex)
 {
-	TArray<UPrimitiveComponent*> Candidates = GWorld->GetLevel()->GetDynamicPrimitives();
-	Candidates.Reserve(MaxPrimitiveCount);
-	FNodeQueue NodeQueue;
+	FOctreeElement& Element = Elements[ElementIndex];
+	FOctreeNode& Node = Nodes[Element.NodeIndex];
 
-	float RootDistance = this->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-	NodeQueue.push({ RootDistance, this });
+	if (Element.Prev >= 0)
+	{
+		Elements[Element.Prev].Next = Element.Next;
+	}
+	else
+	{
+		Node.FirstElement = Element.Next;
+	}
+	if (Element.Next >= 0)
+	{
+		Elements[Element.Next].Prev = Element.Prev;
+	}
+	--Node.ElementCount;
 
-	while (!NodeQueue.empty() && Candidates.Num() < static_cast<int32>(MaxPrimitiveCount))
+	AdjustSubtreeCount(Element.NodeIndex, -1);
+	Element.NodeIndex = -1;
+	Element.Prev = -1;
+	Element.Next = -1;
+}
+
+void FOctree::AdjustSubtreeCount(int32 NodeIndex, int32 Delta)
+{
+	for (int32 Current = NodeIndex; Current >= 0; Current = Nodes[Current].Parent)
 	{
-		FOctree* CurrentNode = NodeQueue.top().second;
-		NodeQueue.pop();
+		Nodes[Current].SubtreeElementCount += Delta;
+	}
+}
 
-		if (CurrentNode->IsLeafNode())
+void FOctree::InsertElement(int32 ElementIndex, int32 StartNodeIndex)
+{
+	int32 NodeIndex = StartNodeIndex;
+	while (true)
+	{
+		if (Nodes[NodeIndex].IsLeaf())
 		{
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
+			// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면 이 노드에 저장
+			if (Nodes[NodeIndex].ElementCount < MAX_PRIMITIVES || Nodes[NodeIndex].Depth >= MAX_DEPTH)
 			{
-				Candidates.Add(Primitive);
+				break;
 			}
+			Subdivide(NodeIndex);
 		}
-		else
+
+		// 자식 셀에 완전히 들어가지 않는 원소는 현재 노드에 저장
+		const int32 ChildIndex = FindChildForBounds(NodeIndex, Elements[ElementIndex].Bounds);
+		if (ChildIndex < 0)
 		{
-			for (int i = 0; i < 8; ++i)
-			{
-				FOctree* Child = CurrentNode->Children[i];
-				if (Child)
-				{
-					float ChildDistance = Child->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-					NodeQueue.push({ ChildDistance, Child });
-				}
-			}
+			break;
 		}
+		NodeIndex = ChildIndex;
 	}
 
-	return Candidates;
+	LinkElement(ElementIndex, NodeIndex);
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+int32 FOctree::FindChildForBounds(int32 NodeIndex, const FAABB& Bounds) const
 {
-	const FVector& Min = BoundingBox.Min;
-	const FVector& Max = BoundingBox.Max;
-	const FVector Center = (Min + Max) * 0.5f;
-
-	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
-	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
-	Children[2] = new FOctree(FAABB(FVector(Min.X, Center.Y, Center.Z), FVector(Center.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Left
-	Children[3] = new FOctree(FAABB(FVector(Center.X, Center.Y, Center.Z), FVector(Max.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Right
-	Children[4] = new FOctree(FAABB(FVector(Min.X, Min.Y, Min.Z), FVector(Center.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Left
-	Children[5] = new FOctree(FAABB(FVector(Center.X, Min.Y, Min.Z), FVector(Max.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Right
-	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
-	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
-
-	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.Add(InPrimitive);
-	Primitives.Empty();
-
-	for (UPrimitiveComponent* prim : primitivesToMove)
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	if (Node.IsLeaf())
 	{
-		Insert(prim);
+		return -1;
 	}
+
+	// 원소의 중심이 속한 자식 셀 하나만 후보가 된다 (loose 경계 덕분에 경계에 걸친 원소도 내려갈 수 있음)
+	const FVector Center = Bounds.GetCenter();
+	const int32 Octant =
+		(Center.X >= Node.Center.X ? 1 : 0) |
+		(Center.Y >= Node.Center.Y ? 2 : 0) |
+		(Center.Z >= Node.Center.Z ? 4 : 0);
+
+	const int32 ChildIndex = Node.FirstChild + Octant;
+	return GetNodeLooseBounds(ChildIndex).IsContains(Bounds) ? ChildIndex : -1;
 }
 
-void FOctree::TryMerge()
+void FOctree::Subdivide(int32 NodeIndex)
 {
-	// Case 1. 자식 노드가 존재하지 않으므로 종료
-	if (IsLeaf())
+	// 병합으로 해제된 블록이 있으면 재사용, 없으면 풀 끝에 8개 노드를 추가
+	int32 FirstChild;
+	if (!FreeChildBlocks.IsEmpty())
 	{
-		return;
+		FirstChild = FreeChildBlocks.Last();
+		FreeChildBlocks.Pop();
 	}
-
-	// 모든 자식 노드가 리프 노드인지 확인
-	for (int Index = 0; Index < 8; ++Index)
+	else
 	{
-		if (!Children[Index]->IsLeaf())
-		{
-			return; // 하나라도 리프가 아니면 합치지 않음
-		}
+		FirstChild = Nodes.Num();
+		Nodes.SetNum(FirstChild + 8);
 	}
 
-	// 모든 자식 노드에 있는 프리미티브의 총 개수를 계산
-	uint32 TotalPrimitives = static_cast<uint32>(Primitives.Num());
-	for (int Index = 0; Index < 8; ++Index)
+	const FVector Center = Nodes[NodeIndex].Center;
+	const float ChildHalfSize = Nodes[NodeIndex].HalfSize * 0.5f;
+	const int32 ChildDepth = Nodes[NodeIndex].Depth + 1;
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		TotalPrimitives += static_cast<uint32>(Children[Index]->Primitives.Num());
+		FOctreeNode Child;
+		Child.Center = Center + FVector(
+			(Index & 1) ? ChildHalfSize : -ChildHalfSize,
+			(Index & 2) ? ChildHalfSize : -ChildHalfSize,
+			(Index & 4) ? ChildHalfSize : -ChildHalfSize);
+		Child.HalfSize = ChildHalfSize;
+		Child.Parent = NodeIndex;
+		Child.Depth = ChildDepth;
+		Nodes[FirstChild + Index] = Child;
 	}
+	Nodes[NodeIndex].FirstChild = FirstChild;
 
-	// 프리미티브 총 개수가 최대치보다 작으면 합치기 수행
-	if (TotalPrimitives <= MAX_PRIMITIVES)
+	// 기존 원소 중 자식 셀에 들어갈 수 있는 원소들을 자식으로 내린다
+	int32 ElementIndex = Nodes[NodeIndex].FirstElement;
+	while (ElementIndex >= 0)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const int32 NextIndex = Elements[ElementIndex].Next;
+		const int32 ChildIndex = FindChildForBounds(NodeIndex, Elements[ElementIndex].Bounds);
+		if (ChildIndex >= 0)
 		{
-			Primitives.Append(Children[Index]->Primitives);
+			UnlinkElement(ElementIndex);
+			LinkElement(ElementIndex, ChildIndex);
 		}
+		ElementIndex = NextIndex;
+	}
+}
 
-		// 모든 자식 노드를 메모리에서 해제
-		for (int Index = 0; Index < 8; ++Index)
+void FOctree::TryMerge(int32 NodeIndex)
+{
+	// 원소 수가 분할 기준의 절반 이하로 떨어진 가장 높은 조상을 찾는다
+	// (분할 기준과 같은 값을 쓰면 이동 중인 오브젝트의 제거/재삽입마다 분할과 병합이 반복됨)
+	int32 MergeIndex = -1;
+	for (int32 Current = NodeIndex; Current >= 0; Current = Nodes[Current].Parent)
+	{
+		if (!Nodes[Current].IsLeaf() && Nodes[Current].SubtreeElementCount <= MAX_PRIMITIVES / 2)
 		{
-			SafeDelete(Children[Index]);
+			MergeIndex = Current;
 		}
 	}
-}
 
-void FOctree::DeepCopy(FOctree* OutOctree) const
-{
-	if (!OutOctree)
+	if (MergeIndex < 0)
 	{
 		return;
 	}
 
-	// 1) 필드 복사
-	OutOctree->BoundingBox = BoundingBox;
-	OutOctree->Depth = Depth;
+	TArray<int32> SubtreeElements;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		CollectSubtreeElements(Nodes[MergeIndex].FirstChild + Index, SubtreeElements);
+	}
+	for (int32 ElementIndex : SubtreeElements)
+	{
+		UnlinkElement(ElementIndex);
+		LinkElement(ElementIndex, MergeIndex);
+	}
 
-	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
-	//    - 프리미티브는 대입으로 교체
-	OutOctree->Primitives = Primitives; // shallow copy of pointers
+	FreeChildren(MergeIndex);
+}
 
-	//    - 기존 자식 노드 메모리 해제
-	for (FOctree* Child : OutOctree->Children)
+void FOctree::CollectSubtreeElements(int32 NodeIndex, TArray<int32>& OutElements) const
+{
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	if (Node.SubtreeElementCount == 0)
 	{
-		SafeDelete(Child);
+		return;
 	}
-	OutOctree->Children.Empty();
-	OutOctree->Children.SetNum(8, nullptr);
 
-	// 3) 자식 재귀 복사
-	if (!IsLeaf())
+	for (int32 ElementIndex = Node.FirstElement; ElementIndex >= 0; ElementIndex = Elements[ElementIndex].Next)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		OutElements.Add(ElementIndex);
+	}
+
+	if (!Node.IsLeaf())
+	{
+		for (int32 Index = 0; Index < 8; ++Index)
 		{
-			if (Children[Index] != nullptr)
-			{
-				// 자식 노드 생성 후 재귀 복사
-				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
-				Children[Index]->DeepCopy(OutOctree->Children[Index]);
-			}
+			CollectSubtreeElements(Node.FirstChild + Index, OutElements);
 		}
 	}
 }
 
-void FOctree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const
+void FOctree::FreeChildren(int32 NodeIndex)
 {
-	// Early out: If this node's AABB doesn't intersect the query box, skip it
-	if (!BoundingBox.IsIntersected(QueryBox))
+	const int32 FirstChild = Nodes[NodeIndex].FirstChild;
+	if (FirstChild < 0)
 	{
 		return;
 	}
 
-	// Add all primitives in this node
-	for (UPrimitiveComponent* Prim : Primitives)
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		if (Prim)
-		{
-			OutResults.Add(Prim);
-		}
+		FreeChildren(FirstChild + Index);
 	}
 
-	// Recursively query children
-	if (!IsLeaf())
-	{
-		for (int i = 0; i < 8; ++i)
-		{
-			if (Children[i] != nullptr)
-			{
-				Children[i]->QueryAABB(QueryBox, OutResults);
-			}
-		}
-	}
+	FreeChildBlocks.Add(FirstChild);
+	Nodes[NodeIndex].FirstChild = -1;
 }
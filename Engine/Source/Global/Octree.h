@@ -1,12 +1,60 @@
 #pragma once
 
 #include "Physics/Public/AABB.h"
+#include "Global/BoundsSoA.h"
 
 class UPrimitiveComponent;
 
 constexpr int MAX_PRIMITIVES = 16;
-constexpr int MAX_DEPTH = 14;  // Support large world (64000 units, min node size ~3.9 units)      
+constexpr int MAX_DEPTH = 14;  // Support large world (64000 units, min node size ~3.9 units)
+constexpr float OCTREE_LOOSENESS = 2.0f; // 노드의 loose 경계 = 셀 중심 ± HalfSize * OCTREE_LOOSENESS
 
+/**
+* @brief Octree 풀에 저장되는 노드
+* @note 자식 8개는 항상 Nodes 풀의 연속된 블록으로 할당되므로 첫 자식 인덱스만 저장한다.
+*       노드에 저장된 원소들은 Elements 풀 안의 이중 연결 리스트로 연결된다.
+*/
+struct FOctreeNode
+{
+	FVector Center;
+	float HalfSize = 0.0f;             // loose 배율을 적용하기 전 셀의 절반 크기
+	int32 Parent = -1;
+	int32 FirstChild = -1;             // -1이면 leaf
+	int32 FirstElement = -1;
+	int32 ElementCount = 0;            // 이 노드에 직접 저장된 원소 수
+	int32 SubtreeElementCount = 0;     // 자신 + 모든 자손 노드에 저장된 원소 수
+	int32 Depth = 0;
+
+	bool IsLeaf() const { return FirstChild < 0; }
+};
+
+/**
+* @brief Octree에 저장된 프리미티브와 삽입 시점의 World AABB
+*/
+struct FOctreeElement
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	FAABB Bounds;
+	int32 NodeIndex = -1;
+	int32 Prev = -1;
+	int32 Next = -1;                   // 해제된 원소에서는 free list의 다음 원소
+};
+
+/**
+* @brief Traverse의 노드 방문 함수가 반환하는 값
+*/
+enum class EOctreeVisit : uint8
+{
+	Skip,       // 이 노드와 자손 노드를 건너뜀
+	Visit,      // 이 노드의 원소를 개별적으로 방문하고 자식 노드를 검사
+	VisitAll    // 더 이상 노드 검사 없이 자손 노드의 모든 원소를 방문
+};
+
+/**
+* @brief 노드와 원소를 연속된 풀에 저장하는 Loose Octree
+* @note 원소는 자신을 완전히 포함하는 가장 깊은 노드(loose 경계 기준)에 저장되며,
+*       프리미티브 → 원소 인덱스 맵을 통해 트리 탐색 없이 제거할 수 있다.
+*/
 class FOctree
 {
 public:
@@ -15,38 +63,231 @@ public:
 	FOctree(const FAABB& InBoundingBox, int InDepth);
 	~FOctree();
 
+	// 루트 영역 밖이면 false를 반환하고, 이미 트리에 있던 프리미티브는 제거된다
 	bool Insert(UPrimitiveComponent* InPrimitive);
 	bool Remove(UPrimitiveComponent* InPrimitive);
+	bool Contains(UPrimitiveComponent* InPrimitive) const { return ElementLookup.Contains(InPrimitive); }
 	void Clear();
 
 	void DeepCopy(FOctree* OutOctree) const;
 
-	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	// TFrameArray 등 다른 할당 정책의 배열로도 받을 수 있다
+	template <typename AllocatorType>
+	void GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const;
+	// 배열로 복사하지 않고 원소 풀을 제자리에서 훑으며 Function(UPrimitiveComponent*) 호출
+	template <typename FunctionType>
+	void ForEachPrimitive(FunctionType&& Function) const;
 	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
 
 	// Query all primitives overlapping the given AABB (for collision queries)
 	void QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const;
 
+	/**
+	* @brief 노드 단위로 가지치기하며 트리를 순회. 원소가 없는 서브트리는 방문하지 않는다.
+	* @param NodeVisitor: EOctreeVisit(const FAABB& LooseBounds)
+	* @param ElementVisitor: void(UPrimitiveComponent* Primitive, const FAABB& CachedBounds, bool bAcceptedByNode)
+	*        bAcceptedByNode는 조상 노드가 VisitAll을 반환해 개별 검사가 필요 없는 경우 true
+	*/
+	template <typename NodeVisitorType, typename ElementVisitorType>
+	void Traverse(NodeVisitorType&& NodeVisitor, ElementVisitorType&& ElementVisitor) const;
+
+	/**
+	* @brief Traverse와 같은 노드 가지치기를 여러 뷰에 대해 한 번의 순회로 수행하고 원소 인덱스마다 뷰 비트 마스크를 기록
+	* 뷰 하나만 컬링할 때도 InViewMask = 1로 같은 함수를 쓴다.
+	* @param NodeClassifier: void(const FAABB& LooseBounds, uint32& InOutTestMask, uint32& InOutAcceptMask)
+	*        InOutTestMask의 뷰 중 노드 밖인 뷰는 지우고, 노드를 완전히 포함하는 뷰는 InOutAcceptMask로 옮긴다
+	* @param OutTestMasks: 개별 검사가 필요한 뷰, OutAcceptMasks: 조상 노드가 통과시킨 뷰 (둘 다 GetElementBounds().Num() 크기)
+	*/
+	template <typename NodeClassifierType>
+	void ClassifyElements(uint32 InViewMask, NodeClassifierType&& NodeClassifier,
+		TArray<uint32>& OutTestMasks, TArray<uint32>& OutAcceptMasks) const;
+
+	// 원소 풀과 같은 인덱스의 World AABB (SoA). 빈 원소의 값은 의미가 없다
+	const FBoundsSoA& GetElementBounds() const { return ElementBounds; }
+	UPrimitiveComponent* GetElementPrimitive(int32 ElementIndex) const { return Elements[ElementIndex].Primitive; }
+
+	// 루트 셀의 경계 (이 영역과 겹치지 않는 프리미티브는 삽입되지 않음)
 	const FAABB& GetBoundingBox() const { return BoundingBox; }
-	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
-	bool IsLeafNode() const { return IsLeaf(); }
-	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
-	TArray<FOctree*>& GetChildren() { return Children; }
-	const TArray<FOctree*>& GetChildren() const { return Children; } 
+	FAABB GetNodeLooseBounds(int32 NodeIndex) const;
+
+	int32 GetNodeCount() const { return Nodes.Num() - FreeChildBlocks.Num() * 8; }
+	int32 GetElementCount() const { return ElementLookup.Num(); }
 
 private:
-	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
-	void TryMerge();
+	void ResetRoot();
+	int32 AllocateElement();
+	void LinkElement(int32 ElementIndex, int32 NodeIndex);
+	void UnlinkElement(int32 ElementIndex);
+	void AdjustSubtreeCount(int32 NodeIndex, int32 Delta);
+
+	//@brief 원소를 포함할 수 있는 가장 깊은 노드를 찾아 저장 (필요하면 leaf를 분할)
+	void InsertElement(int32 ElementIndex, int32 StartNodeIndex);
+	//@brief 원소의 중심이 속한 자식 셀이 원소 전체를 포함하면 그 자식 인덱스를, 아니면 -1 반환
+	int32 FindChildForBounds(int32 NodeIndex, const FAABB& Bounds) const;
+	void Subdivide(int32 NodeIndex);
+	void TryMerge(int32 NodeIndex);
+	void CollectSubtreeElements(int32 NodeIndex, TArray<int32>& OutElements) const;
+	void FreeChildren(int32 NodeIndex);
+
+	//@param ElementIndexVisitor: void(int32 ElementIndex, bool bAcceptedByNode)
+	template <typename NodeVisitorType, typename ElementIndexVisitorType>
+	void TraverseElementIndices(NodeVisitorType& NodeVisitor, ElementIndexVisitorType& ElementIndexVisitor) const;
 
 	FAABB BoundingBox;
-	int Depth;                       
-	TArray<UPrimitiveComponent*> Primitives;
-	TArray<FOctree*> Children;
+	int Depth;
+	TArray<FOctreeNode> Nodes;                   // Nodes[0]이 루트
+	TArray<int32> FreeChildBlocks;               // 병합으로 해제된 8개짜리 자식 블록의 시작 인덱스
+	TArray<FOctreeElement> Elements;
+	FBoundsSoA ElementBounds;                    // Elements[i].Bounds의 SoA 사본 (컬링용)
+	int32 FreeElementHead = -1;
+	TFlatMap<UPrimitiveComponent*, int32> ElementLookup; // 프리미티브 → Elements 인덱스 (back-pointer)
 };
 
 using FNodeQueue = std::priority_queue<
-	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
-	std::greater<std::pair<float, FOctree*>>
+	std::pair<float, int32>,
+	std::vector<std::pair<float, int32>>,
+	std::greater<std::pair<float, int32>>
 >;
+
+template <typename AllocatorType>
+void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const
+{
+	// 원소 풀을 순서대로 훑으므로 트리 순회보다 빠르고 결과 순서도 안정적이다
+	OutPrimitives.Reserve(OutPrimitives.Num() + ElementLookup.Num());
+	ForEachPrimitive([&OutPrimitives](UPrimitiveComponent* Primitive) { OutPrimitives.Add(Primitive); });
+}
+
+template <typename FunctionType>
+void FOctree::ForEachPrimitive(FunctionType&& Function) const
+{
+	for (const FOctreeElement& Element : Elements)
+	{
+		if (Element.Primitive)
+		{
+			Function(Element.Primitive);
+		}
+	}
+}
+
+template <typename NodeVisitorType, typename ElementVisitorType>
+void FOctree::Traverse(NodeVisitorType&& NodeVisitor, ElementVisitorType&& ElementVisitor) const
+{
+	auto ElementIndexVisitor = [this, &ElementVisitor](int32 ElementIndex, bool bAccepted)
+	{
+		const FOctreeElement& Element = Elements[ElementIndex];
+		ElementVisitor(Element.Primitive, Element.Bounds, bAccepted);
+	};
+	TraverseElementIndices(NodeVisitor, ElementIndexVisitor);
+}
+
+template <typename NodeVisitorType, typename ElementIndexVisitorType>
+void FOctree::TraverseElementIndices(NodeVisitorType& NodeVisitor, ElementIndexVisitorType& ElementIndexVisitor) const
+{
+	if (Nodes.IsEmpty() || Nodes[0].SubtreeElementCount == 0)
+	{
+		return;
+	}
+
+	// 깊이마다 최대 7개의 형제 노드가 스택에 남으므로 고정 크기 스택으로 충분
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		bool bAccepted;
+	};
+	FStackEntry NodeStack[8 * (MAX_DEPTH + 1) + 1];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = { 0, false };
+
+	while (StackSize > 0)
+	{
+		const FStackEntry Entry = NodeStack[--StackSize];
+		const FOctreeNode& Node = Nodes[Entry.NodeIndex];
+
+		bool bAccepted = Entry.bAccepted;
+		if (!bAccepted)
+		{
+			const EOctreeVisit Visit = NodeVisitor(GetNodeLooseBounds(Entry.NodeIndex));
+			if (Visit == EOctreeVisit::Skip)
+			{
+				continue;
+			}
+			bAccepted = (Visit == EOctreeVisit::VisitAll);
+		}
+
+		for (int32 ElementIndex = Node.FirstElement; ElementIndex >= 0; ElementIndex = Elements[ElementIndex].Next)
+		{
+			ElementIndexVisitor(ElementIndex, bAccepted);
+		}
+
+		if (!Node.IsLeaf())
+		{
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				const int32 ChildIndex = Node.FirstChild + Index;
+				if (Nodes[ChildIndex].SubtreeElementCount > 0)
+				{
+					NodeStack[StackSize++] = { ChildIndex, bAccepted };
+				}
+			}
+		}
+	}
+}
+
+template <typename NodeClassifierType>
+void FOctree::ClassifyElements(uint32 InViewMask, NodeClassifierType&& NodeClassifier,
+	TArray<uint32>& OutTestMasks, TArray<uint32>& OutAcceptMasks) const
+{
+	OutTestMasks.SetNum(ElementBounds.Num());
+	OutAcceptMasks.SetNum(ElementBounds.Num());
+	std::fill(OutTestMasks.begin(), OutTestMasks.end(), 0u);
+	std::fill(OutAcceptMasks.begin(), OutAcceptMasks.end(), 0u);
+
+	if (InViewMask == 0 || Nodes.IsEmpty() || Nodes[0].SubtreeElementCount == 0)
+	{
+		return;
+	}
+
+	// Traverse와 같지만 bAccepted 대신 뷰 마스크 두 개를 스택에 싣는다
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		uint32 TestMask;
+		uint32 AcceptMask;
+	};
+	FStackEntry NodeStack[8 * (MAX_DEPTH + 1) + 1];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = { 0, InViewMask, 0u };
+
+	while (StackSize > 0)
+	{
+		FStackEntry Entry = NodeStack[--StackSize];
+		const FOctreeNode& Node = Nodes[Entry.NodeIndex];
+
+		if (Entry.TestMask != 0)
+		{
+			NodeClassifier(GetNodeLooseBounds(Entry.NodeIndex), Entry.TestMask, Entry.AcceptMask);
+			if ((Entry.TestMask | Entry.AcceptMask) == 0)
+			{
+				continue;
+			}
+		}
+
+		for (int32 ElementIndex = Node.FirstElement; ElementIndex >= 0; ElementIndex = Elements[ElementIndex].Next)
+		{
+			OutTestMasks[ElementIndex] = Entry.TestMask;
+			OutAcceptMasks[ElementIndex] = Entry.AcceptMask;
+		}
+
+		if (!Node.IsLeaf())
+		{
+			for (int32 Index = 0; Index < 8; ++Index)
+			{
+				const int32 ChildIndex = Node.FirstChild + Index;
+				if (Nodes[ChildIndex].SubtreeElementCount > 0)
+				{
+					NodeStack[StackSize++] = { ChildIndex, Entry.TestMask, Entry.AcceptMask };
+				}
+			}
+		}
+	}
+}
@@ -44,4 +44,6 @@ using int64 = std::int64_t;
 #include "Source/Runtime/Core/Public/Containers/TArray.h"
 #include "Source/Runtime/Core/Public/Containers/TMap.h"
 #include "Source/Runtime/Core/Public/Containers/TSet.h"
+#include "Source/Runtime/Core/Public/Containers/TFlatMap.h"
+#include "Source/Runtime/Core/Public/Containers/TFlatSet.h"
 
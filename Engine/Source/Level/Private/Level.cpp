@@ -9,6 +9,7 @@
 #include "Core/Public/Object.h"
 #include "Editor/Public/Editor.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Global/OverlapInfo.h"
 #include "Level/Public/Level.h"
 #include "Level/Public/CurveLibrary.h"
@@ -20,6 +21,9 @@
 #include "Physics/Public/AABB.h"
 #include "Physics/Public/CollisionHelper.h"
 #include "Physics/Public/HitResult.h"
+#include "Physics/Public/OverlapBroadphase.h"
+#include "Physics/Public/OverlapNarrowphase.h"
+#include "Render/UI/Overlay/Public/StatOverlay.h"
 #include <json.hpp>
 
 IMPLEMENT_CLASS(ULevel, UObject)
@@ -27,6 +31,8 @@ IMPLEMENT_CLASS(ULevel, UObject)
 ULevel::ULevel()
 {
 	StaticOctree = new FOctree(FVector(0, 0, 0), 1000, 0);
+	DynamicPrimitiveTree = new FDynamicAABBTree();
+	OverlapBroadphase = new FOverlapBroadphase();
 	CurveLibrary = NewObject<UCurveLibrary>(this);
 	CurveLibrary->InitializeDefaults();
 }
@@ -43,6 +49,8 @@ ULevel::~ULevel()
 
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
+	SafeDelete(DynamicPrimitiveTree);
+	SafeDelete(OverlapBroadphase);
 	SafeDelete(CurveLibrary);
 }
 
@@ -178,11 +186,12 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 		// StaticOctree에 먼저 삽입 시도
 		if (!(StaticOctree->Insert(PrimitiveComponent)))
 		{
-			// 실패하면 DynamicPrimitiveQueue 목록에 추가
+			// 실패하면 동적 AABB 트리에 추가
 			OnPrimitiveUpdated(PrimitiveComponent);
 		}
 
 		// Note: Initial overlaps will be detected in next Level::UpdateAllOverlaps() call
+		AddOverlapProxy(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -229,6 +238,7 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 		StaticOctree->Remove(PrimitiveComponent);
 
 		OnPrimitiveUnregistered(PrimitiveComponent);
+		RemoveOverlapProxy(PrimitiveComponent, false);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -287,9 +297,11 @@ void ULevel::AddLevelComponent(AActor* Actor)
 			// Octree Insert 시도
 			if (!(StaticOctree->Insert(PrimitiveComponent)))
 			{
-				// 실패하면 DynamicPrimitiveQueue에 추가
+				// 실패하면 동적 AABB 트리에 추가
 				OnPrimitiveUpdated(PrimitiveComponent);
 			}
+
+			AddOverlapProxy(PrimitiveComponent);
 		}
 		else if (auto LightComponent = Cast<ULightComponent>(Component))
 		{
@@ -363,10 +375,23 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
+	// 이미 동적 트리에 있다면 fat AABB를 벗어났을 때만 트리 안에서 재배치된다
+	if (DynamicProxyIds.Contains(InComponent))
+	{
+		OnPrimitiveUpdated(InComponent);
+		return;
+	}
+
 	if (!StaticOctree->Remove(InComponent))
 	{
 		return;
 	}
+
+	// Static 프리미티브는 (에디터 편집 등으로) 드물게 움직이므로 곧바로 Octree에 다시 넣는다
+	if (InComponent->GetMobility() == EComponentMobility::Static && StaticOctree->Insert(InComponent))
+	{
+		return;
+	}
 	OnPrimitiveUpdated(InComponent);
 }
 
@@ -408,97 +433,27 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 	Octree Management
 -----------------------------------------------------------------------------*/
 
-void ULevel::UpdateOctree()
-{
-	if (!StaticOctree)
-	{
-		return;
-	}
-
-	uint32 Count = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
-
-	while (!DynamicPrimitiveQueue.empty() && Count < MAX_OBJECTS_TO_INSERT_PER_FRAME)
-	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
-
-		auto* FoundTimestampPtr = DynamicPrimitiveMap.Find(Component);
-		if (FoundTimestampPtr)
-		{
-			if (*FoundTimestampPtr <= TimePoint)
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입한다.
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.Remove(Component);
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, *FoundTimestampPtr});
-				}
-				// TODO: 오브젝트의 유일성을 보장하기 위해 StaticOctree->Remove(Component)가 필요한가?
-				++Count;
-			}
-			else
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입한다.
-				DynamicPrimitiveQueue.push({Component, *FoundTimestampPtr});
-			}
-		}
-	}
-
-	DynamicPrimitiveQueue = NotInsertedQueue;
-	if (Count != 0)
-	{
-		// UE_LOG("UpdateOctree: %d개의 컴포넌트가 업데이트 되었습니다.", Count);
-	}
-}
-
 void ULevel::UpdateOctreeImmediate()
 {
-	if (!StaticOctree)
+	if (!StaticOctree || !DynamicPrimitiveTree)
 	{
 		return;
 	}
 
-	uint32 TotalCount = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
+	// 로드 직후에는 아직 아무것도 움직이지 않았으므로 Octree 범위 안의 프리미티브를 모두 Octree로 옮긴다
+	TArray<UPrimitiveComponent*> DynamicPrimitives;
+	DynamicPrimitiveTree->GetAllPrimitives(DynamicPrimitives);
 
-	// MAX_OBJECTS_TO_INSERT_PER_FRAME 제한 없이 모든 큐 비우기
-	while (!DynamicPrimitiveQueue.empty())
+	uint32 TotalCount = 0;
+	for (UPrimitiveComponent* Component : DynamicPrimitives)
 	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
-
-		auto* FoundTimestampPtr = DynamicPrimitiveMap.Find(Component);
-		if (FoundTimestampPtr)
+		if (StaticOctree->Insert(Component))
 		{
-			if (*FoundTimestampPtr <= TimePoint)
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.Remove(Component);
-					++TotalCount;
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, *FoundTimestampPtr});
-				}
-			}
-			else
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입
-				DynamicPrimitiveQueue.push({Component, *FoundTimestampPtr});
-			}
+			OnPrimitiveUnregistered(Component);
+			++TotalCount;
 		}
 	}
 
-	DynamicPrimitiveQueue = NotInsertedQueue;
-
 	if (TotalCount > 0)
 	{
 		UE_LOG("Level: Octree 즉시 구축 완료 (%u개 컴포넌트)", TotalCount);
@@ -512,18 +467,17 @@ void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
 		return;
 	}
 
-	float GameTime = UTimeManager::GetInstance().GetGameTime();
-	float* FoundTimePtr = DynamicPrimitiveMap.Find(InComponent);
+	FVector WorldMin, WorldMax;
+	InComponent->GetWorldAABB(WorldMin, WorldMax);
+	const FAABB WorldBounds(WorldMin, WorldMax);
 
-	if (FoundTimePtr)
+	if (const int32* ProxyId = DynamicProxyIds.Find(InComponent))
 	{
-		*FoundTimePtr = GameTime;
+		DynamicPrimitiveTree->MoveProxy(*ProxyId, WorldBounds);
 	}
 	else
 	{
-		DynamicPrimitiveMap.Add(InComponent, GameTime);
-
-		DynamicPrimitiveQueue.push({InComponent, GameTime});
+		DynamicProxyIds.Add(InComponent, DynamicPrimitiveTree->CreateProxy(InComponent, WorldBounds));
 	}
 }
 
@@ -534,7 +488,11 @@ void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
 		return;
 	}
 
-	DynamicPrimitiveMap.Remove(InComponent);
+	int32 ProxyId;
+	if (DynamicProxyIds.RemoveAndCopyValue(InComponent, ProxyId))
+	{
+		DynamicPrimitiveTree->DestroyProxy(ProxyId);
+	}
 }
 
 AActor* ULevel::FindTemplateActorByName(const FName& InName) const
@@ -614,313 +572,208 @@ TArray<AActor*> ULevel::FindActorsOfClassByName(const FString& ClassName) const
 	Centralized Overlap Management (Unreal-style)
 -----------------------------------------------------------------------------*/
 
-void ULevel::UpdateAllOverlaps()
+namespace
 {
-	if (!StaticOctree)
-		return;
+	/** @brief Narrow phase에서 상태가 바뀐 pair. 검사가 모두 끝난 뒤 순서대로 이벤트를 발생시킨다. */
+	struct FOverlapEvent
+	{
+		// WeakObjectPtr 사용: 앞선 이벤트의 Delegate 내부에서 객체가 삭제될 가능성 대비
+		TWeakObjectPtr<UPrimitiveComponent> ComponentA;
+		TWeakObjectPtr<UPrimitiveComponent> ComponentB;
+		bool bBeginOverlap;
+	};
 
-	// 1. 모든 primitive component 수집
-	// UpdateAllOverlaps 도중 생성되는 액터가 존재할 수 있으므로 인덱스 기반 (iterator invalidation 방지)
-	TArray<UPrimitiveComponent*> AllPrimitives;
-	for (int32 Idx = 0; Idx < LevelActors.Num(); ++Idx)
+	void DispatchOverlapEvent(const FOverlapEvent& Event)
 	{
-		AActor* Actor = LevelActors[Idx];
-		if (!Actor)
-			continue;
+		UPrimitiveComponent* A = Event.ComponentA.Get();
+		UPrimitiveComponent* B = Event.ComponentB.Get();
+		if (!A || !B)
+		{
+			return;
+		}
 
-		TArray<UActorComponent*>& Components = Actor->GetOwnedComponents();
-		for (UActorComponent* Comp : Components)
+		if (Event.bBeginOverlap)
 		{
-			if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Comp))
+			// BeginOverlap - 양방향 상태 업데이트 (using public API)
+			A->AddOverlapInfo(B);
+			B->AddOverlapInfo(A);
+
+			// 양방향 delegate 브로드캐스트 (using public API)
+			FHitResult HitResult;
+			HitResult.Actor = B->GetOwner();
+			HitResult.Component = B;
+			A->NotifyComponentBeginOverlap(B, HitResult);
+
+			// A의 delegate 호출 후 B가 여전히 유효한지 확인
+			if (Event.ComponentA.IsValid() && Event.ComponentB.IsValid())
 			{
-				AllPrimitives.Add(PrimComp);
+				HitResult.Actor = A->GetOwner();
+				HitResult.Component = A;
+				B->NotifyComponentBeginOverlap(A, HitResult);
 			}
 		}
-	}
-
-	// 중복 pair 방지용
-	TSet<TPair<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UPrimitiveComponent>>, PairHash> ProcessedPairs;
-
-	// 이번 프레임에 검사된 컴포넌트 추적 (cleanup 로직에서 사용)
-	TSet<UPrimitiveComponent*> CheckedComponents;
-
-	// Dynamic primitives 수집 (1회만 - 성능 최적화)
-	TArray<UPrimitiveComponent*> DynamicPrims = GetDynamicPrimitives();
-
-	// 2. 각 component의 Broad Phase + Narrow Phase
-	// 핵심 최적화: bNeedsOverlapUpdate 플래그가 있는 것만 검사 (Unreal-style)
-	// - MarkAsDirty() 호출 시 플래그 설정됨 (이동한 컴포넌트)
-	// - 검사 후 플래그 클리어하여 다음 프레임에는 검사 안 함
-	for (UPrimitiveComponent* A : AllPrimitives)
-	{
-		if (!A)
-			continue;
-
-		// Skip if overlap events are disabled (Unreal-style)
-		if (!A->GetGenerateOverlapEvents())
-			continue;
-
-		// ✅ 핵심: bNeedsOverlapUpdate 플래그 체크 (이동한 것만 검사)
-		if (!A->GetNeedsOverlapUpdate())
-			continue;
-
-		// ✅ Static 컴포넌트 스킵 (Static은 MarkAsDirty 안 불리므로 플래그도 안 서지만 명시적으로 체크)
-		if (A->GetMobility() == EComponentMobility::Static)
-			continue;
-
-		// 이번 프레임에 검사된 컴포넌트로 추적
-		CheckedComponents.Add(A);
-
-		// === BROAD PHASE: Octree 쿼리로 후보 수집 ===
-		FBounds ABounds = A->CalcBounds();
-		FAABB AAABB(ABounds.Min, ABounds.Max);
-
-		TArray<UPrimitiveComponent*> Candidates;
-		StaticOctree->QueryAABB(AAABB, Candidates);
-
-		// Dynamic primitives 추가 (미리 수집한 리스트 재사용)
-		Candidates.Append(DynamicPrims);
-
-		for (UPrimitiveComponent* B : Candidates)
+		else
 		{
-			if (!B)
-				continue;
-
-			// 자기 자신 스킵
-			if (B == A)
-				continue;
-
-			// 같은 액터 스킵
-			if (B->GetOwner() == A->GetOwner())
-				continue;
-
-			// Skip if B also has overlap events disabled
-			// Both components must have overlap events enabled (Unreal behavior)
-			if (!B->GetGenerateOverlapEvents())
-				continue;
-
-			// NOTE: A는 bNeedsOverlapUpdate가 true인 것 (최근 이동함)
-			// B는 Octree/DynamicPrims에서 온 것 (Static 또는 다른 Movable)
-			// Static-Static는 자동 제외됨 (Static은 bNeedsOverlapUpdate가 false)
+			// EndOverlap - 양방향 상태 업데이트 (using public API)
+			A->RemoveOverlapInfo(B);
+			B->RemoveOverlapInfo(A);
 
-			// 중복 pair 방지 (정렬된 pair 생성, WeakObjectPtr 사용)
-			TPair<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UPrimitiveComponent>> Pair =
-				(A < B) ? TPair(TWeakObjectPtr<UPrimitiveComponent>(A), TWeakObjectPtr<UPrimitiveComponent>(B))
-				        : TPair(TWeakObjectPtr<UPrimitiveComponent>(B), TWeakObjectPtr<UPrimitiveComponent>(A));
+			A->NotifyComponentEndOverlap(B);
 
-			if (ProcessedPairs.Contains(Pair))
-				continue;
-
-			ProcessedPairs.Add(Pair);
-
-			// === NARROW PHASE: 정밀 충돌 테스트 ===
-			FBounds BBounds = B->CalcBounds();
-
-			// AABB 레벨 rejection
-			if (!ABounds.Overlaps(BBounds))
+			// A의 delegate 호출 후 B가 여전히 유효한지 확인
+			if (Event.ComponentA.IsValid() && Event.ComponentB.IsValid())
 			{
-				// AABB가 겹치지 않음 → overlap이 아님
-				bool bWasOverlapping = PreviousOverlapState.FindRef(Pair);
-				if (bWasOverlapping)
-				{
-					// EndOverlap 발생
-					A->RemoveOverlapInfo(B);
-					B->RemoveOverlapInfo(A);
-
-					// WeakObjectPtr 사용: Delegate 내부에서 객체 삭제 가능성 대비
-					TWeakObjectPtr<UPrimitiveComponent> WeakA(A);
-					TWeakObjectPtr<UPrimitiveComponent> WeakB(B);
-
-					A->NotifyComponentEndOverlap(B);
-
-					// A의 delegate 호출 후 B가 여전히 유효한지 확인
-					if (WeakA.IsValid() && WeakB.IsValid())
-					{
-						B->NotifyComponentEndOverlap(A);
-					}
-				}
-				PreviousOverlapState[Pair] = false;
-				continue;
+				B->NotifyComponentEndOverlap(A);
 			}
+		}
+	}
+}
 
-			// 정밀 shape 테스트
-			const IBoundingVolume* ShapeA = A->GetCollisionShape();
-			const IBoundingVolume* ShapeB = B->GetCollisionShape();
-
-			if (!ShapeA || !ShapeB)
-			{
-				// Shape가 없음 → overlap이 아님
-				bool bWasOverlapping = PreviousOverlapState.FindRef(Pair);
-				if (bWasOverlapping)
-				{
-					// EndOverlap 발생
-					A->RemoveOverlapInfo(B);
-					B->RemoveOverlapInfo(A);
+void ULevel::UpdateAllOverlaps()
+{
+	if (!OverlapBroadphase)
+		return;
 
-					// WeakObjectPtr 사용: Delegate 내부에서 객체 삭제 가능성 대비
-					TWeakObjectPtr<UPrimitiveComponent> WeakA(A);
-					TWeakObjectPtr<UPrimitiveComponent> WeakB(B);
+	// 1. BROAD PHASE: 지난 프레임 이후 이동한 proxy만 끝점 재정렬
+	// - MarkAsDirty() 호출 시 MarkPrimitiveOverlapMoved()로 기록됨
+	// - 정지한 컴포넌트는 비용이 없고, AABB overlap pair는 프레임 간 유지됨
+	FScopeCycleCounter BroadphaseCounter;
+	const TArray<int32>& MovedProxies = OverlapBroadphase->GetMovedProxies();
+	for (int32 ProxyIndex : MovedProxies)
+	{
+		OverlapBroadphase->UpdateProxy(ProxyIndex, OverlapBroadphase->GetPrimitive(ProxyIndex)->CalcBounds());
+	}
+	const uint32 MovedProxyCount = MovedProxies.Num();
+	const float BroadphaseMs = static_cast<float>(BroadphaseCounter.Finish());
 
-					A->NotifyComponentEndOverlap(B);
+	// 2. NARROW PHASE: 상태가 바뀐 pair만 이벤트로 기록
+	FScopeCycleCounter NarrowphaseCounter;
+	TFrameArray<FOverlapEvent> Events;
 
-					// A의 delegate 호출 후 B가 여전히 유효한지 확인
-					if (WeakA.IsValid() && WeakB.IsValid())
-					{
-						B->NotifyComponentEndOverlap(A);
-					}
-				}
-				PreviousOverlapState[Pair] = false;
-				continue;
-			}
+	// overlap 중이던 pair의 AABB가 떨어져 pair cache에서 제거됨 → EndOverlap
+	for (const FBroadphasePair& Pair : OverlapBroadphase->GetEndedPairs())
+	{
+		Events.Add({ OverlapBroadphase->GetPrimitive(Pair.ProxyA), OverlapBroadphase->GetPrimitive(Pair.ProxyB), false });
+	}
 
-			bool bIsOverlapping = FCollisionHelper::TestOverlap(ShapeA, ShapeB);
+	// 2-1. 검사 대상 수집 (게임 스레드): shape의 world 변환 갱신은 컴포넌트 상태를 바꾸므로 여기서 끝낸다
+	TArray<FBroadphasePair>& Pairs = OverlapBroadphase->GetPairs();
+	TFrameArray<FOverlapTestTask> TestTasks;
+	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
+	{
+		const FBroadphasePair& Pair = Pairs[PairIndex];
+		UPrimitiveComponent* A = OverlapBroadphase->GetPrimitive(Pair.ProxyA);
+		UPrimitiveComponent* B = OverlapBroadphase->GetPrimitive(Pair.ProxyB);
+
+		// 이동한 Movable 컴포넌트가 포함된 pair만 검사
+		// - 양쪽 다 안 움직였다면 overlap 상태 유지
+		// - Static은 검사 주체가 되지 않음 (Static-Static 제외)
+		const bool bCheckA = OverlapBroadphase->IsProxyMoved(Pair.ProxyA) && A->GetMobility() != EComponentMobility::Static;
+		const bool bCheckB = OverlapBroadphase->IsProxyMoved(Pair.ProxyB) && B->GetMobility() != EComponentMobility::Static;
+		if (!bCheckA && !bCheckB)
+			continue;
 
-			// 3. 이전 프레임 상태 비교
-			bool bWasOverlapping = PreviousOverlapState.FindRef(Pair);
+		TestTasks.Add({ A->GetCollisionShape(), B->GetCollisionShape(), PairIndex, Pair.bOverlapping });
+	}
 
-			// === EVENT HANDLING ===
-			if (bIsOverlapping && !bWasOverlapping)
-			{
-				// BeginOverlap - 양방향 상태 업데이트 (using public API)
-				A->AddOverlapInfo(B);
-				B->AddOverlapInfo(A);
-
-				// 양방향 delegate 브로드캐스트 (using public API)
-				// WeakObjectPtr 사용: Delegate 내부에서 객체 삭제 가능성 대비
-				TWeakObjectPtr<UPrimitiveComponent> WeakA(A);
-				TWeakObjectPtr<UPrimitiveComponent> WeakB(B);
-
-				FHitResult HitResult;
-				HitResult.Actor = B->GetOwner();
-				HitResult.Component = B;
-				A->NotifyComponentBeginOverlap(B, HitResult);
-
-				// A의 delegate 호출 후 B가 여전히 유효한지 확인
-				if (WeakA.IsValid() && WeakB.IsValid())
-				{
-					HitResult.Actor = A->GetOwner();
-					HitResult.Component = A;
-					B->NotifyComponentBeginOverlap(A, HitResult);
-				}
-			}
-			else if (!bIsOverlapping && bWasOverlapping)
-			{
-				// EndOverlap - 양방향 상태 업데이트 (using public API)
-				A->RemoveOverlapInfo(B);
-				B->RemoveOverlapInfo(A);
+	// 2-2. 정밀 shape 테스트 (태스크 스케줄러 스레드): AABB 레벨 rejection은 broad phase에서 끝남
+	// - 결과는 이전 프레임 상태(pair cache)와 달라진 것만, 수집 순서대로 반환됨
+	TFrameArray<FOverlapTestResult> ChangedResults;
+	FOverlapNarrowphase::Run(TestTasks, true, ChangedResults);
 
-				// 양방향 delegate 브로드캐스트 (using public API)
-				// WeakObjectPtr 사용: Delegate 내부에서 객체 삭제 가능성 대비
-				TWeakObjectPtr<UPrimitiveComponent> WeakA(A);
-				TWeakObjectPtr<UPrimitiveComponent> WeakB(B);
+	// 2-3. 상태 반영 (게임 스레드): 이벤트 순서는 워커 수와 무관하게 pair 순서를 따른다
+	for (const FOverlapTestResult& Result : ChangedResults)
+	{
+		FBroadphasePair& Pair = Pairs[TestTasks[Result.TaskIndex].PairIndex];
+		Pair.bOverlapping = Result.bIsOverlapping;
+		Events.Add({ OverlapBroadphase->GetPrimitive(Pair.ProxyA), OverlapBroadphase->GetPrimitive(Pair.ProxyB), Result.bIsOverlapping });
+	}
 
-				A->NotifyComponentEndOverlap(B);
+	// 검사 완료 후 플래그 클리어 (다음 프레임에는 이동하지 않으면 검사 안 함)
+	for (int32 ProxyIndex : MovedProxies)
+	{
+		OverlapBroadphase->GetPrimitive(ProxyIndex)->SetNeedsOverlapUpdate(false);
+	}
+	OverlapBroadphase->ClearMovedProxies();
+	OverlapBroadphase->ClearEndedPairs();
+	const float NarrowphaseMs = static_cast<float>(NarrowphaseCounter.Finish());
 
-				// A의 delegate 호출 후 B가 여전히 유효한지 확인
-				if (WeakA.IsValid() && WeakB.IsValid())
-				{
-					B->NotifyComponentEndOverlap(A);
-				}
-			}
+	// 3. EVENT HANDLING: 검사가 모두 끝난 뒤 발생시키므로 delegate에서 컴포넌트가 추가/제거되어도 안전
+	uint32 BeginOverlapCount = 0;
+	for (const FOverlapEvent& Event : Events)
+	{
+		BeginOverlapCount += Event.bBeginOverlap ? 1 : 0;
+		DispatchOverlapEvent(Event);
+	}
 
-			// 상태 저장
-			PreviousOverlapState[Pair] = bIsOverlapping;
-		}
+	UStatOverlay::GetInstance().RecordOverlapStats(
+		OverlapBroadphase->GetProxyCount(), MovedProxyCount, OverlapBroadphase->GetPairCount(), TestTasks.Num(),
+		BeginOverlapCount, Events.Num() - BeginOverlapCount, BroadphaseMs, NarrowphaseMs);
+}
 
-		// 검사 완료 후 플래그 클리어 (다음 프레임에는 이동하지 않으면 검사 안 함)
-		A->SetNeedsOverlapUpdate(false);
+void ULevel::UpdatePrimitiveOverlapProxy(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent || !OverlapBroadphase)
+	{
+		return;
 	}
 
-	// 4. EndOverlap 정리: 이전 프레임에 overlap이었지만 현재 프레임에 체크되지 않은 pair
-	//    (두 컴포넌트가 멀어져서 Octree 쿼리 결과에 나타나지 않은 경우)
-	//
-	//    중요: "체크되지 않음"의 의미를 구분해야 함!
-	//    1. 실제로 멀어져서 검사 안 됨 → EndOverlap 발생 ✅
-	//    2. 양쪽 다 안 움직여서 검사 안 함 → overlap 상태 유지 ✅
-	TArray<TPair<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UPrimitiveComponent>>> PairsToRemove;
-
-	for (auto& [Pair, bWasOverlapping] : PreviousOverlapState)
+	if (InComponent->GetGenerateOverlapEvents())
 	{
-		// 이번 프레임에 체크되지 않았지만 이전에는 overlap이었던 pair
-		if (bWasOverlapping && !ProcessedPairs.Contains(Pair))
+		// 레벨에 등록된(Octree 또는 동적 트리에 있는) 컴포넌트만 추가
+		if (StaticOctree->Contains(InComponent) || DynamicProxyIds.Contains(InComponent))
 		{
-			// WeakObjectPtr에서 raw pointer 가져오기 (삭제된 객체는 nullptr 반환)
-			UPrimitiveComponent* A = Pair.first.Get();
-			UPrimitiveComponent* B = Pair.second.Get();
-
-			// 컴포넌트가 여전히 유효한지 확인 (WeakObjectPtr이 자동으로 nullptr 체크)
-			if (A && B)
-			{
-				// ✅ 핵심: CheckedComponents로 이번 프레임에 검사되었는지 확인
-				bool bAWasChecked = CheckedComponents.Contains(A);
-				bool bBWasChecked = CheckedComponents.Contains(B);
+			AddOverlapProxy(InComponent);
+		}
+	}
+	else
+	{
+		RemoveOverlapProxy(InComponent, true);
+	}
+}
 
-				// ProcessedPairs에 없는 이유를 판단:
-				// 1. 둘 중 하나라도 검사되었다면 → 실제로 멀어진 것 (EndOverlap 발생)
-				// 2. 둘 다 검사 안 되었다면 → 양쪽 다 안 움직임 (overlap 상태 유지)
-				bool bShouldCleanup = false;
+void ULevel::MarkPrimitiveOverlapMoved(UPrimitiveComponent* InComponent)
+{
+	if (OverlapBroadphase && InComponent->OverlapProxyIndex >= 0)
+	{
+		OverlapBroadphase->MarkProxyMoved(InComponent->OverlapProxyIndex);
+	}
+}
 
-				if (bAWasChecked || bBWasChecked)
-				{
-					// 둘 중 하나라도 검사되었는데 ProcessedPairs에 없다
-					// = 실제로 멀어져서 Octree 쿼리에서 안 나옴
-					bShouldCleanup = true;
-				}
-				else
-				{
-					// 둘 다 검사 안 됨 (양쪽 다 안 움직임)
-					// → overlap 상태 유지
-					bShouldCleanup = false;
-				}
+void ULevel::AddOverlapProxy(UPrimitiveComponent* InComponent)
+{
+	if (!OverlapBroadphase || !InComponent->GetGenerateOverlapEvents() || InComponent->OverlapProxyIndex >= 0)
+	{
+		return;
+	}
 
-				// 추가 체크: overlap events가 꺼진 경우도 cleanup
-				if (!A->GetGenerateOverlapEvents() || !B->GetGenerateOverlapEvents())
-				{
-					bShouldCleanup = true;
-				}
+	// 새 proxy는 이동한 상태로 표시되므로 다음 UpdateAllOverlaps()에서 초기 overlap이 검사된다
+	InComponent->OverlapProxyIndex = OverlapBroadphase->CreateProxy(InComponent, InComponent->CalcBounds());
+}
 
-				if (bShouldCleanup)
-				{
-					// 이벤트 발생 시에만 로깅
-					UE_LOG("[UpdateAllOverlaps] Cleanup - EndOverlap: [%s]%s <-> [%s]%s",
-						A->GetOwner() ? A->GetOwner()->GetName().ToString().c_str() : "None",
-						A->GetName().ToString().c_str(),
-						B->GetOwner() ? B->GetOwner()->GetName().ToString().c_str() : "None",
-						B->GetName().ToString().c_str());
-
-					// EndOverlap - 양방향 상태 업데이트
-					A->RemoveOverlapInfo(B);
-					B->RemoveOverlapInfo(A);
-
-					// 양방향 delegate 브로드캐스트
-					// WeakObjectPtr 사용: Delegate 내부에서 객체 삭제 가능성 대비
-					TWeakObjectPtr<UPrimitiveComponent> WeakA(A);
-					TWeakObjectPtr<UPrimitiveComponent> WeakB(B);
-
-					A->NotifyComponentEndOverlap(B);
-
-					// A의 delegate 호출 후 B가 여전히 유효한지 확인
-					if (WeakA.IsValid() && WeakB.IsValid())
-					{
-						B->NotifyComponentEndOverlap(A);
-					}
-
-					// 제거할 pair 목록에 추가
-					PairsToRemove.Add(Pair);
-				}
-			}
-			else
-			{
-				// 컴포넌트가 삭제되었으면 맵에서 제거 (댕글링 포인터 방지)
-				PairsToRemove.Add(Pair);
-			}
-		}
+void ULevel::RemoveOverlapProxy(UPrimitiveComponent* InComponent, bool bNotifyEndOverlap)
+{
+	if (!OverlapBroadphase || InComponent->OverlapProxyIndex < 0)
+	{
+		return;
 	}
 
-	// 더 이상 overlap이 아닌 pair 제거
-	for (const auto& Pair : PairsToRemove)
+	TArray<UPrimitiveComponent*> OverlappingComponents;
+	OverlapBroadphase->DestroyProxy(InComponent->OverlapProxyIndex, OverlappingComponents);
+	InComponent->OverlapProxyIndex = -1;
+
+	for (UPrimitiveComponent* Other : OverlappingComponents)
 	{
-		PreviousOverlapState.Remove(Pair);
+		if (bNotifyEndOverlap)
+		{
+			DispatchOverlapEvent({ InComponent, Other, false });
+		}
+		else
+		{
+			// 레벨에서 제거되는 컴포넌트: 상대 쪽에 남은 overlap 정보만 정리
+			InComponent->RemoveOverlapInfo(Other);
+			Other->RemoveOverlapInfo(InComponent);
+		}
 	}
 }
 
@@ -947,9 +800,7 @@ bool ULevel::SweepComponentSingle(UPrimitiveComponent* Component, const FVector&
 	TArray<UPrimitiveComponent*> Candidates;
 	StaticOctree->QueryAABB(TargetAABB, Candidates);
 
-	// Dynamic primitives도 추가
-	TArray<UPrimitiveComponent*> DynamicPrims = GetDynamicPrimitives();
-	Candidates.Append(DynamicPrims);
+	DynamicPrimitiveTree->QueryAABB(TargetAABB, Candidates);
 
 	// 4. 목표 위치에서의 collision shape 준비
 	const IBoundingVolume* ComponentShape = Component->GetCollisionShape();
@@ -1044,9 +895,7 @@ bool ULevel::SweepComponentMulti(
 	TArray<UPrimitiveComponent*> Candidates;
 	StaticOctree->QueryAABB(TargetAABB, Candidates);
 
-	// Dynamic primitives도 추가
-	TArray<UPrimitiveComponent*> DynamicPrims = GetDynamicPrimitives();
-	Candidates.Append(DynamicPrims);
+	DynamicPrimitiveTree->QueryAABB(TargetAABB, Candidates);
 
 	// 4. 목표 위치에서의 collision shape 준비
 	const IBoundingVolume* ComponentShape = Component->GetCollisionShape();
@@ -1112,9 +961,7 @@ bool ULevel::LineTraceSingle(const FVector& Start, const FVector& End, FHitResul
 	TArray<UPrimitiveComponent*> Candidates;
 	StaticOctree->QueryAABB(TraceAABB, Candidates);
 
-	// Dynamic primitives도 포함
-	TArray<UPrimitiveComponent*> DynamicPrims = GetDynamicPrimitives();
-	Candidates.Append(DynamicPrims);
+	DynamicPrimitiveTree->QueryAABB(TraceAABB, Candidates);
 
 	bool bFoundHit = false;
 	float ClosestDistance = FLT_MAX;
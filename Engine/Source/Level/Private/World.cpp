@@ -109,9 +109,6 @@ void UWorld::Tick(float DeltaTimes)
 	// 스폰 / 삭제 처리
 	FlushPendingDestroy();
 
-	// TODO: 현재 임시로 OCtree 업데이트 처리
-	Level->UpdateOctree();
-
 	if (WorldType == EWorldType::Editor )
 	{
 		// 액터 배열 복사본으로 순회 (Tick 도중 액터가 추가/삭제될 수 있음)
@@ -8,21 +8,10 @@ class UPrimitiveComponent;
 class UPointLightComponent;
 class ULightComponent;
 class FOctree;
+class FDynamicAABBTree;
+class FOverlapBroadphase;
 class UCurveLibrary;
 
-// Custom hash function for pair of WeakObjectPtr (used in overlap tracking)
-struct PairHash
-{
-	template <typename T>
-	std::size_t operator()(const std::pair<TWeakObjectPtr<T>, TWeakObjectPtr<T>>& Pair) const
-	{
-		// WeakObjectPtr.Get()으로 raw pointer를 가져와서 해시
-		std::size_t H1 = std::hash<T*>{}(Pair.first.Get());
-		std::size_t H2 = std::hash<T*>{}(Pair.second.Get());
-		return H1 ^ (H2 << 1); // Simple hash combination
-	}
-};
-
 UCLASS()
 class ULevel :
 	public UObject
@@ -67,27 +56,10 @@ public:
 	FOctree* GetStaticOctree() { return StaticOctree; }
 
 	/**
-	 * @brief Octree 범위 밖에 있는 동적 프리미티브 목록 반환
-	 * @return 동적 프리미티브 배열 (값 복사)
-	 * @note 참조 무효화 방지를 위해 값으로 반환 (각 호출자가 독립적인 복사본 획득)
-	 * @todo 성능 최적화: DirtyFlag와 캐시된 배열 도입
-	 *       - 멤버 변수: TArray<UPrimitiveComponent*> CachedDynamicPrimitives
-	 *       - 플래그: bool bIsDynamicPrimitivesCacheDirty
-	 *       - OnPrimitiveUpdated/OnPrimitiveUnregistered에서 DirtyFlag 설정
-	 *       - GetDynamicPrimitives()에서 캐시가 유효하면 재사용
-	 *       - 예상 성능 개선: 매 프레임 복사 비용 제거 (특히 다중 호출 시)
+	 * @brief 움직인 프리미티브와 Octree 범위 밖의 프리미티브를 보관하는 동적 AABB 트리
+	 * @note Octree에는 로드 이후 움직이지 않은 프리미티브만 남는다. 쿼리 시 두 트리를 모두 검사해야 한다.
 	 */
-	TArray<UPrimitiveComponent*> GetDynamicPrimitives() const
-	{
-		TArray<UPrimitiveComponent*> Result;
-		Result.Reserve(DynamicPrimitiveMap.Num());
-
-		for (auto [Component, TimePoint] : DynamicPrimitiveMap)
-		{
-			Result.Add(Component);
-		}
-		return Result;
-	}
+	FDynamicAABBTree* GetDynamicPrimitiveTree() const { return DynamicPrimitiveTree; }
 
 	friend class UWorld;
 
@@ -128,7 +100,6 @@ private:
 		Octree Management
 	-----------------------------------------------------------------------------*/
 public:
-	void UpdateOctree();
 	void UpdateOctreeImmediate();
 
 private:
@@ -137,30 +108,13 @@ private:
 
 	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
 
-	/** @brief 한 프레임에 Octree에 삽입할 오브젝트의 최대 크기를 결정해서 부하를 여러 프레임에 분산함. */
-	static constexpr uint32 MAX_OBJECTS_TO_INSERT_PER_FRAME = 256;
-
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent를 Octree에 삽입하기 위해 필요한 구조체. */
-	struct FDynamicPrimitiveData
-	{
-		UPrimitiveComponent* Primitive;
-		float LastMoveTimePoint;
-
-		bool operator>(const FDynamicPrimitiveData& Other) const
-		{
-			return LastMoveTimePoint > Other.LastMoveTimePoint;
-		}
-	};
-
-	using FDynamicPrimitiveQueue = TQueue<FDynamicPrimitiveData>;
-
 	FOctree* StaticOctree = nullptr;
 
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent부터 순서대로 Octree에 삽입할 수 있도록 보관 */
-	FDynamicPrimitiveQueue DynamicPrimitiveQueue;
+	/** @brief Movable 프리미티브가 처음 움직이면 Octree에서 이 트리로 옮겨지고, 이후에는 fat AABB를 벗어날 때만 재배치된다. */
+	FDynamicAABBTree* DynamicPrimitiveTree = nullptr;
 
-	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
-	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+	/** @brief 동적 트리에 있는 프리미티브 → Proxy ID */
+	TFlatMap<UPrimitiveComponent*, int32> DynamicProxyIds;
 
 	/*-----------------------------------------------------------------------------
 		Lighting Management
@@ -180,10 +134,20 @@ public:
 	 * @note World::Tick()에서 호출되며, 모든 primitive component의 overlap을 한번에 체크
 	 *       - Component tick 여부와 무관하게 동작
 	 *       - 양방향 상태 + 이벤트 동기화
-	 *       - 중복 overlap 테스트 방지 (각 pair는 한 번만 체크)
+	 *       - Broad phase: 지난 프레임 이후 이동한 proxy만 sweep-and-prune으로 갱신 (pair cache 유지)
+	 *       - Narrow phase: 이동한 Movable 컴포넌트가 포함된 pair만 정밀 검사하고 상태가 바뀐 pair만 이벤트 발생
 	 */
 	void UpdateAllOverlaps();
 
+	/**
+	 * @brief 컴포넌트의 GenerateOverlapEvents 설정에 맞춰 overlap broadphase proxy를 추가/제거
+	 * @note 설정이 꺼지면 겹쳐 있던 상대와 EndOverlap 이벤트를 즉시 발생시킨다.
+	 */
+	void UpdatePrimitiveOverlapProxy(UPrimitiveComponent* InComponent);
+
+	//@brief 이동한 컴포넌트를 다음 UpdateAllOverlaps의 broad phase 갱신 대상으로 표시
+	void MarkPrimitiveOverlapMoved(UPrimitiveComponent* InComponent);
+
 	/**
 	 * @brief 컴포넌트가 특정 위치로 이동했을 때 첫 번째로 충돌하는 컴포넌트 반환 (실제 이동 없이 테스트만)
 	 * @param Component 테스트할 컴포넌트
@@ -247,10 +211,13 @@ public:
 	);
 
 private:
+	void AddOverlapProxy(UPrimitiveComponent* InComponent);
+	//@param bNotifyEndOverlap: false이면 (컴포넌트 제거 시) 이벤트 없이 overlap 정보만 정리
+	void RemoveOverlapProxy(UPrimitiveComponent* InComponent, bool bNotifyEndOverlap);
+
 	/**
-	 * @brief 이전 프레임의 overlap 상태 추적 (변화 감지용)
-	 * @note Key: 정렬된 component pair (A < B 기준, WeakObjectPtr로 댕글링 포인터 방지)
-	 *       Value: overlap 상태 (true = overlapping, false = not overlapping)
+	 * @brief GenerateOverlapEvents가 켜진 등록 컴포넌트의 AABB pair cache
+	 * @note 각 pair가 마지막 narrow phase 결과를 함께 저장하므로 이전 프레임 상태 맵이 필요 없다.
 	 */
-	TMap<TPair<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UPrimitiveComponent>>, bool, PairHash> PreviousOverlapState;
+	FOverlapBroadphase* OverlapBroadphase = nullptr;
 };
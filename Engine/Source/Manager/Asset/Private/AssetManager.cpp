@@ -8,22 +8,38 @@
 #include "Manager/Path/Public/PathManager.h"
 #include "Manager/Asset/Public/FbxManager.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+
+namespace
+{
+	// 비동기 로드가 끝나기 전에 메시 대신 그릴 에셋
+	const char* PLACEHOLDER_STATIC_MESH_PATH = "Data/Shapes/Cube.obj";
+}
 
 IMPLEMENT_SINGLETON_CLASS(UAssetManager, UObject)
 UAssetManager::UAssetManager()
 {
 	TextureManager = new FTextureManager();
+	AsyncLoader = new FAsyncAssetLoader(TextureManager);
 }
 
 UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
-	TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
-	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
-	LoadAllObjStaticMesh();
 	FFbxImporter::Initialize();
-	LoadAllFbxMesh();  // FBX 통합 로드 (Static + Skeletal)
+
+	// 플레이스홀더 메시는 다른 요청보다 먼저 로드
+	FAssetLoadHandle PlaceholderHandle = RequestAsyncLoad(FName(PLACEHOLDER_STATIC_MESH_PATH));
+	PlaceholderHandle.Wait();
+	PlaceholderStaticMesh = PlaceholderHandle.Get<UStaticMesh>();
+
+	// Data 폴더 속 모든 텍스처, .obj, .fbx 파일을 워커 스레드에서 로드 후 캐싱
+	// 메시가 참조하는 텍스처는 메시와 동시에 로드되고, GPU 업로드와 UObject 생성만 메인 스레드에서 수행
+	FScopeCycleCounter LoadCounter;
+	const int32 RequestCount = RequestAllAssetsInDataDirectory({ ".png", ".dds", ".jpg", ".jpeg", ".bmp", ".tiff", ".obj", ".fbx" });
+	WaitForAsyncLoads();
+	UE_LOG_SUCCESS("[UAssetManager] 에셋 %d개 로드 완료 (%.2f ms)", RequestCount, LoadCounter.Finish());
 
 	VertexDatas.Emplace(EPrimitiveType::Torus, &VerticesTorus);
 	VertexDatas.Emplace(EPrimitiveType::Arrow, &VerticesArrow);
@@ -93,6 +109,10 @@ void UAssetManager::Initialize()
 
 void UAssetManager::Release()
 {
+	// 진행 중인 로드가 캐시에 등록을 마친 뒤 해제
+	WaitForAsyncLoads();
+	SafeDelete(AsyncLoader);
+
 	// TMap.Value()
 	for (auto& Pair : VertexBuffers)
 	{
@@ -156,129 +176,104 @@ void UAssetManager::Release()
  */
 void UAssetManager::LoadAllObjStaticMesh()
 {
-	TArray<FName> ObjList;
+	RequestAllAssetsInDataDirectory({ ".obj" });
+	WaitForAsyncLoads();
+}
+
+void UAssetManager::LoadAllFbxMesh()
+{
+	// FBX 통합 로드 (Static + Skeletal). 스켈레탈 메시는 내부 StaticMesh도 StaticMeshCache에 등록된다
+	RequestAllAssetsInDataDirectory({ ".fbx" });
+	WaitForAsyncLoads();
+}
+
+int32 UAssetManager::RequestAllAssetsInDataDirectory(const TSet<FString>& InExtensions)
+{
 	const FString DataDirectory = "Data/"; // 검색할 기본 디렉토리
-	// 디렉토리가 실제로 존재하는지 먼저 확인합니다.
-	if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+	if (!std::filesystem::exists(DataDirectory) || !std::filesystem::is_directory(DataDirectory))
 	{
-		// recursive_directory_iterator를 사용하여 디렉토리와 모든 하위 디렉토리를 순회합니다.
-		for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
-		{
-			// 현재 항목이 일반 파일이고, 확장자가 ".obj"인지 확인합니다.
-			if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
-			{
-				// .generic_string()을 사용하여 OS에 상관없이 '/' 구분자를 사용하는 경로를 바로 얻습니다.
-				FString PathString = Entry.path().generic_string();
-
-				// 찾은 파일 경로를 FName으로 변환하여 ObjList에 추가합니다.
-				ObjList.Emplace(FName(PathString));
-			}
-		}
+		return 0;
 	}
 
-	// Enable winding order flip for this OBJ file
-	FObjImporter::Configuration Config;
-	Config.bFlipWindingOrder = false;
-	Config.bIsBinaryEnabled = true;
-	Config.bPositionToUEBasis = true;
-	Config.bNormalToUEBasis = true;
-	Config.bUVToUEBasis = true;
-
-	// 범위 기반 for문을 사용하여 배열의 모든 요소를 순회합니다.
-	for (const FName& ObjPath : ObjList)
+	int32 RequestCount = 0;
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
 	{
-		// FObjManager가 UStaticMesh 포인터를 반환한다고 가정합니다.
-		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config);
-
-		// 로드에 성공했는지 확인합니다.
-		if (LoadedMesh)
+		if (!Entry.is_regular_file())
 		{
-			StaticMeshCache.Emplace(ObjPath, LoadedMesh);
+			continue;
+		}
 
-			StaticMeshVertexBuffers.Emplace(ObjPath, this->CreateVertexBuffer(LoadedMesh->GetVertices()));
-			StaticMeshIndexBuffers.Emplace(ObjPath, this->CreateIndexBuffer(LoadedMesh->GetIndices()));
+		FString Extension = Entry.path().extension().string();
+		std::ranges::transform(Extension, Extension.begin(), ::tolower);
+		if (InExtensions.Contains(Extension))
+		{
+			// .generic_string()을 사용하여 OS에 상관없이 '/' 구분자를 사용하는 경로를 키로 사용
+			RequestAsyncLoad(FName(Entry.path().generic_string()));
+			++RequestCount;
 		}
 	}
+	return RequestCount;
 }
 
-void UAssetManager::LoadAllFbxMesh()
+FAssetLoadHandle UAssetManager::RequestAsyncLoad(const FName& InPath, TFunction<void(UObject*)> InCallback)
 {
-	TArray<FName> FbxList;
-	const FString DataDirectory = "Data/";
+	return AsyncLoader->RequestLoad(InPath, std::move(InCallback));
+}
 
-	if (std::filesystem::exists(DataDirectory))
+void UAssetManager::WaitForAsyncLoads()
+{
+	if (AsyncLoader)
 	{
-		for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
-		{
-			if (Entry.is_regular_file() && Entry.path().extension() == ".fbx")
-			{
-				FbxList.Emplace(FName(Entry.path().generic_string()));
-			}
-		}
+		AsyncLoader->WaitAll();
 	}
+}
 
-	FFbxImporter::Configuration Config;
-	Config.bIsBinaryEnabled = true;
+bool UAssetManager::IsAsyncLoading() const
+{
+	return AsyncLoader && AsyncLoader->GetPendingCount() > 0;
+}
 
-	// 1. FBX 파일 순회 로드
-	for (const FName& FbxPath : FbxList)
+UTexture* UAssetManager::GetPlaceholderTexture()
+{
+	return TextureManager->GetPlaceholderTexture();
+}
+
+void UAssetManager::RegisterStaticMesh(const FName& InPath, UStaticMesh* InStaticMesh, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer)
+{
+	if (!InStaticMesh)
 	{
-		UObject* LoadedObject = FFbxManager::LoadFbxMesh(FbxPath, Config);
-		if (!LoadedObject)
-		{
-			UE_LOG_ERROR("FBX 로드 실패: %s", FbxPath.ToString().c_str());
-			continue;
-		}
+		SafeRelease(InVertexBuffer);
+		SafeRelease(InIndexBuffer);
+		return;
+	}
 
-		// Static Mesh 타입이면 바로 등록
-		if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(LoadedObject))
-		{
-			StaticMeshCache.Emplace(FbxPath, StaticMesh);
-			StaticMeshVertexBuffers.Emplace(FbxPath, CreateVertexBuffer(StaticMesh->GetVertices()));
-			StaticMeshIndexBuffers.Emplace(FbxPath, CreateIndexBuffer(StaticMesh->GetIndices()));
+	AddStaticMeshToCache(InPath, InStaticMesh);
 
-			UE_LOG_SUCCESS("[UAssetManager] FBX StaticMesh 로드 완료: %s", FbxPath.ToString().c_str());
-		}
-		// Skeletal Mesh 타입이면 캐싱 + StaticMesh 캐싱 병행
-		else if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(LoadedObject))
-		{
-			AddSkeletalMeshToCache(FbxPath, SkeletalMesh);
-			UE_LOG_SUCCESS("[UAssetManager] FBX SkeletalMesh 로드 완료: %s", FbxPath.ToString().c_str());
-
-			// 내부 StaticMesh를 StaticMeshCache에도 등록 (스태틱 렌더링용)
-			if (UStaticMesh* InnerStaticMesh = SkeletalMesh->GetStaticMesh())
-			{
-				StaticMeshCache.Emplace(FbxPath, InnerStaticMesh);
-				StaticMeshVertexBuffers.Emplace(FbxPath, CreateVertexBuffer(InnerStaticMesh->GetVertices()));
-				StaticMeshIndexBuffers.Emplace(FbxPath, CreateIndexBuffer(InnerStaticMesh->GetIndices()));
-
-				UE_LOG_SUCCESS("[UAssetManager] FBX SkeletalMesh → StaticMesh 캐싱 완료: %s", FbxPath.ToString().c_str());
-			}
-			else
-			{
-				UE_LOG_WARNING("[UAssetManager] SkeletalMesh에 StaticMesh 데이터가 없습니다: %s", FbxPath.ToString().c_str());
-			}
-		}
-		else
-		{
-			UE_LOG_WARNING("[UAssetManager] 알 수 없는 FBX 타입: %s", FbxPath.ToString().c_str());
-		}
+	// 같은 경로가 이미 등록되어 있으면 새로 만든 버퍼는 버린다
+	if (StaticMeshVertexBuffers.Contains(InPath))
+	{
+		SafeRelease(InVertexBuffer);
 	}
-
-	// 2. 스태틱 메시 AABB 계산 (스켈레탈 내부 메시 포함)
-	for (const auto& MeshPair : StaticMeshCache)
+	else
 	{
-		const FName& ObjPath = MeshPair.first;
-		UStaticMesh* StaticMesh = MeshPair.second;
-
-		if (!StaticMesh || !StaticMesh->IsValid())
-			continue;
+		StaticMeshVertexBuffers.Emplace(InPath, InVertexBuffer ? InVertexBuffer : CreateVertexBuffer(InStaticMesh->GetVertices()));
+	}
 
-		const auto& Vertices = StaticMesh->GetVertices();
-		if (Vertices.IsEmpty())
-			continue;
+	if (StaticMeshIndexBuffers.Contains(InPath))
+	{
+		SafeRelease(InIndexBuffer);
+	}
+	else
+	{
+		// LOD 인덱스는 LOD0 인덱스 뒤에 이어 붙여 하나의 버퍼로 만든다
+		const FStaticMesh* StaticMeshAsset = InStaticMesh->GetStaticMeshAsset();
+		StaticMeshIndexBuffers.Emplace(InPath, InIndexBuffer ? InIndexBuffer
+			: CreateIndexBuffer(StaticMeshAsset ? StaticMeshAsset->GetRenderIndices() : InStaticMesh->GetIndices()));
+	}
 
-		StaticMeshAABBs[ObjPath] = CalculateAABB(Vertices);
+	if (InStaticMesh->IsValid() && !InStaticMesh->GetVertices().IsEmpty())
+	{
+		StaticMeshAABBs[InPath] = CalculateAABB(InStaticMesh->GetVertices());
 	}
 }
 
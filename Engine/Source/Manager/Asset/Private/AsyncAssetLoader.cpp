@@ -0,0 +1,490 @@
+#include "pch.h"
+#include "Manager/Asset/Public/AsyncAssetLoader.h"
+
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/TextureManager.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/FbxManager.h"
+#include "Manager/Asset/Public/StaticMeshCooker.h"
+#include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Texture/Public/Texture.h"
+
+/**
+ * @brief 요청된 에셋의 종류 (확장자로 판단)
+ */
+enum class EAsyncAssetType : uint8
+{
+	Texture,
+	ObjStaticMesh,
+	FbxMesh,
+};
+
+/**
+ * @brief 비동기 로드 요청 하나
+ * @note Asset과 Callbacks는 메인 스레드(Finalize 단계)에서만 기록되며, State를 release로 저장해 공개한다.
+ *       Load 단계의 결과 필드는 LoadTask 완료가 Finalize의 선행 조건이므로 별도 동기화 없이 넘겨받는다.
+ */
+struct FAsyncAssetRequest
+{
+	FName Path;  // 텍스처는 FTextureManager의 캐시 키
+	EAsyncAssetType Type = EAsyncAssetType::Texture;
+	std::atomic<EAssetLoadState> State{ EAssetLoadState::Loading };
+	UObject* Asset = nullptr;
+	TArray<TFunction<void(UObject*)>> Callbacks;
+
+	FTaskRef LoadTask;      // 요청 생성 시 설정
+	FTaskRef FinalizeTask;  // LoadTask가 끝나기 전에 설정 (텍스처는 생성 시, 메시는 Load 단계의 끝에서)
+
+	// Load 단계 결과
+	path AbsolutePath;
+	FTextureFileData TextureData;
+	std::unique_ptr<FStaticMesh> StaticMeshAsset;
+	ID3D11Buffer* VertexBuffer = nullptr;
+	ID3D11Buffer* IndexBuffer = nullptr;
+	std::unique_ptr<FFbxSkeletalMeshInfo> SkeletalMeshInfo;
+	TArray<FFbxAnimSequenceInfo> Animations;
+};
+
+namespace
+{
+	bool GetAssetType(const FString& InExtension, EAsyncAssetType& OutType)
+	{
+		static const TSet<FString> TextureExtensions = { ".png", ".dds", ".jpg", ".jpeg", ".bmp", ".tiff" };
+
+		if (InExtension == ".obj")
+		{
+			OutType = EAsyncAssetType::ObjStaticMesh;
+			return true;
+		}
+		if (InExtension == ".fbx")
+		{
+			OutType = EAsyncAssetType::FbxMesh;
+			return true;
+		}
+		if (TextureExtensions.Contains(InExtension))
+		{
+			OutType = EAsyncAssetType::Texture;
+			return true;
+		}
+		return false;
+	}
+
+	FString GetLowerExtension(const FName& InPath)
+	{
+		FString Extension = path(InPath.ToString()).extension().string();
+		std::ranges::transform(Extension, Extension.begin(), ::tolower);
+		return Extension;
+	}
+
+	// 기존 UAssetManager::LoadAllObjStaticMesh의 설정과 동일
+	FObjImporter::Configuration GetObjImportConfig()
+	{
+		FObjImporter::Configuration Config;
+		Config.bFlipWindingOrder = false;
+		Config.bIsBinaryEnabled = true;
+		Config.bPositionToUEBasis = true;
+		Config.bNormalToUEBasis = true;
+		Config.bUVToUEBasis = true;
+		return Config;
+	}
+
+	FFbxImporter::Configuration GetFbxImportConfig()
+	{
+		FFbxImporter::Configuration Config;
+		Config.bIsBinaryEnabled = true;
+		return Config;
+	}
+}
+
+// ========================================
+// FAssetLoadHandle
+// ========================================
+
+FAssetLoadHandle::FAssetLoadHandle(const TSharedPtr<FAsyncAssetRequest>& InRequest)
+	: Request(InRequest)
+{
+}
+
+bool FAssetLoadHandle::IsDone() const
+{
+	return GetState() != EAssetLoadState::Loading;
+}
+
+bool FAssetLoadHandle::IsLoaded() const
+{
+	return GetState() == EAssetLoadState::Loaded;
+}
+
+EAssetLoadState FAssetLoadHandle::GetState() const
+{
+	return Request ? Request->State.load(std::memory_order_acquire) : EAssetLoadState::Failed;
+}
+
+FName FAssetLoadHandle::GetPath() const
+{
+	return Request ? Request->Path : FName();
+}
+
+UObject* FAssetLoadHandle::GetAsset() const
+{
+	return IsLoaded() ? Request->Asset : nullptr;
+}
+
+void FAssetLoadHandle::Wait() const
+{
+	if (!Request)
+	{
+		return;
+	}
+
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	Scheduler.Wait(Request->LoadTask);
+	Scheduler.Wait(Request->FinalizeTask);
+}
+
+// ========================================
+// FAsyncAssetLoader
+// ========================================
+
+FAsyncAssetLoader::FAsyncAssetLoader(FTextureManager* InTextureManager)
+	: TextureManager(InTextureManager)
+{
+}
+
+FAsyncAssetLoader::~FAsyncAssetLoader() = default;
+
+bool FAsyncAssetLoader::IsSupportedExtension(const FString& InExtension)
+{
+	EAsyncAssetType Type;
+	return GetAssetType(InExtension, Type);
+}
+
+FAssetLoadHandle FAsyncAssetLoader::RequestLoad(const FName& InPath, TFunction<void(UObject*)> InCallback)
+{
+	EAsyncAssetType Type;
+	if (!GetAssetType(GetLowerExtension(InPath), Type))
+	{
+		UE_LOG_ERROR("[AsyncAssetLoader] 지원하지 않는 에셋 형식입니다: %s", InPath.ToString().c_str());
+		return FAssetLoadHandle();
+	}
+
+	// 텍스처는 동기 로드(FTextureManager::LoadTexture)와 같은 키를 사용해야 캐시를 공유한다
+	path AbsolutePath;
+	const FName Key = Type == EAsyncAssetType::Texture ? FTextureManager::MakeCacheKey(InPath, &AbsolutePath) : InPath;
+
+	TSharedPtr<FAsyncAssetRequest> Request;
+	bool bIsAlreadyDone = false;
+	{
+		// Dispatch까지 잠근 채로 수행해 다른 스레드가 태스크가 설정되지 않은 요청을 보지 못하게 한다
+		std::lock_guard<std::recursive_mutex> Lock(RequestsMutex);
+
+		if (TSharedPtr<FAsyncAssetRequest>* FoundRequest = Requests.Find(Key))
+		{
+			Request = *FoundRequest;
+			bIsAlreadyDone = Request->State.load(std::memory_order_acquire) != EAssetLoadState::Loading;
+			if (InCallback && !bIsAlreadyDone)
+			{
+				Request->Callbacks.Add(std::move(InCallback));
+			}
+		}
+		else
+		{
+			Request = MakeShared<FAsyncAssetRequest>();
+			Request->Path = Key;
+			Request->Type = Type;
+			Request->AbsolutePath = AbsolutePath;
+			if (InCallback)
+			{
+				Request->Callbacks.Add(std::move(InCallback));
+			}
+
+			Requests.Emplace(Key, Request);
+			PendingCount.fetch_add(1, std::memory_order_acq_rel);
+			DispatchLoad(Request);
+		}
+	}
+
+	// 이미 끝난 요청이면 콜백을 바로 (메인 스레드가 아니면 다음 MainThread 처리 때) 호출
+	if (bIsAlreadyDone && InCallback)
+	{
+		FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+		UObject* Asset = Request->Asset;
+		if (Scheduler.IsInMainThread())
+		{
+			InCallback(Asset);
+		}
+		else
+		{
+			Scheduler.Dispatch([InCallback, Asset]() { InCallback(Asset); }, {}, ETaskThread::MainThread);
+		}
+	}
+
+	return FAssetLoadHandle(Request);
+}
+
+void FAsyncAssetLoader::WaitAll()
+{
+	// 메시의 Load 단계가 텍스처 요청을 추가하므로 남은 요청이 없을 때까지 반복
+	while (GetPendingCount() > 0)
+	{
+		TArray<FAssetLoadHandle> PendingHandles;
+		{
+			std::lock_guard<std::recursive_mutex> Lock(RequestsMutex);
+			for (const auto& Pair : Requests)
+			{
+				if (Pair.second->State.load(std::memory_order_acquire) == EAssetLoadState::Loading)
+				{
+					PendingHandles.Add(FAssetLoadHandle(Pair.second));
+				}
+			}
+		}
+
+		for (const FAssetLoadHandle& Handle : PendingHandles)
+		{
+			Handle.Wait();
+		}
+	}
+}
+
+void FAsyncAssetLoader::DispatchLoad(const TSharedPtr<FAsyncAssetRequest>& InRequest)
+{
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+
+	if (InRequest->Type == EAsyncAssetType::Texture)
+	{
+		// 텍스처는 의존성이 없으므로 Finalize를 바로 예약 (메시의 Finalize가 선행 조건으로 참조)
+		InRequest->LoadTask = Scheduler.Dispatch([InRequest]()
+		{
+			LoadTexture(*InRequest);
+		});
+		InRequest->FinalizeTask = Scheduler.Dispatch([this, InRequest]()
+		{
+			Complete(InRequest, FinalizeTexture(*InRequest));
+		}, { InRequest->LoadTask }, ETaskThread::MainThread);
+		return;
+	}
+
+	InRequest->LoadTask = Scheduler.Dispatch([this, InRequest]()
+	{
+		TArray<FName> TextureDependencies;
+		if (InRequest->Type == EAsyncAssetType::ObjStaticMesh)
+		{
+			LoadObjStaticMesh(*InRequest, TextureDependencies);
+		}
+		else
+		{
+			LoadFbxMesh(*InRequest, TextureDependencies);
+		}
+		DispatchFinalize(InRequest, TextureDependencies);
+	});
+}
+
+void FAsyncAssetLoader::DispatchFinalize(const TSharedPtr<FAsyncAssetRequest>& InRequest, const TArray<FName>& InTextureDependencies)
+{
+	TArray<FTaskRef> Prerequisites;
+	for (const FName& TexturePath : InTextureDependencies)
+	{
+		FAssetLoadHandle TextureHandle = RequestLoad(TexturePath);
+		if (TextureHandle.IsValid())
+		{
+			Prerequisites.Add(TextureHandle.Request->FinalizeTask);
+		}
+	}
+
+	InRequest->FinalizeTask = FTaskScheduler::GetInstance().Dispatch([this, InRequest]()
+	{
+		UObject* Asset = InRequest->SkeletalMeshInfo ? FinalizeSkeletalMesh(*InRequest) : FinalizeStaticMesh(*InRequest);
+		Complete(InRequest, Asset);
+	}, Prerequisites, ETaskThread::MainThread);
+}
+
+// ========================================
+// Load 단계 (워커 스레드)
+// ========================================
+
+void FAsyncAssetLoader::LoadTexture(FAsyncAssetRequest& InRequest)
+{
+	FTextureManager::ReadTextureFile(InRequest.AbsolutePath, true, InRequest.TextureData);
+}
+
+void FAsyncAssetLoader::LoadObjStaticMesh(FAsyncAssetRequest& InRequest, TArray<FName>& OutTextureDependencies)
+{
+	InRequest.StaticMeshAsset = FObjManager::CookObjStaticMeshAsset(InRequest.Path, GetObjImportConfig());
+	if (!InRequest.StaticMeshAsset)
+	{
+		return;
+	}
+
+	CreateStaticMeshBuffers(InRequest);
+
+	// FObjManager::CreateMaterialsFromMTL과 같은 규칙 (OBJ 파일 기준 상대 경로, 파일이 있을 때만 로드)
+	const path ObjDirectory = path(InRequest.Path.ToString()).parent_path();
+	for (const FMaterial& MaterialInfo : InRequest.StaticMeshAsset->MaterialInfo)
+	{
+		for (const FString* TextureMap : { &MaterialInfo.KdMap, &MaterialInfo.KaMap, &MaterialInfo.KsMap, &MaterialInfo.DMap, &MaterialInfo.BumpMap })
+		{
+			if (TextureMap->IsEmpty())
+			{
+				continue;
+			}
+
+			FString TexturePath = (ObjDirectory / *TextureMap).generic_string();
+			if (std::filesystem::exists(TexturePath))
+			{
+				OutTextureDependencies.AddUnique(FName(TexturePath));
+			}
+		}
+	}
+}
+
+void FAsyncAssetLoader::LoadFbxMesh(FAsyncAssetRequest& InRequest, TArray<FName>& OutTextureDependencies)
+{
+	const FFbxImporter::Configuration Config = GetFbxImportConfig();
+	const FString FilePath = InRequest.Path.ToString();
+
+	// FFbxManager::LoadFbxMesh와 같은 규칙 (쿠킹 파일은 스태틱 메시만 만들어지므로 유효하면 씬 로드를 생략)
+	const EFbxMeshType MeshType = FStaticMeshCooker::IsUpToDate(InRequest.Path, FFbxManager::GetCookImportFlags(Config))
+		? EFbxMeshType::Static
+		: FFbxImporter::DetermineMeshType(FilePath);
+
+	if (MeshType == EFbxMeshType::Static)
+	{
+		InRequest.StaticMeshAsset = FFbxManager::CookFbxStaticMeshAsset(InRequest.Path, Config);
+		if (!InRequest.StaticMeshAsset)
+		{
+			return;
+		}
+
+		CreateStaticMeshBuffers(InRequest);
+
+		// FFbxManager::CreateMaterialFromInfo가 로드하는 텍스처
+		for (const FMaterial& MaterialInfo : InRequest.StaticMeshAsset->MaterialInfo)
+		{
+			if (!MaterialInfo.KdMap.IsEmpty())
+			{
+				OutTextureDependencies.AddUnique(FName(MaterialInfo.KdMap));
+			}
+			if (!MaterialInfo.NormalMap.IsEmpty())
+			{
+				OutTextureDependencies.AddUnique(FName(MaterialInfo.NormalMap));
+			}
+		}
+	}
+	else if (MeshType == EFbxMeshType::Skeletal)
+	{
+		// 씬 임포트와 애니메이션 샘플링만 워커에서 수행하고 USkeletalMesh 변환은 Finalize 단계에서 수행
+		auto SkeletalMeshInfo = std::make_unique<FFbxSkeletalMeshInfo>();
+		if (!FFbxImporter::LoadSkeletalMesh(FilePath, SkeletalMeshInfo.get(), Config))
+		{
+			UE_LOG_ERROR("FBX 스켈레탈 메시 로드 실패: %s", FilePath.c_str());
+			return;
+		}
+		FFbxImporter::LoadAnimations(FilePath, SkeletalMeshInfo->Bones, InRequest.Animations);
+
+		for (const FFbxMaterialInfo& MaterialInfo : SkeletalMeshInfo->Materials)
+		{
+			if (!MaterialInfo.DiffuseTexturePath.empty())
+			{
+				OutTextureDependencies.AddUnique(FName(MaterialInfo.DiffuseTexturePath.generic_string()));
+			}
+			if (!MaterialInfo.NormalTexturePath.empty())
+			{
+				OutTextureDependencies.AddUnique(FName(MaterialInfo.NormalTexturePath.generic_string()));
+			}
+		}
+
+		InRequest.SkeletalMeshInfo = std::move(SkeletalMeshInfo);
+	}
+	else
+	{
+		UE_LOG_ERROR("FBX 메시 타입을 판단할 수 없습니다: %s", FilePath.c_str());
+	}
+}
+
+void FAsyncAssetLoader::CreateStaticMeshBuffers(FAsyncAssetRequest& InRequest)
+{
+	// D3D11 디바이스의 리소스 생성은 스레드에 안전하므로 버퍼는 워커에서 만든다 (즉시 컨텍스트는 사용하지 않음)
+	FStaticMesh& StaticMeshAsset = *InRequest.StaticMeshAsset;
+	InRequest.VertexBuffer = FRenderResourceFactory::CreateVertexBuffer(StaticMeshAsset.Vertices.GetData(),
+		static_cast<uint32>(StaticMeshAsset.Vertices.Num() * sizeof(FNormalVertex)));
+	const TArray<uint32> RenderIndices = StaticMeshAsset.GetRenderIndices();
+	InRequest.IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(RenderIndices.GetData(),
+		static_cast<uint32>(RenderIndices.Num() * sizeof(uint32)));
+}
+
+// ========================================
+// Finalize 단계 (메인 스레드)
+// ========================================
+
+UObject* FAsyncAssetLoader::FinalizeTexture(FAsyncAssetRequest& InRequest)
+{
+	if (InRequest.TextureData.Bytes.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	UTexture* Texture = TextureManager->CreateTextureFromMemory(InRequest.Path, InRequest.TextureData);
+	InRequest.TextureData = FTextureFileData();
+	return Texture;
+}
+
+UObject* FAsyncAssetLoader::FinalizeStaticMesh(FAsyncAssetRequest& InRequest)
+{
+	UStaticMesh* StaticMesh = nullptr;
+	if (InRequest.StaticMeshAsset)
+	{
+		StaticMesh = InRequest.Type == EAsyncAssetType::ObjStaticMesh
+			? FObjManager::CreateObjStaticMesh(InRequest.Path, std::move(InRequest.StaticMeshAsset))
+			: FFbxManager::CreateFbxStaticMesh(InRequest.Path, std::move(InRequest.StaticMeshAsset));
+	}
+
+	// 버퍼 소유권은 UAssetManager로 넘어간다 (이미 등록된 경로면 해제됨)
+	UAssetManager::GetInstance().RegisterStaticMesh(InRequest.Path, StaticMesh, InRequest.VertexBuffer, InRequest.IndexBuffer);
+	InRequest.VertexBuffer = nullptr;
+	InRequest.IndexBuffer = nullptr;
+	return StaticMesh;
+}
+
+UObject* FAsyncAssetLoader::FinalizeSkeletalMesh(FAsyncAssetRequest& InRequest)
+{
+	USkeletalMesh* SkeletalMesh = FFbxManager::CreateFbxSkeletalMesh(InRequest.Path, *InRequest.SkeletalMeshInfo, InRequest.Animations);
+	InRequest.SkeletalMeshInfo.reset();
+	InRequest.Animations.Empty();
+	if (!SkeletalMesh)
+	{
+		return nullptr;
+	}
+
+	// 내부 StaticMesh를 StaticMeshCache에도 등록 (스태틱 렌더링용)
+	if (UStaticMesh* InnerStaticMesh = SkeletalMesh->GetStaticMesh())
+	{
+		UAssetManager::GetInstance().RegisterStaticMesh(InRequest.Path, InnerStaticMesh, nullptr, nullptr);
+	}
+	else
+	{
+		UE_LOG_WARNING("[AsyncAssetLoader] SkeletalMesh에 StaticMesh 데이터가 없습니다: %s", InRequest.Path.ToString().c_str());
+	}
+	return SkeletalMesh;
+}
+
+void FAsyncAssetLoader::Complete(const TSharedPtr<FAsyncAssetRequest>& InRequest, UObject* InAsset)
+{
+	TArray<TFunction<void(UObject*)>> Callbacks;
+	{
+		std::lock_guard<std::recursive_mutex> Lock(RequestsMutex);
+		InRequest->Asset = InAsset;
+		InRequest->State.store(InAsset ? EAssetLoadState::Loaded : EAssetLoadState::Failed, std::memory_order_release);
+		std::swap(Callbacks, InRequest->Callbacks);
+	}
+	PendingCount.fetch_sub(1, std::memory_order_acq_rel);
+
+	if (!InAsset)
+	{
+		UE_LOG_ERROR("[AsyncAssetLoader] 에셋 로드 실패: %s", InRequest->Path.ToString().c_str());
+	}
+
+	for (const TFunction<void(UObject*)>& Callback : Callbacks)
+	{
+		Callback(InAsset);
+	}
+}
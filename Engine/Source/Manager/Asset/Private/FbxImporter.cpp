@@ -50,6 +50,7 @@ struct VertexKeyHasher
 
 bool FFbxImporter::Initialize()
 {
+	std::lock_guard<std::mutex> Lock(SdkMutex);
 	if (SdkManager) { return true; }
 
 	SdkManager = FbxManager::Create();
@@ -62,6 +63,7 @@ bool FFbxImporter::Initialize()
 
 void FFbxImporter::Shutdown()
 {
+	std::lock_guard<std::mutex> Lock(SdkMutex);
 	if (!SdkManager) { return; }
 
 	IoSettings->Destroy();
@@ -74,6 +76,8 @@ void FFbxImporter::Shutdown()
 
 EFbxMeshType FFbxImporter::DetermineMeshType(const std::filesystem::path& FilePath)
 {
+	std::lock_guard<std::mutex> Lock(SdkMutex);
+
 	if (!SdkManager)
 	{
 		UE_LOG_ERROR("FBX SDK Manager가 초기화되지 않았습니다.");
@@ -111,6 +115,8 @@ EFbxMeshType FFbxImporter::DetermineMeshType(const std::filesystem::path& FilePa
 
 bool FFbxImporter::LoadStaticMesh(const std::filesystem::path& FilePath, FFbxStaticMeshInfo* OutMeshInfo, Configuration Config)
 {
+	std::lock_guard<std::mutex> Lock(SdkMutex);
+
 	if (!OutMeshInfo)
 	{
 		UE_LOG_ERROR("유효하지 않은 FBXStaticMeshInfo입니다.");
@@ -647,6 +653,8 @@ bool FFbxImporter::EnsureTriangleMesh(FbxMesh*& Mesh, FbxGeometryConverter& Conv
 
 bool FFbxImporter::LoadSkeletalMesh(const std::filesystem::path& FilePath, FFbxSkeletalMeshInfo* OutMeshInfo, Configuration Config)
 {
+	std::lock_guard<std::mutex> Lock(SdkMutex);
+
 	// 입력 검증
 	if (!OutMeshInfo)
 	{
@@ -807,6 +815,119 @@ bool FFbxImporter::LoadSkeletalMesh(const std::filesystem::path& FilePath, FFbxS
 	return true;
 }
 
+bool FFbxImporter::LoadAnimations(const std::filesystem::path& FilePath, const TArray<FFbxBoneInfo>& Bones, TArray<FFbxAnimSequenceInfo>& OutAnimations)
+{
+	std::lock_guard<std::mutex> Lock(SdkMutex);
+	OutAnimations.Empty();
+
+	if (!SdkManager || !std::filesystem::exists(FilePath) || Bones.Num() == 0)
+	{
+		return false;
+	}
+
+	// 씬 전체를 읽기 전에 헤더 정보만으로 애니메이션 스택이 있는지 확인
+	FbxImporter* Importer = FbxImporter::Create(SdkManager, "");
+	if (!Importer->Initialize(FilePath.string().c_str(), -1, IoSettings))
+	{
+		Importer->Destroy();
+		return false;
+	}
+	const int AnimStackCountInFile = Importer->GetAnimStackCount();
+	Importer->Destroy();
+
+	if (AnimStackCountInFile == 0)
+	{
+		return false;
+	}
+
+	// 스켈레톤과 같은 좌표계로 변환된 씬에서 샘플링해야 레퍼런스 포즈와 일치한다
+	FbxScene* Scene = ImportFbxScene(FilePath, false);
+	if (!Scene) { return false; }
+
+	FFbxSceneGuard SceneGuard(Scene);
+
+	TArray<FbxNode*> BoneNodes;
+	BoneNodes.Reserve(Bones.Num());
+	for (const FFbxBoneInfo& Bone : Bones)
+	{
+		BoneNodes.Add(Scene->FindNodeByName(Bone.BoneName.c_str()));
+	}
+
+	const int AnimStackCount = Scene->GetSrcObjectCount<FbxAnimStack>();
+	for (int i = 0; i < AnimStackCount; ++i)
+	{
+		FbxAnimStack* AnimStack = Scene->GetSrcObject<FbxAnimStack>(i);
+		if (!AnimStack)
+		{
+			continue;
+		}
+
+		FFbxAnimSequenceInfo Animation;
+		ExtractAnimStack(Scene, AnimStack, BoneNodes, Bones, &Animation);
+		if (Animation.NumFrames > 0)
+		{
+			UE_LOG("[FbxImporter] 애니메이션 '%s': %d 프레임 (%.1f fps)", Animation.Name.c_str(), Animation.NumFrames, Animation.FrameRate);
+			OutAnimations.Add(std::move(Animation));
+		}
+	}
+
+	return OutAnimations.Num() > 0;
+}
+
+void FFbxImporter::ExtractAnimStack(FbxScene* Scene, FbxAnimStack* AnimStack, const TArray<FbxNode*>& BoneNodes,
+	const TArray<FFbxBoneInfo>& Bones, FFbxAnimSequenceInfo* OutAnimation)
+{
+	Scene->SetCurrentAnimationStack(AnimStack);
+
+	const FbxTimeSpan TimeSpan = AnimStack->GetLocalTimeSpan();
+	const double StartSeconds = TimeSpan.GetStart().GetSecondDouble();
+	const double DurationSeconds = TimeSpan.GetDuration().GetSecondDouble();
+
+	double FrameRate = FbxTime::GetFrameRate(Scene->GetGlobalSettings().GetTimeMode());
+	if (FrameRate <= 0.0)
+	{
+		FrameRate = 30.0;
+	}
+
+	OutAnimation->Name = AnimStack->GetName();
+	OutAnimation->FrameRate = static_cast<float>(FrameRate);
+	OutAnimation->NumFrames = std::max(1, static_cast<int32>(DurationSeconds * FrameRate + 0.5) + 1);
+	OutAnimation->Tracks.SetNum(Bones.Num());
+
+	for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+	{
+		FFbxAnimTrack& Track = OutAnimation->Tracks[BoneIndex];
+		Track.BoneName = Bones[BoneIndex].BoneName;
+
+		// 씬에 노드가 없는 본은 빈 트랙 (레퍼런스 포즈 유지)
+		FbxNode* BoneNode = BoneNodes[BoneIndex];
+		if (!BoneNode)
+		{
+			continue;
+		}
+
+		Track.Translations.SetNum(OutAnimation->NumFrames);
+		Track.Rotations.SetNum(OutAnimation->NumFrames);
+		Track.Scales.SetNum(OutAnimation->NumFrames);
+
+		for (int32 Frame = 0; Frame < OutAnimation->NumFrames; ++Frame)
+		{
+			FbxTime Time;
+			Time.SetSecondDouble(StartSeconds + Frame / FrameRate);
+
+			// ExtractSkeleton과 같은 방식으로 로컬 변환 추출
+			FbxAMatrix LocalTransform = BoneNode->EvaluateLocalTransform(Time);
+			FbxVector4 T = LocalTransform.GetT();
+			FbxQuaternion R = LocalTransform.GetQ();
+			FbxVector4 S = LocalTransform.GetS();
+
+			Track.Translations[Frame] = FVector(T[0], T[1], T[2]);
+			Track.Rotations[Frame] = FQuaternion(R[0], R[1], R[2], R[3]);
+			Track.Scales[Frame] = FVector(S[0], S[1], S[2]);
+		}
+	}
+}
+
 FbxMesh* FFbxImporter::FindFirstSkinnedMesh(FbxNode* RootNode, FbxNode** OutNode)
 {
 	for (int i = 0; i < RootNode->GetChildCount(); ++i)
@@ -2,6 +2,11 @@
 
 #include "Manager/Asset/Public/FbxManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/StaticMeshCooker.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+#include "Runtime/Engine/Public/AnimSequence.h"
 
 // ========================================
 // 🔸 Static member variable definition
@@ -16,8 +21,10 @@ TMap<FName, std::unique_ptr<FStaticMesh>> FFbxManager::FbxSkeletalFStaticMeshMap
 
 UObject* FFbxManager::LoadFbxMesh(const FName& FilePath, const FFbxImporter::Configuration& Config)
 {
-	// 메시 타입 판단
-	EFbxMeshType MeshType = FFbxImporter::DetermineMeshType(FilePath.ToString());
+	// 메시 타입 판단 (쿠킹 파일은 스태틱 메시만 만들어지므로 유효한 쿠킹 파일이 있으면 씬 로드를 생략)
+	EFbxMeshType MeshType = Config.bIsBinaryEnabled && FStaticMeshCooker::IsUpToDate(FilePath, GetCookImportFlags(Config))
+		? EFbxMeshType::Static
+		: FFbxImporter::DetermineMeshType(FilePath.ToString());
 
 	switch (MeshType)
 	{
@@ -45,6 +52,48 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FName& FilePath, const FF
 		return FoundValuePtr->get();
 	}
 
+	std::unique_ptr<FStaticMesh> StaticMesh = CookFbxStaticMeshAsset(FilePath, Config);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	// 캐시에 저장
+	FbxFStaticMeshMap.Emplace(FilePath, std::move(StaticMesh));
+	return FbxFStaticMeshMap[FilePath].get();
+}
+
+std::unique_ptr<FStaticMesh> FFbxManager::CookFbxStaticMeshAsset(const FName& FilePath, const FFbxImporter::Configuration& Config)
+{
+	// 쿠킹된 메시가 있으면 FBX SDK를 거치지 않는다
+	const uint32 CookImportFlags = GetCookImportFlags(Config);
+	if (Config.bIsBinaryEnabled)
+	{
+		auto CookedStaticMesh = std::make_unique<FStaticMesh>();
+		if (FStaticMeshCooker::Load(FilePath, CookImportFlags, CookedStaticMesh.get()))
+		{
+			return CookedStaticMesh;
+		}
+	}
+
+	std::unique_ptr<FStaticMesh> StaticMesh = BuildFbxStaticMeshAsset(FilePath, Config);
+	if (StaticMesh && Config.bIsBinaryEnabled)
+	{
+		FStaticMeshCooker::Save(*StaticMesh, CookImportFlags);
+	}
+	return StaticMesh;
+}
+
+uint32 FFbxManager::GetCookImportFlags(const FFbxImporter::Configuration& Config)
+{
+	return (Config.bOptimizeMesh ? 1u << 0 : 0u)
+		| (Config.bGenerateLODs ? 1u << 1 : 0u)
+		| (Config.bCompressVertices ? 1u << 2 : 0u)
+		| (Config.bGenerateOccluder ? 1u << 3 : 0u);
+}
+
+std::unique_ptr<FStaticMesh> FFbxManager::BuildFbxStaticMeshAsset(const FName& FilePath, const FFbxImporter::Configuration& Config)
+{
 	FFbxStaticMeshInfo MeshInfo;
 	if (!FFbxImporter::LoadStaticMesh(FilePath.ToString(), &MeshInfo, Config))
 	{
@@ -56,12 +105,26 @@ FStaticMesh* FFbxManager::LoadFbxStaticMeshAsset(const FName& FilePath, const FF
 	StaticMesh->PathFileName = FilePath;
 
 	ConvertFbxToStaticMesh(MeshInfo, StaticMesh.get());
+	if (Config.bOptimizeMesh)
+	{
+		FMeshOptimizer::OptimizeStaticMesh(*StaticMesh); // 삼각형 순서가 바뀌므로 BVH보다 먼저
+	}
+	if (Config.bGenerateLODs)
+	{
+		FMeshSimplifier::BuildLODs(*StaticMesh);
+	}
+	if (Config.bCompressVertices)
+	{
+		FVertexQuantizer::QuantizeStaticMesh(*StaticMesh); // 쿠킹 파일에서 읽은 정점과 같아지도록 BVH보다 먼저
+	}
+	if (Config.bGenerateOccluder)
+	{
+		FMeshSimplifier::BuildOccluder(*StaticMesh);
+	}
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축 (Binned SAH)
 
 	UE_LOG_SUCCESS("FBX StaticMesh 변환 완료: %s", FilePath.ToString().c_str());
-
-	// 캐시에 저장
-	FbxFStaticMeshMap.Emplace(FilePath, std::move(StaticMesh));
-	return FbxFStaticMeshMap[FilePath].get();
+	return StaticMesh;
 }
 
 UStaticMesh* FFbxManager::LoadFbxStaticMesh(const FName& FilePath, const FFbxImporter::Configuration& Config)
@@ -90,6 +153,27 @@ UStaticMesh* FFbxManager::LoadFbxStaticMesh(const FName& FilePath, const FFbxImp
 	return StaticMesh;
 }
 
+UStaticMesh* FFbxManager::CreateFbxStaticMesh(const FName& FilePath, std::unique_ptr<FStaticMesh> StaticMeshAsset)
+{
+	// 그 사이 같은 경로가 동기 로드되었다면 먼저 만들어진 메시를 그대로 사용
+	if (UStaticMesh* Cached = UAssetManager::GetInstance().GetStaticMeshFromCache(FilePath))
+	{
+		return Cached;
+	}
+
+	if (!FbxFStaticMeshMap.Find(FilePath))
+	{
+		if (!StaticMeshAsset)
+		{
+			return nullptr;
+		}
+		FbxFStaticMeshMap.Emplace(FilePath, std::move(StaticMeshAsset));
+	}
+
+	// 에셋이 캐시에 있으므로 임포트 없이 UStaticMesh와 머티리얼만 만든다
+	return LoadFbxStaticMesh(FilePath);
+}
+
 // ========================================
 // 🔸 Private Helper Functions
 // ========================================
@@ -238,7 +322,23 @@ USkeletalMesh* FFbxManager::LoadFbxSkeletalMesh(const FName& FilePath, const FFb
 		return nullptr;
 	}
 
-	// 3) 이미 로드된 데이터로부터 FStaticMesh Asset 생성 (중복 로드 방지)
+	// 3) 애니메이션 스택 임포트 (스택이 없으면 씬을 다시 읽지 않음)
+	TArray<FFbxAnimSequenceInfo> FbxAnimations;
+	FFbxImporter::LoadAnimations(FilePath.ToString(), SkeletalMeshInfo.Bones, FbxAnimations);
+
+	return CreateFbxSkeletalMesh(FilePath, SkeletalMeshInfo, FbxAnimations);
+}
+
+USkeletalMesh* FFbxManager::CreateFbxSkeletalMesh(const FName& FilePath, const FFbxSkeletalMeshInfo& SkeletalMeshInfo, const TArray<FFbxAnimSequenceInfo>& FbxAnimations)
+{
+	// 1) 그 사이 같은 경로가 동기 로드되었다면 그대로 사용
+	UAssetManager& AssetManager = UAssetManager::GetInstance();
+	if (USkeletalMesh* Cached = AssetManager.GetSkeletalMeshFromCache(FilePath))
+	{
+		return Cached;
+	}
+
+	// 2) 이미 로드된 데이터로부터 FStaticMesh Asset 생성 (중복 로드 방지)
 	FStaticMesh* StaticMeshAsset = GetOrCreateStaticMeshFromInfo(FilePath, SkeletalMeshInfo);
 	if (!StaticMeshAsset)
 	{
@@ -246,7 +346,7 @@ USkeletalMesh* FFbxManager::LoadFbxSkeletalMesh(const FName& FilePath, const FFb
 		return nullptr;
 	}
 
-	// 4) USkeletalMesh 생성 및 설정
+	// 3) USkeletalMesh 생성 및 설정
 	USkeletalMesh* SkeletalMesh = NewObject<USkeletalMesh>();
 	if (!ConvertFbxToSkeletalMesh(SkeletalMeshInfo, SkeletalMesh, StaticMeshAsset))
 	{
@@ -257,6 +357,12 @@ USkeletalMesh* FFbxManager::LoadFbxSkeletalMesh(const FName& FilePath, const FFb
 
 	UE_LOG_SUCCESS("FBX SkeletalMesh 변환 완료: %s", FilePath.ToString().c_str());
 
+	// 4) 애니메이션 변환
+	if (!FbxAnimations.IsEmpty())
+	{
+		ConvertAnimations(FbxAnimations, SkeletalMesh);
+	}
+
 	// 5) AssetManager에 등록
 	AssetManager.AddSkeletalMeshToCache(FilePath, SkeletalMesh);
 
@@ -309,6 +415,7 @@ bool FFbxManager::ConvertFbxToSkeletalMesh(const FFbxSkeletalMeshInfo& FbxData,
 
 	// 4. 스킨 가중치 변환
 	ConvertSkinWeights(FbxData.SkinWeights, RenderData->SkinWeightVertices);
+	RenderData->BuildSkinWeightStream();
 
 	// 5. RenderData를 SkeletalMesh에 설정
 	OutSkeletalMesh->SetSkeletalMeshRenderData(RenderData);
@@ -376,6 +483,38 @@ void FFbxManager::ConvertSkinWeights(const TArray<FFbxBoneInfluence>& FbxWeights
 	UE_LOG("[FbxManager] 스킨 가중치 변환 완료: %d 정점", OutSkinWeights.Num());
 }
 
+void FFbxManager::ConvertAnimations(const TArray<FFbxAnimSequenceInfo>& FbxAnimations, USkeletalMesh* OutSkeletalMesh)
+{
+	const FReferenceSkeleton& RefSkeleton = OutSkeletalMesh->GetRefSkeleton();
+
+	for (const FFbxAnimSequenceInfo& FbxAnimation : FbxAnimations)
+	{
+		// 트랙을 이름으로 스켈레톤의 본 인덱스에 배치 (찾지 못한 본은 빈 트랙)
+		TArray<FRawAnimSequenceTrack> BoneTracks;
+		BoneTracks.SetNum(RefSkeleton.GetRawBoneNum());
+
+		for (const FFbxAnimTrack& FbxTrack : FbxAnimation.Tracks)
+		{
+			const int32 BoneIndex = RefSkeleton.FindRawBoneIndex(FName(FbxTrack.BoneName));
+			if (BoneIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			FRawAnimSequenceTrack& Track = BoneTracks[BoneIndex];
+			Track.PosKeys = FbxTrack.Translations;
+			Track.RotKeys = FbxTrack.Rotations;
+			Track.ScaleKeys = FbxTrack.Scales;
+		}
+
+		UAnimSequence* AnimSequence = NewObject<UAnimSequence>();
+		AnimSequence->Build(FName(FbxAnimation.Name), FbxAnimation.FrameRate, FbxAnimation.NumFrames, BoneTracks);
+		OutSkeletalMesh->AddAnimSequence(AnimSequence);
+	}
+
+	UE_LOG_SUCCESS("[FbxManager] 애니메이션 변환 완료: %d개", FbxAnimations.Num());
+}
+
 void FFbxManager::ConvertFbxSkeletalToStaticMesh(const FFbxSkeletalMeshInfo& FbxData, FStaticMesh* OutStaticMesh)
 {
 	if (!OutStaticMesh)
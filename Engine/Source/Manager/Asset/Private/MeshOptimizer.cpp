@@ -0,0 +1,502 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+#include <numeric>
+
+namespace
+{
+	constexpr uint32 INVALID_VERTEX = UINT32_MAX;
+
+	/**
+	 * @brief FIFO 캐시 시뮬레이터
+	 * 미스가 날 때만 시각을 올리므로, 마지막으로 들어온 시각과 현재 시각의 차가 캐시 크기 이하이면 아직 캐시에 있다.
+	 */
+	class FFifoCache
+	{
+	public:
+		FFifoCache(uint32 InEntryCount, uint32 InCacheSize)
+			: CacheSize(InCacheSize), Time(InCacheSize + 1)
+		{
+			Timestamps.SetNum(InEntryCount, 0);
+		}
+
+		//@return 미스이면 true
+		bool Access(uint32 InEntry)
+		{
+			if (Time - Timestamps[InEntry] > CacheSize)
+			{
+				Timestamps[InEntry] = Time++;
+				return true;
+			}
+			return false;
+		}
+
+		//@brief 모든 항목을 캐시 밖으로 (draw 경계)
+		void Flush() { Time += CacheSize + 1; }
+
+	private:
+		TArray<uint32> Timestamps;
+		uint32 CacheSize;
+		uint32 Time;
+	};
+
+	struct FCacheCounters
+	{
+		uint64 Misses = 0;
+		uint64 TriangleCount = 0;
+		uint64 FetchedBytes = 0;
+	};
+
+	// 정점 셰이더 실행(캐시 미스)마다 정점 버퍼를 읽는다고 보고 읽은 캐시 라인을 함께 시뮬레이션
+	void AccumulateStatistics(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexStride,
+		FFifoCache& InVertexCache, FFifoCache& InLineCache, FCacheCounters& OutCounters)
+	{
+		OutCounters.TriangleCount += InIndexCount / 3;
+		for (uint32 i = 0; i < InIndexCount; ++i)
+		{
+			const uint32 Vertex = InIndices[i];
+			if (!InVertexCache.Access(Vertex))
+			{
+				continue;
+			}
+
+			++OutCounters.Misses;
+			const uint64 FirstLine = static_cast<uint64>(Vertex) * InVertexStride / MESH_OPTIMIZER_FETCH_LINE_SIZE;
+			const uint64 LastLine = (static_cast<uint64>(Vertex + 1) * InVertexStride - 1) / MESH_OPTIMIZER_FETCH_LINE_SIZE;
+			for (uint64 Line = FirstLine; Line <= LastLine; ++Line)
+			{
+				if (InLineCache.Access(static_cast<uint32>(Line)))
+				{
+					OutCounters.FetchedBytes += MESH_OPTIMIZER_FETCH_LINE_SIZE;
+				}
+			}
+		}
+	}
+
+	FMeshCacheStatistics MakeStatistics(const FCacheCounters& InCounters, uint32 InUsedVertexCount, uint32 InVertexStride)
+	{
+		FMeshCacheStatistics Statistics;
+		if (InCounters.TriangleCount > 0)
+		{
+			Statistics.ACMR = static_cast<float>(static_cast<double>(InCounters.Misses) / InCounters.TriangleCount);
+		}
+		if (InUsedVertexCount > 0)
+		{
+			Statistics.ATVR = static_cast<float>(static_cast<double>(InCounters.Misses) / InUsedVertexCount);
+			Statistics.Overfetch = static_cast<float>(static_cast<double>(InCounters.FetchedBytes) / (static_cast<uint64>(InUsedVertexCount) * InVertexStride));
+		}
+		return Statistics;
+	}
+
+	uint32 CountUsedVertices(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexCount, TArray<uint8>& InOutUsed)
+	{
+		uint32 UsedCount = 0;
+		for (uint32 i = 0; i < InIndexCount; ++i)
+		{
+			uint8& bIsUsed = InOutUsed[InIndices[i]];
+			UsedCount += bIsUsed ? 0 : 1;
+			bIsUsed = 1;
+		}
+		return UsedCount;
+	}
+
+	uint32 GetLineCount(uint32 InVertexCount, uint32 InVertexStride)
+	{
+		return static_cast<uint32>((static_cast<uint64>(InVertexCount) * InVertexStride + MESH_OPTIMIZER_FETCH_LINE_SIZE - 1) / MESH_OPTIMIZER_FETCH_LINE_SIZE) + 1;
+	}
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh& InOutStaticMesh)
+{
+	TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	TArray<uint32>& Indices = InOutStaticMesh.Indices;
+
+	// 섹션이 쓰는 정점만 0부터 다시 번호를 매겨, 섹션이 많아도 섹션 크기에 비례하는 비용으로 처리
+	TArray<uint32> GlobalToLocal;
+	GlobalToLocal.SetNum(Vertices.Num(), INVALID_VERTEX);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	TArray<FNormalVertex> LocalVertices;
+	TArray<uint32> Clusters;
+
+	for (const FMeshSection& Section : InOutStaticMesh.Sections)
+	{
+		const uint32 IndexCount = Section.IndexCount / 3 * 3;
+		if (IndexCount < 6 || static_cast<uint64>(Section.StartIndex) + IndexCount > static_cast<uint64>(Indices.Num()))
+		{
+			continue;
+		}
+
+		uint32* SectionIndices = Indices.GetData() + Section.StartIndex;
+
+		LocalToGlobal.Empty();
+		LocalIndices.SetNum(IndexCount);
+		for (uint32 i = 0; i < IndexCount; ++i)
+		{
+			uint32& LocalIndex = GlobalToLocal[SectionIndices[i]];
+			if (LocalIndex == INVALID_VERTEX)
+			{
+				LocalIndex = static_cast<uint32>(LocalToGlobal.Num());
+				LocalToGlobal.Add(SectionIndices[i]);
+			}
+			LocalIndices[i] = LocalIndex;
+		}
+
+		LocalVertices.SetNum(LocalToGlobal.Num());
+		for (int32 i = 0; i < LocalToGlobal.Num(); ++i)
+		{
+			LocalVertices[i] = Vertices[LocalToGlobal[i]];
+		}
+
+		OptimizeVertexCache(LocalIndices.GetData(), IndexCount, static_cast<uint32>(LocalToGlobal.Num()), &Clusters);
+		OptimizeOverdraw(LocalIndices.GetData(), IndexCount, LocalVertices, Clusters);
+
+		for (uint32 i = 0; i < IndexCount; ++i)
+		{
+			SectionIndices[i] = LocalToGlobal[LocalIndices[i]];
+		}
+		for (uint32 GlobalIndex : LocalToGlobal)
+		{
+			GlobalToLocal[GlobalIndex] = INVALID_VERTEX;
+		}
+	}
+
+	OptimizeVertexFetch(Vertices, Indices);
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* InOutIndices, uint32 InIndexCount, uint32 InVertexCount, TArray<uint32>* OutClusters)
+{
+	const uint32 TriangleCount = InIndexCount / 3;
+	if (OutClusters)
+	{
+		OutClusters->Empty();
+	}
+	if (TriangleCount == 0 || InVertexCount == 0)
+	{
+		return;
+	}
+
+	// 1. 정점 → 인접 삼각형 목록 (CSR)
+	TArray<uint32> AdjacencyOffsets;
+	AdjacencyOffsets.SetNum(InVertexCount + 1, 0);
+	for (uint32 i = 0; i < TriangleCount * 3; ++i)
+	{
+		++AdjacencyOffsets[InOutIndices[i] + 1];
+	}
+	for (uint32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] += AdjacencyOffsets[Vertex];
+	}
+
+	TArray<uint32> AdjacencyTriangles;
+	AdjacencyTriangles.SetNumUninitialized(TriangleCount * 3);
+	TArray<uint32> LiveTriangleCounts;
+	LiveTriangleCounts.SetNum(InVertexCount, 0);
+	for (uint32 i = 0; i < TriangleCount * 3; ++i)
+	{
+		const uint32 Vertex = InOutIndices[i];
+		AdjacencyTriangles[AdjacencyOffsets[Vertex] + LiveTriangleCounts[Vertex]++] = i / 3;
+	}
+
+	// 2. Fan 정점을 옮겨 가며 아직 내보내지 않은 인접 삼각형을 출력
+	TArray<uint32> CacheTimestamps;
+	CacheTimestamps.SetNum(InVertexCount, 0);
+	TArray<uint8> EmittedTriangles;
+	EmittedTriangles.SetNum(TriangleCount, 0);
+	TArray<uint32> DeadEndStack;
+	DeadEndStack.Reserve(TriangleCount * 3);
+	TArray<uint32> Candidates;
+	TArray<uint32> OutputIndices;
+	OutputIndices.Reserve(TriangleCount * 3);
+
+	uint32 Timestamp = MESH_OPTIMIZER_CACHE_SIZE + 1;
+	uint32 InputCursor = 0;
+	int64 FanningVertex = InOutIndices[0];
+
+	if (OutClusters)
+	{
+		OutClusters->Add(0);
+	}
+
+	while (FanningVertex >= 0)
+	{
+		const uint32 Fan = static_cast<uint32>(FanningVertex);
+		Candidates.Empty();
+
+		for (uint32 i = AdjacencyOffsets[Fan]; i < AdjacencyOffsets[Fan + 1]; ++i)
+		{
+			const uint32 Triangle = AdjacencyTriangles[i];
+			if (EmittedTriangles[Triangle])
+			{
+				continue;
+			}
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = InOutIndices[Triangle * 3 + Corner];
+				OutputIndices.Add(Vertex);
+				DeadEndStack.Add(Vertex);
+				Candidates.Add(Vertex);
+				--LiveTriangleCounts[Vertex];
+
+				if (Timestamp - CacheTimestamps[Vertex] > MESH_OPTIMIZER_CACHE_SIZE)
+				{
+					CacheTimestamps[Vertex] = Timestamp++;
+				}
+			}
+			EmittedTriangles[Triangle] = 1;
+		}
+
+		// 다음 fan 정점: 남은 삼각형을 모두 내보내도 캐시에 남아 있을 후보 중 가장 오래 머문 정점
+		FanningVertex = -1;
+		int64 BestPriority = -1;
+		for (uint32 Vertex : Candidates)
+		{
+			if (LiveTriangleCounts[Vertex] == 0)
+			{
+				continue;
+			}
+
+			int64 Priority = 0;
+			const uint32 Age = Timestamp - CacheTimestamps[Vertex];
+			if (Age + 2 * LiveTriangleCounts[Vertex] <= MESH_OPTIMIZER_CACHE_SIZE)
+			{
+				Priority = Age;
+			}
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				FanningVertex = Vertex;
+			}
+		}
+
+		if (FanningVertex >= 0)
+		{
+			continue;
+		}
+
+		// 막다른 곳: 최근에 출력한 정점 중 남은 삼각형이 있는 정점, 없으면 입력 순서상 다음 정점에서 다시 시작
+		while (!DeadEndStack.IsEmpty() && FanningVertex < 0)
+		{
+			const uint32 Vertex = DeadEndStack.Last();
+			DeadEndStack.Pop();
+			if (LiveTriangleCounts[Vertex] > 0)
+			{
+				FanningVertex = Vertex;
+			}
+		}
+		while (FanningVertex < 0 && InputCursor < InVertexCount)
+		{
+			if (LiveTriangleCounts[InputCursor] > 0)
+			{
+				FanningVertex = InputCursor;
+			}
+			++InputCursor;
+		}
+
+		if (FanningVertex >= 0 && OutClusters)
+		{
+			OutClusters->Add(static_cast<uint32>(OutputIndices.Num() / 3));
+		}
+	}
+
+	memcpy(InOutIndices, OutputIndices.GetData(), sizeof(uint32) * OutputIndices.Num());
+}
+
+void FMeshOptimizer::OptimizeOverdraw(uint32* InOutIndices, uint32 InIndexCount, const TArray<FNormalVertex>& InVertices,
+	const TArray<uint32>& InClusters, float InThreshold)
+{
+	const uint32 TriangleCount = InIndexCount / 3;
+	if (TriangleCount == 0 || InClusters.Num() == 0)
+	{
+		return;
+	}
+
+	// 1. Soft boundary: 클러스터 앞부분의 ACMR이 클러스터 전체 ACMR * Threshold 이하가 되는 지점마다 나눈다
+	// - 캐시가 다시 차는 비용이 작은 곳에서만 끊으므로 정렬 후에도 ACMR이 크게 나빠지지 않는다
+	TArray<uint32> Clusters;
+	FFifoCache Cache(static_cast<uint32>(InVertices.Num()), MESH_OPTIMIZER_CACHE_SIZE);
+	for (int32 ClusterIndex = 0; ClusterIndex < InClusters.Num(); ++ClusterIndex)
+	{
+		const uint32 Begin = InClusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < InClusters.Num() ? InClusters[ClusterIndex + 1] : TriangleCount;
+		if (Begin >= End)
+		{
+			continue;
+		}
+
+		uint32 ClusterMisses = 0;
+		Cache.Flush();
+		for (uint32 i = Begin * 3; i < End * 3; ++i)
+		{
+			ClusterMisses += Cache.Access(InOutIndices[i]) ? 1 : 0;
+		}
+		const float ClusterThreshold = InThreshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Begin);
+
+		Clusters.Add(Begin);
+		uint32 SubClusterBegin = Begin;
+		uint32 SubClusterMisses = 0;
+		Cache.Flush();
+		for (uint32 Triangle = Begin; Triangle + 1 < End; ++Triangle)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				SubClusterMisses += Cache.Access(InOutIndices[Triangle * 3 + Corner]) ? 1 : 0;
+			}
+
+			if (static_cast<float>(SubClusterMisses) <= ClusterThreshold * static_cast<float>(Triangle + 1 - SubClusterBegin))
+			{
+				SubClusterBegin = Triangle + 1;
+				SubClusterMisses = 0;
+				Clusters.Add(SubClusterBegin);
+				Cache.Flush();
+			}
+		}
+	}
+
+	// 2. 클러스터마다 면적 가중 중심과 법선을 구하고, 메시 중심에서 바깥을 향하는 정도로 정렬
+	const int32 ClusterCount = Clusters.Num();
+	TArray<FVector> ClusterCentroids;
+	TArray<FVector> ClusterNormals;
+	TArray<float> ClusterAreas;
+	ClusterCentroids.SetNum(ClusterCount, FVector(0, 0, 0));
+	ClusterNormals.SetNum(ClusterCount, FVector(0, 0, 0));
+	ClusterAreas.SetNum(ClusterCount, 0.0f);
+
+	FVector MeshCentroid(0, 0, 0);
+	float MeshArea = 0.0f;
+	for (int32 ClusterIndex = 0; ClusterIndex < ClusterCount; ++ClusterIndex)
+	{
+		const uint32 Begin = Clusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < ClusterCount ? Clusters[ClusterIndex + 1] : TriangleCount;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			const FVector& P0 = InVertices[InOutIndices[Triangle * 3 + 0]].Position;
+			const FVector& P1 = InVertices[InOutIndices[Triangle * 3 + 1]].Position;
+			const FVector& P2 = InVertices[InOutIndices[Triangle * 3 + 2]].Position;
+
+			// 외적의 길이는 면적의 두 배이므로 그대로 면적 가중 법선으로 쓴다
+			const FVector AreaNormal = (P1 - P0).Cross(P2 - P0);
+			const float Area = AreaNormal.Length();
+			const FVector Centroid = (P0 + P1 + P2) / 3.0f;
+
+			ClusterCentroids[ClusterIndex] += Centroid * Area;
+			ClusterNormals[ClusterIndex] += AreaNormal;
+			ClusterAreas[ClusterIndex] += Area;
+			MeshCentroid += Centroid * Area;
+			MeshArea += Area;
+		}
+	}
+	if (MeshArea > 0.0f)
+	{
+		MeshCentroid = MeshCentroid / MeshArea;
+	}
+
+	TArray<float> SortKeys;
+	SortKeys.SetNum(ClusterCount, 0.0f);
+	for (int32 ClusterIndex = 0; ClusterIndex < ClusterCount; ++ClusterIndex)
+	{
+		const float NormalLength = ClusterNormals[ClusterIndex].Length();
+		if (ClusterAreas[ClusterIndex] > 0.0f && NormalLength > 0.0f)
+		{
+			const FVector Centroid = ClusterCentroids[ClusterIndex] / ClusterAreas[ClusterIndex];
+			SortKeys[ClusterIndex] = (Centroid - MeshCentroid).Dot(ClusterNormals[ClusterIndex] / NormalLength);
+		}
+	}
+
+	TArray<int32> ClusterOrder;
+	ClusterOrder.SetNum(ClusterCount);
+	std::iota(ClusterOrder.begin(), ClusterOrder.end(), 0);
+	ClusterOrder.StableSort([&SortKeys](int32 A, int32 B)
+	{
+		return SortKeys[A] > SortKeys[B];
+	});
+
+	// 3. 정렬한 순서로 인덱스 재배치
+	TArray<uint32> SortedIndices;
+	SortedIndices.Reserve(TriangleCount * 3);
+	for (int32 ClusterIndex : ClusterOrder)
+	{
+		const uint32 Begin = Clusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < ClusterCount ? Clusters[ClusterIndex + 1] : TriangleCount;
+		SortedIndices.Append(InOutIndices + Begin * 3, static_cast<int32>((End - Begin) * 3));
+	}
+	memcpy(InOutIndices, SortedIndices.GetData(), sizeof(uint32) * SortedIndices.Num());
+}
+
+void FMeshOptimizer::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+	TArray<uint32> Remap;
+	Remap.SetNum(InOutVertices.Num(), INVALID_VERTEX);
+
+	TArray<FNormalVertex> SortedVertices;
+	SortedVertices.Reserve(InOutVertices.Num());
+	for (uint32& Index : InOutIndices)
+	{
+		uint32& NewIndex = Remap[Index];
+		if (NewIndex == INVALID_VERTEX)
+		{
+			NewIndex = static_cast<uint32>(SortedVertices.Num());
+			SortedVertices.Add(InOutVertices[Index]);
+		}
+		Index = NewIndex;
+	}
+
+	for (int32 Vertex = 0; Vertex < InOutVertices.Num(); ++Vertex)
+	{
+		if (Remap[Vertex] == INVALID_VERTEX)
+		{
+			SortedVertices.Add(InOutVertices[Vertex]);
+		}
+	}
+
+	InOutVertices = std::move(SortedVertices);
+}
+
+FMeshCacheStatistics FMeshOptimizer::Analyze(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexCount,
+	uint32 InVertexStride, uint32 InCacheSize)
+{
+	FFifoCache VertexCache(InVertexCount, InCacheSize);
+	FFifoCache LineCache(GetLineCount(InVertexCount, InVertexStride), MESH_OPTIMIZER_FETCH_CACHE_LINES);
+	FCacheCounters Counters;
+	AccumulateStatistics(InIndices, InIndexCount / 3 * 3, InVertexStride, VertexCache, LineCache, Counters);
+
+	TArray<uint8> UsedVertices;
+	UsedVertices.SetNum(InVertexCount, 0);
+	const uint32 UsedVertexCount = CountUsedVertices(InIndices, InIndexCount / 3 * 3, InVertexCount, UsedVertices);
+	return MakeStatistics(Counters, UsedVertexCount, InVertexStride);
+}
+
+FMeshCacheStatistics FMeshOptimizer::Analyze(const FStaticMesh& InStaticMesh, uint32 InCacheSize)
+{
+	const uint32 VertexCount = static_cast<uint32>(InStaticMesh.Vertices.Num());
+	const uint32 VertexStride = sizeof(FNormalVertex);
+
+	FFifoCache VertexCache(VertexCount, InCacheSize);
+	FFifoCache LineCache(GetLineCount(VertexCount, VertexStride), MESH_OPTIMIZER_FETCH_CACHE_LINES);
+	FCacheCounters Counters;
+	TArray<uint8> UsedVertices;
+	UsedVertices.SetNum(VertexCount, 0);
+	uint32 UsedVertexCount = 0;
+
+	for (const FMeshSection& Section : InStaticMesh.Sections)
+	{
+		const uint32 IndexCount = Section.IndexCount / 3 * 3;
+		if (static_cast<uint64>(Section.StartIndex) + IndexCount > static_cast<uint64>(InStaticMesh.Indices.Num()))
+		{
+			continue;
+		}
+
+		// 섹션마다 draw가 나뉘므로 캐시를 비운다
+		VertexCache.Flush();
+		LineCache.Flush();
+
+		const uint32* SectionIndices = InStaticMesh.Indices.GetData() + Section.StartIndex;
+		AccumulateStatistics(SectionIndices, IndexCount, VertexStride, VertexCache, LineCache, Counters);
+		UsedVertexCount += CountUsedVertices(SectionIndices, IndexCount, VertexCount, UsedVertices);
+	}
+
+	return MakeStatistics(Counters, UsedVertexCount, VertexStride);
+}
@@ -0,0 +1,844 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+
+namespace
+{
+	constexpr uint32 INVALID_VERTEX = UINT32_MAX;
+	constexpr double BORDER_WEIGHT = 10.0;              // 경계 보존 quadric 가중치 (삼각형 quadric 대비)
+	constexpr uint32 MIN_COLLAPSE_FRACTION_INVERSE = 8;  // 한 패스에서 비용 순으로 최소한 후보의 1/8까지는 시도
+
+	enum class EVertexKind : uint8
+	{
+		Manifold,  // 어느 이웃으로든 합칠 수 있음
+		Border,    // 열린 경계 위. 경계를 따라 이웃한 정점으로만 합칠 수 있음
+		Locked,    // 움직이지 않음
+	};
+
+	/**
+	 * @brief 평면까지의 거리 제곱 합을 나타내는 대칭 4x4 행렬
+	 * Error(p) = p^T A p + 2 B·p + C, 가중치 합 W로 나누면 평균 거리 제곱이 된다.
+	 */
+	struct FQuadric
+	{
+		double A00 = 0, A01 = 0, A02 = 0, A11 = 0, A12 = 0, A22 = 0;
+		double B0 = 0, B1 = 0, B2 = 0;
+		double C = 0;
+		double W = 0;
+
+		void AddPlane(double NX, double NY, double NZ, double D, double Weight)
+		{
+			A00 += Weight * NX * NX; A01 += Weight * NX * NY; A02 += Weight * NX * NZ;
+			A11 += Weight * NY * NY; A12 += Weight * NY * NZ; A22 += Weight * NZ * NZ;
+			B0 += Weight * NX * D; B1 += Weight * NY * D; B2 += Weight * NZ * D;
+			C += Weight * D * D;
+			W += Weight;
+		}
+
+		void operator+=(const FQuadric& Other)
+		{
+			A00 += Other.A00; A01 += Other.A01; A02 += Other.A02;
+			A11 += Other.A11; A12 += Other.A12; A22 += Other.A22;
+			B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+			C += Other.C;
+			W += Other.W;
+		}
+
+		//@return 평균 거리 제곱
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X, Y = P.Y, Z = P.Z;
+			const double Result = A00 * X * X + A11 * Y * Y + A22 * Z * Z
+				+ 2.0 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z)
+				+ 2.0 * (B0 * X + B1 * Y + B2 * Z) + C;
+			return W > 0.0 ? std::abs(Result) / W : 0.0;
+		}
+	};
+
+	struct FCollapse
+	{
+		uint32 From;
+		uint32 To;
+		double Error;
+	};
+
+	// 위치 → 인접 삼각형 목록 (CSR)
+	struct FTriangleAdjacency
+	{
+		TArray<uint32> Offsets;
+		TArray<uint32> Triangles;
+
+		void Build(const uint32* InIndices, uint32 InIndexCount, const TArray<uint32>& InPositionIds)
+		{
+			const uint32 PositionCount = static_cast<uint32>(InPositionIds.Num());
+			Offsets.SetNum(PositionCount + 1);
+			memset(Offsets.GetData(), 0, sizeof(uint32) * Offsets.Num());
+			for (uint32 i = 0; i < InIndexCount; ++i)
+			{
+				++Offsets[InPositionIds[InIndices[i]] + 1];
+			}
+			for (uint32 Position = 0; Position < PositionCount; ++Position)
+			{
+				Offsets[Position + 1] += Offsets[Position];
+			}
+
+			Triangles.SetNumUninitialized(InIndexCount);
+			TArray<uint32> Cursor(Offsets);
+			for (uint32 i = 0; i < InIndexCount; ++i)
+			{
+				Triangles[Cursor[InPositionIds[InIndices[i]]]++] = i / 3;
+			}
+		}
+	};
+
+	FVector ComputeTriangleNormal(const FVector& P0, const FVector& P1, const FVector& P2)
+	{
+		return (P1 - P0).Cross(P2 - P0);
+	}
+
+	/**
+	 * @brief 위치가 같은 정점을 하나로 묶는다 (OBJ/FBX는 노멀·UV가 다르면 정점이 나뉘므로 위상은 위치 기준으로 본다)
+	 * @param OutPositionIds: 정점마다 같은 위치를 가진 정점 중 대표 정점의 인덱스
+	 */
+	void WeldPositions(const TArray<FNormalVertex>& InVertices, TArray<uint32>& OutPositionIds)
+	{
+		const uint32 VertexCount = static_cast<uint32>(InVertices.Num());
+		TArray<uint32> Order;
+		Order.SetNum(VertexCount);
+		for (uint32 i = 0; i < VertexCount; ++i)
+		{
+			Order[i] = i;
+		}
+
+		auto Less = [&InVertices](uint32 A, uint32 B)
+		{
+			const FVector& PA = InVertices[A].Position;
+			const FVector& PB = InVertices[B].Position;
+			if (PA.X != PB.X) { return PA.X < PB.X; }
+			if (PA.Y != PB.Y) { return PA.Y < PB.Y; }
+			return PA.Z < PB.Z;
+		};
+		Order.Sort(Less);
+
+		OutPositionIds.SetNum(VertexCount);
+		for (uint32 i = 0; i < VertexCount; ++i)
+		{
+			const bool bSameAsPrevious = i > 0 && !Less(Order[i - 1], Order[i]);
+			OutPositionIds[Order[i]] = bSameAsPrevious ? OutPositionIds[Order[i - 1]] : Order[i];
+		}
+	}
+
+	// 한 위치에 붙은 정점(wedge) 사이의 속성 차이. collapse 후 삼각형 모서리가 쓸 정점을 고를 때 사용
+	float GetWedgeDistance(const FNormalVertex& A, const FNormalVertex& B)
+	{
+		const float DeltaU = A.TexCoord.X - B.TexCoord.X;
+		const float DeltaV = A.TexCoord.Y - B.TexCoord.Y;
+		return DeltaU * DeltaU + DeltaV * DeltaV + (1.0f - A.Normal.Dot(B.Normal));
+	}
+
+	uint32 SimplifyWelded(uint32* InOutIndices, uint32 InIndexCount, const TArray<FNormalVertex>& InVertices,
+		const TArray<uint32>& InPositionIds, const uint8* InLockedVertices, uint32 InTargetIndexCount, float InMaxError,
+		float* OutError)
+	{
+		const uint32 VertexCount = static_cast<uint32>(InVertices.Num());
+		uint32 IndexCount = InIndexCount / 3 * 3;
+		if (OutError)
+		{
+			*OutError = 0.0f;
+		}
+		if (IndexCount <= InTargetIndexCount || VertexCount == 0)
+		{
+			return IndexCount;
+		}
+
+		// 위상(인접, 경계, quadric, collapse)은 모두 위치 단위. 인덱스 버퍼는 정점(wedge) 단위
+		auto PositionOf = [&InPositionIds, InOutIndices](uint32 Triangle, uint32 Corner)
+		{
+			return InPositionIds[InOutIndices[Triangle * 3 + Corner]];
+		};
+
+		// 1. 열린 경계 찾기: 반대 방향 edge가 없는 edge (a→b)
+		FTriangleAdjacency Adjacency;
+		Adjacency.Build(InOutIndices, IndexCount, InPositionIds);
+
+		auto HasEdge = [&](uint32 From, uint32 To)
+		{
+			for (uint32 i = Adjacency.Offsets[From]; i < Adjacency.Offsets[From + 1]; ++i)
+			{
+				const uint32 Triangle = Adjacency.Triangles[i];
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					if (PositionOf(Triangle, Corner) == From && PositionOf(Triangle, (Corner + 1) % 3) == To)
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		};
+
+		TArray<uint32> OpenNext;
+		TArray<uint32> OpenPrev;
+		TArray<uint8> OpenEdgeCounts;
+		OpenNext.SetNum(VertexCount, INVALID_VERTEX);
+		OpenPrev.SetNum(VertexCount, INVALID_VERTEX);
+		OpenEdgeCounts.SetNum(VertexCount, 0);
+
+		TArray<FQuadric> Quadrics;
+		Quadrics.SetNum(VertexCount);
+
+		for (uint32 Triangle = 0; Triangle < IndexCount / 3; ++Triangle)
+		{
+			const FVector& P0 = InVertices[PositionOf(Triangle, 0)].Position;
+			const FVector& P1 = InVertices[PositionOf(Triangle, 1)].Position;
+			const FVector& P2 = InVertices[PositionOf(Triangle, 2)].Position;
+
+			// 2. 삼각형 평면 quadric (면적 가중)
+			const FVector Normal = ComputeTriangleNormal(P0, P1, P2);
+			const float DoubleArea = Normal.Length();
+			if (DoubleArea > 0.0f)
+			{
+				const FVector UnitNormal = Normal / DoubleArea;
+				const double D = -static_cast<double>(UnitNormal.Dot(P0));
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Quadrics[PositionOf(Triangle, Corner)].AddPlane(UnitNormal.X, UnitNormal.Y, UnitNormal.Z, D, DoubleArea * 0.5);
+				}
+			}
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 From = PositionOf(Triangle, Corner);
+				const uint32 To = PositionOf(Triangle, (Corner + 1) % 3);
+				if (From == To || HasEdge(To, From))
+				{
+					continue;
+				}
+
+				OpenNext[From] = To;
+				OpenPrev[To] = From;
+				OpenEdgeCounts[From] = static_cast<uint8>(std::min(OpenEdgeCounts[From] + 1, 255));
+				OpenEdgeCounts[To] = static_cast<uint8>(std::min(OpenEdgeCounts[To] + 1, 255));
+
+				// 3. 경계 보존 quadric: edge를 지나고 삼각형에 수직인 평면
+				if (DoubleArea > 0.0f)
+				{
+					const FVector Edge = InVertices[To].Position - InVertices[From].Position;
+					FVector EdgeNormal = Edge.Cross(Normal);
+					const float EdgeNormalLength = EdgeNormal.Length();
+					if (EdgeNormalLength > 0.0f)
+					{
+						EdgeNormal = EdgeNormal / EdgeNormalLength;
+						const double D = -static_cast<double>(EdgeNormal.Dot(InVertices[From].Position));
+						const double Weight = static_cast<double>(Edge.Dot(Edge)) * BORDER_WEIGHT;
+						Quadrics[From].AddPlane(EdgeNormal.X, EdgeNormal.Y, EdgeNormal.Z, D, Weight);
+						Quadrics[To].AddPlane(EdgeNormal.X, EdgeNormal.Y, EdgeNormal.Z, D, Weight);
+					}
+				}
+			}
+		}
+
+		// 4. 위치 분류
+		// - UV가 둘 이상인 위치(UV seam)는 고정. 노멀만 다른 위치(하드 엣지, flat shading)는 움직일 수 있다
+		TArray<uint32> FirstWedges;
+		TArray<uint8> bIsLocked;
+		FirstWedges.SetNum(VertexCount, INVALID_VERTEX);
+		bIsLocked.SetNum(VertexCount, 0);
+		for (uint32 i = 0; i < IndexCount; ++i)
+		{
+			const uint32 Wedge = InOutIndices[i];
+			const uint32 Position = InPositionIds[Wedge];
+			uint32& FirstWedge = FirstWedges[Position];
+			if (FirstWedge == INVALID_VERTEX)
+			{
+				FirstWedge = Wedge;
+			}
+			else if (InVertices[FirstWedge].TexCoord.X != InVertices[Wedge].TexCoord.X
+				|| InVertices[FirstWedge].TexCoord.Y != InVertices[Wedge].TexCoord.Y)
+			{
+				bIsLocked[Position] = 1;
+			}
+			if (InLockedVertices && InLockedVertices[Wedge])
+			{
+				bIsLocked[Position] = 1;
+			}
+		}
+
+		TArray<EVertexKind> Kinds;
+		Kinds.SetNum(VertexCount, EVertexKind::Manifold);
+		for (uint32 Position = 0; Position < VertexCount; ++Position)
+		{
+			if (bIsLocked[Position])
+			{
+				Kinds[Position] = EVertexKind::Locked;
+			}
+			else if (OpenEdgeCounts[Position] > 0)
+			{
+				// 경계가 한 줄로 지나갈 때만 경계를 따라 움직일 수 있다
+				const bool bSimpleBorder = OpenEdgeCounts[Position] == 2 && OpenNext[Position] != INVALID_VERTEX
+					&& OpenPrev[Position] != INVALID_VERTEX;
+				Kinds[Position] = bSimpleBorder ? EVertexKind::Border : EVertexKind::Locked;
+			}
+		}
+
+		// 5. Collapse 패스: 비용이 작은 순서로, 서로 겹치지 않는 collapse를 한 번에 수행한 뒤 인덱스를 갱신
+		TArray<uint32> Remap;
+		Remap.SetNum(VertexCount);
+		TArray<uint8> Touched;
+		Touched.SetNum(VertexCount);
+		TArray<uint32> NeighborStamps;
+		NeighborStamps.SetNum(VertexCount, 0);
+		uint32 Stamp = 0;
+		TArray<FCollapse> Collapses;
+		const double MaxErrorSquared = static_cast<double>(InMaxError) * InMaxError;
+		double ResultError = 0.0;
+
+		auto IsCollapseAllowed = [&Kinds, &OpenNext, &OpenPrev](uint32 From, uint32 To)
+		{
+			switch (Kinds[From])
+			{
+			case EVertexKind::Manifold:
+				return true;
+			case EVertexKind::Border:
+				return OpenNext[From] == To || OpenPrev[From] == To;
+			default:
+				return false;
+			}
+		};
+
+		auto ContainsPosition = [&PositionOf](uint32 Triangle, uint32 Position)
+		{
+			return PositionOf(Triangle, 0) == Position || PositionOf(Triangle, 1) == Position || PositionOf(Triangle, 2) == Position;
+		};
+
+		while (IndexCount > InTargetIndexCount)
+		{
+			Adjacency.Build(InOutIndices, IndexCount, InPositionIds);
+
+			Collapses.Empty();
+			for (uint32 Triangle = 0; Triangle < IndexCount / 3; ++Triangle)
+			{
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 A = PositionOf(Triangle, Corner);
+					const uint32 B = PositionOf(Triangle, (Corner + 1) % 3);
+					if (A == B)
+					{
+						continue;
+					}
+
+					// 양방향 중 비용이 작은 쪽을 후보로 (내부 edge는 두 삼각형에서 중복으로 나오지만 수행 시 걸러진다)
+					FCollapse Best = { INVALID_VERTEX, INVALID_VERTEX, DBL_MAX };
+					if (IsCollapseAllowed(A, B))
+					{
+						Best = { A, B, Quadrics[A].Evaluate(InVertices[B].Position) };
+					}
+					if (IsCollapseAllowed(B, A))
+					{
+						const double Error = Quadrics[B].Evaluate(InVertices[A].Position);
+						if (Error < Best.Error)
+						{
+							Best = { B, A, Error };
+						}
+					}
+					if (Best.From != INVALID_VERTEX && Best.Error <= MaxErrorSquared)
+					{
+						Collapses.Add(Best);
+					}
+				}
+			}
+
+			if (Collapses.IsEmpty())
+			{
+				break;
+			}
+
+			Collapses.Sort([](const FCollapse& A, const FCollapse& B) { return A.Error < B.Error; });
+
+			// 한 패스에서 너무 큰 오차까지 가지 않도록, 목표까지 필요한 collapse 수 근처의 비용을 패스 한도로 사용
+			// 목표에 가까워지거나 오차 한도에 걸려 후보가 적을 때 패스가 한없이 늘어나지 않도록 후보의 일정 비율은 항상 허용한다
+			const uint32 TrianglesToRemove = (IndexCount - InTargetIndexCount) / 3;
+			const uint32 MinCollapsesPerPass = static_cast<uint32>(Collapses.Num()) / MIN_COLLAPSE_FRACTION_INVERSE;
+			const int32 GoalIndex = std::min(static_cast<int32>(std::max({ TrianglesToRemove / 2, MinCollapsesPerPass, 1u })), Collapses.Num()) - 1;
+			const double PassErrorLimit = Collapses[GoalIndex].Error * 1.5;
+
+			for (uint32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+			{
+				Remap[Vertex] = Vertex;
+			}
+			memset(Touched.GetData(), 0, Touched.Num());
+
+			uint32 RemovedTriangles = 0;
+			uint32 PerformedCollapses = 0;
+			for (const FCollapse& Collapse : Collapses)
+			{
+				if (Collapse.Error > PassErrorLimit && PerformedCollapses > 0)
+				{
+					break;
+				}
+
+				const uint32 From = Collapse.From;
+				const uint32 To = Collapse.To;
+				if (Touched[From] || Touched[To])
+				{
+					continue;
+				}
+
+				const FVector& ToPosition = InVertices[To].Position;
+
+				// 5-1. 뒤집히는 삼각형이 생기면 거부
+				bool bFlipped = false;
+				uint32 SharedTriangles = 0;
+				for (uint32 i = Adjacency.Offsets[From]; i < Adjacency.Offsets[From + 1] && !bFlipped; ++i)
+				{
+					const uint32 Triangle = Adjacency.Triangles[i];
+					if (ContainsPosition(Triangle, To))
+					{
+						++SharedTriangles;
+						continue;
+					}
+
+					const uint32 V0 = PositionOf(Triangle, 0);
+					const uint32 V1 = PositionOf(Triangle, 1);
+					const uint32 V2 = PositionOf(Triangle, 2);
+					const FVector OldNormal = ComputeTriangleNormal(InVertices[V0].Position, InVertices[V1].Position, InVertices[V2].Position);
+					const FVector NewNormal = ComputeTriangleNormal(
+						V0 == From ? ToPosition : InVertices[V0].Position,
+						V1 == From ? ToPosition : InVertices[V1].Position,
+						V2 == From ? ToPosition : InVertices[V2].Position);
+					bFlipped = OldNormal.Dot(NewNormal) <= 0.0f;
+				}
+				if (bFlipped || SharedTriangles == 0)
+				{
+					continue;
+				}
+
+				// 5-2. Link condition: 두 위치의 공통 이웃이 edge를 공유하는 삼각형 수보다 많으면 비다양체가 된다
+				++Stamp;
+				for (uint32 i = Adjacency.Offsets[From]; i < Adjacency.Offsets[From + 1]; ++i)
+				{
+					for (uint32 Corner = 0; Corner < 3; ++Corner)
+					{
+						NeighborStamps[PositionOf(Adjacency.Triangles[i], Corner)] = Stamp;
+					}
+				}
+				const uint32 FromStamp = Stamp++;
+				uint32 CommonNeighbors = 0;
+				for (uint32 i = Adjacency.Offsets[To]; i < Adjacency.Offsets[To + 1]; ++i)
+				{
+					for (uint32 Corner = 0; Corner < 3; ++Corner)
+					{
+						const uint32 Neighbor = PositionOf(Adjacency.Triangles[i], Corner);
+						if (Neighbor != From && Neighbor != To && NeighborStamps[Neighbor] == FromStamp)
+						{
+							NeighborStamps[Neighbor] = Stamp;
+							++CommonNeighbors;
+						}
+					}
+				}
+				if (CommonNeighbors > SharedTriangles)
+				{
+					continue;
+				}
+
+				// 5-3. 수행: From의 정점마다 To에서 속성이 가장 비슷한 정점으로 옮긴다
+				for (uint32 i = Adjacency.Offsets[From]; i < Adjacency.Offsets[From + 1]; ++i)
+				{
+					const uint32 Triangle = Adjacency.Triangles[i];
+					for (uint32 Corner = 0; Corner < 3; ++Corner)
+					{
+						const uint32 Wedge = InOutIndices[Triangle * 3 + Corner];
+						if (InPositionIds[Wedge] != From || Remap[Wedge] != Wedge)
+						{
+							continue;
+						}
+
+						uint32 BestWedge = INVALID_VERTEX;
+						float BestDistance = FLT_MAX;
+						for (uint32 j = Adjacency.Offsets[To]; j < Adjacency.Offsets[To + 1]; ++j)
+						{
+							for (uint32 ToCorner = 0; ToCorner < 3; ++ToCorner)
+							{
+								const uint32 Candidate = InOutIndices[Adjacency.Triangles[j] * 3 + ToCorner];
+								if (InPositionIds[Candidate] != To)
+								{
+									continue;
+								}
+								const float Distance = GetWedgeDistance(InVertices[Wedge], InVertices[Candidate]);
+								if (Distance < BestDistance)
+								{
+									BestDistance = Distance;
+									BestWedge = Candidate;
+								}
+							}
+						}
+						Remap[Wedge] = BestWedge;
+					}
+				}
+
+				Quadrics[To] += Quadrics[From];
+				if (Kinds[From] == EVertexKind::Border)
+				{
+					if (OpenNext[From] == To)
+					{
+						OpenPrev[To] = OpenPrev[From];
+						OpenNext[OpenPrev[From]] = To;
+					}
+					else
+					{
+						OpenNext[To] = OpenNext[From];
+						OpenPrev[OpenNext[From]] = To;
+					}
+				}
+
+				// 주변 위치는 이번 패스에서 더 건드리지 않는다
+				for (const uint32 Position : { From, To })
+				{
+					for (uint32 i = Adjacency.Offsets[Position]; i < Adjacency.Offsets[Position + 1]; ++i)
+					{
+						const uint32 Triangle = Adjacency.Triangles[i];
+						Touched[PositionOf(Triangle, 0)] = Touched[PositionOf(Triangle, 1)] = Touched[PositionOf(Triangle, 2)] = 1;
+					}
+				}
+
+				ResultError = std::max(ResultError, Collapse.Error);
+				RemovedTriangles += SharedTriangles;
+				++PerformedCollapses;
+				if (RemovedTriangles >= TrianglesToRemove)
+				{
+					break;
+				}
+			}
+
+			if (PerformedCollapses == 0)
+			{
+				break;
+			}
+
+			// 5-4. 인덱스 갱신, 퇴화 삼각형(같은 위치가 두 번 나오는 삼각형) 제거
+			uint32 WriteIndex = 0;
+			for (uint32 i = 0; i < IndexCount; i += 3)
+			{
+				const uint32 V0 = Remap[InOutIndices[i + 0]];
+				const uint32 V1 = Remap[InOutIndices[i + 1]];
+				const uint32 V2 = Remap[InOutIndices[i + 2]];
+				const uint32 P0 = InPositionIds[V0];
+				const uint32 P1 = InPositionIds[V1];
+				const uint32 P2 = InPositionIds[V2];
+				if (P0 != P1 && P1 != P2 && P0 != P2)
+				{
+					InOutIndices[WriteIndex++] = V0;
+					InOutIndices[WriteIndex++] = V1;
+					InOutIndices[WriteIndex++] = V2;
+				}
+			}
+			IndexCount = WriteIndex;
+		}
+
+		if (OutError)
+		{
+			*OutError = static_cast<float>(std::sqrt(ResultError));
+		}
+		return IndexCount;
+	}
+}
+
+uint32 FMeshSimplifier::Simplify(uint32* InOutIndices, uint32 InIndexCount, const TArray<FNormalVertex>& InVertices,
+	const uint8* InLockedVertices, uint32 InTargetIndexCount, float InMaxError, float* OutError)
+{
+	TArray<uint32> PositionIds;
+	WeldPositions(InVertices, PositionIds);
+	return SimplifyWelded(InOutIndices, InIndexCount, InVertices, PositionIds, InLockedVertices, InTargetIndexCount, InMaxError, OutError);
+}
+
+void FMeshSimplifier::BuildLODs(FStaticMesh& InOutStaticMesh)
+{
+	InOutStaticMesh.LODs.Empty();
+	InOutStaticMesh.LODIndices.Empty();
+
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	const TArray<uint32>& Indices = InOutStaticMesh.Indices;
+	const uint32 BaseTriangleCount = static_cast<uint32>(Indices.Num() / 3);
+	if (BaseTriangleCount < STATIC_MESH_LOD_MIN_TRIANGLES || Vertices.IsEmpty())
+	{
+		return;
+	}
+
+	// 1. 메시 반경 (AABB 대각선의 절반). 허용 오차와 ScreenSize는 이 값에 대한 비율이다
+	FVector BoundsMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		BoundsMin.X = std::min(BoundsMin.X, Vertex.Position.X);
+		BoundsMin.Y = std::min(BoundsMin.Y, Vertex.Position.Y);
+		BoundsMin.Z = std::min(BoundsMin.Z, Vertex.Position.Z);
+		BoundsMax.X = std::max(BoundsMax.X, Vertex.Position.X);
+		BoundsMax.Y = std::max(BoundsMax.Y, Vertex.Position.Y);
+		BoundsMax.Z = std::max(BoundsMax.Z, Vertex.Position.Z);
+	}
+	const float Radius = (BoundsMax - BoundsMin).Length() * 0.5f;
+	if (Radius <= 0.0f)
+	{
+		return;
+	}
+
+	// 2. 여러 섹션이 쓰는 위치는 고정 (한쪽 섹션만 움직이면 재질 경계에 틈이 생긴다)
+	//    섹션마다 정점이 따로 있어도 위치가 같으면 경계이므로 위치 단위로 판단한다
+	TArray<uint32> PositionIds;
+	WeldPositions(Vertices, PositionIds);
+
+	TArray<uint8> LockedVertices;
+	LockedVertices.SetNum(Vertices.Num(), 0);
+	{
+		TArray<uint32> OwnerSections;
+		TArray<uint8> bIsSharedPosition;
+		OwnerSections.SetNum(Vertices.Num(), INVALID_VERTEX);
+		bIsSharedPosition.SetNum(Vertices.Num(), 0);
+		for (int32 SectionIndex = 0; SectionIndex < InOutStaticMesh.Sections.Num(); ++SectionIndex)
+		{
+			const FMeshSection& Section = InOutStaticMesh.Sections[SectionIndex];
+			for (uint32 i = Section.StartIndex; i < Section.StartIndex + Section.IndexCount && i < static_cast<uint32>(Indices.Num()); ++i)
+			{
+				const uint32 Position = PositionIds[Indices[i]];
+				uint32& Owner = OwnerSections[Position];
+				if (Owner != INVALID_VERTEX && Owner != static_cast<uint32>(SectionIndex))
+				{
+					bIsSharedPosition[Position] = 1;
+				}
+				Owner = static_cast<uint32>(SectionIndex);
+			}
+		}
+		for (int32 Vertex = 0; Vertex < Vertices.Num(); ++Vertex)
+		{
+			LockedVertices[Vertex] = bIsSharedPosition[PositionIds[Vertex]];
+		}
+	}
+
+	// 3. LOD마다 LOD0에서 다시 단순화 (오차가 누적되지 않는다)
+	TArray<uint32> SectionIndices;
+	uint32 PreviousTriangleCount = BaseTriangleCount;
+	float PreviousScreenSize = FLT_MAX;
+	float TargetRatio = 1.0f;
+	for (int32 LODIndex = 1; LODIndex < STATIC_MESH_MAX_LODS; ++LODIndex)
+	{
+		TargetRatio *= STATIC_MESH_LOD_REDUCTION;
+		const float MaxError = STATIC_MESH_LOD_MAX_ERRORS[LODIndex - 1] * Radius;
+
+		FStaticMeshLOD LOD;
+		LOD.StartIndex = static_cast<uint32>(Indices.Num() + InOutStaticMesh.LODIndices.Num());
+		const int32 LODIndicesBegin = InOutStaticMesh.LODIndices.Num();
+		float LODError = 0.0f;
+
+		for (const FMeshSection& Section : InOutStaticMesh.Sections)
+		{
+			const uint32 SectionIndexCount = Section.IndexCount / 3 * 3;
+			if (static_cast<uint64>(Section.StartIndex) + SectionIndexCount > static_cast<uint64>(Indices.Num()))
+			{
+				continue;
+			}
+
+			SectionIndices.SetNum(SectionIndexCount);
+			memcpy(SectionIndices.GetData(), Indices.GetData() + Section.StartIndex, sizeof(uint32) * SectionIndexCount);
+
+			const uint32 TargetIndexCount = static_cast<uint32>(SectionIndexCount / 3 * TargetRatio) * 3;
+			float SectionError = 0.0f;
+			const uint32 SimplifiedIndexCount = SimplifyWelded(SectionIndices.GetData(), SectionIndexCount, Vertices,
+				PositionIds, LockedVertices.GetData(), TargetIndexCount, MaxError, &SectionError);
+			LODError = std::max(LODError, SectionError);
+
+			FMeshOptimizer::OptimizeVertexCache(SectionIndices.GetData(), SimplifiedIndexCount, static_cast<uint32>(Vertices.Num()));
+
+			FMeshSection LODSection = Section;
+			LODSection.StartIndex = static_cast<uint32>(Indices.Num() + InOutStaticMesh.LODIndices.Num());
+			LODSection.IndexCount = SimplifiedIndexCount;
+			InOutStaticMesh.LODIndices.Append(SectionIndices.GetData(), static_cast<int32>(SimplifiedIndexCount));
+			LOD.Sections.Add(LODSection);
+		}
+
+		LOD.IndexCount = static_cast<uint32>(InOutStaticMesh.LODIndices.Num() - LODIndicesBegin);
+		const uint32 TriangleCount = LOD.IndexCount / 3;
+
+		// 허용 오차 안에서 충분히 줄지 않으면 더 거친 LOD도 의미가 없다
+		if (TriangleCount == 0 || TriangleCount > PreviousTriangleCount * STATIC_MESH_LOD_MIN_GAIN)
+		{
+			InOutStaticMesh.LODIndices.SetNum(LODIndicesBegin);
+			break;
+		}
+
+		LOD.Error = LODError / Radius;
+		LOD.ScreenSize = std::min(ComputeScreenSize(LOD.Error), PreviousScreenSize);
+		PreviousScreenSize = LOD.ScreenSize;
+		PreviousTriangleCount = TriangleCount;
+		InOutStaticMesh.LODs.Add(std::move(LOD));
+	}
+}
+
+void FMeshSimplifier::BuildOccluder(FStaticMesh& InOutStaticMesh)
+{
+	InOutStaticMesh.OccluderVertices.Empty();
+	InOutStaticMesh.OccluderIndices.Empty();
+
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	const uint32 IndexCount = static_cast<uint32>(InOutStaticMesh.Indices.Num()) / 3 * 3;
+	if (IndexCount == 0 || Vertices.IsEmpty())
+	{
+		return;
+	}
+
+	FVector BoundsMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		BoundsMin.X = std::min(BoundsMin.X, Vertex.Position.X);
+		BoundsMin.Y = std::min(BoundsMin.Y, Vertex.Position.Y);
+		BoundsMin.Z = std::min(BoundsMin.Z, Vertex.Position.Z);
+		BoundsMax.X = std::max(BoundsMax.X, Vertex.Position.X);
+		BoundsMax.Y = std::max(BoundsMax.Y, Vertex.Position.Y);
+		BoundsMax.Z = std::max(BoundsMax.Z, Vertex.Position.Z);
+	}
+	const float Radius = (BoundsMax - BoundsMin).Length() * 0.5f;
+	if (Radius <= 0.0f)
+	{
+		return;
+	}
+
+	// 1. 위치만 남긴 정점으로 인덱스를 옮긴다. 노멀과 UV가 모두 같으므로 seam 없이 위치 단위로 합쳐진다
+	TArray<uint32> PositionIds;
+	WeldPositions(Vertices, PositionIds);
+
+	TArray<FNormalVertex> PositionVertices;
+	PositionVertices.SetNum(Vertices.Num());
+	for (int32 Vertex = 0; Vertex < Vertices.Num(); ++Vertex)
+	{
+		PositionVertices[Vertex].Position = Vertices[Vertex].Position;
+	}
+
+	TArray<uint32> Indices;
+	Indices.Reserve(IndexCount);
+	for (uint32 i = 0; i < IndexCount; i += 3)
+	{
+		const uint32 P0 = PositionIds[InOutStaticMesh.Indices[i]];
+		const uint32 P1 = PositionIds[InOutStaticMesh.Indices[i + 1]];
+		const uint32 P2 = PositionIds[InOutStaticMesh.Indices[i + 2]];
+		if (P0 != P1 && P1 != P2 && P2 != P0)
+		{
+			Indices.Add(P0);
+			Indices.Add(P1);
+			Indices.Add(P2);
+		}
+	}
+
+	// 2. 목표 삼각형 수까지 단순화. 오차 한도에 걸려 충분히 줄지 않으면 오클루더로 쓰기에 너무 비싸다
+	float OccluderError = 0.0f;
+	const uint32 SimplifiedIndexCount = Simplify(Indices.GetData(), static_cast<uint32>(Indices.Num()), PositionVertices, nullptr,
+		STATIC_MESH_OCCLUDER_TARGET_TRIANGLES * 3, STATIC_MESH_OCCLUDER_MAX_ERROR * Radius, &OccluderError);
+	if (SimplifiedIndexCount == 0 || SimplifiedIndexCount / 3 > STATIC_MESH_OCCLUDER_MAX_TRIANGLES)
+	{
+		return;
+	}
+
+	// 3. 남은 위치만 처음 쓰인 순서로 모은다
+	TArray<uint32> Remap;
+	Remap.SetNum(Vertices.Num(), INVALID_VERTEX);
+	InOutStaticMesh.OccluderIndices.SetNum(SimplifiedIndexCount);
+	for (uint32 i = 0; i < SimplifiedIndexCount; ++i)
+	{
+		uint32& NewIndex = Remap[Indices[i]];
+		if (NewIndex == INVALID_VERTEX)
+		{
+			NewIndex = static_cast<uint32>(InOutStaticMesh.OccluderVertices.Num());
+			InOutStaticMesh.OccluderVertices.Add(Vertices[Indices[i]].Position);
+		}
+		InOutStaticMesh.OccluderIndices[i] = NewIndex;
+	}
+
+	// 4. 원본보다 더 가리지 않도록 정점을 노멀 반대 방향으로 실제 오차만큼 밀어 넣는다.
+	//    열린 메시나 얇은 부분에서는 보장되지 않으므로, 결과가 원본 AABB를 벗어나거나 면이 뒤집히면 오클루더를 만들지 않는다
+	if (OccluderError > 0.0f && !ShrinkAlongNormals(InOutStaticMesh, OccluderError, BoundsMin, BoundsMax))
+	{
+		InOutStaticMesh.OccluderVertices.Empty();
+		InOutStaticMesh.OccluderIndices.Empty();
+	}
+}
+
+bool FMeshSimplifier::ShrinkAlongNormals(FStaticMesh& InOutStaticMesh, float InDistance, const FVector& InBoundsMin, const FVector& InBoundsMax)
+{
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh.Vertices;
+	const TArray<uint32>& SourceIndices = InOutStaticMesh.Indices;
+	TArray<FVector>& OccluderVertices = InOutStaticMesh.OccluderVertices;
+	const TArray<uint32>& OccluderIndices = InOutStaticMesh.OccluderIndices;
+
+	// 감김 방향과 바깥쪽의 관계는 메시마다 다를 수 있으므로 원본 삼각형과 정점 노멀로 정한다
+	float WindingAgreement = 0.0f;
+	for (int32 i = 0; i + 2 < SourceIndices.Num(); i += 3)
+	{
+		const FNormalVertex& V0 = Vertices[SourceIndices[i]];
+		const FNormalVertex& V1 = Vertices[SourceIndices[i + 1]];
+		const FNormalVertex& V2 = Vertices[SourceIndices[i + 2]];
+		const FVector FaceNormal = (V1.Position - V0.Position).Cross(V2.Position - V0.Position);
+		WindingAgreement += FaceNormal.Dot(V0.Normal + V1.Normal + V2.Normal);
+	}
+	const float OutwardSign = WindingAgreement >= 0.0f ? 1.0f : -1.0f;
+
+	// 면적 가중 정점 노멀
+	TArray<FVector> VertexNormals;
+	VertexNormals.SetNum(OccluderVertices.Num(), FVector(0.0f, 0.0f, 0.0f));
+	for (int32 i = 0; i + 2 < OccluderIndices.Num(); i += 3)
+	{
+		const FVector& P0 = OccluderVertices[OccluderIndices[i]];
+		const FVector& P1 = OccluderVertices[OccluderIndices[i + 1]];
+		const FVector& P2 = OccluderVertices[OccluderIndices[i + 2]];
+		const FVector FaceNormal = (P1 - P0).Cross(P2 - P0);
+		VertexNormals[OccluderIndices[i]] += FaceNormal;
+		VertexNormals[OccluderIndices[i + 1]] += FaceNormal;
+		VertexNormals[OccluderIndices[i + 2]] += FaceNormal;
+	}
+
+	TArray<FVector> FaceNormals;
+	FaceNormals.Reserve(OccluderIndices.Num() / 3);
+	for (int32 i = 0; i + 2 < OccluderIndices.Num(); i += 3)
+	{
+		const FVector& P0 = OccluderVertices[OccluderIndices[i]];
+		FaceNormals.Add((OccluderVertices[OccluderIndices[i + 1]] - P0).Cross(OccluderVertices[OccluderIndices[i + 2]] - P0));
+	}
+
+	for (int32 Vertex = 0; Vertex < OccluderVertices.Num(); ++Vertex)
+	{
+		if (VertexNormals[Vertex].LengthSquared() > 0.0f)
+		{
+			OccluderVertices[Vertex] -= VertexNormals[Vertex].GetNormalized() * (OutwardSign * InDistance);
+		}
+
+		const FVector& Position = OccluderVertices[Vertex];
+		if (Position.X < InBoundsMin.X || Position.Y < InBoundsMin.Y || Position.Z < InBoundsMin.Z
+			|| Position.X > InBoundsMax.X || Position.Y > InBoundsMax.Y || Position.Z > InBoundsMax.Z)
+		{
+			return false;
+		}
+	}
+
+	// 노멀이 서로 다른 실루엣 정점이 엇갈려 움직이면 면이 뒤집히거나 사라질 수 있다
+	for (int32 i = 0; i + 2 < OccluderIndices.Num(); i += 3)
+	{
+		const FVector& P0 = OccluderVertices[OccluderIndices[i]];
+		const FVector FaceNormal = (OccluderVertices[OccluderIndices[i + 1]] - P0).Cross(OccluderVertices[OccluderIndices[i + 2]] - P0);
+		if (FaceNormal.Dot(FaceNormals[i / 3]) <= 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+float FMeshSimplifier::ComputeScreenSize(float InRelativeError)
+{
+	// 화면 오차(픽셀) = 상대 오차 * ScreenSize * 화면 높이의 절반
+	if (InRelativeError <= 0.0f)
+	{
+		return FLT_MAX;
+	}
+	return STATIC_MESH_LOD_PIXEL_ERROR / (InRelativeError * STATIC_MESH_LOD_REFERENCE_SCREEN_HEIGHT * 0.5f);
+}
@@ -1,9 +1,254 @@
 #include "pch.h"
 
+#include "Core/Public/MappedFile.h"
 #include "Core/Public/WindowsBinReader.h"
 #include "Core/Public/WindowsBinWriter.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+#include <charconv>
+#include <string_view>
+
+/**
+ * @brief 파일 조각 하나의 파싱 결과
+ * 오브젝트/그룹/머티리얼 지시문은 그 시점까지 쌓인 면·인덱스 수와 함께 기록해 두고,
+ * 병합 단계에서 순서대로 재생해 어느 오브젝트에 면이 속하는지 결정한다.
+ */
+struct FObjParseChunk
+{
+	enum class EDirective : uint8
+	{
+		Object,           // o
+		Group,            // g
+		Material,         // usemtl
+		MaterialLibrary,  // mtllib
+		Face,             // f (오브젝트가 없으면 기본 오브젝트를 만든다)
+	};
+
+	struct FDirective
+	{
+		EDirective Type;
+		FString Name;
+		int32 FaceCount;
+		int32 VertexIndexCount;
+		int32 TexCoordIndexCount;
+		int32 NormalIndexCount;
+	};
+
+	TArray<FVector> VertexList;
+	TArray<FVector> NormalList;
+	TArray<FVector2> TexCoordList;
+
+	TArray<size_t> VertexIndexList;
+	TArray<size_t> TexCoordIndexList;
+	TArray<size_t> NormalIndexList;
+	int32 FaceCount = 0;
+
+	// 음수(상대) 인덱스는 조각 안의 위치로만 풀어 두고, 병합 단계에서 앞 조각들의 요소 수를 더한다
+	TArray<int32> RelativeVertexIndices;
+	TArray<int32> RelativeTexCoordIndices;
+	TArray<int32> RelativeNormalIndices;
+
+	TArray<FDirective> Directives;
+	FString Error;
+
+	void AddDirective(EDirective Type, std::string_view Name)
+	{
+		Directives.Add({ Type, FString(std::string(Name)), FaceCount, VertexIndexList.Num(), TexCoordIndexList.Num(), NormalIndexList.Num() });
+	}
+};
+
+namespace
+{
+	FORCEINLINE bool IsObjSpace(char Character)
+	{
+		return Character == ' ' || Character == '\t' || Character == '\r';
+	}
+
+	/**
+	 * @brief 한 줄 안에서 공백으로 구분된 토큰과 숫자를 문자열 할당 없이 읽는다.
+	 */
+	struct FObjTokenizer
+	{
+		const char* Cursor;
+		const char* End;
+
+		void SkipSpaces()
+		{
+			while (Cursor < End && IsObjSpace(*Cursor))
+			{
+				++Cursor;
+			}
+		}
+
+		std::string_view NextToken()
+		{
+			SkipSpaces();
+			const char* Start = Cursor;
+			while (Cursor < End && !IsObjSpace(*Cursor))
+			{
+				++Cursor;
+			}
+			return std::string_view(Start, static_cast<size_t>(Cursor - Start));
+		}
+
+		bool NextToken(FString& OutToken)
+		{
+			const std::string_view Token = NextToken();
+			if (Token.empty())
+			{
+				return false;
+			}
+			OutToken.assign(Token.data(), Token.size());
+			return true;
+		}
+
+		bool ParseFloat(float& OutValue)
+		{
+			SkipSpaces();
+			if (Cursor < End && *Cursor == '+')
+			{
+				++Cursor;
+			}
+
+			std::from_chars_result Result = std::from_chars(Cursor, End, OutValue);
+			if (Result.ec == std::errc::result_out_of_range)
+			{
+				// float 범위를 벗어난 값은 double로 다시 읽어 가장 가까운 float로 clamp (double로도 벗어나면 실패)
+				double Value = 0.0;
+				Result = std::from_chars(Cursor, End, Value);
+				if (Result.ec != std::errc())
+				{
+					return false;
+				}
+				OutValue = static_cast<float>(std::clamp(Value, -static_cast<double>(FLT_MAX), static_cast<double>(FLT_MAX)));
+			}
+			else if (Result.ec != std::errc())
+			{
+				return false;
+			}
+			Cursor = Result.ptr;
+			return true;
+		}
+
+		bool ParseInt(int32& OutValue)
+		{
+			SkipSpaces();
+			const std::from_chars_result Result = std::from_chars(Cursor, End, OutValue);
+			if (Result.ec != std::errc())
+			{
+				return false;
+			}
+			Cursor = Result.ptr;
+			return true;
+		}
+	};
+
+	/**
+	 * @brief 면 꼭짓점 하나("v", "v/vt", "v//vn", "v/vt/vn")를 0-based 인덱스로 읽는다.
+	 * 음수 인덱스는 그 줄까지 읽은 요소 기준의 상대 인덱스이므로 조각 안의 위치로 풀고 Relative*Indices에 기록한다.
+	 * @return 형식이 잘못되었으면 오류 메시지, 성공하면 nullptr
+	 */
+	const char* ParseFaceCorner(std::string_view Corner, FObjParseChunk* OutChunk)
+	{
+		const char* Cursor = Corner.data();
+		const char* End = Corner.data() + Corner.size();
+
+		auto ParseIndex = [&](TArray<size_t>& OutIndexList, int32 InElementCount, TArray<int32>& OutRelativeIndices) -> bool
+		{
+			int64 Index = 0;
+			const std::from_chars_result Result = std::from_chars(Cursor, End, Index);
+			if (Result.ec != std::errc() || Index == 0)
+			{
+				return false;
+			}
+			Cursor = Result.ptr;
+
+			if (Index < 0)
+			{
+				// 조각 시작보다 앞을 가리키면 음수가 되며, 2의 보수로 저장했다가 병합 때 기준 값을 더한다
+				OutRelativeIndices.Add(OutIndexList.Num());
+				OutIndexList.Add(static_cast<size_t>(static_cast<int64>(InElementCount) + Index));
+				return true;
+			}
+			OutIndexList.Add(static_cast<size_t>(Index - 1));
+			return true;
+		};
+
+		if (!ParseIndex(OutChunk->VertexIndexList, OutChunk->VertexList.Num(), OutChunk->RelativeVertexIndices))
+		{
+			return "정점 위치 인덱스 형식이 잘못되었습니다";
+		}
+		if (Cursor == End)
+		{
+			return nullptr;
+		}
+		if (*Cursor++ != '/')
+		{
+			return "정점 위치 인덱스 형식이 잘못되었습니다";
+		}
+
+		if (Cursor < End && *Cursor == '/')
+		{
+			++Cursor;
+			if (!ParseIndex(OutChunk->NormalIndexList, OutChunk->NormalList.Num(), OutChunk->RelativeNormalIndices) || Cursor != End)
+			{
+				return "정점 법선 인덱스 형식이 잘못되었습니다";
+			}
+			return nullptr;
+		}
+
+		if (!ParseIndex(OutChunk->TexCoordIndexList, OutChunk->TexCoordList.Num(), OutChunk->RelativeTexCoordIndices))
+		{
+			return "정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다";
+		}
+		if (Cursor == End)
+		{
+			return nullptr;
+		}
+		if (*Cursor++ != '/' || !ParseIndex(OutChunk->NormalIndexList, OutChunk->NormalList.Num(), OutChunk->RelativeNormalIndices) || Cursor != End)
+		{
+			return "정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다";
+		}
+		return nullptr;
+	}
+
+	// 한 줄의 끝(개행 문자 위치 또는 End)
+	FORCEINLINE const char* FindLineEnd(const char* Cursor, const char* End)
+	{
+		const void* NewLine = memchr(Cursor, '\n', static_cast<size_t>(End - Cursor));
+		return NewLine ? static_cast<const char*>(NewLine) : End;
+	}
+
+	// mtllib 이름을 .obj 파일 기준의 경로로 바꾼다. 정규화할 수 없는 경로는 이어 붙인 그대로 쓴다
+	std::filesystem::path ResolveMaterialLibraryPath(const std::filesystem::path& ObjFilePath, const FString& LibraryName)
+	{
+		const std::filesystem::path JoinedPath = ObjFilePath.parent_path() / LibraryName;
+
+		std::error_code ErrorCode;
+		std::filesystem::path NormalizedPath = std::filesystem::weakly_canonical(JoinedPath, ErrorCode);
+		if (ErrorCode)
+		{
+			return JoinedPath;
+		}
+		return NormalizedPath;
+	}
+
+	/**
+	 * @brief 파일 전체를 읽기 위한 뷰. 비어 있는 파일은 매핑할 수 없으므로 빈 구간으로 취급한다.
+	 */
+	bool OpenTextFile(const std::filesystem::path& FilePath, FMappedFile& OutFile)
+	{
+		if (OutFile.Open(FilePath))
+		{
+			return true;
+		}
+
+		std::error_code ErrorCode;
+		return std::filesystem::file_size(FilePath, ErrorCode) == 0 && !ErrorCode;
+	}
+}
 
 bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
 {
@@ -47,253 +292,356 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		return false;
 	}
 
-	std::ifstream File(FilePath);
-	if (!File)
+	FMappedFile File;
+	if (!OpenTextFile(FilePath, File))
 	{
 		UE_LOG_ERROR("파일을 열지 못했습니다: %ls", FilePath.c_str());
 		return false;
 	}
 
-	size_t FaceCount = 0;
+	const char* FileBegin = reinterpret_cast<const char*>(File.GetData());
+	const char* FileEnd = FileBegin + File.GetSize();
 
-	TOptional<FObjectInfo> OptObjectInfo;
+	// 1. 줄 경계에 맞춰 조각으로 나눔 (작은 파일은 한 조각)
+	TArray<const char*> ChunkBounds;
+	ChunkBounds.Add(FileBegin);
+	if (Config.bAllowParallelParse && File.GetSize() >= OBJ_PARSE_PARALLEL_MIN_BYTES)
+	{
+		const char* Cursor = FileBegin;
+		while (static_cast<size_t>(FileEnd - Cursor) > OBJ_PARSE_CHUNK_SIZE)
+		{
+			Cursor = FindLineEnd(Cursor + OBJ_PARSE_CHUNK_SIZE, FileEnd);
+			if (Cursor < FileEnd)
+			{
+				++Cursor;
+			}
+			ChunkBounds.Add(Cursor);
+		}
+	}
+	if (ChunkBounds.Last() != FileEnd)
+	{
+		ChunkBounds.Add(FileEnd);
+	}
 
-	FString Buffer;
-	while (std::getline(File, Buffer))
+	// 2. 조각마다 독립적으로 파싱
+	const int32 ChunkCount = ChunkBounds.Num() - 1;
+	TArray<FObjParseChunk> Chunks;
+	Chunks.SetNum(ChunkCount);
+	TArray<uint8> ChunkResults;
+	ChunkResults.SetNum(ChunkCount);
+	FTaskScheduler::GetInstance().ParallelFor(ChunkCount, 1, [&](int32 Begin, int32 End)
 	{
-		std::istringstream Tokenizer(Buffer);
-		FString Prefix;
+		for (int32 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+		{
+			ChunkResults[ChunkIndex] = ParseObjChunk(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1], Config, &Chunks[ChunkIndex]);
+		}
+	});
 
-		Tokenizer >> Prefix;
+	// 3. 파일 순서대로 병합하며 지시문을 재생
+	size_t FaceCount = 0;
+	TOptional<FObjectInfo> OptObjectInfo;
 
-		// ========================== Vertex Information ============================ //
+	auto EnsureObject = [&]()
+	{
+		if (!OptObjectInfo)
+		{
+			OptObjectInfo.emplace();
+			OptObjectInfo->Name = Config.DefaultName;
+		}
+	};
 
-		/** Vertex Position */
-		if (Prefix == "v")
+	for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		FObjParseChunk& Chunk = Chunks[ChunkIndex];
+		if (!ChunkResults[ChunkIndex])
 		{
-			FVector Position;
-			if (!(Tokenizer >> Position.X >> Position.Y >> Position.Z))
-			{
-				UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
-				return false;
-			}
+			UE_LOG_ERROR("%s", Chunk.Error.c_str());
+			return false;
+		}
 
-			if (Config.bPositionToUEBasis)
-			{
-				OutObjInfo->VertexList.Emplace(PositionToUEBasis(Position));
-			}
-			else
+		// 상대 인덱스에 앞 조각들의 요소 수를 더해 파일 전체 기준으로 바꾼다
+		auto ResolveRelativeIndices = [](TArray<size_t>& InOutIndexList, const TArray<int32>& InRelativeIndices, int32 InBaseCount)
+		{
+			for (const int32 Position : InRelativeIndices)
 			{
-				OutObjInfo->VertexList.Emplace(Position);
+				const int64 Resolved = static_cast<int64>(InOutIndexList[Position]) + InBaseCount;
+				if (Resolved < 0)
+				{
+					return false;
+				}
+				InOutIndexList[Position] = static_cast<size_t>(Resolved);
 			}
-
+			return true;
+		};
+		if (!ResolveRelativeIndices(Chunk.VertexIndexList, Chunk.RelativeVertexIndices, OutObjInfo->VertexList.Num())
+			|| !ResolveRelativeIndices(Chunk.TexCoordIndexList, Chunk.RelativeTexCoordIndices, OutObjInfo->TexCoordList.Num())
+			|| !ResolveRelativeIndices(Chunk.NormalIndexList, Chunk.RelativeNormalIndices, OutObjInfo->NormalList.Num()))
+		{
+			UE_LOG_ERROR("상대 인덱스가 파일의 시작보다 앞을 가리킵니다: %ls", FilePath.c_str());
+			return false;
 		}
-		/** Vertex Normal */
-		else if (Prefix == "vn")
+
+		OutObjInfo->VertexList.Append(std::move(Chunk.VertexList));
+		OutObjInfo->NormalList.Append(std::move(Chunk.NormalList));
+		OutObjInfo->TexCoordList.Append(std::move(Chunk.TexCoordList));
+
+		// 직전 지시문 이후에 쌓인 면을 현재 오브젝트로 옮긴다
+		FObjParseChunk::FDirective Flushed = { FObjParseChunk::EDirective::Face, FString(), 0, 0, 0, 0 };
+		auto FlushFaces = [&](int32 InFaceCount, int32 InVertexIndexCount, int32 InTexCoordIndexCount, int32 InNormalIndexCount)
 		{
-			FVector Normal;
-			if (!(Tokenizer >> Normal.X >> Normal.Y >> Normal.Z))
+			if (InVertexIndexCount > Flushed.VertexIndexCount || InTexCoordIndexCount > Flushed.TexCoordIndexCount || InNormalIndexCount > Flushed.NormalIndexCount)
 			{
-				UE_LOG_ERROR("정점 법선 형식이 잘못되었습니다");
-				return false;
+				EnsureObject();
+				OptObjectInfo->VertexIndexList.Append(Chunk.VertexIndexList.GetData() + Flushed.VertexIndexCount, InVertexIndexCount - Flushed.VertexIndexCount);
+				OptObjectInfo->TexCoordIndexList.Append(Chunk.TexCoordIndexList.GetData() + Flushed.TexCoordIndexCount, InTexCoordIndexCount - Flushed.TexCoordIndexCount);
+				OptObjectInfo->NormalIndexList.Append(Chunk.NormalIndexList.GetData() + Flushed.NormalIndexCount, InNormalIndexCount - Flushed.NormalIndexCount);
 			}
+			FaceCount += InFaceCount - Flushed.FaceCount;
 
-			if (Config.bNormalToUEBasis)
-			{
-				OutObjInfo->NormalList.Emplace(NormalToUEBasis(Normal));
-			}
-			else
-			{
-				OutObjInfo->NormalList.Emplace(Normal);
-			}
-		}
-		/** Texture Coordinate */
-		else if (Prefix == "vt")
+			Flushed.FaceCount = InFaceCount;
+			Flushed.VertexIndexCount = InVertexIndexCount;
+			Flushed.TexCoordIndexCount = InTexCoordIndexCount;
+			Flushed.NormalIndexCount = InNormalIndexCount;
+		};
+
+		for (FObjParseChunk::FDirective& Directive : Chunk.Directives)
 		{
-			/** @note: Ignore 3D Texture */
-			FVector2 TexCoord;
-			if (!(Tokenizer >> TexCoord.X >> TexCoord.Y))
+			FlushFaces(Directive.FaceCount, Directive.VertexIndexCount, Directive.TexCoordIndexCount, Directive.NormalIndexCount);
+
+			switch (Directive.Type)
 			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 형식이 잘못되었습니다");
-				return false;
-			}
+			case FObjParseChunk::EDirective::Object:
+				if (OptObjectInfo)
+				{
+					OutObjInfo->ObjectInfoList.Emplace(std::move(*OptObjectInfo));
+				}
+				OptObjectInfo.emplace();
+				OptObjectInfo->Name = std::move(Directive.Name);
+				FaceCount = 0;
+				break;
 
-			if (Config.bUVToUEBasis)
+			case FObjParseChunk::EDirective::Group:
+				EnsureObject();
+				OptObjectInfo->GroupNameList.Emplace(std::move(Directive.Name));
+				OptObjectInfo->GroupIndexList.Emplace(FaceCount);
+				break;
+
+			case FObjParseChunk::EDirective::Material:
+				EnsureObject();
+				OptObjectInfo->MaterialNameList.Emplace(std::move(Directive.Name));
+				OptObjectInfo->MaterialIndexList.Emplace(FaceCount);
+				break;
+
+			case FObjParseChunk::EDirective::MaterialLibrary:
 			{
-				OutObjInfo->TexCoordList.Emplace(UVToUEBasis(TexCoord));
+				const std::filesystem::path MaterialFilePath = ResolveMaterialLibraryPath(FilePath, Directive.Name);
+
+				if (!LoadMaterial(MaterialFilePath, OutObjInfo))
+				{
+					UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %ls", MaterialFilePath.c_str());
+					return false;
+				}
+				break;
 			}
-			else
-			{
-				OutObjInfo->TexCoordList.Emplace(TexCoord);
+
+			case FObjParseChunk::EDirective::Face:
+				EnsureObject();
+				break;
 			}
 		}
+		FlushFaces(Chunk.FaceCount, Chunk.VertexIndexList.Num(), Chunk.TexCoordIndexList.Num(), Chunk.NormalIndexList.Num());
+	}
 
-		// =========================== Group Information ============================ //
+	if (OptObjectInfo)
+	{
+		OutObjInfo->ObjectInfoList.Emplace(std::move(*OptObjectInfo));
+	}
 
-		/** Object Information */
-		else if (Prefix == "o")
+	// objbin 저장 (캐싱)
+	if (Config.bIsBinaryEnabled)
+	{
+		// Cooked 폴더가 이미 PathManager에 의해 생성되어 있음
+		FWindowsBinWriter WindowsBinWriter(BinFilePath);
+		WindowsBinWriter << *OutObjInfo;
+		UE_LOG_SUCCESS("ObjCache: Saved objbin '%ls'", BinFilePath.c_str());
+	}
+
+	return true;
+}
+
+void FObjImporter::FindMaterialLibraries(const std::filesystem::path& FilePath, TArray<std::filesystem::path>& OutPaths)
+{
+	FMappedFile File;
+	if (!OpenTextFile(FilePath, File))
+	{
+		return;
+	}
+
+	const char* Cursor = reinterpret_cast<const char*>(File.GetData());
+	const char* FileEnd = Cursor + File.GetSize();
+	while (Cursor < FileEnd)
+	{
+		const char* LineEnd = FindLineEnd(Cursor, FileEnd);
+		FObjTokenizer Tokenizer{ Cursor, LineEnd };
+		Cursor = LineEnd + 1;
+
+		if (Tokenizer.NextToken() != "mtllib")
 		{
-			if (!Config.bIsObjectEnabled)
-			{
-				continue; // Ignore 'o' prefix
-			}
+			continue;
+		}
+		const std::string_view LibraryName = Tokenizer.NextToken();
+		if (!LibraryName.empty())
+		{
+			OutPaths.Add(ResolveMaterialLibraryPath(FilePath, FString(LibraryName)));
+		}
+	}
+}
 
-			if (OptObjectInfo)
-			{
-				OutObjInfo->ObjectInfoList.Emplace(std::move(*OptObjectInfo));
-			}
+bool FObjImporter::ParseObjChunk(const char* Begin, const char* End, const Configuration& Config, FObjParseChunk* OutChunk)
+{
+	using EDirective = FObjParseChunk::EDirective;
+
+	// 조각 크기로 대략적인 요소 수를 예상해 재할당을 줄인다 (정점 한 줄은 대략 30바이트)
+	const size_t EstimatedLineCount = static_cast<size_t>(End - Begin) / 32;
+	OutChunk->VertexList.Reserve(static_cast<int32>(EstimatedLineCount / 2));
+	OutChunk->VertexIndexList.Reserve(static_cast<int32>(EstimatedLineCount));
+
+	std::string_view FaceCorners[64];
+
+	const char* LineBegin = Begin;
+	while (LineBegin < End)
+	{
+		const char* LineEnd = FindLineEnd(LineBegin, End);
+		FObjTokenizer Tokenizer{ LineBegin, LineEnd };
+		LineBegin = LineEnd + 1;
+
+		const std::string_view Prefix = Tokenizer.NextToken();
+		if (Prefix.empty() || Prefix[0] == '#')
+		{
+			continue;
+		}
+
+		// ========================== Vertex Information ============================ //
 
-			FString ObjectName;
-			if (!(Tokenizer >> ObjectName))
+		/** Vertex Position */
+		if (Prefix == "v")
+		{
+			FVector Position;
+			if (!Tokenizer.ParseFloat(Position.X) || !Tokenizer.ParseFloat(Position.Y) || !Tokenizer.ParseFloat(Position.Z))
 			{
-				UE_LOG_ERROR("오브젝트 이름 형식이 잘못되었습니다");
+				OutChunk->Error = "정점 위치 형식이 잘못되었습니다";
 				return false;
 			}
-			OptObjectInfo.emplace();
-			OptObjectInfo->Name = std::move(ObjectName);
-
-			FaceCount = 0;
+			OutChunk->VertexList.Emplace(Config.bPositionToUEBasis ? PositionToUEBasis(Position) : Position);
 		}
-
-		/** Group Information */
-		else if (Prefix == "g")
+		/** Vertex Normal */
+		else if (Prefix == "vn")
 		{
-			if (!OptObjectInfo)
+			FVector Normal;
+			if (!Tokenizer.ParseFloat(Normal.X) || !Tokenizer.ParseFloat(Normal.Y) || !Tokenizer.ParseFloat(Normal.Z))
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				OutChunk->Error = "정점 법선 형식이 잘못되었습니다";
+				return false;
 			}
-
-			FString GroupName;
-			if (!(Tokenizer >> GroupName))
+			OutChunk->NormalList.Emplace(Config.bNormalToUEBasis ? NormalToUEBasis(Normal) : Normal);
+		}
+		/** Texture Coordinate */
+		else if (Prefix == "vt")
+		{
+			/** @note: Ignore 3D Texture */
+			FVector2 TexCoord;
+			if (!Tokenizer.ParseFloat(TexCoord.X) || !Tokenizer.ParseFloat(TexCoord.Y))
 			{
-				UE_LOG_ERROR("잘못된 그룹 이름 형식입니다");
+				OutChunk->Error = "정점 텍스쳐 좌표 형식이 잘못되었습니다";
 				return false;
 			}
-
-			OptObjectInfo->GroupNameList.Emplace(std::move(GroupName));
-			OptObjectInfo->GroupIndexList.Emplace(FaceCount);
+			OutChunk->TexCoordList.Emplace(Config.bUVToUEBasis ? UVToUEBasis(TexCoord) : TexCoord);
 		}
 
 		// ============================ Face Information ============================ //
 
-		/** Face Information */
 		else if (Prefix == "f")
 		{
-			if (!OptObjectInfo)
+			int32 CornerCount = 0;
+			for (std::string_view Corner = Tokenizer.NextToken(); !Corner.empty(); Corner = Tokenizer.NextToken())
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				if (CornerCount == static_cast<int32>(std::size(FaceCorners)))
+				{
+					OutChunk->Error = "면의 꼭짓점 수가 너무 많습니다";
+					return false;
+				}
+				FaceCorners[CornerCount++] = Corner;
 			}
 
-			TArray<FString> FaceBuffers;
-			FString FaceBuffer;
-			while (Tokenizer >> FaceBuffer)
+			if (CornerCount < 2)
 			{
-				FaceBuffers.Emplace(FaceBuffer);
+				OutChunk->Error = "면 형식이 잘못되었습니다";
+				return false;
 			}
 
-			if (FaceBuffers.Num() < 2)
+			// 오브젝트가 없을 때 기본 오브젝트를 만들도록 병합 단계에 알린다
+			if (OutChunk->Directives.IsEmpty() || OutChunk->Directives.Last().Type != EDirective::Face)
 			{
-				UE_LOG_ERROR("면 형식이 잘못되었습니다");
-				return false;
+				OutChunk->AddDirective(EDirective::Face, std::string_view());
 			}
 
 			/** @todo: 오목 다각형에 대한 지원 필요, 현재는 볼록 다각형만 지원 */
-			for (int32 i = 1; i + 1 < FaceBuffers.Num(); ++i)
+			for (int32 i = 1; i + 1 < CornerCount; ++i)
 			{
-				if (Config.bFlipWindingOrder)
+				const std::string_view& Second = Config.bFlipWindingOrder ? FaceCorners[i + 1] : FaceCorners[i];
+				const std::string_view& Third = Config.bFlipWindingOrder ? FaceCorners[i] : FaceCorners[i + 1];
+				for (const std::string_view& Corner : { FaceCorners[0], Second, Third })
 				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
+					if (const char* Error = ParseFaceCorner(Corner, OutChunk))
 					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-				}
-				else
-				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
-						return false;
-					}
-
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
-					{
-						UE_LOG_ERROR("면 파싱에 실패했습니다");
+						OutChunk->Error = Error;
 						return false;
 					}
 				}
-				++FaceCount;
+				++OutChunk->FaceCount;
 			}
 		}
 
-		// ============================ Material Information ============================ //
+		// =========================== Group Information ============================ //
 
-		else if (Prefix == "mtllib")
+		/** Object Information */
+		else if (Prefix == "o")
 		{
-			/** @todo: Parse material data */
-			/** @todo: Support relative path from .obj file to find .mtl file */
-			FString MaterialFileName;
-			Tokenizer >> MaterialFileName;
-
-			std::filesystem::path MaterialFilePath = FilePath.parent_path() / MaterialFileName;
-
-			MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+			if (!Config.bIsObjectEnabled)
+			{
+				continue; // Ignore 'o' prefix
+			}
 
-			if (!LoadMaterial(MaterialFilePath, OutObjInfo))
+			const std::string_view ObjectName = Tokenizer.NextToken();
+			if (ObjectName.empty())
 			{
-				UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %ls", MaterialFilePath.c_str());
+				OutChunk->Error = "오브젝트 이름 형식이 잘못되었습니다";
 				return false;
 			}
+			OutChunk->AddDirective(EDirective::Object, ObjectName);
 		}
-
-		else if (Prefix == "usemtl")
+		/** Group Information */
+		else if (Prefix == "g")
 		{
-			FString MaterialName;
-			Tokenizer >> MaterialName;
-
-			if (!OptObjectInfo)
+			const std::string_view GroupName = Tokenizer.NextToken();
+			if (GroupName.empty())
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				OutChunk->Error = "잘못된 그룹 이름 형식입니다";
+				return false;
 			}
-
-			OptObjectInfo->MaterialNameList.Emplace(std::move(MaterialName));
-			OptObjectInfo->MaterialIndexList.Emplace(FaceCount);
+			OutChunk->AddDirective(EDirective::Group, GroupName);
 		}
-	}
 
-	if (OptObjectInfo)
-	{
-		OutObjInfo->ObjectInfoList.Emplace(std::move(*OptObjectInfo));
-	}
+		// ============================ Material Information ============================ //
 
-	// objbin 저장 (캐싱)
-	if (Config.bIsBinaryEnabled)
-	{
-		// Cooked 폴더가 이미 PathManager에 의해 생성되어 있음
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
-		UE_LOG_SUCCESS("ObjCache: Saved objbin '%ls'", BinFilePath.c_str());
+		else if (Prefix == "mtllib")
+		{
+			OutChunk->AddDirective(EDirective::MaterialLibrary, Tokenizer.NextToken());
+		}
+		else if (Prefix == "usemtl")
+		{
+			OutChunk->AddDirective(EDirective::Material, Tokenizer.NextToken());
+		}
 	}
 
 	return true;
@@ -318,8 +666,8 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 		return false;
 	}
 
-	std::ifstream File(FilePath);
-	if (!File)
+	FMappedFile File;
+	if (!OpenTextFile(FilePath, File))
 	{
 		UE_LOG_ERROR("파일을 열지 못했습니다: %ls", FilePath.c_str());
 		return false;
@@ -327,13 +675,15 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 
 	TOptional<FObjectMaterialInfo> OptMaterialInfo;
 
-	FString Buffer;
-	while (std::getline(File, Buffer))
+	const char* FileEnd = reinterpret_cast<const char*>(File.GetData()) + File.GetSize();
+	const char* LineBegin = reinterpret_cast<const char*>(File.GetData());
+	while (LineBegin < FileEnd)
 	{
-		std::istringstream Tokenizer(Buffer);
-		FString Prefix;
+		const char* LineEnd = FindLineEnd(LineBegin, FileEnd);
+		FObjTokenizer Tokenizer{ LineBegin, LineEnd };
+		LineBegin = LineEnd + 1;
 
-		Tokenizer >> Prefix;
+		const std::string_view Prefix = Tokenizer.NextToken();
 
 		if (Prefix == "newmtl")
 		{
@@ -343,7 +693,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 			}
 
 			OptMaterialInfo.emplace();
-			if (!(Tokenizer >> OptMaterialInfo->Name))
+			if (!Tokenizer.NextToken(OptMaterialInfo->Name))
 			{
 				UE_LOG_ERROR("머티리얼 이름 형식이 잘못되었습니다");
 				return false;
@@ -357,7 +707,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Ns))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->Ns))
 			{
 				UE_LOG_ERROR("Ns(광택) 속성 형식이 잘못되었습니다");
 				return false;
@@ -371,7 +721,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Ka.X >> OptMaterialInfo->Ka.Y >> OptMaterialInfo->Ka.Z))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->Ka.X) || !Tokenizer.ParseFloat(OptMaterialInfo->Ka.Y) || !Tokenizer.ParseFloat(OptMaterialInfo->Ka.Z))
 			{
 				UE_LOG_ERROR("Ka(주변) 속성 형식이 잘못되었습니다");
 				return false;
@@ -385,7 +735,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Kd.X >> OptMaterialInfo->Kd.Y >> OptMaterialInfo->Kd.Z))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->Kd.X) || !Tokenizer.ParseFloat(OptMaterialInfo->Kd.Y) || !Tokenizer.ParseFloat(OptMaterialInfo->Kd.Z))
 			{
 				UE_LOG_ERROR("Kd(분산) 속성 형식이 잘못되었습니다");
 				return false;
@@ -399,7 +749,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Ks.X >> OptMaterialInfo->Ks.Y >> OptMaterialInfo->Ks.Z))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->Ks.X) || !Tokenizer.ParseFloat(OptMaterialInfo->Ks.Y) || !Tokenizer.ParseFloat(OptMaterialInfo->Ks.Z))
 			{
 				UE_LOG_ERROR("Ks(반사) 속성 형식이 잘못되었습니다");
 				return false;
@@ -417,7 +767,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Ni))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->Ni))
 			{
 				UE_LOG_ERROR("Ni(굴절률) 속성 형식이 잘못되었습니다");
 				return false;
@@ -431,7 +781,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->D))
+			if (!Tokenizer.ParseFloat(OptMaterialInfo->D))
 			{
 				UE_LOG_ERROR("d(투명도) 속성 형식이 잘못되었습니다");
 				return false;
@@ -445,7 +795,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 			float Tr;
-			if (!(Tokenizer >> Tr))
+			if (!Tokenizer.ParseFloat(Tr))
 			{
 				UE_LOG_ERROR("Tr(투명도) 속성 형식이 잘못되었습니다");
 				return false;
@@ -464,7 +814,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->Illumination))
+			if (!Tokenizer.ParseInt(OptMaterialInfo->Illumination))
 			{
 				UE_LOG_ERROR("illum(조명 모델) 속성 형식이 잘못되었습니다");
 				return false;
@@ -478,7 +828,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->KaMap))
+			if (!Tokenizer.NextToken(OptMaterialInfo->KaMap))
 			{
 				UE_LOG_ERROR("map_Ka(주변 텍스처) 속성 형식이 잘못되었습니다");
 				return false;
@@ -492,7 +842,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->KdMap))
+			if (!Tokenizer.NextToken(OptMaterialInfo->KdMap))
 			{
 				UE_LOG_ERROR("map_Kd(분산 텍스처) 속성 형식이 잘못되었습니다");
 				return false;
@@ -506,7 +856,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->KsMap))
+			if (!Tokenizer.NextToken(OptMaterialInfo->KsMap))
 			{
 				UE_LOG_ERROR("map_Ks(반사 텍스처) 속성 형식이 잘못되었습니다");
 				return false;
@@ -520,7 +870,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->NsMap))
+			if (!Tokenizer.NextToken(OptMaterialInfo->NsMap))
 			{
 				UE_LOG_ERROR("map_Ns(광택 텍스처) 속성 형식이 잘못되었습니다");
 				return false;
@@ -534,7 +884,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			if (!(Tokenizer >> OptMaterialInfo->DMap))
+			if (!Tokenizer.NextToken(OptMaterialInfo->DMap))
 			{
 				UE_LOG_ERROR("map_d(투명도 텍스처) 속성 형식이 잘못되었습니다");
 				return false;
@@ -548,25 +898,22 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 				return false;
 			}
 
-			FString Token;
 			FString BumpPath;
 			float BumpScaleValue = 1.0f;
 
-			while (Tokenizer >> Token)
+			for (std::string_view Token = Tokenizer.NextToken(); !Token.empty(); Token = Tokenizer.NextToken())
 			{
 				if (Token == "-bm")
 				{
-					FString ScaleString;
-					if (!(Tokenizer >> ScaleString))
+					const std::string_view ScaleString = Tokenizer.NextToken();
+					if (ScaleString.empty())
 					{
 						UE_LOG_ERROR("map_Bump -bm 옵션 값이 없습니다");
 						return false;
 					}
-					try
-					{
-						BumpScaleValue = std::stof(ScaleString);
-					}
-					catch ([[maybe_unused]] const std::invalid_argument& Exception)
+
+					FObjTokenizer ScaleTokenizer{ ScaleString.data(), ScaleString.data() + ScaleString.size() };
+					if (!ScaleTokenizer.ParseFloat(BumpScaleValue))
 					{
 						UE_LOG_ERROR("map_Bump -bm 옵션 값 형식이 잘못되었습니다");
 						return false;
@@ -574,13 +921,13 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 					continue;
 				}
 
-				if (!Token.empty() && Token[0] == '-')
+				if (Token[0] == '-')
 				{
 					// 다른 옵션들은 현재 무시
 					continue;
 				}
 
-				BumpPath = Token;
+				BumpPath = std::string(Token);
 				break;
 			}
 
@@ -633,109 +980,3 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 
 	return true;
 }
-
-bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo)
-{
-	/** Ignore data when ObjInfo is nullptr */
-	if (!OutObjectInfo)
-	{
-		return false;
-	}
-
-	TArray<FString> IndexBuffers;
-	std::istringstream Tokenizer(FaceBuffer);
-	FString IndexBuffer;
-	while (std::getline(Tokenizer, IndexBuffer, '/'))
-	{
-		IndexBuffers.Emplace(IndexBuffer);
-	}
-
-	if (IndexBuffers.IsEmpty())
-	{
-		UE_LOG_ERROR("면 형식이 잘못되었습니다");
-		return false;
-	}
-
-	if (IndexBuffers[0].empty())
-	{
-		UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
-		return false;
-	}
-
-	try
-	{
-		OutObjectInfo->VertexIndexList.Add(std::stoull(IndexBuffers[0]) - 1);
-	}
-	catch ([[maybe_unused]] const std::invalid_argument& Exception)
-	{
-		UE_LOG_ERROR("정점 위치 인덱스 형식이 잘못되었습니다");
-		return false;
-	}
-
-	switch (IndexBuffers.Num())
-	{
-	case 1:
-		/** @brief: Only position data (e.g., 'f 1 2 3') */
-		break;
-	case 2:
-		/** @brief: Position and texture coordinate data (e.g., 'f 1/1 2/1') */
-		if (IndexBuffers[1].empty())
-		{
-			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
-			return false;
-		}
-
-		try
-		{
-			OutObjectInfo->TexCoordIndexList.Add(std::stoull(IndexBuffers[1]) - 1);
-		}
-		catch ([[maybe_unused]] const std::invalid_argument& Exception)
-		{
-			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
-			return false;
-		}
-		break;
-	case 3:
-		/** @brief: Position, texture coordinate and vertex normal data (e.g., 'f 1/1/1 2/2/1' or 'f 1//1 2//1') */
-		if (IndexBuffers[1].empty()) /** Position and vertex normal */
-		{
-			if (IndexBuffers[2].empty())
-			{
-				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-
-			try
-			{
-				OutObjectInfo->NormalIndexList.Add(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
-			{
-				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-		}
-		else /** Position, texture coordinate, and vertex normal */
-		{
-			if (IndexBuffers[1].empty() || IndexBuffers[2].empty())
-			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-
-			try
-			{
-				OutObjectInfo->TexCoordIndexList.Add(std::stoull(IndexBuffers[1]) - 1);
-				OutObjectInfo->NormalIndexList.Add(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
-			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
-		}
-		break;
-	}
-
-	return true;
-}
@@ -4,6 +4,10 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/StaticMeshCooker.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 #include <filesystem>
@@ -125,7 +129,6 @@ struct VertexKeyHash
 	}
 };
 
-/** @todo: std::filesystem으로 변경 */
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
 	auto* FoundValuePtr = ObjFStaticMeshMap.Find(PathFileName);
@@ -135,6 +138,56 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return FoundValuePtr->get();
 	}
 
+	std::unique_ptr<FStaticMesh> StaticMesh = CookObjStaticMeshAsset(PathFileName, Config);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	ObjFStaticMeshMap.Emplace(PathFileName, std::move(StaticMesh));
+	return ObjFStaticMeshMap[PathFileName].get();
+}
+
+std::unique_ptr<FStaticMesh> FObjManager::CookObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
+{
+	// 쿠킹된 메시가 있으면 정점 병합, 탄젠트 계산, BVH 빌드를 모두 건너뛴다
+	const uint32 CookImportFlags = GetCookImportFlags(Config);
+	if (Config.bIsBinaryEnabled)
+	{
+		auto CookedStaticMesh = std::make_unique<FStaticMesh>();
+		if (FStaticMeshCooker::Load(PathFileName, CookImportFlags, CookedStaticMesh.get()))
+		{
+			return CookedStaticMesh;
+		}
+	}
+
+	std::unique_ptr<FStaticMesh> StaticMesh = BuildObjStaticMeshAsset(PathFileName, Config);
+	if (StaticMesh && Config.bIsBinaryEnabled)
+	{
+		// .mtl이 바뀌어도 다시 쿠킹하도록 참조하는 재질 라이브러리를 의존 파일로 기록
+		TArray<std::filesystem::path> MaterialLibraryPaths;
+		FObjImporter::FindMaterialLibraries(PathFileName.ToString(), MaterialLibraryPaths);
+		FStaticMeshCooker::Save(*StaticMesh, CookImportFlags, MaterialLibraryPaths);
+	}
+	return StaticMesh;
+}
+
+uint32 FObjManager::GetCookImportFlags(const FObjImporter::Configuration& Config)
+{
+	return (Config.bIsObjectEnabled ? 1u << 0 : 0u)
+		| (Config.bFlipWindingOrder ? 1u << 1 : 0u)
+		| (Config.bPositionToUEBasis ? 1u << 2 : 0u)
+		| (Config.bNormalToUEBasis ? 1u << 3 : 0u)
+		| (Config.bUVToUEBasis ? 1u << 4 : 0u)
+		| (Config.bOptimizeMesh ? 1u << 5 : 0u)
+		| (Config.bGenerateLODs ? 1u << 6 : 0u)
+		| (Config.bCompressVertices ? 1u << 7 : 0u)
+		| (Config.bGenerateOccluder ? 1u << 8 : 0u);
+}
+
+/** @todo: std::filesystem으로 변경 */
+std::unique_ptr<FStaticMesh> FObjManager::BuildObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
+{
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
 	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
@@ -290,10 +343,28 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	//StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
-	ObjFStaticMeshMap.Emplace(PathFileName, std::move(StaticMesh));
+	// 삼각형 순서가 바뀌므로 BVH보다 먼저 최적화
+	if (Config.bOptimizeMesh)
+	{
+		FMeshOptimizer::OptimizeStaticMesh(*StaticMesh);
+	}
+	if (Config.bGenerateLODs)
+	{
+		FMeshSimplifier::BuildLODs(*StaticMesh);
+	}
+	// 쿠킹 파일에서 읽은 정점과 같아지도록 BVH보다 먼저 양자화
+	if (Config.bCompressVertices)
+	{
+		FVertexQuantizer::QuantizeStaticMesh(*StaticMesh);
+	}
+	if (Config.bGenerateOccluder)
+	{
+		FMeshSimplifier::BuildOccluder(*StaticMesh);
+	}
 
-	return ObjFStaticMeshMap[PathFileName].get();
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축 (Binned SAH)
+
+	return StaticMesh;
 }
 
 /**
@@ -447,6 +518,22 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FOb
 	return nullptr;
 }
 
+UStaticMesh* FObjManager::CreateObjStaticMesh(const FName& PathFileName, std::unique_ptr<FStaticMesh> StaticMeshAsset)
+{
+	// 그 사이 같은 경로가 동기 로드되었다면 먼저 만들어진 에셋을 그대로 사용
+	if (!ObjFStaticMeshMap.Find(PathFileName))
+	{
+		if (!StaticMeshAsset)
+		{
+			return nullptr;
+		}
+		ObjFStaticMeshMap.Emplace(PathFileName, std::move(StaticMeshAsset));
+	}
+
+	// 에셋이 캐시에 있으므로 임포트 없이 UStaticMesh와 머티리얼만 만든다
+	return LoadObjStaticMesh(PathFileName);
+}
+
 void FObjManager::Release()
 {
 	// Clean up the cached default material to prevent memory leak
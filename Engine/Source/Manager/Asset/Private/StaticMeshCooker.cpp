@@ -0,0 +1,518 @@
+#include "pch.h"
+
+#include "Core/Public/Archive.h"
+#include "Core/Public/MappedFile.h"
+#include "Manager/Asset/Public/StaticMeshCooker.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+#include "Manager/Path/Public/PathManager.h"
+#include "Texture/Public/Material.h"
+
+namespace
+{
+	// 쿠킹 버퍼에 이어 쓰는 아카이브
+	struct FCookedMemoryWriter : public FArchive
+	{
+		explicit FCookedMemoryWriter(TArray<uint8>& InBytes) : Bytes(InBytes) {}
+
+		bool IsLoading() const override { return false; }
+
+		void Serialize(void* V, size_t Length) override
+		{
+			const size_t Offset = Bytes.Num();
+			Bytes.SetNum(static_cast<int32>(Offset + Length));
+			memcpy(Bytes.GetData() + Offset, V, Length);
+		}
+
+		TArray<uint8>& Bytes;
+	};
+
+	// 매핑된 메모리 구간을 읽는 아카이브. 범위를 넘으면 0으로 채우고 bOverflow를 남긴다
+	struct FCookedMemoryReader : public FArchive
+	{
+		FCookedMemoryReader(const uint8* InData, size_t InSize) : Data(InData), Size(InSize) {}
+
+		bool IsLoading() const override { return true; }
+
+		void Serialize(void* V, size_t Length) override
+		{
+			if (bOverflow || Length > Size - Position)
+			{
+				bOverflow = true;
+				memset(V, 0, Length);
+				return;
+			}
+			memcpy(V, Data + Position, Length);
+			Position += Length;
+		}
+
+		const uint8* Data;
+		size_t Size;
+		size_t Position = 0;
+		bool bOverflow = false;
+	};
+
+	void SerializeMaterial(FArchive& Ar, FMaterial& Material)
+	{
+		Ar << Material.Name;
+		Ar << Material.Ka << Material.Kd << Material.Ks << Material.Ke;
+		Ar << Material.Ns << Material.Ni << Material.D << Material.Illumination;
+		Ar << Material.KaMap << Material.KdMap << Material.KsMap << Material.NsMap;
+		Ar << Material.DMap << Material.BumpMap << Material.NormalMap;
+	}
+
+	int64 GetSourceWriteTime(const std::filesystem::path& InSourcePath)
+	{
+		std::error_code ErrorCode;
+		const auto WriteTime = std::filesystem::last_write_time(InSourcePath, ErrorCode);
+		return ErrorCode ? 0 : static_cast<int64>(WriteTime.time_since_epoch().count());
+	}
+
+	FCookedStaticMeshSection& GetSection(FCookedStaticMeshHeader& Header, ECookedStaticMeshSection Section)
+	{
+		return Header.Sections[static_cast<uint32>(Section)];
+	}
+
+	// 버퍼 끝을 정렬한 뒤 섹션 데이터를 이어 붙인다
+	void AppendSection(TArray<uint8>& Bytes, FCookedStaticMeshSection& OutSection, const void* InData, uint32 InCount, uint32 InStride)
+	{
+		const uint64 Offset = (Bytes.Num() + COOKED_STATIC_MESH_ALIGNMENT - 1) & ~(COOKED_STATIC_MESH_ALIGNMENT - 1);
+		const uint64 Size = static_cast<uint64>(InCount) * InStride;
+		Bytes.SetNum(static_cast<int32>(Offset + Size));
+		if (Size > 0)
+		{
+			memcpy(Bytes.GetData() + Offset, InData, Size);
+		}
+
+		OutSection.Offset = Offset;
+		OutSection.Size = Size;
+		OutSection.Count = InCount;
+		OutSection.Stride = InStride;
+	}
+
+	// 의존 파일마다 경로와 쿠킹 당시의 수정 시각을 기록
+	void AppendDependencies(TArray<uint8>& Bytes, FCookedStaticMeshSection& OutSection, const TArray<std::filesystem::path>& InDependencyPaths)
+	{
+		TArray<uint8> DependencyBytes;
+		FCookedMemoryWriter DependencyWriter(DependencyBytes);
+		for (const std::filesystem::path& DependencyPath : InDependencyPaths)
+		{
+			FString PathString = DependencyPath.generic_string();
+			int64 WriteTime = GetSourceWriteTime(DependencyPath);
+			DependencyWriter << PathString << WriteTime;
+		}
+		AppendSection(Bytes, OutSection, DependencyBytes.GetData(), DependencyBytes.Num(), 1);
+		OutSection.Count = InDependencyPaths.Num();
+		OutSection.Stride = 0;
+	}
+
+	// 기록된 의존 파일이 모두 쿠킹 당시와 같은 수정 시각인지 검사 (섹션은 IsValidSection으로 검증된 상태)
+	bool AreDependenciesUpToDate(const uint8* FileData, const FCookedStaticMeshSection& Section)
+	{
+		FCookedMemoryReader DependencyReader(FileData + Section.Offset, Section.Size);
+		for (uint32 i = 0; i < Section.Count; ++i)
+		{
+			FString PathString;
+			int64 WriteTime = 0;
+			DependencyReader << PathString << WriteTime;
+			if (DependencyReader.bOverflow || WriteTime != GetSourceWriteTime(std::filesystem::path(PathString)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// 섹션이 파일 안에 있고 정렬·요소 크기가 맞는지 검사
+	bool IsValidSection(const FCookedStaticMeshSection& Section, uint64 FileSize, uint32 ExpectedStride)
+	{
+		if (Section.Offset % COOKED_STATIC_MESH_ALIGNMENT != 0 || Section.Offset > FileSize || Section.Size > FileSize - Section.Offset)
+		{
+			return false;
+		}
+		return Section.Stride == ExpectedStride && (ExpectedStride == 0 || static_cast<uint64>(Section.Count) * ExpectedStride == Section.Size);
+	}
+}
+
+std::filesystem::path FStaticMeshCooker::GetCookedFilePath(const FName& InSourcePath)
+{
+	const std::filesystem::path SourcePath(InSourcePath.ToString());
+
+	// FNV-1a (실행마다 같은 값이 나와야 하므로 std::hash 대신 사용)
+	uint32 PathHash = 2166136261u;
+	for (const char Character : SourcePath.generic_string())
+	{
+		PathHash = (PathHash ^ static_cast<uint8>(Character)) * 16777619u;
+	}
+
+	char HashString[16];
+	snprintf(HashString, sizeof(HashString), ".%08x", PathHash);
+
+	std::filesystem::path FileName = SourcePath.filename();
+	FileName += HashString;
+	FileName += ".smcooked";
+	return UPathManager::GetInstance().GetCookedPath() / FileName;
+}
+
+bool FStaticMeshCooker::Save(const FStaticMesh& InStaticMesh, uint32 InImportFlags, const TArray<std::filesystem::path>& InDependencyPaths)
+{
+	const std::filesystem::path SourcePath(InStaticMesh.PathFileName.ToString());
+	const std::filesystem::path CookedFilePath = GetCookedFilePath(InStaticMesh.PathFileName);
+
+	FCookedStaticMeshHeader Header;
+	Header.ImportFlags = InImportFlags;
+	Header.SourceWriteTime = GetSourceWriteTime(SourcePath);
+
+	FVector BoundsMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FNormalVertex& Vertex : InStaticMesh.Vertices)
+	{
+		BoundsMin.X = std::min(BoundsMin.X, Vertex.Position.X);
+		BoundsMin.Y = std::min(BoundsMin.Y, Vertex.Position.Y);
+		BoundsMin.Z = std::min(BoundsMin.Z, Vertex.Position.Z);
+		BoundsMax.X = std::max(BoundsMax.X, Vertex.Position.X);
+		BoundsMax.Y = std::max(BoundsMax.Y, Vertex.Position.Y);
+		BoundsMax.Z = std::max(BoundsMax.Z, Vertex.Position.Z);
+	}
+	Header.BoundsMin = InStaticMesh.Vertices.IsEmpty() ? FVector(0.0f, 0.0f, 0.0f) : BoundsMin;
+	Header.BoundsMax = InStaticMesh.Vertices.IsEmpty() ? FVector(0.0f, 0.0f, 0.0f) : BoundsMax;
+
+	// 헤더 자리를 비워 두고 섹션을 이어 붙인 뒤 마지막에 헤더를 채운다
+	TArray<uint8> Bytes;
+	Bytes.SetNum(sizeof(FCookedStaticMeshHeader));
+
+	// 정점: 양자화한 메시는 압축 형태로만 저장 (Vertices가 이미 압축했다 푼 값이므로 다시 인코딩해도 같은 값이 나온다)
+	TArray<FCompressedVertex> CompressedVertices;
+	TArray<uint32> VertexColors;
+	if (InStaticMesh.bQuantizedVertices)
+	{
+		Header.VertexQuantization = InStaticMesh.VertexQuantization;
+		FVertexQuantizer::Encode(InStaticMesh.Vertices, InStaticMesh.VertexQuantization, CompressedVertices, VertexColors);
+	}
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::Vertices),
+		InStaticMesh.Vertices.GetData(), InStaticMesh.bQuantizedVertices ? 0 : InStaticMesh.Vertices.Num(), sizeof(FNormalVertex));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::Indices),
+		InStaticMesh.Indices.GetData(), InStaticMesh.Indices.Num(), sizeof(uint32));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::MeshSections),
+		InStaticMesh.Sections.GetData(), InStaticMesh.Sections.Num(), sizeof(FMeshSection));
+
+	const TArray<FFlatBVHNode>& BVHNodes = InStaticMesh.BVH.GetFlatNodes();
+	const TArray<int32>& BVHTriangleIndices = InStaticMesh.BVH.GetTriangleIndices();
+	const bool bHasFlatBVH = InStaticMesh.BVH.IsFlattened();
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::BVHNodes),
+		BVHNodes.GetData(), bHasFlatBVH ? BVHNodes.Num() : 0, sizeof(FFlatBVHNode));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::BVHTriangleIndices),
+		BVHTriangleIndices.GetData(), bHasFlatBVH ? BVHTriangleIndices.Num() : 0, sizeof(int32));
+
+	TArray<uint8> MaterialBytes;
+	FCookedMemoryWriter MaterialWriter(MaterialBytes);
+	for (const FMaterial& Material : InStaticMesh.MaterialInfo)
+	{
+		FMaterial MaterialCopy = Material;
+		SerializeMaterial(MaterialWriter, MaterialCopy);
+	}
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::Materials), MaterialBytes.GetData(), MaterialBytes.Num(), 1);
+	GetSection(Header, ECookedStaticMeshSection::Materials).Count = InStaticMesh.MaterialInfo.Num();
+	GetSection(Header, ECookedStaticMeshSection::Materials).Stride = 0;
+
+	TArray<FCookedStaticMeshLOD> CookedLODs;
+	TArray<FMeshSection> LODSections;
+	for (const FStaticMeshLOD& LOD : InStaticMesh.LODs)
+	{
+		FCookedStaticMeshLOD CookedLOD;
+		CookedLOD.StartIndex = LOD.StartIndex;
+		CookedLOD.IndexCount = LOD.IndexCount;
+		CookedLOD.ScreenSize = LOD.ScreenSize;
+		CookedLOD.Error = LOD.Error;
+		CookedLOD.FirstSection = LODSections.Num();
+		CookedLOD.SectionCount = LOD.Sections.Num();
+		CookedLODs.Add(CookedLOD);
+		LODSections.Append(LOD.Sections);
+	}
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::LODs),
+		CookedLODs.GetData(), CookedLODs.Num(), sizeof(FCookedStaticMeshLOD));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::LODSections),
+		LODSections.GetData(), LODSections.Num(), sizeof(FMeshSection));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::LODIndices),
+		InStaticMesh.LODIndices.GetData(), InStaticMesh.LODIndices.Num(), sizeof(uint32));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::CompressedVertices),
+		CompressedVertices.GetData(), CompressedVertices.Num(), sizeof(FCompressedVertex));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::VertexColors),
+		VertexColors.GetData(), VertexColors.Num(), sizeof(uint32));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::OccluderVertices),
+		InStaticMesh.OccluderVertices.GetData(), InStaticMesh.OccluderVertices.Num(), sizeof(FVector));
+	AppendSection(Bytes, GetSection(Header, ECookedStaticMeshSection::OccluderIndices),
+		InStaticMesh.OccluderIndices.GetData(), InStaticMesh.OccluderIndices.Num(), sizeof(uint32));
+	AppendDependencies(Bytes, GetSection(Header, ECookedStaticMeshSection::Dependencies), InDependencyPaths);
+
+	Header.FileSize = Bytes.Num();
+	memcpy(Bytes.GetData(), &Header, sizeof(Header));
+
+	// 저장 도중 종료되어도 깨진 파일이 남지 않도록 임시 파일에 쓴 뒤 교체
+	std::filesystem::path TempFilePath = CookedFilePath;
+	TempFilePath += ".tmp";
+	{
+		std::ofstream Stream(TempFilePath, std::ios::binary | std::ios::out | std::ios::trunc);
+		if (!Stream)
+		{
+			UE_LOG_ERROR("CookedMesh: 쓰기용 파일을 여는데 실패했습니다: %ls", TempFilePath.c_str());
+			return false;
+		}
+		Stream.write(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num());
+		if (!Stream)
+		{
+			UE_LOG_ERROR("CookedMesh: 파일 쓰기를 실패했습니다: %ls", TempFilePath.c_str());
+			return false;
+		}
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::rename(TempFilePath, CookedFilePath, ErrorCode);
+	if (ErrorCode)
+	{
+		std::filesystem::remove(TempFilePath, ErrorCode);
+		UE_LOG_ERROR("CookedMesh: 파일 교체를 실패했습니다: %ls", CookedFilePath.c_str());
+		return false;
+	}
+
+	UE_LOG_SUCCESS("CookedMesh: Saved '%ls' (%.1f KB)", CookedFilePath.c_str(), Bytes.Num() / 1024.0f);
+	return true;
+}
+
+bool FStaticMeshCooker::IsUpToDate(const FName& InSourcePath, uint32 InImportFlags)
+{
+	FMappedFile File;
+	if (!File.Open(GetCookedFilePath(InSourcePath)) || File.GetSize() < sizeof(FCookedStaticMeshHeader))
+	{
+		return false;
+	}
+
+	FCookedStaticMeshHeader Header;
+	memcpy(&Header, File.GetData(), sizeof(Header));
+	if (Header.Magic != COOKED_STATIC_MESH_MAGIC || Header.Version != COOKED_STATIC_MESH_VERSION
+		|| Header.HeaderSize != sizeof(FCookedStaticMeshHeader) || Header.FileSize != File.GetSize()
+		|| Header.ImportFlags != InImportFlags || Header.SourceWriteTime != GetSourceWriteTime(InSourcePath.ToString()))
+	{
+		return false;
+	}
+
+	const FCookedStaticMeshSection& DependencySection = GetSection(Header, ECookedStaticMeshSection::Dependencies);
+	return IsValidSection(DependencySection, Header.FileSize, 0) && AreDependenciesUpToDate(File.GetData(), DependencySection);
+}
+
+bool FStaticMeshCooker::Load(const FName& InSourcePath, uint32 InImportFlags, FStaticMesh* OutStaticMesh)
+{
+	if (!OutStaticMesh)
+	{
+		return false;
+	}
+
+	const std::filesystem::path CookedFilePath = GetCookedFilePath(InSourcePath);
+	FMappedFile File;
+	if (!File.Open(CookedFilePath) || File.GetSize() < sizeof(FCookedStaticMeshHeader))
+	{
+		return false;
+	}
+
+	// 1. 헤더 검증
+	FCookedStaticMeshHeader Header;
+	memcpy(&Header, File.GetData(), sizeof(Header));
+	if (Header.Magic != COOKED_STATIC_MESH_MAGIC || Header.Version != COOKED_STATIC_MESH_VERSION
+		|| Header.HeaderSize != sizeof(FCookedStaticMeshHeader) || Header.FileSize != File.GetSize())
+	{
+		UE_LOG_INFO("CookedMesh: 버전이 다르거나 손상된 파일입니다. 다시 쿠킹합니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+	if (Header.ImportFlags != InImportFlags || Header.SourceWriteTime != GetSourceWriteTime(InSourcePath.ToString()))
+	{
+		UE_LOG_INFO("CookedMesh: 원본이 바뀌어 다시 쿠킹합니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	const FCookedStaticMeshSection& VertexSection = GetSection(Header, ECookedStaticMeshSection::Vertices);
+	const FCookedStaticMeshSection& IndexSection = GetSection(Header, ECookedStaticMeshSection::Indices);
+	const FCookedStaticMeshSection& MeshSection = GetSection(Header, ECookedStaticMeshSection::MeshSections);
+	const FCookedStaticMeshSection& NodeSection = GetSection(Header, ECookedStaticMeshSection::BVHNodes);
+	const FCookedStaticMeshSection& TriangleSection = GetSection(Header, ECookedStaticMeshSection::BVHTriangleIndices);
+	const FCookedStaticMeshSection& MaterialSection = GetSection(Header, ECookedStaticMeshSection::Materials);
+	const FCookedStaticMeshSection& LODSection = GetSection(Header, ECookedStaticMeshSection::LODs);
+	const FCookedStaticMeshSection& LODMeshSection = GetSection(Header, ECookedStaticMeshSection::LODSections);
+	const FCookedStaticMeshSection& LODIndexSection = GetSection(Header, ECookedStaticMeshSection::LODIndices);
+	const FCookedStaticMeshSection& CompressedVertexSection = GetSection(Header, ECookedStaticMeshSection::CompressedVertices);
+	const FCookedStaticMeshSection& VertexColorSection = GetSection(Header, ECookedStaticMeshSection::VertexColors);
+	const FCookedStaticMeshSection& OccluderVertexSection = GetSection(Header, ECookedStaticMeshSection::OccluderVertices);
+	const FCookedStaticMeshSection& OccluderIndexSection = GetSection(Header, ECookedStaticMeshSection::OccluderIndices);
+	const FCookedStaticMeshSection& DependencySection = GetSection(Header, ECookedStaticMeshSection::Dependencies);
+
+	const uint64 FileSize = Header.FileSize;
+	if (!IsValidSection(VertexSection, FileSize, sizeof(FNormalVertex))
+		|| !IsValidSection(IndexSection, FileSize, sizeof(uint32))
+		|| !IsValidSection(MeshSection, FileSize, sizeof(FMeshSection))
+		|| !IsValidSection(NodeSection, FileSize, sizeof(FFlatBVHNode))
+		|| !IsValidSection(TriangleSection, FileSize, sizeof(int32))
+		|| !IsValidSection(MaterialSection, FileSize, 0)
+		|| !IsValidSection(LODSection, FileSize, sizeof(FCookedStaticMeshLOD))
+		|| !IsValidSection(LODMeshSection, FileSize, sizeof(FMeshSection))
+		|| !IsValidSection(LODIndexSection, FileSize, sizeof(uint32))
+		|| !IsValidSection(CompressedVertexSection, FileSize, sizeof(FCompressedVertex))
+		|| !IsValidSection(VertexColorSection, FileSize, sizeof(uint32))
+		|| !IsValidSection(OccluderVertexSection, FileSize, sizeof(FVector))
+		|| !IsValidSection(OccluderIndexSection, FileSize, sizeof(uint32))
+		|| !IsValidSection(DependencySection, FileSize, 0))
+	{
+		UE_LOG_ERROR("CookedMesh: 섹션 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	const uint8* FileData = File.GetData();
+	if (!AreDependenciesUpToDate(FileData, DependencySection))
+	{
+		UE_LOG_INFO("CookedMesh: 의존 파일이 바뀌어 다시 쿠킹합니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// 2. 정점: 압축 정점은 매핑된 구간에서 바로 디코딩, 아니면 그대로 복사
+	const bool bCompressedVertices = CompressedVertexSection.Count > 0;
+	const uint32 ExpectedColorCount = bCompressedVertices && Header.VertexQuantization.bHasVertexColors ? CompressedVertexSection.Count : 0;
+	if ((bCompressedVertices && VertexSection.Count > 0) || VertexColorSection.Count != ExpectedColorCount)
+	{
+		UE_LOG_ERROR("CookedMesh: 정점 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	OutStaticMesh->PathFileName = InSourcePath;
+	if (bCompressedVertices)
+	{
+		OutStaticMesh->Vertices.SetNum(CompressedVertexSection.Count);
+		FVertexQuantizer::Decode(reinterpret_cast<const FCompressedVertex*>(FileData + CompressedVertexSection.Offset),
+			reinterpret_cast<const uint32*>(FileData + VertexColorSection.Offset), CompressedVertexSection.Count,
+			Header.VertexQuantization, OutStaticMesh->Vertices.GetData());
+		OutStaticMesh->VertexQuantization = Header.VertexQuantization;
+		OutStaticMesh->bQuantizedVertices = true;
+	}
+	else
+	{
+		OutStaticMesh->Vertices.SetNum(VertexSection.Count);
+		memcpy(OutStaticMesh->Vertices.GetData(), FileData + VertexSection.Offset, VertexSection.Size);
+	}
+
+	// 인덱스/섹션: 매핑된 구간을 그대로 복사
+	OutStaticMesh->Indices.SetNum(IndexSection.Count);
+	memcpy(OutStaticMesh->Indices.GetData(), FileData + IndexSection.Offset, IndexSection.Size);
+	OutStaticMesh->Sections.SetNum(MeshSection.Count);
+	memcpy(OutStaticMesh->Sections.GetData(), FileData + MeshSection.Offset, MeshSection.Size);
+
+	// 렌더러와 BVH는 인덱스 범위를 검사하지 않는다
+	const uint32 VertexCount = static_cast<uint32>(OutStaticMesh->Vertices.Num());
+	uint32 MaxIndex = 0;
+	for (const uint32 Index : OutStaticMesh->Indices)
+	{
+		MaxIndex = std::max(MaxIndex, Index);
+	}
+	if (!OutStaticMesh->Indices.IsEmpty() && MaxIndex >= VertexCount)
+	{
+		UE_LOG_ERROR("CookedMesh: 인덱스가 정점 범위를 벗어났습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// LOD: 인덱스와 LOD 범위도 같은 이유로 검사 (섹션은 재질 슬롯 수를 안 뒤 한꺼번에 검사)
+	OutStaticMesh->LODIndices.SetNum(LODIndexSection.Count);
+	memcpy(OutStaticMesh->LODIndices.GetData(), FileData + LODIndexSection.Offset, LODIndexSection.Size);
+	for (const uint32 Index : OutStaticMesh->LODIndices)
+	{
+		MaxIndex = std::max(MaxIndex, Index);
+	}
+
+	const uint64 RenderIndexCount = static_cast<uint64>(IndexSection.Count) + LODIndexSection.Count;
+	const FCookedStaticMeshLOD* CookedLODs = reinterpret_cast<const FCookedStaticMeshLOD*>(FileData + LODSection.Offset);
+	const FMeshSection* LODSections = reinterpret_cast<const FMeshSection*>(FileData + LODMeshSection.Offset);
+	bool bValidLODs = OutStaticMesh->LODIndices.IsEmpty() || MaxIndex < VertexCount;
+	OutStaticMesh->LODs.SetNum(LODSection.Count);
+	for (uint32 i = 0; i < LODSection.Count && bValidLODs; ++i)
+	{
+		FCookedStaticMeshLOD CookedLOD;
+		memcpy(&CookedLOD, CookedLODs + i, sizeof(CookedLOD));
+		bValidLODs = static_cast<uint64>(CookedLOD.StartIndex) + CookedLOD.IndexCount <= RenderIndexCount
+			&& static_cast<uint64>(CookedLOD.FirstSection) + CookedLOD.SectionCount <= LODMeshSection.Count;
+		if (!bValidLODs)
+		{
+			break;
+		}
+
+		FStaticMeshLOD& LOD = OutStaticMesh->LODs[i];
+		LOD.StartIndex = CookedLOD.StartIndex;
+		LOD.IndexCount = CookedLOD.IndexCount;
+		LOD.ScreenSize = CookedLOD.ScreenSize;
+		LOD.Error = CookedLOD.Error;
+		LOD.Sections.SetNum(CookedLOD.SectionCount);
+		memcpy(LOD.Sections.GetData(), LODSections + CookedLOD.FirstSection, sizeof(FMeshSection) * CookedLOD.SectionCount);
+	}
+	if (!bValidLODs)
+	{
+		UE_LOG_ERROR("CookedMesh: LOD 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// 3. 재질 슬롯
+	FCookedMemoryReader MaterialReader(FileData + MaterialSection.Offset, MaterialSection.Size);
+	OutStaticMesh->MaterialInfo.SetNum(MaterialSection.Count);
+	for (FMaterial& Material : OutStaticMesh->MaterialInfo)
+	{
+		SerializeMaterial(MaterialReader, Material);
+	}
+	if (MaterialReader.bOverflow)
+	{
+		UE_LOG_ERROR("CookedMesh: 재질 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// 섹션: 렌더러가 인덱스 범위와 재질 슬롯을 그대로 쓰므로 LOD 섹션과 같이 범위를 검사 (재질을 찾지 못한 섹션은 UINT32_MAX)
+	auto IsValidMeshSection = [&](const FMeshSection& Section, uint64 InIndexCount)
+	{
+		return static_cast<uint64>(Section.StartIndex) + Section.IndexCount <= InIndexCount
+			&& (Section.MaterialSlot < MaterialSection.Count || Section.MaterialSlot == UINT32_MAX);
+	};
+	bool bValidSections = true;
+	for (const FMeshSection& Section : OutStaticMesh->Sections)
+	{
+		bValidSections = bValidSections && IsValidMeshSection(Section, IndexSection.Count);
+	}
+	for (const FStaticMeshLOD& LOD : OutStaticMesh->LODs)
+	{
+		for (const FMeshSection& Section : LOD.Sections)
+		{
+			bValidSections = bValidSections && IsValidMeshSection(Section, RenderIndexCount);
+		}
+	}
+	if (!bValidSections)
+	{
+		UE_LOG_ERROR("CookedMesh: 메시 섹션 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// 4. 오클루더: 오클루전 컬러도 인덱스 범위를 검사하지 않는다
+	OutStaticMesh->OccluderVertices.SetNum(OccluderVertexSection.Count);
+	memcpy(OutStaticMesh->OccluderVertices.GetData(), FileData + OccluderVertexSection.Offset, OccluderVertexSection.Size);
+	OutStaticMesh->OccluderIndices.SetNum(OccluderIndexSection.Count);
+	memcpy(OutStaticMesh->OccluderIndices.GetData(), FileData + OccluderIndexSection.Offset, OccluderIndexSection.Size);
+	bool bValidOccluder = OccluderIndexSection.Count % 3 == 0;
+	for (const uint32 Index : OutStaticMesh->OccluderIndices)
+	{
+		bValidOccluder = bValidOccluder && Index < OccluderVertexSection.Count;
+	}
+	if (!bValidOccluder)
+	{
+		UE_LOG_ERROR("CookedMesh: 오클루더 정보가 잘못되었습니다: '%ls'", CookedFilePath.c_str());
+		return false;
+	}
+
+	// 5. BVH: 평탄화 트리가 있으면 그대로 사용하고, 없거나 맞지 않으면 다시 빌드
+	const bool bLoadedBVH = NodeSection.Count > 0 && OutStaticMesh->BVH.BuildFromFlat(OutStaticMesh,
+		reinterpret_cast<const FFlatBVHNode*>(FileData + NodeSection.Offset), NodeSection.Count,
+		reinterpret_cast<const int32*>(FileData + TriangleSection.Offset), TriangleSection.Count);
+	if (!bLoadedBVH)
+	{
+		OutStaticMesh->BVH.Build(OutStaticMesh);
+	}
+
+	return true;
+}
@@ -8,6 +8,45 @@
 #include "Texture/Public/Texture.h"
 #include "Manager/Path/Public/PathManager.h"
 #include "Utility/Public/TextureConverter.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 PLACEHOLDER_TEXTURE_SIZE = 2;
+    constexpr uint32 PLACEHOLDER_TEXTURE_COLORS[2] = { 0xFFFF00FF, 0xFF202020 }; // 마젠타 / 진회색 (ABGR)
+
+    // WIC(DirectXTex)는 호출 스레드에 COM이 초기화되어 있어야 한다. 워커 스레드는 처음 사용할 때 한 번 초기화
+    void EnsureComInitializedForThread()
+    {
+        thread_local bool bIsComInitialized = false;
+        if (!bIsComInitialized && FTaskScheduler::GetCurrentThreadIndex() != 0)
+        {
+            CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+            bIsComInitialized = true;
+        }
+    }
+
+    bool ReadFileBytes(const path& InFilePath, TArray<uint8>& OutBytes)
+    {
+        std::ifstream File(InFilePath, std::ios::binary | std::ios::ate);
+        if (!File)
+        {
+            return false;
+        }
+
+        const std::streamsize FileSize = File.tellg();
+        if (FileSize <= 0)
+        {
+            return false;
+        }
+
+        OutBytes.SetNum(static_cast<int32>(FileSize));
+        File.seekg(0, std::ios::beg);
+        return static_cast<bool>(File.read(reinterpret_cast<char*>(OutBytes.GetData()), FileSize));
+    }
+}
 
 FTextureManager::FTextureManager() = default;
 
@@ -17,6 +56,7 @@ FTextureManager::~FTextureManager()
     {
         SafeDelete(TextureCache.second);
     }
+    SafeDelete(PlaceholderTexture);
     if (DefaultSampler)
     {
         SafeRelease(DefaultSampler);
@@ -24,6 +64,35 @@ FTextureManager::~FTextureManager()
 }
 
 UTexture* FTextureManager::LoadTexture(const FName& InFilePath, bool bSRGB)
+{
+    path AbsolutePath;
+    FName CacheKey = MakeCacheKey(InFilePath, &AbsolutePath);
+
+    // Check Cached
+    const auto* FoundValuePtr = TextureCaches.Find(CacheKey);
+    if (FoundValuePtr)
+    {
+        return *FoundValuePtr;
+    }
+
+    // Not Cached
+    ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string(), bSRGB);
+
+    UTexture* Texture = NewObject<UTexture>();
+    Texture->SetFilePath(CacheKey);
+    Texture->CreateRenderProxy(SRV, GetDefaultSampler());
+
+    UTexture** ExistingTexturePtr = TextureCaches.Find(CacheKey);
+    if (ExistingTexturePtr)
+    {
+        SafeDelete(*ExistingTexturePtr);
+    }
+
+    TextureCaches[CacheKey] = Texture;
+    return Texture;
+}
+
+FName FTextureManager::MakeCacheKey(const FName& InFilePath, path* OutAbsolutePath)
 {
     // Path 정규화
     path InputPath(InFilePath.ToString());  // 사용자의 원본 입력
@@ -51,38 +120,154 @@ UTexture* FTextureManager::LoadTexture(const FName& InFilePath, bool bSRGB)
         FString NormalizedPath = RelativeKeyPath.generic_string();
         RelativeKeyPath = NormalizedPath;
     }
-    FName CacheKey(RelativeKeyPath.string());
 
-    // Check Cached
-    const auto* FoundValuePtr = TextureCaches.Find(CacheKey);
-    if (FoundValuePtr)
+    if (OutAbsolutePath)
     {
-        return *FoundValuePtr;
+        *OutAbsolutePath = AbsolutePath;
     }
+    return FName(RelativeKeyPath.string());
+}
 
-    // Not Cached
-    ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string(), bSRGB);
+bool FTextureManager::ReadTextureFile(const path& InFilePath, bool bSRGB, FTextureFileData& OutData)
+{
+    FString FileExtension = InFilePath.extension().string();
+    transform(FileExtension.begin(), FileExtension.end(), FileExtension.begin(), ::tolower);
 
-    if (!DefaultSampler)
+#ifdef USE_DDS_CACHE
+    // DDS 캐시 변환은 CPU 압축이므로 워커 스레드에서 끝내 두고, 메인 스레드는 업로드만 한다
+    if (FileExtension != ".dds" && FTextureConverter::IsSupportedFormat(FileExtension))
     {
-        DefaultSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP);
-        UE_LOG("[TextureManager] Default Sampler Create");
+        EnsureComInitializedForThread();
+
+        std::string SourcePath = InFilePath.string();
+        std::string DDSCachePath = FTextureConverter::GetDDSCachePath(SourcePath);
+
+        bool bHasDDSCache = !FTextureConverter::ShouldRegenerateDDS(SourcePath, DDSCachePath);
+        if (!bHasDDSCache)
+        {
+            DXGI_FORMAT Format = FTextureConverter::GetRecommendedFormat(true, bSRGB);
+            bHasDDSCache = FTextureConverter::ConvertToDDS(SourcePath, DDSCachePath, Format);
+        }
+
+        if (bHasDDSCache && ReadFileBytes(UTF8ToWide(DDSCachePath), OutData.Bytes))
+        {
+            OutData.bIsDDS = true;
+            return true;
+        }
+        // 캐시 실패 시 원본 파일을 읽는다 (fallback)
     }
+#endif
 
-    UTexture* Texture = NewObject<UTexture>();
-    Texture->SetFilePath(CacheKey);
-    Texture->CreateRenderProxy(SRV, DefaultSampler);
+    OutData.bIsDDS = FileExtension == ".dds";
+    if (!ReadFileBytes(InFilePath, OutData.Bytes))
+    {
+        UE_LOG_ERROR("TextureManager: 텍스처 파일 읽기 실패 - %ls", InFilePath.c_str());
+        return false;
+    }
+    return true;
+}
 
-    UTexture** ExistingTexturePtr = TextureCaches.Find(CacheKey);
-    if (ExistingTexturePtr)
+UTexture* FTextureManager::CreateTextureFromMemory(const FName& InCacheKey, const FTextureFileData& InData)
+{
+    // 그 사이 같은 텍스처가 동기 로드되었다면 그대로 사용
+    if (UTexture* FoundTexture = FindTexture(InCacheKey))
     {
-        SafeDelete(*ExistingTexturePtr);
+        return FoundTexture;
     }
 
-    TextureCaches[CacheKey] = Texture;
+    URenderer& Renderer = URenderer::GetInstance();
+    ID3D11Device* Device = Renderer.GetDevice();
+    ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
+    if (!Device || !DeviceContext || InData.Bytes.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    // 밉맵 생성에 즉시 컨텍스트가 필요하므로 GPU 리소스 생성은 메인 스레드에서 수행
+    ComPtr<ID3D11ShaderResourceView> SRV;
+    HRESULT ResultHandle = InData.bIsDDS
+        ? DirectX::CreateDDSTextureFromMemory(Device, DeviceContext, InData.Bytes.GetData(), InData.Bytes.Num(), nullptr, SRV.GetAddressOf())
+        : DirectX::CreateWICTextureFromMemory(Device, DeviceContext, InData.Bytes.GetData(), InData.Bytes.Num(), nullptr, SRV.GetAddressOf());
+    if (FAILED(ResultHandle))
+    {
+        UE_LOG_ERROR("TextureManager: 텍스처 생성 실패 - %s (HRESULT: 0x%08lX)", InCacheKey.ToString().c_str(), ResultHandle);
+        return nullptr;
+    }
+
+    UTexture* Texture = NewObject<UTexture>();
+    Texture->SetFilePath(InCacheKey);
+    Texture->CreateRenderProxy(SRV, GetDefaultSampler());
+
+    TextureCaches[InCacheKey] = Texture;
     return Texture;
 }
 
+UTexture* FTextureManager::FindTexture(const FName& InCacheKey) const
+{
+    return TextureCaches.FindRef(InCacheKey);
+}
+
+UTexture* FTextureManager::GetPlaceholderTexture()
+{
+    if (PlaceholderTexture)
+    {
+        return PlaceholderTexture;
+    }
+
+    ID3D11Device* Device = URenderer::GetInstance().GetDevice();
+    if (!Device)
+    {
+        return nullptr;
+    }
+
+    uint32 Pixels[PLACEHOLDER_TEXTURE_SIZE * PLACEHOLDER_TEXTURE_SIZE];
+    for (uint32 Y = 0; Y < PLACEHOLDER_TEXTURE_SIZE; ++Y)
+    {
+        for (uint32 X = 0; X < PLACEHOLDER_TEXTURE_SIZE; ++X)
+        {
+            Pixels[Y * PLACEHOLDER_TEXTURE_SIZE + X] = PLACEHOLDER_TEXTURE_COLORS[(X + Y) & 1];
+        }
+    }
+
+    D3D11_TEXTURE2D_DESC TextureDesc = {};
+    TextureDesc.Width = PLACEHOLDER_TEXTURE_SIZE;
+    TextureDesc.Height = PLACEHOLDER_TEXTURE_SIZE;
+    TextureDesc.MipLevels = 1;
+    TextureDesc.ArraySize = 1;
+    TextureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    TextureDesc.SampleDesc.Count = 1;
+    TextureDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    TextureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    D3D11_SUBRESOURCE_DATA InitData = {};
+    InitData.pSysMem = Pixels;
+    InitData.SysMemPitch = PLACEHOLDER_TEXTURE_SIZE * sizeof(uint32);
+
+    ComPtr<ID3D11Texture2D> Texture2D;
+    ComPtr<ID3D11ShaderResourceView> SRV;
+    if (FAILED(Device->CreateTexture2D(&TextureDesc, &InitData, Texture2D.GetAddressOf())) ||
+        FAILED(Device->CreateShaderResourceView(Texture2D.Get(), nullptr, SRV.GetAddressOf())))
+    {
+        UE_LOG_ERROR("TextureManager: Placeholder 텍스처 생성 실패");
+        return nullptr;
+    }
+
+    PlaceholderTexture = NewObject<UTexture>();
+    PlaceholderTexture->SetFilePath(FName("Placeholder"));
+    PlaceholderTexture->CreateRenderProxy(SRV, GetDefaultSampler());
+    return PlaceholderTexture;
+}
+
+ID3D11SamplerState* FTextureManager::GetDefaultSampler()
+{
+    if (!DefaultSampler)
+    {
+        DefaultSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP);
+        UE_LOG("[TextureManager] Default Sampler Create");
+    }
+    return DefaultSampler;
+}
+
 void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
 {
     if (!std::filesystem::exists(InDirectoryPath) || !std::filesystem::is_directory(InDirectoryPath))
@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	constexpr float UNORM16_MAX = 65535.0f;
+	constexpr float SNORM16_MAX = 32767.0f;
+
+	// SNORM16에서 -32768은 -32767과 같은 값으로 풀리므로 남는 코드를 길이 0인 방향에 쓴다
+	constexpr int16 ZERO_DIRECTION_CODE = INT16_MIN;
+
+	uint16 EncodeUnorm16(float InValue, float InMin, float InStep)
+	{
+		if (InStep <= 0.0f)
+		{
+			return 0;
+		}
+		const float Quantized = std::round((InValue - InMin) / InStep);
+		return static_cast<uint16>(std::clamp(Quantized, 0.0f, UNORM16_MAX));
+	}
+
+	int16 EncodeSnorm16(float InValue)
+	{
+		return static_cast<int16>(std::round(std::clamp(InValue, -1.0f, 1.0f) * SNORM16_MAX));
+	}
+
+	float DecodeSnorm16(int16 InValue)
+	{
+		return std::max(static_cast<float>(InValue) / SNORM16_MAX, -1.0f);
+	}
+
+	uint8 EncodeUnorm8(float InValue)
+	{
+		return static_cast<uint8>(std::round(std::clamp(InValue, 0.0f, 1.0f) * 255.0f));
+	}
+
+	uint32 EncodeColor(const FVector4& InColor)
+	{
+		return static_cast<uint32>(EncodeUnorm8(InColor.X)) | static_cast<uint32>(EncodeUnorm8(InColor.Y)) << 8
+			| static_cast<uint32>(EncodeUnorm8(InColor.Z)) << 16 | static_cast<uint32>(EncodeUnorm8(InColor.W)) << 24;
+	}
+
+	FVector4 DecodeColor(uint32 InColor)
+	{
+		return FVector4((InColor & 0xFF) / 255.0f, (InColor >> 8 & 0xFF) / 255.0f,
+			(InColor >> 16 & 0xFF) / 255.0f, (InColor >> 24 & 0xFF) / 255.0f);
+	}
+
+	float SignNotZero(float InValue)
+	{
+		return InValue >= 0.0f ? 1.0f : -1.0f;
+	}
+}
+
+FVertexQuantization FVertexQuantizer::ComputeQuantization(const TArray<FNormalVertex>& InVertices)
+{
+	FVertexQuantization Quantization;
+	Quantization.ConstantColor = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+	if (InVertices.IsEmpty())
+	{
+		return Quantization;
+	}
+
+	FVector BoundsMin = InVertices[0].Position;
+	FVector BoundsMax = InVertices[0].Position;
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		BoundsMin.X = std::min(BoundsMin.X, Vertex.Position.X);
+		BoundsMin.Y = std::min(BoundsMin.Y, Vertex.Position.Y);
+		BoundsMin.Z = std::min(BoundsMin.Z, Vertex.Position.Z);
+		BoundsMax.X = std::max(BoundsMax.X, Vertex.Position.X);
+		BoundsMax.Y = std::max(BoundsMax.Y, Vertex.Position.Y);
+		BoundsMax.Z = std::max(BoundsMax.Z, Vertex.Position.Z);
+	}
+	Quantization.PositionMin = BoundsMin;
+	Quantization.PositionStep = (BoundsMax - BoundsMin) / UNORM16_MAX;
+
+	FVector2 TexCoordMin = InVertices[0].TexCoord;
+	FVector2 TexCoordMax = InVertices[0].TexCoord;
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		TexCoordMin.X = std::min(TexCoordMin.X, Vertex.TexCoord.X);
+		TexCoordMin.Y = std::min(TexCoordMin.Y, Vertex.TexCoord.Y);
+		TexCoordMax.X = std::max(TexCoordMax.X, Vertex.TexCoord.X);
+		TexCoordMax.Y = std::max(TexCoordMax.Y, Vertex.TexCoord.Y);
+	}
+	Quantization.TexCoordMin = TexCoordMin;
+	Quantization.TexCoordStep = FVector2((TexCoordMax.X - TexCoordMin.X) / UNORM16_MAX, (TexCoordMax.Y - TexCoordMin.Y) / UNORM16_MAX);
+
+	// 정점 색이 모두 같으면 (대부분 기본값 흰색) 스트림을 생략
+	const FVector4& FirstColor = InVertices[0].Color;
+	Quantization.ConstantColor = FirstColor;
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		if (memcmp(&Vertex.Color, &FirstColor, sizeof(FVector4)) != 0)
+		{
+			Quantization.bHasVertexColors = 1;
+			break;
+		}
+	}
+	return Quantization;
+}
+
+void FVertexQuantizer::Encode(const TArray<FNormalVertex>& InVertices, const FVertexQuantization& InQuantization,
+	TArray<FCompressedVertex>& OutVertices, TArray<uint32>& OutColors)
+{
+	OutVertices.SetNum(InVertices.Num());
+	OutColors.SetNum(InQuantization.bHasVertexColors ? InVertices.Num() : 0);
+
+	for (int32 i = 0; i < InVertices.Num(); ++i)
+	{
+		const FNormalVertex& Vertex = InVertices[i];
+		FCompressedVertex& Compressed = OutVertices[i];
+
+		Compressed.Position[0] = EncodeUnorm16(Vertex.Position.X, InQuantization.PositionMin.X, InQuantization.PositionStep.X);
+		Compressed.Position[1] = EncodeUnorm16(Vertex.Position.Y, InQuantization.PositionMin.Y, InQuantization.PositionStep.Y);
+		Compressed.Position[2] = EncodeUnorm16(Vertex.Position.Z, InQuantization.PositionMin.Z, InQuantization.PositionStep.Z);
+		Compressed.TexCoord[0] = EncodeUnorm16(Vertex.TexCoord.X, InQuantization.TexCoordMin.X, InQuantization.TexCoordStep.X);
+		Compressed.TexCoord[1] = EncodeUnorm16(Vertex.TexCoord.Y, InQuantization.TexCoordMin.Y, InQuantization.TexCoordStep.Y);
+		EncodeOctahedral(Vertex.Normal, Compressed.Normal[0], Compressed.Normal[1]);
+
+		// handedness는 Tangent Y의 최하위 비트 (Y 정밀도는 15비트가 된다)
+		EncodeOctahedral(FVector(Vertex.Tangent.X, Vertex.Tangent.Y, Vertex.Tangent.Z), Compressed.Tangent[0], Compressed.Tangent[1]);
+		Compressed.Tangent[1] = static_cast<int16>((Compressed.Tangent[1] & ~1) | (Vertex.Tangent.W < 0.0f ? 1 : 0));
+
+		if (InQuantization.bHasVertexColors)
+		{
+			OutColors[i] = EncodeColor(Vertex.Color);
+		}
+	}
+}
+
+void FVertexQuantizer::Decode(const FCompressedVertex* InVertices, const uint32* InColors, uint32 InVertexCount,
+	const FVertexQuantization& InQuantization, FNormalVertex* OutVertices)
+{
+	const bool bHasVertexColors = InQuantization.bHasVertexColors && InColors;
+	for (uint32 i = 0; i < InVertexCount; ++i)
+	{
+		const FCompressedVertex& Compressed = InVertices[i];
+		FNormalVertex& Vertex = OutVertices[i];
+		memset(&Vertex, 0, sizeof(FNormalVertex));  // 패딩까지 같게 만들어 디코딩 결과를 바이트 단위로 비교할 수 있도록
+
+		Vertex.Position = FVector(
+			InQuantization.PositionMin.X + Compressed.Position[0] * InQuantization.PositionStep.X,
+			InQuantization.PositionMin.Y + Compressed.Position[1] * InQuantization.PositionStep.Y,
+			InQuantization.PositionMin.Z + Compressed.Position[2] * InQuantization.PositionStep.Z);
+		Vertex.Normal = DecodeOctahedral(Compressed.Normal[0], Compressed.Normal[1]);
+		Vertex.Color = bHasVertexColors ? DecodeColor(InColors[i]) : InQuantization.ConstantColor;
+		Vertex.TexCoord = FVector2(
+			InQuantization.TexCoordMin.X + Compressed.TexCoord[0] * InQuantization.TexCoordStep.X,
+			InQuantization.TexCoordMin.Y + Compressed.TexCoord[1] * InQuantization.TexCoordStep.Y);
+
+		const FVector Tangent = DecodeOctahedral(Compressed.Tangent[0], static_cast<int16>(Compressed.Tangent[1] & ~1));
+		Vertex.Tangent = FVector4(Tangent, (Compressed.Tangent[1] & 1) ? -1.0f : 1.0f);
+	}
+}
+
+void FVertexQuantizer::QuantizeStaticMesh(FStaticMesh& InOutStaticMesh)
+{
+	const FVertexQuantization Quantization = ComputeQuantization(InOutStaticMesh.Vertices);
+
+	// octahedral 접힘 경계(Z = 0)의 방향은 두 가지 코드로 표현될 수 있어, 한 번 더 돌려 다시 인코딩해도 바뀌지 않는 값으로 맞춘다
+	TArray<FCompressedVertex> CompressedVertices;
+	TArray<uint32> Colors;
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		Encode(InOutStaticMesh.Vertices, Quantization, CompressedVertices, Colors);
+		Decode(CompressedVertices.GetData(), Colors.GetData(), static_cast<uint32>(CompressedVertices.Num()), Quantization,
+			InOutStaticMesh.Vertices.GetData());
+	}
+
+	InOutStaticMesh.VertexQuantization = Quantization;
+	InOutStaticMesh.bQuantizedVertices = true;
+}
+
+uint64 FVertexQuantizer::GetCompressedSize(uint32 InVertexCount, bool bInHasVertexColors)
+{
+	return static_cast<uint64>(InVertexCount) * (sizeof(FCompressedVertex) + (bInHasVertexColors ? sizeof(uint32) : 0));
+}
+
+void FVertexQuantizer::EncodeOctahedral(const FVector& InDirection, int16& OutX, int16& OutY)
+{
+	// 단위 구를 팔면체에 투영한 뒤 아래쪽 반을 접어 [-1, 1]^2에 펼친다
+	const float L1Norm = std::abs(InDirection.X) + std::abs(InDirection.Y) + std::abs(InDirection.Z);
+	if (L1Norm <= 0.0f)
+	{
+		OutX = ZERO_DIRECTION_CODE;
+		OutY = ZERO_DIRECTION_CODE;
+		return;
+	}
+
+	float X = InDirection.X / L1Norm;
+	float Y = InDirection.Y / L1Norm;
+	if (InDirection.Z < 0.0f)
+	{
+		const float FoldedX = (1.0f - std::abs(Y)) * SignNotZero(X);
+		const float FoldedY = (1.0f - std::abs(X)) * SignNotZero(Y);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	OutX = EncodeSnorm16(X);
+	OutY = EncodeSnorm16(Y);
+}
+
+FVector FVertexQuantizer::DecodeOctahedral(int16 InX, int16 InY)
+{
+	if (InX == ZERO_DIRECTION_CODE && InY == ZERO_DIRECTION_CODE)
+	{
+		return FVector(0.0f, 0.0f, 0.0f);
+	}
+
+	float X = DecodeSnorm16(InX);
+	float Y = DecodeSnorm16(InY);
+	const float Z = 1.0f - std::abs(X) - std::abs(Y);
+	if (Z < 0.0f)
+	{
+		const float UnfoldedX = (1.0f - std::abs(Y)) * SignNotZero(X);
+		const float UnfoldedY = (1.0f - std::abs(X)) * SignNotZero(Y);
+		X = UnfoldedX;
+		Y = UnfoldedY;
+	}
+
+	FVector Direction(X, Y, Z);
+	Direction.Normalize();
+	return Direction;
+}
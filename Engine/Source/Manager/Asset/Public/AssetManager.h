@@ -2,6 +2,7 @@
 
 #include "ObjImporter.h"
 #include "TextureManager.h"
+#include "AsyncAssetLoader.h"
 #include "Component/Mesh/Public/StaticMesh.h"
 
 class USkeletalMesh;
@@ -52,6 +53,18 @@ public:
 	FAABB& GetAABB(EPrimitiveType InType);
 	FAABB& GetStaticMeshAABB(FName InName);
 
+	// Async Loading
+	/**
+	 * @brief 에셋(.obj, .fbx, 텍스처)을 워커 스레드에서 로드하도록 요청
+	 * @param InCallback: 완료 시 메인 스레드에서 호출 (실패하면 nullptr)
+	 * @return 상태 폴링 및 대기용 핸들. 로드 중에는 GetPlaceholder*()를 대신 사용할 수 있다.
+	 */
+	FAssetLoadHandle RequestAsyncLoad(const FName& InPath, TFunction<void(UObject*)> InCallback = nullptr);
+	void WaitForAsyncLoads();
+	bool IsAsyncLoading() const;
+	UStaticMesh* GetPlaceholderStaticMesh() const { return PlaceholderStaticMesh; }
+	UTexture* GetPlaceholderTexture();
+
 private:
 	// Vertex Resource
 	TMap<EPrimitiveType, ID3D11Buffer*> VertexBuffers;
@@ -75,6 +88,16 @@ private:
 	TMap<FName, ID3D11Buffer*> SkeletalMeshVertexBuffers;
 	TMap<FName, ID3D11Buffer*> SkeletalMeshIndexBuffers;
 
+	// Async Loading Resource
+	FAsyncAssetLoader* AsyncLoader;
+	UStaticMesh* PlaceholderStaticMesh = nullptr;
+
+	//@brief Data/ 하위에서 확장자가 일치하는 파일을 모두 비동기 로드 요청하고 요청 수를 반환
+	int32 RequestAllAssetsInDataDirectory(const TSet<FString>& InExtensions);
+	//@brief 로드된 스태틱 메시와 버퍼, AABB를 등록 (버퍼 소유권을 가져가며 이미 등록된 경로면 해제)
+	void RegisterStaticMesh(const FName& InPath, UStaticMesh* InStaticMesh, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer);
+	friend class FAsyncAssetLoader;
+
 	// Helper Functions
 	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
 	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
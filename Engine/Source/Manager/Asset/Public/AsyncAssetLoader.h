@@ -0,0 +1,108 @@
+#pragma once
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+class FTextureManager;
+struct FAsyncAssetRequest;
+
+/**
+ * @brief 비동기 로드 요청의 진행 상태
+ */
+enum class EAssetLoadState : uint8
+{
+	Loading,  // Load 또는 Finalize 단계 진행 중
+	Loaded,   // 에셋이 캐시에 등록됨
+	Failed,   // 파일이 없거나 임포트/GPU 리소스 생성 실패
+};
+
+/**
+ * @brief 비동기 로드 요청에 대한 핸들
+ * 상태를 폴링하거나 Wait()로 완료를 기다린다. 같은 경로의 요청은 하나의 요청을 공유한다.
+ */
+class FAssetLoadHandle
+{
+public:
+	FAssetLoadHandle() = default;
+	explicit FAssetLoadHandle(const TSharedPtr<FAsyncAssetRequest>& InRequest);
+
+	bool IsValid() const { return Request.IsValid(); }
+	bool IsDone() const;
+	bool IsLoaded() const;
+	EAssetLoadState GetState() const;
+	FName GetPath() const;
+
+	//@brief 로드된 에셋 (완료 전이거나 실패하면 nullptr). FBX는 타입에 따라 UStaticMesh 또는 USkeletalMesh
+	UObject* GetAsset() const;
+
+	template <typename T>
+	T* Get() const { return Cast<T>(GetAsset()); }
+
+	/**
+	 * @brief 요청이 완료될 때까지 대기
+	 * @note 메인 스레드에서 호출해야 Finalize 단계까지 처리된다. (대기 중에 MainThread 태스크를 실행)
+	 */
+	void Wait() const;
+
+private:
+	friend class FAsyncAssetLoader;
+
+	TSharedPtr<FAsyncAssetRequest> Request;
+};
+
+/**
+ * @brief UAssetManager가 소유하는 비동기 에셋 로더
+ *
+ * 요청 하나는 두 단계의 태스크로 처리된다.
+ * - Load (워커): 파일 IO, 쿠킹 파일 로드 또는 임포트 후 쿠킹, 정점/인덱스 버퍼 생성, DDS 변환
+ * - Finalize (메인 스레드): UObject 생성, 텍스처 GPU 업로드, 캐시 등록, 완료 콜백 호출
+ *
+ * 메시의 Load 단계는 머티리얼이 참조하는 텍스처를 요청한 뒤, 그 텍스처들의 Finalize를 선행 조건으로
+ * 메시의 Finalize를 예약한다. 따라서 메시와 텍스처는 동시에 로드되고, 머티리얼을 만들 때는 텍스처가 이미 캐시에 있다.
+ */
+class FAsyncAssetLoader
+{
+public:
+	explicit FAsyncAssetLoader(FTextureManager* InTextureManager);
+	~FAsyncAssetLoader();
+
+	/**
+	 * @brief 확장자(.obj, .fbx, 텍스처)로 에셋 종류를 판단해 로드를 요청
+	 * @param InCallback: 완료 시 메인 스레드에서 호출 (실패하면 nullptr 전달)
+	 * @note 같은 경로의 요청이 이미 있으면 그 요청의 핸들을 반환한다. 어느 스레드에서든 호출 가능
+	 */
+	FAssetLoadHandle RequestLoad(const FName& InPath, TFunction<void(UObject*)> InCallback = nullptr);
+
+	//@brief 메인 스레드 전용. 진행 중인 요청(로드 중 추가된 의존 요청 포함)이 모두 끝날 때까지 대기
+	void WaitAll();
+
+	int32 GetPendingCount() const { return PendingCount.load(std::memory_order_acquire); }
+
+	static bool IsSupportedExtension(const FString& InExtension);
+
+private:
+	FAsyncAssetLoader(const FAsyncAssetLoader&) = delete;
+	FAsyncAssetLoader& operator=(const FAsyncAssetLoader&) = delete;
+
+	//@brief 요청 종류에 맞는 Load 태스크를 예약 (텍스처는 Finalize도 함께 예약)
+	void DispatchLoad(const TSharedPtr<FAsyncAssetRequest>& InRequest);
+	//@brief 메시 Load 단계의 끝에서 텍스처 의존 요청의 Finalize를 선행 조건으로 Finalize 예약
+	void DispatchFinalize(const TSharedPtr<FAsyncAssetRequest>& InRequest, const TArray<FName>& InTextureDependencies);
+
+	// Load 단계 (워커 스레드)
+	static void LoadTexture(FAsyncAssetRequest& InRequest);
+	static void LoadObjStaticMesh(FAsyncAssetRequest& InRequest, TArray<FName>& OutTextureDependencies);
+	static void LoadFbxMesh(FAsyncAssetRequest& InRequest, TArray<FName>& OutTextureDependencies);
+	static void CreateStaticMeshBuffers(FAsyncAssetRequest& InRequest);
+
+	// Finalize 단계 (메인 스레드)
+	UObject* FinalizeTexture(FAsyncAssetRequest& InRequest);
+	static UObject* FinalizeStaticMesh(FAsyncAssetRequest& InRequest);
+	static UObject* FinalizeSkeletalMesh(FAsyncAssetRequest& InRequest);
+	void Complete(const TSharedPtr<FAsyncAssetRequest>& InRequest, UObject* InAsset);
+
+	FTextureManager* TextureManager;
+
+	// 요청 생성과 태스크 예약을 함께 보호. 스케줄러가 꺼져 있으면 Load가 즉시 실행되어 재진입하므로 recursive
+	mutable std::recursive_mutex RequestsMutex;
+	TMap<FName, TSharedPtr<FAsyncAssetRequest>> Requests;  // 완료된 요청도 유지 (같은 경로의 재요청은 핸들만 반환)
+	std::atomic<int32> PendingCount{ 0 };
+};
@@ -81,6 +81,24 @@ struct FFbxSkeletalMeshInfo : public FFbxStaticMeshInfo
 	TArray<int32> ControlPointIndices;       // 각 PolygonVertex가 어떤 ControlPoint에서 왔는지 매핑 (VertexList와 1:1 대응)
 };
 
+/** FBX에서 추출한 본 하나의 애니메이션 키 (프레임마다 1개씩, 엔진 독립적) */
+struct FFbxAnimTrack
+{
+	std::string BoneName;
+	TArray<FVector> Translations;
+	TArray<FQuaternion> Rotations;
+	TArray<FVector> Scales;
+};
+
+/** FBX 애니메이션 스택 하나를 일정한 프레임 간격으로 샘플링한 데이터 */
+struct FFbxAnimSequenceInfo
+{
+	std::string Name;
+	float FrameRate = 30.0f;
+	int32 NumFrames = 0;
+	TArray<FFbxAnimTrack> Tracks;  // Bones와 같은 순서
+};
+
 enum class EFbxMeshType
 {
 	Static,
@@ -94,13 +112,17 @@ public:
 	struct Configuration
 	{
 		bool bIsBinaryEnabled = false;
+		bool bOptimizeMesh = true; // 쿠킹 시 정점 캐시/오버드로/정점 fetch 순서 최적화 (스태틱 메시만)
+		bool bGenerateLODs = true; // 쿠킹 시 단순화된 LOD 인덱스 버퍼 생성 (스태틱 메시만)
+		bool bCompressVertices = true; // 쿠킹 파일에 정점을 양자화해 FCompressedVertex로 저장 (디스크 크기와 로드 I/O만 줄고 GPU 정점은 그대로, 스태틱 메시만)
+		bool bGenerateOccluder = true; // 쿠킹 시 소프트웨어 오클루전 컬링용 단순화 메시 생성 (스태틱 메시만)
 	};
 
 	// 🔸 FBX SDK 세션 관리
 	static bool Initialize();
 	static void Shutdown();
 
-	// 🔸 Public API - 타입별 로드 함수
+	// 🔸 Public API - 타입별 로드 함수 (모든 스레드에서 호출 가능, 내부에서 직렬화)
 
 	/** FBX 파일에서 메시 타입 판단 */
 	static EFbxMeshType DetermineMeshType(const std::filesystem::path& FilePath);
@@ -117,6 +139,16 @@ public:
 		FFbxSkeletalMeshInfo* OutMeshInfo,
 		Configuration Config = {});
 
+	/**
+	 * 애니메이션 스택 임포트
+	 * 각 스택을 씬의 프레임 레이트로 샘플링하며, 트랙은 Bones와 같은 순서로 이름이 같은 노드에서 추출한다.
+	 * @return 애니메이션 스택이 하나 이상 추출되었으면 true
+	 */
+	static bool LoadAnimations(
+		const std::filesystem::path& FilePath,
+		const TArray<FFbxBoneInfo>& Bones,
+		TArray<FFbxAnimSequenceInfo>& OutAnimations);
+
 private:
 	// 🔸 RAII Helper - FbxScene 자동 관리 (메모리 릭 방지)
 	class FFbxSceneGuard
@@ -169,8 +201,15 @@ private:
 	static void ExtractSkeletalGeometryData(FbxMesh* Mesh, FFbxSkeletalMeshInfo* OutMeshInfo, const Configuration& Config,
 		uint32 VertexOffset = 0, uint32 MaterialOffset = 0, int32 ControlPointOffset = 0);
 
+	// 🔸 Animation 전용
+	static void ExtractAnimStack(FbxScene* Scene, FbxAnimStack* AnimStack, const TArray<FbxNode*>& BoneNodes,
+		const TArray<FFbxBoneInfo>& Bones, FFbxAnimSequenceInfo* OutAnimation);
+
 	static inline FbxManager* SdkManager = nullptr;
 	static inline FbxIOSettings* IoSettings = nullptr;
+
+	// FBX SDK 매니저는 스레드 안전하지 않으므로 Public API는 한 번에 하나씩만 실행 (비동기 에셋 로딩 태스크 대비)
+	static inline std::mutex SdkMutex;
 };
 
 // ========================================
@@ -29,10 +29,28 @@ public:
 		const FName& FilePath,
 		const FFbxImporter::Configuration& Config = {});
 
+	/** 쿠킹 파일을 읽거나 FBX로부터 구성한 뒤 쿠킹. 캐시를 건드리지 않으므로 워커 스레드에서 호출 가능 */
+	static std::unique_ptr<FStaticMesh> CookFbxStaticMeshAsset(
+		const FName& FilePath,
+		const FFbxImporter::Configuration& Config = {});
+
+	/** 쿠킹 파일에 기록해 임포트 설정이 바뀌면 다시 쿠킹하도록 하는 플래그 */
+	static uint32 GetCookImportFlags(const FFbxImporter::Configuration& Config);
+
+	/** 캐시와 쿠킹 파일을 거치지 않고 FBX로부터 FStaticMesh를 새로 구성 */
+	static std::unique_ptr<FStaticMesh> BuildFbxStaticMeshAsset(
+		const FName& FilePath,
+		const FFbxImporter::Configuration& Config = {});
+
 	static UStaticMesh* LoadFbxStaticMesh(
 		const FName& FilePath,
 		const FFbxImporter::Configuration& Config = {});
 
+	/** CookFbxStaticMeshAsset의 결과를 캐시에 등록하고 UStaticMesh를 만든다. 메인 스레드 전용 */
+	static UStaticMesh* CreateFbxStaticMesh(
+		const FName& FilePath,
+		std::unique_ptr<FStaticMesh> StaticMeshAsset);
+
 	// ========================================
 	// 🔸 Skeletal Mesh
 	// ========================================
@@ -45,6 +63,12 @@ public:
 		const FName& FilePath,
 		const FFbxImporter::Configuration& Config = {});
 
+	/** 임포트가 끝난 스켈레탈 메시 정보로 USkeletalMesh를 만들고 캐시에 등록. 메인 스레드 전용 */
+	static USkeletalMesh* CreateFbxSkeletalMesh(
+		const FName& FilePath,
+		const FFbxSkeletalMeshInfo& SkeletalMeshInfo,
+		const TArray<FFbxAnimSequenceInfo>& FbxAnimations);
+
 	// ========================================
 	// 🔸 Memory Management
 	// ========================================
@@ -79,6 +103,11 @@ private:
 		const TArray<FFbxBoneInfluence>& FbxWeights,
 		TArray<FRawSkinWeight>& OutSkinWeights);
 
+	/** FFbxAnimSequenceInfo 배열을 UAnimSequence로 압축해 스켈레탈 메시에 추가 */
+	static void ConvertAnimations(
+		const TArray<FFbxAnimSequenceInfo>& FbxAnimations,
+		USkeletalMesh* OutSkeletalMesh);
+
 	/** FFbxSkeletalMeshInfo를 FStaticMesh로 변환 (지오메트리 데이터만) */
 	static void ConvertFbxSkeletalToStaticMesh(
 		const FFbxSkeletalMeshInfo& FbxData,
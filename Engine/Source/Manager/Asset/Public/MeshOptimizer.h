@@ -0,0 +1,61 @@
+#pragma once
+
+struct FNormalVertex;
+struct FStaticMesh;
+
+constexpr uint32 MESH_OPTIMIZER_CACHE_SIZE = 16;            // Tipsify와 분석기가 가정하는 post-transform 캐시 크기 (FIFO)
+constexpr float MESH_OPTIMIZER_OVERDRAW_THRESHOLD = 1.05f;  // 오버드로 클러스터를 나눌 때 허용하는 ACMR 증가 비율
+constexpr uint32 MESH_OPTIMIZER_FETCH_LINE_SIZE = 64;       // 정점 fetch 분석의 캐시 라인 크기 (bytes)
+constexpr uint32 MESH_OPTIMIZER_FETCH_CACHE_LINES = 64;     // 정점 fetch 분석의 캐시 라인 수 (4KB, FIFO)
+
+/**
+ * @brief 인덱스 버퍼의 정점 처리 효율 (GPU 없이 CPU에서 시뮬레이션한 값)
+ */
+struct FMeshCacheStatistics
+{
+	float ACMR = 0.0f;       // Average Cache Miss Ratio: 삼각형당 정점 셰이더 실행 수 (최적 약 0.5, 최악 3)
+	float ATVR = 0.0f;       // Average Transformed Vertex Ratio: 사용된 정점당 정점 셰이더 실행 수 (최적 1)
+	float Overfetch = 0.0f;  // 정점 버퍼에서 읽은 바이트 / 사용된 정점 바이트 (최적 1)
+};
+
+/**
+ * @brief 임포트한 메시의 인덱스/정점 순서를 GPU 친화적으로 재배치하는 쿠킹 단계
+ *
+ * 1. Tipsify: 정점이 post-transform 캐시에 남아 있는 동안 인접 삼각형을 fan 형태로 내보낸다.
+ * 2. 오버드로: Tipsify가 막다른 곳에서 끊은 클러스터를 ACMR이 크게 나빠지지 않는 범위에서 더 나누고,
+ *    메시 바깥을 향하는 클러스터가 먼저 그려지도록 정렬한다. (Sander et al. 2007)
+ * 3. 정점 fetch: 정점을 인덱스 버퍼의 첫 사용 순서로 재배치한다.
+ */
+class FMeshOptimizer
+{
+public:
+	/**
+	 * @brief 섹션마다 1, 2단계를 적용한 뒤 메시 전체에 3단계를 적용
+	 * @note 삼각형 순서가 바뀌므로 BVH는 호출자가 이후에 빌드해야 한다. 섹션 구간과 재질 슬롯은 그대로 유지된다.
+	 */
+	static void OptimizeStaticMesh(FStaticMesh& InOutStaticMesh);
+
+	/**
+	 * @brief Tipsify 삼각형 재정렬
+	 * @param OutClusters: 클러스터 시작 위치(삼각형 인덱스). 첫 값은 항상 0
+	 */
+	static void OptimizeVertexCache(uint32* InOutIndices, uint32 InIndexCount, uint32 InVertexCount, TArray<uint32>* OutClusters = nullptr);
+
+	/**
+	 * @brief 클러스터 단위로 삼각형을 바깥쪽을 향하는 순서로 정렬 (클러스터 내부 순서는 유지)
+	 * @param InClusters: OptimizeVertexCache가 반환한 클러스터 시작 위치
+	 */
+	static void OptimizeOverdraw(uint32* InOutIndices, uint32 InIndexCount, const TArray<FNormalVertex>& InVertices,
+		const TArray<uint32>& InClusters, float InThreshold = MESH_OPTIMIZER_OVERDRAW_THRESHOLD);
+
+	/**
+	 * @brief 정점을 인덱스 버퍼의 첫 사용 순서로 재배치하고 인덱스를 갱신 (사용되지 않는 정점은 뒤로 보낸다)
+	 */
+	static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+	//@brief 인덱스 버퍼 하나를 한 번의 draw로 그린다고 가정한 캐시 통계
+	static FMeshCacheStatistics Analyze(const uint32* InIndices, uint32 InIndexCount, uint32 InVertexCount,
+		uint32 InVertexStride, uint32 InCacheSize = MESH_OPTIMIZER_CACHE_SIZE);
+	//@brief 섹션마다 별도의 draw로 그린다고 가정한 메시 전체의 캐시 통계
+	static FMeshCacheStatistics Analyze(const FStaticMesh& InStaticMesh, uint32 InCacheSize = MESH_OPTIMIZER_CACHE_SIZE);
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+struct FNormalVertex;
+struct FStaticMesh;
+
+constexpr int32 STATIC_MESH_MAX_LODS = 4;                         // LOD0(원본) 포함
+constexpr uint32 STATIC_MESH_LOD_MIN_TRIANGLES = 128;              // 이보다 작은 메시는 LOD를 만들지 않는다
+constexpr float STATIC_MESH_LOD_REDUCTION = 0.5f;                  // LOD마다 목표 삼각형 수 비율 (LOD0 기준으로 누적)
+constexpr float STATIC_MESH_LOD_MIN_GAIN = 0.85f;                  // 이전 LOD보다 삼각형이 이 비율 이상 남으면 LOD 생성을 멈춘다
+constexpr float STATIC_MESH_LOD_MAX_ERRORS[STATIC_MESH_MAX_LODS - 1] = { 0.01f, 0.025f, 0.06f };  // LOD1~: 메시 반경 대비 허용 오차
+constexpr float STATIC_MESH_LOD_PIXEL_ERROR = 1.0f;                // LOD 전환 시 허용하는 화면 오차 (픽셀)
+constexpr float STATIC_MESH_LOD_REFERENCE_SCREEN_HEIGHT = 1080.0f; // ScreenSize를 픽셀로 환산할 때 가정하는 화면 높이
+
+constexpr uint32 STATIC_MESH_OCCLUDER_TARGET_TRIANGLES = 256;      // 오클루더 메시의 목표 삼각형 수
+constexpr uint32 STATIC_MESH_OCCLUDER_MAX_TRIANGLES = 2048;        // 오차 한도 때문에 이보다 많이 남으면 오클루더를 만들지 않는다
+constexpr float STATIC_MESH_OCCLUDER_MAX_ERROR = 0.02f;            // 메시 반경 대비 허용 오차 (실제 오차만큼 노멀 반대로 줄여 잘못 가리는 일을 줄인다)
+
+/**
+ * @brief Quadric error metric 기반 edge collapse 메시 단순화 (Garland & Heckbert 1997)
+ *
+ * 정점은 새로 만들지 않고 기존 정점으로 합치는 half-edge collapse만 수행하므로,
+ * 단순화 결과는 원본 정점 버퍼를 그대로 공유하는 인덱스 버퍼가 된다.
+ * - 위상은 위치 단위로 본다. 노멀만 다른 정점(하드 엣지)은 함께 움직이고, 각 정점은 합쳐지는 위치에서 가장 비슷한 정점으로 옮겨진다.
+ * - 열린 경계의 위치는 경계를 따라서만 합쳐진다.
+ * - UV가 둘 이상인 위치(UV seam), 복잡한 경계, InLockedVertices의 정점이 있는 위치는 움직이지 않는다.
+ */
+class FMeshSimplifier
+{
+public:
+	/**
+	 * @brief 인덱스 버퍼를 목표 삼각형 수 또는 허용 오차에 도달할 때까지 단순화
+	 * @param InLockedVertices: 정점마다 0이 아니면 고정 (nullptr 가능)
+	 * @param InTargetIndexCount: 목표 인덱스 수 (오차 한도에 먼저 걸리면 더 많이 남는다)
+	 * @param InMaxError: 허용 오차 (원본 표면까지의 거리 단위)
+	 * @param OutError: 실제로 발생한 최대 오차 (nullptr 가능)
+	 * @return 단순화된 인덱스 수
+	 */
+	static uint32 Simplify(uint32* InOutIndices, uint32 InIndexCount, const TArray<FNormalVertex>& InVertices,
+		const uint8* InLockedVertices, uint32 InTargetIndexCount, float InMaxError, float* OutError = nullptr);
+
+	/**
+	 * @brief LOD1부터 LOD 체인을 만들어 InOutStaticMesh.LODs/LODIndices를 채운다
+	 * @note 여러 섹션이 공유하는 정점은 고정하므로 섹션(재질) 경계는 모든 LOD에서 같다.
+	 */
+	static void BuildLODs(FStaticMesh& InOutStaticMesh);
+
+	/**
+	 * @brief 소프트웨어 오클루전 컬링용 오클루더 메시를 만들어 InOutStaticMesh.OccluderVertices/OccluderIndices를 채운다
+	 * @note 위치만 보므로 UV seam, 하드 엣지, 섹션 경계가 모두 풀린다. 목표까지 줄지 않는 메시는 오클루더를 만들지 않는다.
+	 */
+	static void BuildOccluder(FStaticMesh& InOutStaticMesh);
+
+	/**
+	 * @brief 오클루더 정점을 면적 가중 노멀의 반대(메시 안쪽)로 InDistance만큼 옮긴다
+	 * @note 원본 안에 들어간다는 보장은 없는 근사이다. 열린 메시, 얇은 부분, 노멀이 엇갈리는 실루엣에서는 여전히 잘못 가릴 수 있다.
+	 * @return 옮긴 정점이 원본 AABB를 벗어나거나 면이 뒤집히면 false (오클루더로 쓰지 않는다)
+	 */
+	static bool ShrinkAlongNormals(FStaticMesh& InOutStaticMesh, float InDistance, const FVector& InBoundsMin, const FVector& InBoundsMax);
+
+	//@brief 메시 반경 대비 오차로부터 LOD를 써도 되는 최대 화면 크기 계산
+	static float ComputeScreenSize(float InRelativeError);
+};
@@ -14,6 +14,10 @@
 // Forward Declarations
 struct FObjectInfo;
 struct FObjectMaterialInfo;
+struct FObjParseChunk;
+
+constexpr size_t OBJ_PARSE_CHUNK_SIZE = 512 * 1024;            // Target chunk size for parallel parsing (aligned to line ends)
+constexpr size_t OBJ_PARSE_PARALLEL_MIN_BYTES = 2 * 1024 * 1024; // Smaller files are parsed on the calling thread
 
 /** @brief Holds all the data parsed from a single .obj file, including all objects, materials, and global vertex data. */
 struct FObjInfo
@@ -158,6 +162,11 @@ struct FObjImporter
 		bool bPositionToUEBasis = true;
 		bool bNormalToUEBasis = true;
 		bool bUVToUEBasis = true;
+		bool bAllowParallelParse = true;
+		bool bOptimizeMesh = true; // 쿠킹 시 정점 캐시/오버드로/정점 fetch 순서 최적화
+		bool bGenerateLODs = true; // 쿠킹 시 거리 기반 LOD 선택용 단순화된 LOD 인덱스 버퍼 생성
+		bool bCompressVertices = true; // 쿠킹 파일에 정점을 양자화해 FCompressedVertex로 저장 (오차는 양자화 한 단계 이내. 디스크 크기와 로드 I/O만 줄고 GPU 정점은 FNormalVertex 그대로)
+		bool bGenerateOccluder = true; // 쿠킹 시 소프트웨어 오클루전 컬링용 위치 전용 단순화 메시 생성
 		// ...
 	};
 
@@ -178,16 +187,20 @@ struct FObjImporter
 	 */
 	static bool LoadMaterial(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo);
 
+	/**
+	 * @brief Collects the .mtl files referenced by 'mtllib' lines, resolved the same way LoadObj resolves them.
+	 * @note Only scans line prefixes, so it is cheap enough to call when cooking to record material dependencies.
+	 */
+	static void FindMaterialLibraries(const std::filesystem::path& FilePath, TArray<std::filesystem::path>& OutPaths);
+
 private:
 	/**
-	 * @brief Parses a single face component string (e.g., "v/vt/vn").
-	 * @param FaceBuffer The string chunk representing one vertex of a face.
-	 * @param OutObjectInfo The object info struct to populate with the parsed indices.
-	 * @return True on success, false on failure.
-	 * @note This function assumes a consistent face format within a single object.
-	 *       Mixing formats (e.g., 'f 1/1' and 'f 1//1') may lead to incorrect parsing.
+	 * @brief Parses the lines in [Begin, End) without touching global state.
+	 * Positive face indices are file-global, so chunks can be parsed in any order and merged afterwards.
+	 * Negative (relative) indices are resolved against the chunk's own lists and offset during the merge.
+	 * @return False on a malformed line (OutChunk->Error holds the message).
 	 */
-	static bool ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo);
+	static bool ParseObjChunk(const char* Begin, const char* End, const Configuration& Config, FObjParseChunk* OutChunk);
 
 	static FVector PositionToUEBasis(const FVector& InVector)
 	{
@@ -9,7 +9,15 @@ class FObjManager
 {
 public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/** @brief 쿠킹 파일을 읽거나 '.obj'로부터 구성한 뒤 쿠킹. 캐시를 건드리지 않으므로 워커 스레드에서 호출 가능 */
+	static std::unique_ptr<FStaticMesh> CookObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/** @brief 캐시와 쿠킹 파일을 거치지 않고 '.obj'(또는 objbin)로부터 FStaticMesh를 새로 구성 */
+	static std::unique_ptr<FStaticMesh> BuildObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/** @brief 쿠킹 파일 유효성 검사에 쓰는 임포트 설정 값 */
+	static uint32 GetCookImportFlags(const FObjImporter::Configuration& Config);
 	static UStaticMesh* LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/** @brief CookObjStaticMeshAsset의 결과를 캐시에 등록하고 UStaticMesh를 만든다. 메인 스레드 전용 */
+	static UStaticMesh* CreateObjStaticMesh(const FName& PathFileName, std::unique_ptr<FStaticMesh> StaticMeshAsset);
 	static void CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* StaticMeshAsset, const FName& ObjFilePath);
 	static void Release();
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+constexpr uint32 COOKED_STATIC_MESH_MAGIC = 0x4B434D53;    // "SMCK"
+constexpr uint32 COOKED_STATIC_MESH_VERSION = 8;           // FNormalVertex/FFlatBVHNode/FMaterial 레이아웃이 바뀌면 올린다 (2: LOD, 3: 압축 정점, 4: 오클루더, 5: UV UNORM16, 6: 의존 파일, 7: 오클루더 축소, 8: 축소 결과 검사)
+constexpr uint64 COOKED_STATIC_MESH_ALIGNMENT = 64;        // 섹션 시작 오프셋 정렬 (캐시 라인)
+
+/**
+ * @brief 쿠킹된 스태틱 메시 파일의 데이터 구간
+ */
+enum class ECookedStaticMeshSection : uint32
+{
+	Vertices,            // FNormalVertex[] (정점을 압축한 메시는 비어 있음)
+	Indices,             // uint32[]
+	MeshSections,        // FMeshSection[]
+	BVHNodes,            // FFlatBVHNode[] (평탄화 트리가 없으면 비어 있음)
+	BVHTriangleIndices,  // int32[]
+	Materials,           // FMaterial[] (문자열 포함, FArchive 직렬화)
+	LODs,                // FCookedStaticMeshLOD[]
+	LODSections,         // FMeshSection[] (모든 LOD의 섹션을 이어 붙임)
+	LODIndices,          // uint32[]
+	CompressedVertices,  // FCompressedVertex[] (정점을 압축하지 않은 메시는 비어 있음)
+	VertexColors,        // uint32[] RGBA8 (압축 정점 중 정점 색이 모두 같지 않은 메시만)
+	OccluderVertices,    // FVector[]
+	OccluderIndices,     // uint32[]
+	Dependencies,        // 원본 외에 결과에 영향을 주는 파일(.mtl 등)의 경로와 수정 시각 (FArchive 직렬화)
+	Count
+};
+
+struct FCookedStaticMeshSection
+{
+	uint64 Offset = 0;
+	uint64 Size = 0;
+	uint32 Count = 0;
+	uint32 Stride = 0;  // 고정 크기 배열의 요소 크기, Materials/Dependencies는 0
+};
+
+/**
+ * @brief FStaticMeshLOD의 고정 크기 부분. 섹션은 LODSections 구간의 [FirstSection, FirstSection + SectionCount)
+ */
+struct FCookedStaticMeshLOD
+{
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+	float ScreenSize = 0.0f;
+	float Error = 0.0f;
+	uint32 FirstSection = 0;
+	uint32 SectionCount = 0;
+};
+
+/**
+ * @brief 쿠킹된 스태틱 메시 파일의 고정 헤더
+ * @note 헤더 뒤의 각 섹션은 COOKED_STATIC_MESH_ALIGNMENT에 맞춰 정렬되어 있어 매핑된 메모리를 그대로 읽을 수 있다.
+ */
+struct FCookedStaticMeshHeader
+{
+	uint32 Magic = COOKED_STATIC_MESH_MAGIC;
+	uint32 Version = COOKED_STATIC_MESH_VERSION;
+	uint32 HeaderSize = sizeof(FCookedStaticMeshHeader);
+	uint32 ImportFlags = 0;      // 원본 임포트 설정. 다르면 다시 쿠킹
+	int64 SourceWriteTime = 0;   // 원본 파일의 수정 시각. 다르면 다시 쿠킹
+	uint64 FileSize = 0;
+	FVector BoundsMin;
+	FVector BoundsMax;
+	FVertexQuantization VertexQuantization;  // CompressedVertices를 풀 때 사용
+	FCookedStaticMeshSection Sections[static_cast<uint32>(ECookedStaticMeshSection::Count)];
+};
+
+/**
+ * @brief 임포트가 끝난 FStaticMesh(최종 정점/인덱스, 섹션, 재질 슬롯, AABB, 평탄화 BVH, LOD, 오클루더)를
+ *        Data/Cooked에 저장하고, 다음 실행에서 정점 병합·탄젠트 계산·BVH 빌드 없이 불러온다.
+ *
+ * - 파일은 메모리 매핑으로 열고 섹션마다 한 번의 memcpy로 TArray에 옮긴다. 압축 정점은 매핑된 메모리에서 바로 디코딩한다.
+ * - 원본이나 의존 파일(.mtl 등)의 수정 시각, 임포트 설정, 버전이 다르면 Load가 실패하므로 호출자가 원본에서 다시 임포트한 뒤 Save한다.
+ */
+class FStaticMeshCooker
+{
+public:
+	/**
+	 * @brief 원본 경로에 대응하는 쿠킹 파일 경로 (이름이 같은 다른 폴더의 파일과 겹치지 않도록 경로 해시를 붙인다)
+	 */
+	static std::filesystem::path GetCookedFilePath(const FName& InSourcePath);
+
+	/**
+	 * @brief InStaticMesh.PathFileName을 원본으로 하는 쿠킹 파일을 저장
+	 * @param InImportFlags: 임포트 설정을 나타내는 값. Load에 같은 값을 넘겨야 한다.
+	 * @param InDependencyPaths: 원본 외에 임포트 결과에 영향을 주는 파일. 수정 시각이 바뀌면 쿠킹 파일이 무효가 된다.
+	 */
+	static bool Save(const FStaticMesh& InStaticMesh, uint32 InImportFlags, const TArray<std::filesystem::path>& InDependencyPaths = {});
+
+	/**
+	 * @brief 유효한 쿠킹 파일이 있으면 OutStaticMesh를 채운다.
+	 * @return 파일이 없거나 오래되었거나 손상되었으면 false (OutStaticMesh는 부분적으로 채워졌을 수 있음)
+	 */
+	static bool Load(const FName& InSourcePath, uint32 InImportFlags, FStaticMesh* OutStaticMesh);
+
+	/**
+	 * @brief 헤더와 의존 파일 목록만 읽어 원본과 설정에 맞는 쿠킹 파일이 있는지 확인
+	 */
+	static bool IsUpToDate(const FName& InSourcePath, uint32 InImportFlags);
+};
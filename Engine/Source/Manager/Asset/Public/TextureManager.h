@@ -1,5 +1,14 @@
 ﻿#pragma once
 
+/**
+ * @brief 워커 스레드에서 읽어 둔 텍스처 파일 (GPU 리소스 생성 전 단계)
+ */
+struct FTextureFileData
+{
+    TArray<uint8> Bytes;
+    bool bIsDDS = false;
+};
+
 class FTextureManager
 {
 public:
@@ -10,9 +19,22 @@ public:
     void LoadAllTexturesFromDirectory(const path& InDirectoryPath);
     const TMap<FName, UTexture*>& GetTextureCache() const;
 
+    // 비동기 로드용 함수들
+    /** @brief 캐시 키(RootPath 기준 상대 경로, '/' 구분자)를 구한다. 어느 스레드에서든 호출 가능 */
+    static FName MakeCacheKey(const FName& InFilePath, path* OutAbsolutePath = nullptr);
+    /** @brief DDS 캐시 변환(필요 시)과 파일 읽기만 수행. 어느 스레드에서든 호출 가능 */
+    static bool ReadTextureFile(const path& InFilePath, bool bSRGB, FTextureFileData& OutData);
+    /** @brief 읽어 둔 데이터로 GPU 텍스처를 만들고 캐시에 등록. 메인 스레드 전용 */
+    UTexture* CreateTextureFromMemory(const FName& InCacheKey, const FTextureFileData& InData);
+    UTexture* FindTexture(const FName& InCacheKey) const;
+    /** @brief 로드가 끝나지 않은 텍스처 대신 사용할 2x2 체커 텍스처 (캐시 목록에는 포함되지 않음) */
+    UTexture* GetPlaceholderTexture();
+
 private:
     ComPtr<ID3D11ShaderResourceView> CreateTextureFromFile(const path& InFilePath, bool bSRGB);
+    ID3D11SamplerState* GetDefaultSampler();
 	
     TMap<FName, UTexture*> TextureCaches;
-    ID3D11SamplerState* DefaultSampler; // 추후 샘플러 종류가 많아지면 매핑 형태로 캐싱 후 사용
+    ID3D11SamplerState* DefaultSampler = nullptr; // 추후 샘플러 종류가 많아지면 매핑 형태로 캐싱 후 사용
+    UTexture* PlaceholderTexture = nullptr;
 };
@@ -0,0 +1,41 @@
+#pragma once
+
+struct FStaticMesh;
+
+/**
+ * @brief FNormalVertex <-> FCompressedVertex 변환 (쿠킹 시 인코딩, 쿠킹 파일 로드 시 디코딩)
+ *
+ * - Position: 메시 AABB를 65535 단계로 나눈 UNORM16 (오차는 축마다 단계의 절반 이하)
+ * - Normal, Tangent: octahedral 매핑 후 SNORM16. Tangent는 handedness를 위해 Y의 최하위 비트를 쓴다.
+ *   길이가 0인 방향은 octahedral 사각형 밖의 코드(-32768, -32768)로 남겨 디코딩 후에도 0이 된다.
+ * - TexCoord: 메시 UV 범위를 65535 단계로 나눈 UNORM16 (타일링된 큰 UV에서도 half보다 오차가 작다)
+ * - Color: 모든 정점이 같으면 생략하고 FVertexQuantization::ConstantColor에 저장, 다르면 RGBA8 (0~1로 clamp)
+ */
+class FVertexQuantizer
+{
+public:
+	//@brief 정점 배열의 AABB와 정점 색 생략 여부로 양자화 범위 계산
+	static FVertexQuantization ComputeQuantization(const TArray<FNormalVertex>& InVertices);
+
+	/**
+	 * @param OutColors: InQuantization.bHasVertexColors일 때만 정점마다 RGBA8, 아니면 비워 둔다
+	 */
+	static void Encode(const TArray<FNormalVertex>& InVertices, const FVertexQuantization& InQuantization,
+		TArray<FCompressedVertex>& OutVertices, TArray<uint32>& OutColors);
+
+	//@param InColors: InQuantization.bHasVertexColors가 아니면 nullptr 가능
+	static void Decode(const FCompressedVertex* InVertices, const uint32* InColors, uint32 InVertexCount,
+		const FVertexQuantization& InQuantization, FNormalVertex* OutVertices);
+
+	/**
+	 * @brief 정점을 압축했다 푼 값으로 바꾸고 양자화 정보를 InOutStaticMesh에 남긴다
+	 * @note 새로 임포트한 메시와 쿠킹 파일에서 읽은 메시가 같은 정점을 갖도록 BVH 빌드 전에 호출한다.
+	 */
+	static void QuantizeStaticMesh(FStaticMesh& InOutStaticMesh);
+
+	//@brief 압축 정점 스트림 전체의 크기 (bytes)
+	static uint64 GetCompressedSize(uint32 InVertexCount, bool bInHasVertexColors);
+
+	static void EncodeOctahedral(const FVector& InDirection, int16& OutX, int16& OutY);
+	static FVector DecodeOctahedral(int16 InX, int16 InY);
+};
@@ -0,0 +1,213 @@
+#include "pch.h"
+#include "Optimization/Public/MultiViewCuller.h"
+#include "Optimization/Public/FrustumSIMD.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
+
+namespace
+{
+	/**
+	 * @brief SoA 풀의 한 구간을 4개씩 훑으며 뷰마다 노드 분류 마스크와 박스 검사를 합쳐 비트셋에 기록
+	 * @param FirstSlot 이 풀의 0번이 차지하는 슬롯 번호 (4의 배수이므로 묶음 하나가 uint64 하나를 넘지 않는다)
+	 * @param IsRenderable bool(int32 PoolIndex), 숨겨진 프리미티브를 거른다. 어떤 뷰의 마스크에도 없는 인덱스(빈 슬롯, 패딩)는 묻지 않는다
+	 */
+	template <typename RenderableFunctionType>
+	void SweepBounds(const FBoundsSoA& Bounds, const uint32* TestMasks, const uint32* AcceptMasks,
+		const FFrustumSIMD* Frustums, int32 FirstView, FViewCullingStats* Stats,
+		uint64* VisibilityBits, int32 WordsPerView, int32 FirstSlot, RenderableFunctionType&& IsRenderable)
+	{
+		for (int32 BaseIndex = 0; BaseIndex < Bounds.Num(); BaseIndex += BOUNDS_SOA_BATCH)
+		{
+			const uint32* BatchTestMasks = TestMasks + BaseIndex;
+			const uint32* BatchAcceptMasks = AcceptMasks + BaseIndex;
+			const uint32 AnyTestMask = BatchTestMasks[0] | BatchTestMasks[1] | BatchTestMasks[2] | BatchTestMasks[3];
+			const uint32 AnyAcceptMask = BatchAcceptMasks[0] | BatchAcceptMasks[1] | BatchAcceptMasks[2] | BatchAcceptMasks[3];
+			if ((AnyTestMask | AnyAcceptMask) == 0)
+			{
+				continue;
+			}
+
+			__m128 CenterX, CenterY, CenterZ, ExtentX, ExtentY, ExtentZ;
+			if (AnyTestMask != 0)
+			{
+				CenterX = _mm_loadu_ps(Bounds.CenterX.GetData() + BaseIndex);
+				CenterY = _mm_loadu_ps(Bounds.CenterY.GetData() + BaseIndex);
+				CenterZ = _mm_loadu_ps(Bounds.CenterZ.GetData() + BaseIndex);
+				ExtentX = _mm_loadu_ps(Bounds.ExtentX.GetData() + BaseIndex);
+				ExtentY = _mm_loadu_ps(Bounds.ExtentY.GetData() + BaseIndex);
+				ExtentZ = _mm_loadu_ps(Bounds.ExtentZ.GetData() + BaseIndex);
+			}
+
+			// 숨겨진 프리미티브는 어떤 뷰에서도 보이지 않으므로 묶음마다 한 번만 확인
+			uint32 RenderableLanes = 0;
+			for (int32 Lane = 0; Lane < BOUNDS_SOA_BATCH; ++Lane)
+			{
+				if ((BatchTestMasks[Lane] | BatchAcceptMasks[Lane]) != 0 && IsRenderable(BaseIndex + Lane))
+				{
+					RenderableLanes |= 1u << Lane;
+				}
+			}
+
+			const int32 Slot = FirstSlot + BaseIndex;
+			for (uint32 ViewMask = AnyTestMask | AnyAcceptMask; ViewMask != 0; ViewMask &= ViewMask - 1)
+			{
+				const int32 GroupViewIndex = std::countr_zero(ViewMask);
+				const uint32 ViewBit = 1u << GroupViewIndex;
+
+				uint32 TestLanes = 0;
+				uint32 AcceptLanes = 0;
+				for (int32 Lane = 0; Lane < BOUNDS_SOA_BATCH; ++Lane)
+				{
+					TestLanes |= ((BatchTestMasks[Lane] & ViewBit) ? 1u : 0u) << Lane;
+					AcceptLanes |= ((BatchAcceptMasks[Lane] & ViewBit) ? 1u : 0u) << Lane;
+				}
+
+				uint32 VisibleLanes = AcceptLanes;
+				if (TestLanes != 0)
+				{
+					VisibleLanes |= TestLanes & ~static_cast<uint32>(TestOutside4(Frustums[GroupViewIndex],
+						CenterX, CenterY, CenterZ, ExtentX, ExtentY, ExtentZ));
+				}
+				VisibleLanes &= RenderableLanes;
+
+				// 검사 수는 ViewVolumeCuller와 같이 숨겨진 프리미티브도 센다
+				const int32 ViewIndex = FirstView + GroupViewIndex;
+				Stats[ViewIndex].BoxTestCount += std::popcount(TestLanes);
+				Stats[ViewIndex].AcceptedByNodeCount += std::popcount(AcceptLanes);
+				VisibilityBits[ViewIndex * WordsPerView + Slot / 64] |= static_cast<uint64>(VisibleLanes) << (Slot % 64);
+			}
+		}
+	}
+}
+
+void FMultiViewCuller::Reset()
+{
+	Frustums.Empty();
+	bValidFrustums.Empty();
+	Stats.Empty();
+	VisibilityBits.Empty();
+	WordsPerView = 0;
+	SlotCount = 0;
+	StaticSlotCount = 0;
+	StaticOctree = nullptr;
+	DynamicPrimitiveTree = nullptr;
+}
+
+int32 FMultiViewCuller::AddView(const FMatrix& InViewProjection)
+{
+	FFrustum Frustum;
+	const bool bValid = ViewVolumeCuller::BuildFrustum(InViewProjection, Frustum);
+	Frustums.Add(Frustum);
+	bValidFrustums.Add(bValid ? 1 : 0);
+	return Frustums.Num() - 1;
+}
+
+void FMultiViewCuller::Cull(FOctree* InStaticOctree, FDynamicAABBTree* InDynamicPrimitiveTree)
+{
+	StaticOctree = InStaticOctree;
+	DynamicPrimitiveTree = InDynamicPrimitiveTree;
+	StaticSlotCount = StaticOctree ? StaticOctree->GetElementBounds().Num() : 0;
+	SlotCount = StaticSlotCount + (DynamicPrimitiveTree ? DynamicPrimitiveTree->GetProxyBounds().Num() : 0);
+
+	WordsPerView = (SlotCount + 63) / 64;
+	VisibilityBits.SetNum(WordsPerView * Frustums.Num());
+	std::fill(VisibilityBits.begin(), VisibilityBits.end(), 0ull);
+	Stats.SetNum(Frustums.Num());
+	std::fill(Stats.begin(), Stats.end(), FViewCullingStats());
+
+	for (int32 FirstView = 0; FirstView < Frustums.Num(); FirstView += MAX_SHARED_CULL_VIEWS)
+	{
+		CullViewGroup(FirstView, std::min(MAX_SHARED_CULL_VIEWS, Frustums.Num() - FirstView));
+	}
+
+	const int32 PrimitiveCount = (StaticOctree ? StaticOctree->GetElementCount() : 0)
+		+ (DynamicPrimitiveTree ? DynamicPrimitiveTree->GetProxyCount() : 0);
+	for (int32 ViewIndex = 0; ViewIndex < Frustums.Num(); ++ViewIndex)
+	{
+		int32 VisibleCount = 0;
+		for (int32 WordIndex = 0; WordIndex < WordsPerView; ++WordIndex)
+		{
+			VisibleCount += std::popcount(VisibilityBits[ViewIndex * WordsPerView + WordIndex]);
+		}
+		Stats[ViewIndex].VisibleCount = VisibleCount;
+		Stats[ViewIndex].CulledCount = PrimitiveCount - VisibleCount;
+	}
+}
+
+void FMultiViewCuller::CullViewGroup(int32 FirstView, int32 ViewCount)
+{
+	FFrustumSIMD GroupFrustums[MAX_SHARED_CULL_VIEWS];
+	uint32 ViewMask = 0;
+	for (int32 Index = 0; Index < ViewCount; ++Index)
+	{
+		if (bValidFrustums[FirstView + Index])
+		{
+			BroadcastFrustum(Frustums[FirstView + Index], GroupFrustums[Index]);
+			ViewMask |= 1u << Index;
+		}
+	}
+
+	// 노드가 절두체 밖인 뷰는 마스크에서 빼고, 노드를 완전히 포함하는 뷰는 Accept로 옮긴다
+	auto ClassifyNode = [this, FirstView](const FAABB& NodeBounds, uint32& InOutTestMask, uint32& InOutAcceptMask)
+	{
+		for (uint32 Mask = InOutTestMask; Mask != 0; Mask &= Mask - 1)
+		{
+			const int32 GroupViewIndex = std::countr_zero(Mask);
+			const uint32 ViewBit = 1u << GroupViewIndex;
+			++Stats[FirstView + GroupViewIndex].NodeTestCount;
+
+			switch (Frustums[FirstView + GroupViewIndex].CheckIntersection(NodeBounds))
+			{
+			case EBoundCheckResult::Outside:
+				InOutTestMask &= ~ViewBit;
+				break;
+			case EBoundCheckResult::Inside:
+				InOutTestMask &= ~ViewBit;
+				InOutAcceptMask |= ViewBit;
+				break;
+			default:
+				break;
+			}
+		}
+	};
+
+	if (StaticOctree)
+	{
+		StaticOctree->ClassifyElements(ViewMask, ClassifyNode, StaticTestMasks, StaticAcceptMasks);
+		SweepBounds(StaticOctree->GetElementBounds(), StaticTestMasks.GetData(), StaticAcceptMasks.GetData(),
+			GroupFrustums, FirstView, Stats.GetData(), VisibilityBits.GetData(), WordsPerView, 0,
+			[this](int32 ElementIndex)
+			{
+				UPrimitiveComponent* Primitive = StaticOctree->GetElementPrimitive(ElementIndex);
+				return Primitive != nullptr && Primitive->IsVisible();
+			});
+	}
+
+	if (DynamicPrimitiveTree)
+	{
+		DynamicPrimitiveTree->ClassifyProxies(ViewMask, ClassifyNode, DynamicTestMasks, DynamicAcceptMasks);
+		SweepBounds(DynamicPrimitiveTree->GetProxyBounds(), DynamicTestMasks.GetData(), DynamicAcceptMasks.GetData(),
+			GroupFrustums, FirstView, Stats.GetData(), VisibilityBits.GetData(), WordsPerView, StaticSlotCount,
+			[this](int32 ProxyId)
+			{
+				UPrimitiveComponent* Primitive = DynamicPrimitiveTree->GetPrimitive(ProxyId);
+				return Primitive != nullptr && Primitive->IsVisible();
+			});
+	}
+}
+
+UPrimitiveComponent* FMultiViewCuller::GetSlotPrimitive(int32 SlotIndex) const
+{
+	return SlotIndex < StaticSlotCount
+		? StaticOctree->GetElementPrimitive(SlotIndex)
+		: DynamicPrimitiveTree->GetPrimitive(SlotIndex - StaticSlotCount);
+}
+
+void FMultiViewCuller::GetVisiblePrimitives(int32 ViewIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	ForEachVisible(ViewIndex, [&OutPrimitives](UPrimitiveComponent* Primitive)
+	{
+		OutPrimitives.Add(Primitive);
+	});
+}
@@ -1,29 +1,106 @@
 ﻿#include "pch.h"
 #include "Optimization/Public/OcclusionCuller.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
 
-#include "Level/Public/Level.h"
-#include "Global/Octree.h"
+namespace
+{
+    constexpr float MIN_TRIANGLE_DOUBLE_AREA = 1.0e-6f;  // 화면 픽셀 단위, 이보다 작으면 덮는 픽셀이 없다고 본다
+    constexpr uint32 FULL_TILE_MASK = 0xFFFFFFFFu;
+
+    /**
+     * @brief 4개 점을 한 번에 clip space로 변환 (행 벡터 * 행렬)
+     */
+    void TransformPoints4(const FMatrix& Matrix, __m128 X, __m128 Y, __m128 Z,
+        __m128& OutX, __m128& OutY, __m128& OutZ, __m128& OutW)
+    {
+        const float (*M)[4] = Matrix.Data;
+        OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(M[0][0])), _mm_mul_ps(Y, _mm_set1_ps(M[1][0]))),
+            _mm_add_ps(_mm_mul_ps(Z, _mm_set1_ps(M[2][0])), _mm_set1_ps(M[3][0])));
+        OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(M[0][1])), _mm_mul_ps(Y, _mm_set1_ps(M[1][1]))),
+            _mm_add_ps(_mm_mul_ps(Z, _mm_set1_ps(M[2][1])), _mm_set1_ps(M[3][1])));
+        OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(M[0][2])), _mm_mul_ps(Y, _mm_set1_ps(M[1][2]))),
+            _mm_add_ps(_mm_mul_ps(Z, _mm_set1_ps(M[2][2])), _mm_set1_ps(M[3][2])));
+        OutW = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(M[0][3])), _mm_mul_ps(Y, _mm_set1_ps(M[1][3]))),
+            _mm_add_ps(_mm_mul_ps(Z, _mm_set1_ps(M[2][3])), _mm_set1_ps(M[3][3])));
+    }
+
+    float HorizontalMin(__m128 Value)
+    {
+        Value = _mm_min_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 3, 0, 1)));
+        Value = _mm_min_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_cvtss_f32(Value);
+    }
+
+    float HorizontalMax(__m128 Value)
+    {
+        Value = _mm_max_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 3, 0, 1)));
+        Value = _mm_max_ps(Value, _mm_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_cvtss_f32(Value);
+    }
+
+    // near plane(clip Z = 0)과 선분의 교점
+    FVector4 IntersectNearPlane(const FVector4& Inside, const FVector4& Outside)
+    {
+        const float T = Inside.Z / (Inside.Z - Outside.Z);
+        return FVector4(
+            Inside.X + (Outside.X - Inside.X) * T,
+            Inside.Y + (Outside.Y - Inside.Y) * T,
+            0.0f,
+            Inside.W + (Outside.W - Inside.W) * T);
+    }
+}
 
 COcclusionCuller::COcclusionCuller()
 {
-    CPU_ZBuffer.SetNum(Z_BUFFER_SIZE);
+    TileZMax0.SetNum(TILES_X * TILES_Y);
+    TileZMax1.SetNum(TILES_X * TILES_Y);
+    TileMasks.SetNum(TILES_X * TILES_Y);
+    Bins.SetNum(BINS_X * BINS_Y);
+
+    int32 Width = TILES_X;
+    int32 Height = TILES_Y;
+    while (true)
+    {
+        FDepthPyramidLevel& Level = DepthPyramid[DepthPyramid.Emplace()];
+        Level.Width = Width;
+        Level.Height = Height;
+        Level.Depth.SetNum(Width * Height);
+        if (Width == 1 && Height == 1)
+        {
+            break;
+        }
+        Width = (Width + 1) / 2;
+        Height = (Height + 1) / 2;
+    }
 }
 
 void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
 {
-    fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
+    fill(TileZMax0.begin(), TileZMax0.end(), 1.0f);
+    fill(TileZMax1.begin(), TileZMax1.end(), 0.0f);
+    fill(TileMasks.begin(), TileMasks.end(), 0u);
+    for (TArray<uint32>& Bin : Bins)
+    {
+        Bin.Reset();
+    }
+    // 매 프레임 다시 채우므로 할당은 유지한다
+    Triangles.Reset();
+    Stats = FOcclusionCullingStats();
+
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
 {
-    Frame++;
+    FScopeCycleCounter SetupCounter;
+
     // 0. Primitive AABB 데이터 채우기
     CachedAABBs.Empty();
-    for (int32 i = 0; i < AllPrimitives.Num(); ++i)
+    for (UPrimitiveComponent* PrimitiveComp : AllPrimitives)
     {
-        UPrimitiveComponent* PrimitiveComp = AllPrimitives[i];
         if (!PrimitiveComp) continue;
 
         FWorldAABBData Data;
@@ -31,398 +108,472 @@ TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrim
         PrimitiveComp->GetWorldAABB(Data.Min, Data.Max);
         Data.Center = (Data.Min + Data.Max) * 0.5f;
         CachedAABBs.Add(Data);
-
-        // 인덱스를 컴포넌트에 직접 캐시
-        PrimitiveComp->CachedAABBIndex = i;
-        PrimitiveComp->CachedFrame = Frame;
     }
 
+    // 1. 오클루더 선택 및 삼각형 binning
+    TFrameArray<uint8> bIsOccluder;
+    bIsOccluder.SetNum(CachedAABBs.Num(), 0);
+    FOccluderIndexArray Occluders;
+    SelectOccluders(CameraPos, Occluders);
+    for (const int32 Index : Occluders)
+    {
+        UStaticMeshComponent* StaticMeshComp = static_cast<UStaticMeshComponent*>(CachedAABBs[Index].Prim);
+        AddOccluder(*StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset(), StaticMeshComp->GetWorldTransformMatrix());
+        bIsOccluder[Index] = 1;
+        ++Stats.OccluderCount;
+    }
+    Stats.SetupMs = SetupCounter.Finish();
 
-    // 1. 오클루더 동적 선택
-    ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.Num()) / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
-
-    // 2. CPU Z-Buffer 구성
-    RasterizeOccluders(SelectedOccluders, CameraPos);
+    // 2. 타일 버퍼와 깊이 피라미드 구성
+    RenderOccluders();
 
-    // 3. 가시성 테스트
+    // 3. 가시성 테스트. 단순화한 오클루더가 원본보다 약간 클 수 있으므로 오클루더 자신은 검사하지 않는다
+    FScopeCycleCounter TestCounter;
     VisibleMeshComponents.Empty();
-    for (auto& AABBData : CachedAABBs)
+    for (int32 i = 0; i < CachedAABBs.Num(); ++i)
     {
-        if (IsMeshVisible(AABBData))
+        const FWorldAABBData& AABBData = CachedAABBs[i];
+        if (bIsOccluder[i] || !Cast<UMeshComponent>(AABBData.Prim))
         {
             VisibleMeshComponents.Add(AABBData.Prim);
+            continue;
+        }
+
+        ++Stats.TestedCount;
+        if (IsOccluded(AABBData.Min, AABBData.Max))
+        {
+            ++Stats.OccludedCount;
+            continue;
         }
+        VisibleMeshComponents.Add(AABBData.Prim);
     }
+    Stats.TestMs = TestCounter.Finish();
 
     return VisibleMeshComponents;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+void COcclusionCuller::SelectOccluders(const FVector& CameraPos, FOccluderIndexArray& OutOccluders) const
 {
-    FilteredOccluders.Empty();
-
-    for (UPrimitiveComponent* Occluder : Candidates)
+    struct FCandidate
+    {
+        int32 Index;
+        float ScreenSize;
+        float DistanceSq;
+        int32 TriangleCount;
+    };
+
+    TFrameArray<FCandidate> Candidates;
+    Candidates.Reserve(CachedAABBs.Num());
+    for (int32 i = 0; i < CachedAABBs.Num(); ++i)
     {
-        if (Occluder->CachedFrame != Frame)
+        const FWorldAABBData& Data = CachedAABBs[i];
+        UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Data.Prim);
+        UStaticMesh* StaticMesh = StaticMeshComp ? StaticMeshComp->GetStaticMesh() : nullptr;
+        const FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+        if (!StaticMeshAsset || StaticMeshAsset->OccluderIndices.IsEmpty())
         {
             continue;
         }
-        FWorldAABBData& Data = CachedAABBs[Occluder->CachedAABBIndex];
 
-        float AABB_Diagonal_LengthSq = FVector::DistSquared(Data.Min, Data.Max);
-        float DistanceToOccluderSq = FVector::DistSquared(CameraPos, Data.Center);
-
-        if (DistanceToOccluderSq < AABB_Diagonal_LengthSq)
+        // 바운딩 구의 화면 크기. 카메라가 구 안에 있으면 가장 큰 값
+        const float Radius = FVector::Dist(Data.Min, Data.Max) * 0.5f;
+        const float DistanceSq = FVector::DistSquared(CameraPos, Data.Center);
+        const float Distance = std::sqrt(DistanceSq);
+        const float ScreenSize = Distance > Radius ? Radius / Distance : 1.0f;
+        if (ScreenSize < OCCLUDER_MIN_SCREEN_SIZE)
         {
             continue;
         }
 
-        FilteredOccluders.Add(Occluder);
+        Candidates.Add({ i, ScreenSize, DistanceSq, StaticMeshAsset->OccluderIndices.Num() / 3 });
     }
-    return FilteredOccluders;
-}
 
-void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos)
-{
-    for (UPrimitiveComponent* OccluderComp : SelectedOccluders)
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B)
     {
-        if (OccluderComp->CachedFrame != Frame)
+        return A.ScreenSize != B.ScreenSize ? A.ScreenSize > B.ScreenSize : A.Index < B.Index;
+    });
+
+    TArray<FCandidate, TInlineAllocator<MAX_OCCLUDERS>> Selected;
+    int32 TriangleCount = 0;
+    for (const FCandidate& Candidate : Candidates)
+    {
+        if (Selected.Num() >= MAX_OCCLUDERS)
+        {
+            break;
+        }
+        if (TriangleCount + Candidate.TriangleCount > MAX_OCCLUDER_TRIANGLES)
         {
             continue;
         }
-        // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
+        TriangleCount += Candidate.TriangleCount;
+        Selected.Add(Candidate);
+    }
 
-        // 2. CPU 래스터라이징
-        for (int32 Idx = 0; Idx < BoxTriangles.Num(); Idx += 3)
-        {
-            // 삼각형의 세 정점 (월드 좌표)
-            const FVector& P1_World = BoxTriangles[Idx];
-            const FVector& P2_World = BoxTriangles[Idx + 1];
-            const FVector& P3_World = BoxTriangles[Idx + 2];
-
-            // 정점을 화면 좌표로 투영
-            FVector P1_Screen = Project(P1_World);
-            FVector P2_Screen = Project(P2_World);
-            FVector P3_Screen = Project(P3_World);
-
-            // Backface Culling
-            FVector2 V1(P2_Screen.X - P1_Screen.X, P2_Screen.Y - P1_Screen.Y);
-            FVector2 V2(P3_Screen.X - P1_Screen.X, P3_Screen.Y - P1_Screen.Y);
-
-            // 2D 외적 (Z 성분만)
-            float CrossZ = V1.X * V2.Y - V1.Y * V2.X;
-            if (CrossZ < 0.0f)
-            {
-                continue;
-            }
+    // 가까운 오클루더를 먼저 그려야 타일이 빨리 채워지고 뒤쪽 삼각형을 일찍 건너뛴다
+    Selected.Sort([](const FCandidate& A, const FCandidate& B)
+    {
+        return A.DistanceSq != B.DistanceSq ? A.DistanceSq < B.DistanceSq : A.Index < B.Index;
+    });
 
-            // Z-Buffer에 깊이 쓰기
-            RasterizeTriangle(P1_Screen, P2_Screen, P3_Screen, CPU_ZBuffer);
-        }
+    OutOccluders.Reset();
+    for (const FCandidate& Candidate : Selected)
+    {
+        OutOccluders.Add(Candidate.Index);
     }
 }
 
-FVector COcclusionCuller::Project(const FVector& WorldPos) const
+void COcclusionCuller::AddOccluder(const FStaticMesh& InStaticMesh, const FMatrix& InWorldMatrix)
 {
-    FVector4 WorldPos4(WorldPos.X, WorldPos.Y, WorldPos.Z, 1.0f);
-    FVector4 ClipPos = WorldPos4 * CurrentViewProj;
+    const FMatrix WorldViewProj = InWorldMatrix * CurrentViewProj;
 
-    if (ClipPos.W != 0.0f)
+    // 정점 변환 (행 벡터 * 행렬을 SSE로)
+    const int32 VertexCount = InStaticMesh.OccluderVertices.Num();
+    ClipVertices.SetNum(VertexCount);
+    for (int32 i = 0; i < VertexCount; ++i)
     {
-        ClipPos.X /= ClipPos.W;
-        ClipPos.Y /= ClipPos.W;
-        ClipPos.Z /= ClipPos.W;
+        const FVector& Position = InStaticMesh.OccluderVertices[i];
+        const __m128 Clip = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Position.X), WorldViewProj.V[0]), _mm_mul_ps(_mm_set1_ps(Position.Y), WorldViewProj.V[1])),
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Position.Z), WorldViewProj.V[2]), WorldViewProj.V[3]));
+        _mm_storeu_ps(&ClipVertices[i].X, Clip);
     }
 
-    // NDC to Screen
-    float ScreenX = (ClipPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
-    float ScreenY = (1.0f - ClipPos.Y) * 0.5f * Z_BUFFER_HEIGHT;
-    float ScreenZ = ClipPos.Z;
-
-    return {ScreenX, ScreenY, ScreenZ};
+    const TArray<uint32>& Indices = InStaticMesh.OccluderIndices;
+    for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+    {
+        AddClippedTriangle(ClipVertices[Indices[i]], ClipVertices[Indices[i + 1]], ClipVertices[Indices[i + 2]]);
+    }
 }
 
-bool COcclusionCuller::IsMeshVisible(const FWorldAABBData& AABBData)
+void COcclusionCuller::AddClippedTriangle(const FVector4& A, const FVector4& B, const FVector4& C)
 {
-    const FVector& WorldMin = AABBData.Min;
-    const FVector& WorldMax = AABBData.Max;
-    const FVector& WorldCenter = AABBData.Center;
-
-    constexpr int32 NumSamples = 19;
-    FVector OriginalSamplesArray[NumSamples];
-    int32 Index = 0; // 배열 인덱스 카운터
-
-    // 1개 중심점
-    OriginalSamplesArray[Index++] = WorldCenter;
-
-    // 6개 면 중심
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMax.Z);
-
-    // 12개 엣지 중심
-    // X 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMax.Z);
-
-    // Y 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMax.Z);
+    // 한 절두체 평면 바깥에 모두 있으면 버린다
+    if ((A.X < -A.W && B.X < -B.W && C.X < -C.W) || (A.X > A.W && B.X > B.W && C.X > C.W)
+        || (A.Y < -A.W && B.Y < -B.W && C.Y < -C.W) || (A.Y > A.W && B.Y > B.W && C.Y > C.W))
+    {
+        return;
+    }
 
-    // Z 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMax.Y, WorldCenter.Z);
+    const FVector4* Input[3] = { &A, &B, &C };
+    const bool bInside[3] = { A.Z >= 0.0f, B.Z >= 0.0f, C.Z >= 0.0f };
+    const int32 InsideCount = bInside[0] + bInside[1] + bInside[2];
+    if (InsideCount == 0)
+    {
+        return;
+    }
+    if (InsideCount == 3)
+    {
+        SetupTriangle(A, B, C);
+        return;
+    }
 
-    // SIMD 배치 처리를 위해 20개로 패딩
-    const int32 BatchCount = (NumSamples + 3) / 4;
+    // near plane 절단 (Sutherland-Hodgman, 평면 하나이므로 결과는 최대 사각형)
+    FVector4 Polygon[4];
+    int32 PolygonCount = 0;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const int32 Next = (i + 1) % 3;
+        if (bInside[i])
+        {
+            Polygon[PolygonCount++] = *Input[i];
+        }
+        if (bInside[i] != bInside[Next])
+        {
+            Polygon[PolygonCount++] = bInside[i]
+                ? IntersectNearPlane(*Input[i], *Input[Next])
+                : IntersectNearPlane(*Input[Next], *Input[i]);
+        }
+    }
 
-    for (int32 i = 0; i < 19; ++i)
+    for (int32 i = 1; i + 1 < PolygonCount; ++i)
     {
-        SampleCoords[0][i] = OriginalSamplesArray[i].X;  // X
-        SampleCoords[1][i] = OriginalSamplesArray[i].Y;  // Y
-        SampleCoords[2][i] = OriginalSamplesArray[i].Z;  // Z
+        SetupTriangle(Polygon[0], Polygon[i], Polygon[i + 1]);
     }
+}
 
-    // 패딩
-    for (int32 i = 19; i < 20; ++i)
+void COcclusionCuller::SetupTriangle(const FVector4& A, const FVector4& B, const FVector4& C)
+{
+    const FVector4* Clip[3] = { &A, &B, &C };
+    float X[3], Y[3], Z[3];
+    for (int32 i = 0; i < 3; ++i)
     {
-        SampleCoords[0][i] = 1e30f;
-        SampleCoords[1][i] = 1e30f;
-        SampleCoords[2][i] = 1e30f;
+        if (Clip[i]->W <= 0.0f)
+        {
+            return;
+        }
+        const float InvW = 1.0f / Clip[i]->W;
+        X[i] = (Clip[i]->X * InvW + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
+        Y[i] = (1.0f - Clip[i]->Y * InvW) * 0.5f * Z_BUFFER_HEIGHT;
+        Z[i] = Clip[i]->Z * InvW;
     }
 
-    constexpr float Z_TOLERANCE = 0.001f;
-    for (int32 BatchIdx = 0; BatchIdx < BatchCount; ++BatchIdx)
+    // 양면 모두 오클루더로 쓴다 (스태틱 메시는 컬링 없이 그려진다)
+    const float DoubleArea = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+    if (std::abs(DoubleArea) < MIN_TRIANGLE_DOUBLE_AREA)
     {
-        BatchProjectionInput Input;
-        Input.WorldX = _mm_load_ps(&SampleCoords[0][BatchIdx * 4]);
-        Input.WorldY = _mm_load_ps(&SampleCoords[1][BatchIdx * 4]);
-        Input.WorldZ = _mm_load_ps(&SampleCoords[2][BatchIdx * 4]);
+        return;
+    }
 
-        BatchProjectionResult ProjectionResult = BatchProject4(Input);
+    // 중심이 삼각형 안에 드는 픽셀 범위 (화면 밖 좌표는 정수로 바꾸기 전에 자른다)
+    const int32 MinPixelX = static_cast<int32>(std::ceil(std::clamp(std::min({ X[0], X[1], X[2] }) - 0.5f, 0.0f, static_cast<float>(Z_BUFFER_WIDTH))));
+    const int32 MaxPixelX = static_cast<int32>(std::floor(std::clamp(std::max({ X[0], X[1], X[2] }) - 0.5f, -1.0f, Z_BUFFER_WIDTH - 1.0f)));
+    const int32 MinPixelY = static_cast<int32>(std::ceil(std::clamp(std::min({ Y[0], Y[1], Y[2] }) - 0.5f, 0.0f, static_cast<float>(Z_BUFFER_HEIGHT))));
+    const int32 MaxPixelY = static_cast<int32>(std::floor(std::clamp(std::max({ Y[0], Y[1], Y[2] }) - 0.5f, -1.0f, Z_BUFFER_HEIGHT - 1.0f)));
+    if (MinPixelX > MaxPixelX || MinPixelY > MaxPixelY)
+    {
+        return;
+    }
 
-        // 멤버 배열에 저장
-        _mm_store_si128((__m128i*)TempPixelCoords[0], ProjectionResult.PixelX);
-        _mm_store_si128((__m128i*)TempPixelCoords[1], ProjectionResult.PixelY);
-        _mm_store_ps(TempScreenZ, ProjectionResult.ScreenZ);
+    FOcclusionTriangle Triangle;
+    const float Sign = DoubleArea > 0.0f ? 1.0f : -1.0f;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const int32 Next = (i + 1) % 3;
+        Triangle.EdgeA[i] = (Y[i] - Y[Next]) * Sign;
+        Triangle.EdgeB[i] = (X[Next] - X[i]) * Sign;
+        Triangle.EdgeC[i] = (X[i] * Y[Next] - X[Next] * Y[i]) * Sign;
+    }
 
-        for (int32 i = 0; i < 4; ++i)
+    const float InvDoubleArea = 1.0f / DoubleArea;
+    Triangle.DepthDx = ((Z[1] - Z[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (Z[2] - Z[0])) * InvDoubleArea;
+    Triangle.DepthDy = ((X[1] - X[0]) * (Z[2] - Z[0]) - (Z[1] - Z[0]) * (X[2] - X[0])) * InvDoubleArea;
+    Triangle.DepthC = Z[0] - Triangle.DepthDx * X[0] - Triangle.DepthDy * Y[0];
+    Triangle.MinDepth = std::min({ Z[0], Z[1], Z[2] });
+    Triangle.MaxDepth = std::max({ Z[0], Z[1], Z[2] });
+    Triangle.MinTileX = MinPixelX / TILE_WIDTH;
+    Triangle.MaxTileX = MaxPixelX / TILE_WIDTH;
+    Triangle.MinTileY = MinPixelY / TILE_HEIGHT;
+    Triangle.MaxTileY = MaxPixelY / TILE_HEIGHT;
+
+    const uint32 TriangleIndex = static_cast<uint32>(Triangles.Num());
+    Triangles.Add(Triangle);
+    ++Stats.TriangleCount;
+
+    for (int32 BinY = Triangle.MinTileY / BIN_TILES_Y; BinY <= Triangle.MaxTileY / BIN_TILES_Y; ++BinY)
+    {
+        for (int32 BinX = Triangle.MinTileX / BIN_TILES_X; BinX <= Triangle.MaxTileX / BIN_TILES_X; ++BinX)
         {
-            int32 SampleIdx = BatchIdx * 4 + i;
-            if (SampleIdx >= 19) break;
-
-            int32 X = TempPixelCoords[0][i];  // PixelX
-            int32 Y = TempPixelCoords[1][i];  // PixelY
+            Bins[BinY * BINS_X + BinX].Add(TriangleIndex);
+            ++Stats.BinnedTriangleCount;
+        }
+    }
+}
 
-            if (X >= 0 && X < Z_BUFFER_WIDTH && Y >= 0 && Y < Z_BUFFER_HEIGHT)
+void COcclusionCuller::RenderOccluders()
+{
+    FScopeCycleCounter RasterCounter;
+    if (bParallelRasterization)
+    {
+        // bin끼리는 타일이 겹치지 않으므로 잠금 없이 병렬 처리
+        FTaskScheduler::GetInstance().ParallelFor(Bins.Num(), 1, [this](int32 Begin, int32 End)
+        {
+            for (int32 BinIndex = Begin; BinIndex < End; ++BinIndex)
             {
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-                if (TempScreenZ[i] < CPU_ZBuffer[Index] + Z_TOLERANCE)
-                {
-                    return true;
-                }
+                RasterizeBin(BinIndex);
             }
+        });
+    }
+    else
+    {
+        for (int32 BinIndex = 0; BinIndex < Bins.Num(); ++BinIndex)
+        {
+            RasterizeBin(BinIndex);
         }
     }
-    return false;
-}
+    Stats.RasterMs = RasterCounter.Finish();
 
-BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput& Input) const
-{
-    // 1. 4개 월드 좌표를 동질 좌표로 변환 (W = 1.0f)
-    __m128 Ones = _mm_set1_ps(1.0f);
-
-    // 2. ViewProjection 행렬 접근
-    const float* MatrixData = (const float*)&CurrentViewProj;
-
-    __m128 Row0 = _mm_load_ps(&MatrixData[0]);
-    __m128 Row1 = _mm_load_ps(&MatrixData[4]);
-    __m128 Row2 = _mm_load_ps(&MatrixData[8]);
-    __m128 Row3 = _mm_load_ps(&MatrixData[12]);
-
-    __m128 ClipX = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x00)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x00))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x00))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x00)));
-
-    __m128 ClipY = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0x55)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0x55))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0x55))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0x55)));
-
-    __m128 ClipZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xAA)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xAA))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xAA))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xAA)));
-
-    __m128 ClipW = _mm_add_ps(_mm_add_ps(_mm_add_ps(
-        _mm_mul_ps(Input.WorldX, _mm_shuffle_ps(Row0, Row0, 0xFF)),
-        _mm_mul_ps(Input.WorldY, _mm_shuffle_ps(Row1, Row1, 0xFF))),
-        _mm_mul_ps(Input.WorldZ, _mm_shuffle_ps(Row2, Row2, 0xFF))),
-        _mm_mul_ps(Ones, _mm_shuffle_ps(Row3, Row3, 0xFF)));
-
-    // -----------------------------------------------------------
-    // 3. Perspective divide 안전성 체크 및 수행
-    // -----------------------------------------------------------
-
-    // 3-1. W > 0 (프러스텀 앞)인 항목만 유효하게 만듦
-    __m128 W_is_positive = _mm_cmpgt_ps(ClipW, _mm_set1_ps(1e-6f)); // W > 0.000001f
-
-    // 3-2. 역수 (InvW) 계산
-    __m128 SafeW = _mm_or_ps(ClipW, _mm_andnot_ps(W_is_positive, Ones));
-    // W > 0이면 ClipW, 아니면 1.0f (0으로 나누는 것을 방지)
-
-    __m128 InvW = _mm_div_ps(Ones, SafeW);
-
-    // 3-3. W <= 0 (Near Plane 뒤)인 항목은 InvW를 0으로 마스킹
-    InvW = _mm_and_ps(InvW, W_is_positive);
-
-    // 역투영
-    ClipX = _mm_mul_ps(ClipX, InvW);
-    ClipY = _mm_mul_ps(ClipY, InvW);
-    ClipZ = _mm_mul_ps(ClipZ, InvW);
-    // W <= 0인 좌표는 ClipX/Y/Z = 0이 되므로, NDC 밖(-1 또는 1)으로 튀어나가지 않음
-
-    // -----------------------------------------------------------
-    // 4. NDC to Screen coordinates (4개 동시)
-    // -----------------------------------------------------------
-    __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
-    __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
-
-    BatchProjectionResult Result;
-    // X: (ClipX + 1.0) * 0.5 * Width
-    Result.ScreenX = _mm_mul_ps(_mm_add_ps(ClipX, Ones), HalfWidth);
-    // Y: (1.0 - ClipY) * 0.5 * Height
-    Result.ScreenY = _mm_mul_ps(_mm_sub_ps(Ones, ClipY), HalfHeight);
-    Result.ScreenZ = ClipZ; // ScreenZ (NDC Z)
-
-    // 5. 정수형 픽셀 좌표로 변환
-    // _mm_cvtps_epi32는 기본적으로 TRUNCATE (버림)을 수행
-    Result.PixelX = _mm_cvtps_epi32(Result.ScreenX);
-    Result.PixelY = _mm_cvtps_epi32(Result.ScreenY);
-
-    return Result;
+    FScopeCycleCounter PyramidCounter;
+    BuildDepthPyramid();
+    Stats.PyramidMs = PyramidCounter.Finish();
 }
 
-void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer)
+void COcclusionCuller::RasterizeBin(int32 BinIndex)
 {
-    // 1. 바운딩 박스 계산
-    int32 MinX = max(0, (int32)min({ P1.X, P2.X, P3.X }));
-    int32 MaxX = min(Z_BUFFER_WIDTH - 1, (int32)max({ P1.X, P2.X, P3.X }));
-    int32 MinY = max(0, (int32)min({ P1.Y, P2.Y, P3.Y }));
-    int32 MaxY = min(Z_BUFFER_HEIGHT - 1, (int32)max({ P1.Y, P2.Y, P3.Y }));
-
-    // 3. 삼각형 면적 계산 (degenerate triangle 체크용)
-    float Area = 0.5f * abs((P2.X - P1.X) * (P3.Y - P1.Y) - (P3.X - P1.X) * (P2.Y - P1.Y));
-    if (Area < 0.001f) { return; }
+    const int32 BinMinTileX = (BinIndex % BINS_X) * BIN_TILES_X;
+    const int32 BinMinTileY = (BinIndex / BINS_X) * BIN_TILES_Y;
+    const int32 BinMaxTileX = std::min(BinMinTileX + BIN_TILES_X, TILES_X) - 1;
+    const int32 BinMaxTileY = std::min(BinMinTileY + BIN_TILES_Y, TILES_Y) - 1;
 
-    // 4. Barycentric 좌표 계산을 위한 분모 미리 계산 (최적화)
-    float Denom1 = (P2.X - P3.X) * (P1.Y - P3.Y) - (P2.Y - P3.Y) * (P1.X - P3.X);
-    float Denom2 = (P3.X - P1.X) * (P2.Y - P1.Y) - (P3.Y - P1.Y) * (P2.X - P1.X);
-
-    // 5. 분모가 0에 가까우면 degenerate triangle
-    if (abs(Denom1) < 0.0001f || abs(Denom2) < 0.0001f) { return; }
+    for (const uint32 TriangleIndex : Bins[BinIndex])
+    {
+        const FOcclusionTriangle& Triangle = Triangles[TriangleIndex];
+        RasterizeTriangle(Triangle,
+            std::max(Triangle.MinTileX, BinMinTileX), std::max(Triangle.MinTileY, BinMinTileY),
+            std::min(Triangle.MaxTileX, BinMaxTileX), std::min(Triangle.MaxTileY, BinMaxTileY));
+    }
+}
 
-    // 6. 역수 미리 계산
-    float InvDenom1 = 1.0f / Denom1;
-    float InvDenom2 = 1.0f / Denom2;
+void COcclusionCuller::RasterizeTriangle(const FOcclusionTriangle& Triangle, int32 MinTileX, int32 MinTileY, int32 MaxTileX, int32 MaxTileY)
+{
+    // 타일 왼쪽 위 픽셀 중심에서 각 열까지의 모서리 함수 증분
+    const __m128 ColumnOffsets0 = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 ColumnOffsets1 = _mm_setr_ps(4.5f, 5.5f, 6.5f, 7.5f);
+    const __m128 Zero = _mm_setzero_ps();
+    __m128 EdgeOffsets0[3];
+    __m128 EdgeOffsets1[3];
+    for (int32 Edge = 0; Edge < 3; ++Edge)
+    {
+        const __m128 EdgeA = _mm_set1_ps(Triangle.EdgeA[Edge]);
+        EdgeOffsets0[Edge] = _mm_mul_ps(EdgeA, ColumnOffsets0);
+        EdgeOffsets1[Edge] = _mm_mul_ps(EdgeA, ColumnOffsets1);
+    }
 
-    // 7. 바운딩 박스 내의 모든 픽셀에 대해 검사
-    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    for (int32 TileY = MinTileY; TileY <= MaxTileY; ++TileY)
     {
-        for (int32 X = MinX; X <= MaxX; ++X)
+        const float TileTop = static_cast<float>(TileY * TILE_HEIGHT);
+        for (int32 TileX = MinTileX; TileX <= MaxTileX; ++TileX)
         {
-            // 픽셀 중심점
-            float PixelX = X + 0.5f;
-            float PixelY = Y + 0.5f;
-
-            // Barycentric coordinates 계산 (최적화된 버전)
-            float W1 = ((P2.X - P3.X) * (PixelY - P3.Y) - (P2.Y - P3.Y) * (PixelX - P3.X)) * InvDenom1;
-            float W2 = ((P3.X - P1.X) * (PixelY - P1.Y) - (P3.Y - P1.Y) * (PixelX - P1.X)) * InvDenom2;
-            float W3 = 1.0f - W1 - W2;
+            const int32 TileIndex = TileY * TILES_X + TileX;
 
-            const float EPSILON = -0.0001f; // 경계 케이스 처리
-            if (W1 >= EPSILON && W2 >= EPSILON && W3 >= EPSILON)
+            // 타일 전체가 이미 이 삼각형보다 가까운 오클루더로 덮여 있음
+            if (Triangle.MinDepth >= TileZMax0[TileIndex])
             {
-                // 깊이값 보간
-                float InterpolatedZ = W1 * P1.Z + W2 * P2.Z + W3 * P3.Z;
-
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
+                continue;
+            }
 
-                // 깊이 테스트 및 업데이트
-                if (InterpolatedZ < ZBuffer[Index])
+            // 1. 8x4 coverage mask (비트 = 행 * 8 + 열)
+            const float TileLeft = static_cast<float>(TileX * TILE_WIDTH);
+            uint32 Coverage = 0;
+            for (int32 Row = 0; Row < TILE_HEIGHT; ++Row)
+            {
+                const float PixelY = TileTop + Row + 0.5f;
+                __m128 Inside0 = _mm_cmpeq_ps(Zero, Zero);
+                __m128 Inside1 = Inside0;
+                for (int32 Edge = 0; Edge < 3; ++Edge)
                 {
-                    ZBuffer[Index] = InterpolatedZ;
+                    const __m128 RowBase = _mm_set1_ps(Triangle.EdgeA[Edge] * TileLeft + Triangle.EdgeB[Edge] * PixelY + Triangle.EdgeC[Edge]);
+                    Inside0 = _mm_and_ps(Inside0, _mm_cmpge_ps(_mm_add_ps(RowBase, EdgeOffsets0[Edge]), Zero));
+                    Inside1 = _mm_and_ps(Inside1, _mm_cmpge_ps(_mm_add_ps(RowBase, EdgeOffsets1[Edge]), Zero));
                 }
+                const uint32 RowMask = static_cast<uint32>(_mm_movemask_ps(Inside0)) | static_cast<uint32>(_mm_movemask_ps(Inside1)) << 4;
+                Coverage |= RowMask << (Row * TILE_WIDTH);
+            }
+            if (Coverage == 0)
+            {
+                continue;
+            }
+
+            // 2. 타일 안에서 삼각형의 최대 깊이 (평면의 최댓값은 타일 모서리 중 하나)
+            float TriangleMaxDepth = Triangle.DepthC
+                + Triangle.DepthDx * (Triangle.DepthDx > 0.0f ? TileLeft + TILE_WIDTH : TileLeft)
+                + Triangle.DepthDy * (Triangle.DepthDy > 0.0f ? TileTop + TILE_HEIGHT : TileTop);
+            TriangleMaxDepth = std::min(TriangleMaxDepth, Triangle.MaxDepth);
+
+            // 3. 두 레이어 갱신. 작업 레이어가 새 삼각형보다 기준 레이어와의 거리보다 더 멀리 떨어져 있으면 버리고 새로 시작한다
+            float& ZMax0 = TileZMax0[TileIndex];
+            float& ZMax1 = TileZMax1[TileIndex];
+            uint32& Mask = TileMasks[TileIndex];
+            if (ZMax1 - TriangleMaxDepth > ZMax0 - ZMax1)
+            {
+                ZMax1 = 0.0f;
+                Mask = 0;
+            }
+            ZMax1 = std::max(ZMax1, TriangleMaxDepth);
+            Mask |= Coverage;
+
+            // 작업 레이어가 타일을 다 덮으면 기준 레이어로 합친다
+            if (Mask == FULL_TILE_MASK)
+            {
+                ZMax0 = std::min(ZMax0, ZMax1);
+                ZMax1 = 0.0f;
+                Mask = 0;
             }
         }
     }
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+void COcclusionCuller::BuildDepthPyramid()
 {
-    Triangles.Empty();
-
-    if (!Prim) { return Triangles; }
-
-    FWorldAABBData& Data = CachedAABBs[Prim->CachedAABBIndex];
-    const FVector& WorldCenter = Data.Center;
-    FVector Extent = (Data.Min - Data.Max) * 0.5f;
-
-    constexpr float OccluderScale = 0.5f;
+    memcpy(DepthPyramid[0].Depth.GetData(), TileZMax0.GetData(), sizeof(float) * TileZMax0.Num());
 
-    FVector WorldMin = WorldCenter - Extent * OccluderScale;
-    FVector WorldMax = WorldCenter + Extent * OccluderScale;
-
-    // AABB의 8개 정점 계산
-    FVector Vertices[8];
-    Vertices[0] = FVector(WorldMin.X, WorldMin.Y, WorldMin.Z); // 000
-    Vertices[1] = FVector(WorldMax.X, WorldMin.Y, WorldMin.Z); // 100
-    Vertices[2] = FVector(WorldMax.X, WorldMax.Y, WorldMin.Z); // 110
-    Vertices[3] = FVector(WorldMin.X, WorldMax.Y, WorldMin.Z); // 010
-    Vertices[4] = FVector(WorldMin.X, WorldMin.Y, WorldMax.Z); // 001
-    Vertices[5] = FVector(WorldMax.X, WorldMin.Y, WorldMax.Z); // 101
-    Vertices[6] = FVector(WorldMax.X, WorldMax.Y, WorldMax.Z); // 111
-    Vertices[7] = FVector(WorldMin.X, WorldMax.Y, WorldMax.Z); // 011
-
-    // Front face (Z = Min)
-    Triangles.Add(Vertices[0]); Triangles.Add(Vertices[1]); Triangles.Add(Vertices[2]);
-    Triangles.Add(Vertices[0]); Triangles.Add(Vertices[2]); Triangles.Add(Vertices[3]);
-
-    // Back face (Z = Max)
-    Triangles.Add(Vertices[5]); Triangles.Add(Vertices[4]); Triangles.Add(Vertices[7]);
-    Triangles.Add(Vertices[5]); Triangles.Add(Vertices[7]); Triangles.Add(Vertices[6]);
-
-    // Left face (X = Min)
-    Triangles.Add(Vertices[4]); Triangles.Add(Vertices[0]); Triangles.Add(Vertices[3]);
-    Triangles.Add(Vertices[4]); Triangles.Add(Vertices[3]); Triangles.Add(Vertices[7]);
+    for (int32 LevelIndex = 1; LevelIndex < DepthPyramid.Num(); ++LevelIndex)
+    {
+        const FDepthPyramidLevel& Source = DepthPyramid[LevelIndex - 1];
+        FDepthPyramidLevel& Level = DepthPyramid[LevelIndex];
+        for (int32 Y = 0; Y < Level.Height; ++Y)
+        {
+            const int32 SourceY0 = Y * 2;
+            const int32 SourceY1 = std::min(SourceY0 + 1, Source.Height - 1);
+            for (int32 X = 0; X < Level.Width; ++X)
+            {
+                const int32 SourceX0 = X * 2;
+                const int32 SourceX1 = std::min(SourceX0 + 1, Source.Width - 1);
+                Level.Depth[Y * Level.Width + X] = std::max(
+                    std::max(Source.Depth[SourceY0 * Source.Width + SourceX0], Source.Depth[SourceY0 * Source.Width + SourceX1]),
+                    std::max(Source.Depth[SourceY1 * Source.Width + SourceX0], Source.Depth[SourceY1 * Source.Width + SourceX1]));
+            }
+        }
+    }
+}
 
-    // Right face (X = Max)
-    Triangles.Add(Vertices[1]); Triangles.Add(Vertices[5]); Triangles.Add(Vertices[6]);
-    Triangles.Add(Vertices[1]); Triangles.Add(Vertices[6]); Triangles.Add(Vertices[2]);
+bool COcclusionCuller::IsOccluded(const FVector& WorldMin, const FVector& WorldMax) const
+{
+    // 1. 8개 꼭짓점을 4개씩 변환
+    const __m128 CornerX = _mm_setr_ps(WorldMin.X, WorldMax.X, WorldMin.X, WorldMax.X);
+    const __m128 CornerY = _mm_setr_ps(WorldMin.Y, WorldMin.Y, WorldMax.Y, WorldMax.Y);
+    __m128 ClipX[2], ClipY[2], ClipZ[2], ClipW[2];
+    TransformPoints4(CurrentViewProj, CornerX, CornerY, _mm_set1_ps(WorldMin.Z), ClipX[0], ClipY[0], ClipZ[0], ClipW[0]);
+    TransformPoints4(CurrentViewProj, CornerX, CornerY, _mm_set1_ps(WorldMax.Z), ClipX[1], ClipY[1], ClipZ[1], ClipW[1]);
+
+    // near plane에 걸치면 화면 사각형을 구할 수 없으므로 보이는 것으로 본다
+    const __m128 Zero = _mm_setzero_ps();
+    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(ClipZ[0], Zero), _mm_cmplt_ps(ClipZ[1], Zero))) != 0)
+    {
+        return false;
+    }
 
-    // Bottom face (Y = Min)
-    Triangles.Add(Vertices[4]); Triangles.Add(Vertices[5]); Triangles.Add(Vertices[1]);
-    Triangles.Add(Vertices[4]); Triangles.Add(Vertices[1]); Triangles.Add(Vertices[0]);
+    // 2. 화면 사각형과 가장 가까운 깊이. 원근 투영의 깊이는 거리에 대해 단조이므로 꼭짓점의 최솟값이 박스의 최솟값이다
+    __m128 MinX = _mm_set1_ps(FLT_MAX), MaxX = _mm_set1_ps(-FLT_MAX);
+    __m128 MinY = MinX, MaxY = MaxX, MinZ = MinX;
+    const __m128 One = _mm_set1_ps(1.0f);
+    const __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
+    const __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
+    for (int32 i = 0; i < 2; ++i)
+    {
+        const __m128 InvW = _mm_div_ps(One, ClipW[i]);
+        const __m128 ScreenX = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ClipX[i], InvW), One), HalfWidth);
+        const __m128 ScreenY = _mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(ClipY[i], InvW)), HalfHeight);
+        MinX = _mm_min_ps(MinX, ScreenX);
+        MaxX = _mm_max_ps(MaxX, ScreenX);
+        MinY = _mm_min_ps(MinY, ScreenY);
+        MaxY = _mm_max_ps(MaxY, ScreenY);
+        MinZ = _mm_min_ps(MinZ, _mm_mul_ps(ClipZ[i], InvW));
+    }
 
-    // Top face (Y = Max)
-    Triangles.Add(Vertices[3]); Triangles.Add(Vertices[2]); Triangles.Add(Vertices[6]);
-    Triangles.Add(Vertices[3]); Triangles.Add(Vertices[6]); Triangles.Add(Vertices[7]);
+    const float RectMinX = HorizontalMin(MinX);
+    const float RectMaxX = HorizontalMax(MaxX);
+    const float RectMinY = HorizontalMin(MinY);
+    const float RectMaxY = HorizontalMax(MaxY);
+    if (RectMaxX < 0.0f || RectMaxY < 0.0f || RectMinX >= Z_BUFFER_WIDTH || RectMinY >= Z_BUFFER_HEIGHT)
+    {
+        return false;
+    }
+    const float NearestDepth = HorizontalMin(MinZ);
+
+    // 3. 사각형이 닿는 타일 범위
+    const int32 MinTileX = static_cast<int32>(std::max(RectMinX, 0.0f)) / TILE_WIDTH;
+    const int32 MaxTileX = static_cast<int32>(std::min(RectMaxX, Z_BUFFER_WIDTH - 1.0f)) / TILE_WIDTH;
+    const int32 MinTileY = static_cast<int32>(std::max(RectMinY, 0.0f)) / TILE_HEIGHT;
+    const int32 MaxTileY = static_cast<int32>(std::min(RectMaxY, Z_BUFFER_HEIGHT - 1.0f)) / TILE_HEIGHT;
+
+    // 4. 한 변이 4칸 이하가 되는 가장 세밀한 피라미드 레벨에서 최대 깊이와 비교
+    int32 LevelIndex = 0;
+    while (LevelIndex + 1 < DepthPyramid.Num()
+        && ((MaxTileX >> LevelIndex) - (MinTileX >> LevelIndex) >= 4 || (MaxTileY >> LevelIndex) - (MinTileY >> LevelIndex) >= 4))
+    {
+        ++LevelIndex;
+    }
 
-    return Triangles;
+    const FDepthPyramidLevel& Level = DepthPyramid[LevelIndex];
+    for (int32 Y = MinTileY >> LevelIndex; Y <= (MaxTileY >> LevelIndex); ++Y)
+    {
+        for (int32 X = MinTileX >> LevelIndex; X <= (MaxTileX >> LevelIndex); ++X)
+        {
+            if (NearestDepth <= Level.Depth[Y * Level.Width + X])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
 }
@@ -1,138 +1,95 @@
 #include "pch.h"
 #include "Optimization/Public/ViewVolumeCuller.h"
+#include "Optimization/Public/MultiViewCuller.h"
 #include "Core/Public/Object.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 
 namespace
 {
-	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
+	// 컬러 객체마다 마스크 배열을 두지 않도록 스레드마다 하나를 재사용한다
+	FMultiViewCuller& GetSharedCuller()
 	{
-		FVector Min, Max;
-		InPrimitive->GetWorldAABB(Min, Max);
-
-		return FAABB(Min, Max);
+		thread_local FMultiViewCuller SharedCuller;
+		return SharedCuller;
 	}
 }
 
-void ViewVolumeCuller::Cull(FOctree* StaticOctree, TArray<UPrimitiveComponent*>& DynamicPrimitives, const FCameraConstants& ViewProjConstants)
+void ViewVolumeCuller::Cull(FOctree* StaticOctree, FDynamicAABBTree* DynamicPrimitiveTree, const FCameraConstants& ViewProjConstants)
 {
-	// 이전의 Cull했던 정보를 지운다.
-	RenderableObjects.Empty();
-	CurrentFrustum.Clear();
-
-	// 1. 절두체 'Key' 생성 
-	FMatrix VP = ViewProjConstants.View * ViewProjConstants.Projection;
-	CurrentFrustum.Planes[0] = VP[3] + VP[0]; // Left
-	CurrentFrustum.Planes[1] = VP[3] - VP[0]; // Right
-	CurrentFrustum.Planes[2] = VP[3] + VP[1]; // Bottom
-	CurrentFrustum.Planes[3] = VP[3] - VP[1]; // Top
-	CurrentFrustum.Planes[4] = VP[2]; // Near
-	CurrentFrustum.Planes[5] = VP[3] - VP[2]; // Far
-
-	for (int i = 0; i < 6; i++)
-	{
-		const float Length = sqrt((CurrentFrustum.Planes[i].X * CurrentFrustum.Planes[i].X) +
-								(CurrentFrustum.Planes[i].Y * CurrentFrustum.Planes[i].Y) +
-								(CurrentFrustum.Planes[i].Z * CurrentFrustum.Planes[i].Z));
-
-		if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return; }
+	ViewVolumeCuller* Self = this;
+	CullViewsInternal(StaticOctree, DynamicPrimitiveTree, &Self, &ViewProjConstants, 1);
+}
 
-		CurrentFrustum.Planes[i] /= -Length;
-	}
+void ViewVolumeCuller::CullViews(FOctree* StaticOctree, FDynamicAABBTree* DynamicPrimitiveTree,
+	const TArray<FCameraConstants>& InViews, TArray<ViewVolumeCuller>& InOutCullers)
+{
+	InOutCullers.SetNum(InViews.Num());
 
-	// 2. 옥트리를 이용해 보이는 객체만 RenderableObjects에 저장한다.
-	if (StaticOctree)
+	TFrameArray<ViewVolumeCuller*> Cullers;
+	Cullers.Reserve(InOutCullers.Num());
+	for (ViewVolumeCuller& Culler : InOutCullers)
 	{
-		CullOctree(StaticOctree);
+		Cullers.Add(&Culler);
 	}
 
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	{
-		if (Primitive != nullptr
-			&& Primitive->IsVisible()
-			&& CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
-		{
-			RenderableObjects.Add(Primitive);
-		}
-	}
+	CullViewsInternal(StaticOctree, DynamicPrimitiveTree, Cullers.GetData(), InViews.GetData(), InViews.Num());
 }
 
-const TArray<UPrimitiveComponent*>& ViewVolumeCuller::GetRenderableObjects() const
+bool ViewVolumeCuller::BuildFrustum(const FCameraConstants& ViewProjConstants, FFrustum& OutFrustum)
 {
-	// Octree에 없는 DynamicPrimitives들 추가
-	//TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-	//for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	//{
-	//	if (Primitive != nullptr && Primitive->IsVisible())
-	//	{
-	//		RenderableObjects.push_back(Primitive);
-	//	}
-	//}
-	return RenderableObjects;
+	return BuildFrustum(ViewProjConstants.View * ViewProjConstants.Projection, OutFrustum);
 }
 
-void ViewVolumeCuller::CullOctree(FOctree* Octree)
+bool ViewVolumeCuller::BuildFrustum(const FMatrix& ViewProjection, FFrustum& OutFrustum)
 {
-	if (!Octree) { return; }
+	OutFrustum.Clear();
 
-	// 0. 탐색할 노드를 추가합니다.
-	TDeque<FOctree*> VisitngNodes;
-	VisitngNodes.push_back(Octree);
+	const FMatrix& VP = ViewProjection;
+	OutFrustum.Planes[0] = VP[3] + VP[0]; // Left
+	OutFrustum.Planes[1] = VP[3] - VP[0]; // Right
+	OutFrustum.Planes[2] = VP[3] + VP[1]; // Bottom
+	OutFrustum.Planes[3] = VP[3] - VP[1]; // Top
+	OutFrustum.Planes[4] = VP[2]; // Near
+	OutFrustum.Planes[5] = VP[3] - VP[2]; // Far
 
-	while (VisitngNodes.empty() == false)
+	for (int i = 0; i < 6; i++)
 	{
-		FOctree* CurrentNode = VisitngNodes.back();
-		VisitngNodes.pop_back();
+		const float Length = sqrt((OutFrustum.Planes[i].X * OutFrustum.Planes[i].X) +
+								(OutFrustum.Planes[i].Y * OutFrustum.Planes[i].Y) +
+								(OutFrustum.Planes[i].Z * OutFrustum.Planes[i].Z));
 
-		// 현재 옥트리 노드(자신)의 경계와 절두체의 관계를 확인합니다.
-		EBoundCheckResult result = CurrentFrustum.CheckIntersection(CurrentNode->GetBoundingBox());
-	
-		// Case 1. 노드가 절두체 밖에 있다면, 즉시 다음 노드로 넘어갑니다. 
-		if (result == EBoundCheckResult::Outside)
-		{
-			continue;
-		}
-		// Case 2. 노드가 절두체 안에 완전히 포함된다면, 전부 포함하고 다음 노드로 넘어갑니다.
-		else if (result == EBoundCheckResult::Inside)
-		{
-			TArray<UPrimitiveComponent*> Primitives;
-			CurrentNode->GetAllPrimitives(Primitives);
-			for (UPrimitiveComponent* Primitive : Primitives)
-			{
-				if (Primitive != nullptr && Primitive->IsVisible())
-				{
-					RenderableObjects.Add(Primitive);
-				}
-			}
-			continue;
-		}
-		// Case 3. 노드가 절두체와 부분적으로 겹쳐진다면, 개별 검사를 합니다.
-		else if (result == EBoundCheckResult::Intersect)
-		{
-			// 노드가 겹치면, 현재 노드에 있는 프리미티브들만 개별적으로 검사합니다.
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
-			{
-				if (Primitive != nullptr
-					&& Primitive->IsVisible()
-					&& CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
-				{
-					RenderableObjects.Add(Primitive);
-				}
-			}
+		if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return false; }
 
-			// 2. 자식 노드들을 탐색 대상에 추가합니다.
-			if (CurrentNode->IsLeafNode() == false)
-			{
-				const TArray<FOctree*>& Children = CurrentNode->GetChildren();
-				for (FOctree* Child : Children)
-				{
-					if (Child != nullptr) { VisitngNodes.push_back(Child); }
-				}
-			}
+		OutFrustum.Planes[i] /= -Length;
+	}
 
-		}
+	return true;
+}
 
+const TArray<UPrimitiveComponent*>& ViewVolumeCuller::GetRenderableObjects() const
+{
+	return RenderableObjects;
+}
+
+void ViewVolumeCuller::CullViewsInternal(FOctree* StaticOctree, FDynamicAABBTree* DynamicPrimitiveTree,
+	ViewVolumeCuller* const* Cullers, const FCameraConstants* Views, int32 ViewCount)
+{
+	// 트리 순회와 SoA 검사는 그림자 뷰와 같은 FMultiViewCuller가 맡고, 결과를 컬러마다 옮겨 담는다
+	FMultiViewCuller& SharedCuller = GetSharedCuller();
+	SharedCuller.Reset();
+	for (int32 ViewIndex = 0; ViewIndex < ViewCount; ++ViewIndex)
+	{
+		SharedCuller.AddView(Views[ViewIndex].View * Views[ViewIndex].Projection);
 	}
+	SharedCuller.Cull(StaticOctree, DynamicPrimitiveTree);
 
-}
\ No newline at end of file
+	for (int32 ViewIndex = 0; ViewIndex < ViewCount; ++ViewIndex)
+	{
+		ViewVolumeCuller* Culler = Cullers[ViewIndex];
+		Culler->RenderableObjects.Empty();
+		SharedCuller.GetVisiblePrimitives(ViewIndex, Culler->RenderableObjects);
+		Culler->Stats = SharedCuller.GetStats(ViewIndex);
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+/**
+ * @brief 절두체 평면 여섯 개를 박스 4개에 적용할 수 있도록 성분마다 브로드캐스트한 값
+ * @note FMultiViewCuller가 FBoundsSoA를 4개씩 검사할 때 쓴다
+ */
+struct FFrustumSIMD
+{
+	__m128 X[6];
+	__m128 Y[6];
+	__m128 Z[6];
+	__m128 W[6];
+	__m128 AbsX[6];
+	__m128 AbsY[6];
+	__m128 AbsZ[6];
+};
+
+inline void BroadcastFrustum(const FFrustum& InFrustum, FFrustumSIMD& OutFrustum)
+{
+	for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const FVector4& Plane = InFrustum.Planes[PlaneIndex];
+		OutFrustum.X[PlaneIndex] = _mm_set1_ps(Plane.X);
+		OutFrustum.Y[PlaneIndex] = _mm_set1_ps(Plane.Y);
+		OutFrustum.Z[PlaneIndex] = _mm_set1_ps(Plane.Z);
+		OutFrustum.W[PlaneIndex] = _mm_set1_ps(Plane.W);
+		OutFrustum.AbsX[PlaneIndex] = _mm_set1_ps(std::fabs(Plane.X));
+		OutFrustum.AbsY[PlaneIndex] = _mm_set1_ps(std::fabs(Plane.Y));
+		OutFrustum.AbsZ[PlaneIndex] = _mm_set1_ps(std::fabs(Plane.Z));
+	}
+}
+
+/**
+ * @brief 박스 4개를 여섯 평면에 대해 검사해 완전히 바깥에 있는 박스의 비트 마스크를 반환
+ * @note 평면까지의 거리 D = N·C + W, 박스의 투영 반경 R = |N|·E 이고, D - R > 0이면 가장 안쪽 꼭짓점도 바깥이다.
+ *       FFrustum::CheckIntersection이 Outside를 반환하는 조건과 같다.
+ */
+inline int32 TestOutside4(const FFrustumSIMD& Frustum,
+	__m128 CenterX, __m128 CenterY, __m128 CenterZ, __m128 ExtentX, __m128 ExtentY, __m128 ExtentZ)
+{
+	const __m128 Zero = _mm_setzero_ps();
+	__m128 Outside = _mm_setzero_ps();
+	for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		const __m128 Distance = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(Frustum.X[PlaneIndex], CenterX), _mm_mul_ps(Frustum.Y[PlaneIndex], CenterY)),
+			_mm_add_ps(_mm_mul_ps(Frustum.Z[PlaneIndex], CenterZ), Frustum.W[PlaneIndex]));
+		const __m128 Radius = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(Frustum.AbsX[PlaneIndex], ExtentX), _mm_mul_ps(Frustum.AbsY[PlaneIndex], ExtentY)),
+			_mm_mul_ps(Frustum.AbsZ[PlaneIndex], ExtentZ));
+		Outside = _mm_or_ps(Outside, _mm_cmpgt_ps(_mm_sub_ps(Distance, Radius), Zero));
+	}
+	return _mm_movemask_ps(Outside);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <bit>
+
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+class FOctree;
+class FDynamicAABBTree;
+
+constexpr int32 MAX_SHARED_CULL_VIEWS = 32; // 트리 한 번의 순회에서 함께 분류하는 뷰 수 (uint32 뷰 마스크)
+
+/**
+ * @brief 여러 절두체(에디터 카메라, 그림자 캐스케이드, 스팟 라이트, 포인트 라이트의 각 면)를 한 번에 컬링하는 서비스
+ * @note 옥트리와 동적 AABB 트리를 뷰마다 따로 순회하지 않고, 노드마다 뷰 비트 마스크를 좁혀 가며 한 번만 순회한다.
+ *       그 뒤 SoA AABB 풀을 한 번 훑으며 박스 4개씩 남은 뷰의 평면을 검사하고, 결과를 뷰마다 슬롯 비트셋으로 기록한다.
+ *       슬롯은 옥트리 원소 인덱스, 그 뒤에 동적 트리의 proxy ID 순서이다.
+ *       MAX_SHARED_CULL_VIEWS보다 많은 뷰는 그 수만큼씩 나누어 순회한다.
+ */
+class FMultiViewCuller
+{
+public:
+	//@brief 등록된 뷰와 결과를 비운다 (할당한 메모리는 재사용)
+	void Reset();
+
+	/**
+	 * @brief 절두체를 View * Projection 행렬로 등록
+	 * @return 뷰 인덱스. 행렬이 퇴화했으면 아무것도 보이지 않는 뷰가 된다
+	 */
+	int32 AddView(const FMatrix& InViewProjection);
+	int32 GetViewCount() const { return Frustums.Num(); }
+
+	//@brief 등록된 모든 뷰를 컬링. 숨겨진(IsVisible이 false인) 프리미티브는 어떤 뷰에서도 보이지 않는다
+	void Cull(FOctree* StaticOctree, FDynamicAABBTree* DynamicPrimitiveTree);
+
+	bool IsSlotVisible(int32 ViewIndex, int32 SlotIndex) const
+	{
+		return (VisibilityBits[ViewIndex * WordsPerView + SlotIndex / 64] >> (SlotIndex % 64)) & 1;
+	}
+
+	//@brief 뷰에서 보이는 프리미티브마다 Function(UPrimitiveComponent*) 호출 (슬롯 순서)
+	template <typename FunctionType>
+	void ForEachVisible(int32 ViewIndex, FunctionType&& Function) const;
+
+	void GetVisiblePrimitives(int32 ViewIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	const FViewCullingStats& GetStats(int32 ViewIndex) const { return Stats[ViewIndex]; }
+
+private:
+	void CullViewGroup(int32 FirstView, int32 ViewCount);
+	UPrimitiveComponent* GetSlotPrimitive(int32 SlotIndex) const;
+
+	TArray<FFrustum> Frustums;
+	TArray<uint8> bValidFrustums;
+	TArray<FViewCullingStats> Stats;
+
+	FOctree* StaticOctree = nullptr;
+	FDynamicAABBTree* DynamicPrimitiveTree = nullptr;
+	int32 StaticSlotCount = 0;     // 옥트리 SoA 풀 크기 (4의 배수)
+	int32 SlotCount = 0;
+
+	// 뷰마다 WordsPerView개의 uint64가 이어진 슬롯 비트셋
+	TArray<uint64> VisibilityBits;
+	int32 WordsPerView = 0;
+
+	// 슬롯마다 개별 검사가 필요한 뷰 / 노드가 통과시킨 뷰 (순회마다 재사용)
+	TArray<uint32> StaticTestMasks;
+	TArray<uint32> StaticAcceptMasks;
+	TArray<uint32> DynamicTestMasks;
+	TArray<uint32> DynamicAcceptMasks;
+};
+
+template <typename FunctionType>
+void FMultiViewCuller::ForEachVisible(int32 ViewIndex, FunctionType&& Function) const
+{
+	const uint64* Words = VisibilityBits.GetData() + ViewIndex * WordsPerView;
+	for (int32 WordIndex = 0; WordIndex < WordsPerView; ++WordIndex)
+	{
+		for (uint64 Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
+		{
+			Function(GetSlotPrimitive(WordIndex * 64 + std::countr_zero(Word)));
+		}
+	}
+}
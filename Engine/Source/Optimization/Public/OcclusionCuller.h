@@ -1,10 +1,60 @@
 ﻿#pragma once
 
+class UPrimitiveComponent;
+struct FStaticMesh;
+
 /**
- * @brief Occlusion Culling 을 담당하는 클래스
+ * @brief 래스터라이즈할 오클루더 삼각형 (화면 픽셀 좌표, 앞뒷면과 관계없이 안쪽에서 모서리 함수가 0 이상)
  */
-class UPrimitiveComponent;
+struct FOcclusionTriangle
+{
+    float EdgeA[3];
+    float EdgeB[3];
+    float EdgeC[3];     // 모서리 함수 E(x, y) = A * x + B * y + C
+    float DepthDx;
+    float DepthDy;
+    float DepthC;       // 깊이 평면 z(x, y) = Dx * x + Dy * y + C (NDC 깊이)
+    float MinDepth;
+    float MaxDepth;
+    int32 MinTileX;
+    int32 MinTileY;
+    int32 MaxTileX;
+    int32 MaxTileY;
+};
+
+/**
+ * @brief 마지막 PerformCulling의 통계
+ */
+struct FOcclusionCullingStats
+{
+    int32 OccluderCount = 0;
+    int32 TriangleCount = 0;        // near plane 절단 후 화면에 걸친 삼각형 수
+    int32 BinnedTriangleCount = 0;  // bin에 담긴 횟수 (여러 bin에 걸친 삼각형은 중복)
+    int32 TestedCount = 0;
+    int32 OccludedCount = 0;
+    double SetupMs = 0.0;           // 오클루더 선택, 변환, 절단, binning
+    double RasterMs = 0.0;
+    double PyramidMs = 0.0;
+    double TestMs = 0.0;
+};
+
+struct FWorldAABBData
+{
+    UPrimitiveComponent* Prim;
+    FVector Min;
+    FVector Max;
+    FVector Center; // 자주 사용되는 Center 값도 저장하여 계산 오버헤드 제거
+};
 
+/**
+ * @brief Masked Occlusion Culling 방식의 CPU 오클루전 컬러 (Hasselgren et al. 2016)
+ *
+ * - 깊이 버퍼는 8x4 픽셀 타일마다 32비트 coverage mask와 깊이 두 개만 가진다.
+ *   ZMax0는 타일 전체를 덮는 오클루더의 최대 깊이, ZMax1과 mask는 아직 타일을 다 덮지 못한 작업 레이어이다.
+ * - 오클루더는 쿠킹 시 만든 단순화 메시(FStaticMesh::OccluderVertices/OccluderIndices)이며, near plane에서 잘라
+ *   화면 bin에 나눠 담은 뒤 bin마다 병렬로 래스터라이즈한다. 타일마다 삼각형 순서가 같으므로 결과는 스레드 수와 무관하다.
+ * - 가려짐 검사는 AABB의 화면 사각형과 가장 가까운 깊이를 타일 최대 깊이 피라미드와 비교한다. (보수적)
+ */
 class COcclusionCuller
 {
 public:
@@ -18,83 +68,95 @@ public:
 
      /**
      * @brief 오클루전 컬링의 전체 프로세스를 실행하고 최종 가시 오브젝트 목록을 반환
-     * @param AllStaticMeshes 프러스텀 컬링을 통과한 모든 스태틱 메시 목록
+     * @param AllPrimitives 프러스텀 컬링을 통과한 프리미티브 목록. 메시 컴포넌트만 가려짐을 검사한다
      * @param CameraPos 현재 카메라 위치
-     * @return 렌더링되어야 할 UPrimitiveComponent 목록
+     * @return 렌더링되어야 할 UPrimitiveComponent 목록 (다음 PerformCulling까지 유효)
      */
-    TArray<UPrimitiveComponent*> PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
-
-    // Constants
-    static constexpr int Z_BUFFER_WIDTH = 256;
-    static constexpr int Z_BUFFER_HEIGHT = 256;
-    static constexpr int Z_BUFFER_SIZE = Z_BUFFER_WIDTH * Z_BUFFER_HEIGHT;
+    const TArray<UPrimitiveComponent*>& PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos);
 
-private:
     /**
-    * @brief 카메라에서 과도하게 가까운 애들 제외
-    * @param AllCandidates 가까운 곳의 Occluders 후보
-    * @return 오클루더로 선정된 UPrimitiveComponent 목록
-    */
-    TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
-
-    void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
+     * @brief 오클루더 메시를 clip space로 변환하고 near plane에서 잘라 화면 bin에 담는다
+     */
+    void AddOccluder(const FStaticMesh& InStaticMesh, const FMatrix& InWorldMatrix);
 
     /**
-     * @brief World Pos > Clip Space > Screen Coordinate
-     * @return 스크린 좌표 (X, Y)와 NDC Depth (Z)를 담은 FVector
+     * @brief bin에 담긴 삼각형을 타일 버퍼에 래스터라이즈하고 깊이 피라미드를 만든다
      */
-    FVector Project(const FVector& WorldPos) const;
+    void RenderOccluders();
 
     /**
-     * @brief 해당 메시 컴포넌트가 Z-Buffer에 의해 가려지는지 테스트합니다.
-     * @return 바운딩 박스의 코너 중 하나라도 보이면 true를 반환합니다.
+     * @brief 월드 AABB가 오클루더에 완전히 가려지는지 검사
+     * @return near plane에 걸치거나 화면 밖이면 false
      */
-    bool IsMeshVisible(const struct FWorldAABBData& AABBData);
+    bool IsOccluded(const FVector& WorldMin, const FVector& WorldMax) const;
+
+    void SetParallelRasterization(bool bInParallel) { bParallelRasterization = bInParallel; }
+    const FOcclusionCullingStats& GetStats() const { return Stats; }
+    const TArray<FOcclusionTriangle>& GetTriangles() const { return Triangles; }
+    // 타일마다 ZMax0 (TILES_X x TILES_Y)
+    const TArray<float>& GetTileDepths() const { return TileZMax0; }
 
-    struct BatchProjectionResult BatchProject4(const struct BatchProjectionInput& Input) const;
+    // Constants
+    static constexpr int Z_BUFFER_WIDTH = 320;
+    static constexpr int Z_BUFFER_HEIGHT = 192;
+    static constexpr int TILE_WIDTH = 8;
+    static constexpr int TILE_HEIGHT = 4;
+    static constexpr int TILES_X = Z_BUFFER_WIDTH / TILE_WIDTH;
+    static constexpr int TILES_Y = Z_BUFFER_HEIGHT / TILE_HEIGHT;
+    static constexpr int BIN_TILES_X = 8;  // bin 하나는 8x8 타일 (64x32 픽셀)
+    static constexpr int BIN_TILES_Y = 8;
+    static constexpr int BINS_X = (TILES_X + BIN_TILES_X - 1) / BIN_TILES_X;
+    static constexpr int BINS_Y = (TILES_Y + BIN_TILES_Y - 1) / BIN_TILES_Y;
+
+    static constexpr int MAX_OCCLUDERS = 64;
+    static constexpr int MAX_OCCLUDER_TRIANGLES = 32768;
+    static constexpr float OCCLUDER_MIN_SCREEN_SIZE = 0.1f;  // 바운딩 구 반경 / 거리
 
+private:
+    // 선택한 오클루더 목록. 최대 MAX_OCCLUDERS개이므로 힙을 쓰지 않는다
+    using FOccluderIndexArray = TArray<int32, TInlineAllocator<MAX_OCCLUDERS>>;
 
     /**
-     * @brief CPU Z-Buffer에 삼각형을 래스터라이징, 깊이 테스트 수행
-     */
-    void RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer);
+    * @brief 화면에서 크게 보이는 오클루더를 고르고 앞에서 뒤 순서로 정렬
+    * @param OutOccluders CachedAABBs의 인덱스 목록
+    */
+    void SelectOccluders(const FVector& CameraPos, FOccluderIndexArray& OutOccluders) const;
+
+    // 절단된 clip space 삼각형을 화면 삼각형으로 만들어 bin에 담는다
+    void AddClippedTriangle(const FVector4& A, const FVector4& B, const FVector4& C);
+    void SetupTriangle(const FVector4& A, const FVector4& B, const FVector4& C);
+
+    void RasterizeBin(int32 BinIndex);
 
     /**
-     * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
+     * @brief 삼각형을 타일 범위 안에서 래스터라이즈 (SSE로 한 행 8픽셀의 모서리 함수를 계산)
      */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
+    void RasterizeTriangle(const FOcclusionTriangle& Triangle, int32 MinTileX, int32 MinTileY, int32 MaxTileX, int32 MaxTileY);
+
+    void BuildDepthPyramid();
 
-    TArray<float> CPU_ZBuffer;
     FMatrix CurrentViewProj;
 
-    TArray<struct FWorldAABBData> CachedAABBs;
-    TArray<FVector> Triangles;
-    TArray<UPrimitiveComponent*> FilteredOccluders;    
-    TArray<UPrimitiveComponent*> VisibleMeshComponents;
-    uint32 Frame = 0;
+    // 타일 버퍼 (SoA)
+    TArray<float> TileZMax0;
+    TArray<float> TileZMax1;
+    TArray<uint32> TileMasks;
 
-    // For SIMD
-    alignas(16) float SampleCoords[3][20];     // [0]=X, [1]=Y, [2]=Z
-    alignas(16) int32 TempPixelCoords[2][4];   // [0]=X, [1]=Y  
-    alignas(16) float TempScreenZ[4];
-};
+    struct FDepthPyramidLevel
+    {
+        int32 Width = 0;
+        int32 Height = 0;
+        TArray<float> Depth;
+    };
+    TArray<FDepthPyramidLevel> DepthPyramid;  // [0]은 타일 해상도, 위로 갈수록 2x2 최댓값
 
-struct FWorldAABBData
-{
-    UPrimitiveComponent* Prim;
-    FVector Min;
-    FVector Max;
-    FVector Center; // 자주 사용되는 Center 값도 저장하여 계산 오버헤드 제거
-};
+    TArray<FOcclusionTriangle> Triangles;
+    TArray<TArray<uint32>> Bins;              // bin마다 Triangles 인덱스 (추가된 순서)
+    TArray<FVector4> ClipVertices;
 
-struct alignas(16) BatchProjectionInput
-{
-    __m128 WorldX, WorldY, WorldZ; // 4개 점의 X, Y, Z 좌표
-};
+    TArray<FWorldAABBData> CachedAABBs;
+    TArray<UPrimitiveComponent*> VisibleMeshComponents;
 
-struct alignas(16) BatchProjectionResult
-{
-    __m128 ScreenX, ScreenY, ScreenZ; // 4개 점의 스크린 좌표
-    __m128i PixelX, PixelY;          // 정수형 픽셀 좌표
-    __m128 InBoundsMask;             // 화면 경계 내부 마스크
+    FOcclusionCullingStats Stats;
+    bool bParallelRasterization = true;
 };
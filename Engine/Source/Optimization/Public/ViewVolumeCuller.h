@@ -4,6 +4,7 @@
 #include "Physics/Public/AABB.h"
 
 class FOctree;
+class FDynamicAABBTree;
 
 enum class EBoundCheckResult
 {
@@ -24,29 +25,29 @@ struct FFrustum
         {
             const FVector4& P = Planes[i];
 
-            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
-            FVector PositiveVertex(
-                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
-                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
-                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
+            // negative vertex: 법선 반대 방향으로 가장 먼 꼭짓점
+            FVector NegativeVertex(
+                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
+                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
+                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
             );
 
-            if (P.Dot3(PositiveVertex) + P.W > 0)
+            if (P.Dot3(NegativeVertex) + P.W > 0)
             {
-                // 박스가 평면 바깥(+측)으로 완전히 나감
+                // 가장 안쪽 꼭짓점까지 평면 바깥(+측)이면 박스가 완전히 나감
                 return EBoundCheckResult::Outside;
             }
 
-            // negative vertex: 반대쪽 꼭짓점
-            FVector NegativeVertex(
-                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
-                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
-                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
+            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
+            FVector PositiveVertex(
+                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
+                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
+                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
             );
 
-            if (P.Dot3(NegativeVertex) + P.W < 0)
+            if (P.Dot3(PositiveVertex) + P.W < 0)
             {
-                // 박스가 평면 안쪽(-측)으로 완전히 들어옴 → 계속 검사
+                // 가장 바깥 꼭짓점까지 평면 안쪽(-측)이면 박스가 완전히 들어옴 → 계속 검사
                 continue;
             }
 
@@ -61,6 +62,23 @@ struct FFrustum
     void Clear() { for (int i = 0; i < 6; ++i) { Planes[i] = FVector4::Zero(); }; }
 };
 
+/**
+ * @brief 뷰 하나의 절두체 컬링 통계 (Cull 호출마다 갱신)
+ */
+struct FViewCullingStats
+{
+    int32 NodeTestCount = 0;        // 옥트리/동적 트리 노드의 절두체 검사 수
+    int32 BoxTestCount = 0;         // 노드가 부분적으로 겹쳐 SIMD로 개별 검사한 프리미티브 수
+    int32 AcceptedByNodeCount = 0;  // 노드가 절두체 안에 완전히 들어가 개별 검사 없이 통과한 프리미티브 수
+    int32 VisibleCount = 0;
+    int32 CulledCount = 0;          // 등록된 프리미티브 중 절두체 밖이거나 숨겨져 제외된 수
+};
+
+/**
+ * @brief 옥트리와 동적 AABB 트리의 노드로 큰 영역을 가지치기한 뒤, 트리가 유지하는 SoA AABB 풀을
+ *        순서대로 훑으며 박스 4개씩 SSE로 여섯 평면을 검사하는 절두체 컬러
+ * @note 순회와 검사는 FMultiViewCuller가 하고, 이 클래스는 뷰 하나의 결과(보이는 프리미티브 목록과 통계)를 보관한다.
+ */
 class ViewVolumeCuller
 {
 public:
@@ -71,14 +89,31 @@ public:
 
 	void Cull(
         FOctree* StaticOctree,
-        TArray<UPrimitiveComponent*>& DynamicPrimitives,
+        FDynamicAABBTree* DynamicPrimitiveTree,
 		const FCameraConstants& ViewProjConstants
 	);
 
+	/**
+	 * @brief 여러 뷰(에디터 뷰포트, 그림자 캐스케이드 등)를 한 번에 컬링. 트리를 한 번 순회하고 SoA 풀의 각 묶음을 한 번 읽어 모든 뷰의 평면을 검사한다.
+	 * @param InOutCullers InViews와 같은 수로 맞춰지며, i번째 컬러가 i번째 뷰의 결과와 통계를 가진다
+	 */
+	static void CullViews(
+		FOctree* StaticOctree,
+		FDynamicAABBTree* DynamicPrimitiveTree,
+		const TArray<FCameraConstants>& InViews,
+		TArray<ViewVolumeCuller>& InOutCullers
+	);
+
+	//@brief View * Projection에서 정규화된 여섯 평면을 추출. 평면 안쪽이 음수이다. 행렬이 퇴화했으면 false
+	static bool BuildFrustum(const FCameraConstants& ViewProjConstants, FFrustum& OutFrustum);
+	static bool BuildFrustum(const FMatrix& ViewProjection, FFrustum& OutFrustum);
+
 	const TArray<UPrimitiveComponent*>& GetRenderableObjects() const;
+	const FViewCullingStats& GetStats() const { return Stats; }
 private:
-    void CullOctree(FOctree* Octree);
+	static void CullViewsInternal(FOctree* StaticOctree, FDynamicAABBTree* DynamicPrimitiveTree,
+		ViewVolumeCuller* const* Cullers, const FCameraConstants* Views, int32 ViewCount);
 
-    FFrustum CurrentFrustum{};
     TArray<UPrimitiveComponent*> RenderableObjects{};
+    FViewCullingStats Stats{};
 };
\ No newline at end of file
@@ -0,0 +1,396 @@
+#include "pch.h"
+#include "Physics/Public/OverlapBroadphase.h"
+#include "Component/Public/PrimitiveComponent.h"
+
+namespace
+{
+	constexpr float REMOVED_ENDPOINT_VALUE = std::numeric_limits<float>::infinity();
+
+	void GetBoundsAxisValues(const FBounds& InBounds, float OutMin[3], float OutMax[3])
+	{
+		OutMin[0] = InBounds.Min.X; OutMin[1] = InBounds.Min.Y; OutMin[2] = InBounds.Min.Z;
+		OutMax[0] = InBounds.Max.X; OutMax[1] = InBounds.Max.Y; OutMax[2] = InBounds.Max.Z;
+	}
+}
+
+int32 FOverlapBroadphase::CreateProxy(UPrimitiveComponent* InPrimitive, const FBounds& InBounds)
+{
+	int32 ProxyIndex;
+	if (FreeProxyHead >= 0)
+	{
+		ProxyIndex = FreeProxyHead;
+		FreeProxyHead = Proxies[ProxyIndex].NextFree;
+		Proxies[ProxyIndex] = FBroadphaseProxy();
+	}
+	else
+	{
+		ProxyIndex = Proxies.Add(FBroadphaseProxy());
+	}
+	++ProxyCount;
+
+	FBroadphaseProxy& Proxy = Proxies[ProxyIndex];
+	Proxy.Primitive = InPrimitive;
+	Proxy.Owner = InPrimitive->GetOwner();
+
+	float MinValues[3], MaxValues[3];
+	GetBoundsAxisValues(InBounds, MinValues, MaxValues);
+
+	// 끝점을 각 축 배열의 끝에 추가한 뒤 제자리까지 내려 보낸다
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const uint32 Data = static_cast<uint32>(ProxyIndex) << 1;
+		Proxy.MinEndpoint[Axis] = Endpoints[Axis].Add({ MinValues[Axis], Data });
+		Proxy.MaxEndpoint[Axis] = Endpoints[Axis].Add({ MaxValues[Axis], Data | 1 });
+	}
+
+	// 앞의 두 축이 제자리를 찾은 뒤 마지막 축에서만 pair를 갱신하면 2축 검사가 정확하다
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const bool bUpdatePairs = (Axis == 2);
+		SortMinDown(Axis, Proxies[ProxyIndex].MinEndpoint[Axis], bUpdatePairs);
+		SortMaxDown(Axis, Proxies[ProxyIndex].MaxEndpoint[Axis], bUpdatePairs);
+	}
+
+	MarkProxyMoved(ProxyIndex);
+	return ProxyIndex;
+}
+
+void FOverlapBroadphase::DestroyProxy(int32 ProxyIndex, TArray<UPrimitiveComponent*>& OutOverlappingPrimitives)
+{
+	assert(ProxyIndex >= 0 && ProxyIndex < Proxies.Num() && Proxies[ProxyIndex].Primitive);
+
+	// 끝점을 배열 끝으로 보낸다. 0번 축에서 Min이 다른 proxy의 Max를 모두 지나므로 모든 pair가 제거된다.
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+
+		AxisEndpoints[Proxies[ProxyIndex].MaxEndpoint[Axis]].Value = REMOVED_ENDPOINT_VALUE;
+		SortMaxUp(Axis, Proxies[ProxyIndex].MaxEndpoint[Axis], false);
+
+		AxisEndpoints[Proxies[ProxyIndex].MinEndpoint[Axis]].Value = REMOVED_ENDPOINT_VALUE;
+		SortMinUp(Axis, Proxies[ProxyIndex].MinEndpoint[Axis], Axis == 0);
+
+		assert(Proxies[ProxyIndex].MaxEndpoint[Axis] == AxisEndpoints.Num() - 1);
+		assert(Proxies[ProxyIndex].MinEndpoint[Axis] == AxisEndpoints.Num() - 2);
+		AxisEndpoints.Pop();
+		AxisEndpoints.Pop();
+	}
+
+	// 방금 제거된 pair와 아직 EndOverlap이 처리되지 않은 pair의 상대를 돌려준다
+	for (int32 Index = EndedPairs.Num() - 1; Index >= 0; --Index)
+	{
+		const FBroadphasePair& Pair = EndedPairs[Index];
+		if (Pair.ProxyA == ProxyIndex || Pair.ProxyB == ProxyIndex)
+		{
+			const int32 OtherProxy = (Pair.ProxyA == ProxyIndex) ? Pair.ProxyB : Pair.ProxyA;
+			OutOverlappingPrimitives.Add(Proxies[OtherProxy].Primitive);
+			EndedPairs.RemoveAtSwap(Index);
+		}
+	}
+
+	if (Proxies[ProxyIndex].bMoved)
+	{
+		MovedProxies.RemoveSwap(ProxyIndex);
+	}
+
+	Proxies[ProxyIndex] = FBroadphaseProxy();
+	Proxies[ProxyIndex].NextFree = FreeProxyHead;
+	FreeProxyHead = ProxyIndex;
+	--ProxyCount;
+}
+
+void FOverlapBroadphase::MarkProxyMoved(int32 ProxyIndex)
+{
+	FBroadphaseProxy& Proxy = Proxies[ProxyIndex];
+	if (!Proxy.bMoved)
+	{
+		Proxy.bMoved = true;
+		MovedProxies.Add(ProxyIndex);
+	}
+}
+
+void FOverlapBroadphase::UpdateProxy(int32 ProxyIndex, const FBounds& InBounds)
+{
+	float MinValues[3], MaxValues[3];
+	GetBoundsAxisValues(InBounds, MinValues, MaxValues);
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+		FSweepEndpoint& MinEndpoint = AxisEndpoints[Proxies[ProxyIndex].MinEndpoint[Axis]];
+		FSweepEndpoint& MaxEndpoint = AxisEndpoints[Proxies[ProxyIndex].MaxEndpoint[Axis]];
+
+		const float OldMin = MinEndpoint.Value;
+		const float OldMax = MaxEndpoint.Value;
+		MinEndpoint.Value = MinValues[Axis];
+		MaxEndpoint.Value = MaxValues[Axis];
+
+		// 커지는 방향(pair 추가)을 먼저, 줄어드는 방향(pair 제거)을 나중에 처리
+		if (MinValues[Axis] < OldMin)
+		{
+			SortMinDown(Axis, Proxies[ProxyIndex].MinEndpoint[Axis], true);
+		}
+		if (MaxValues[Axis] > OldMax)
+		{
+			SortMaxUp(Axis, Proxies[ProxyIndex].MaxEndpoint[Axis], true);
+		}
+		if (MinValues[Axis] > OldMin)
+		{
+			SortMinUp(Axis, Proxies[ProxyIndex].MinEndpoint[Axis], true);
+		}
+		if (MaxValues[Axis] < OldMax)
+		{
+			SortMaxDown(Axis, Proxies[ProxyIndex].MaxEndpoint[Axis], true);
+		}
+	}
+}
+
+void FOverlapBroadphase::ClearMovedProxies()
+{
+	for (int32 ProxyIndex : MovedProxies)
+	{
+		Proxies[ProxyIndex].bMoved = false;
+	}
+	MovedProxies.Empty();
+}
+
+void FOverlapBroadphase::Clear()
+{
+	Proxies.Empty();
+	FreeProxyHead = -1;
+	ProxyCount = 0;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Endpoints[Axis].Empty();
+	}
+	Pairs.Empty();
+	PairLookup.Empty();
+	EndedPairs.Empty();
+	MovedProxies.Empty();
+}
+
+bool FOverlapBroadphase::CheckValidity() const
+{
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+		if (AxisEndpoints.Num() != ProxyCount * 2)
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < AxisEndpoints.Num(); ++Index)
+		{
+			if (Index > 0 && AxisEndpoints[Index - 1].Value > AxisEndpoints[Index].Value)
+			{
+				return false;
+			}
+
+			const FBroadphaseProxy& Proxy = Proxies[AxisEndpoints[Index].GetProxyIndex()];
+			const int32 BackReference = AxisEndpoints[Index].IsMax() ? Proxy.MaxEndpoint[Axis] : Proxy.MinEndpoint[Axis];
+			if (BackReference != Index)
+			{
+				return false;
+			}
+		}
+	}
+
+	// 끝점 순서 기준의 전수 검사 결과와 pair cache 비교
+	int32 ExpectedPairCount = 0;
+	for (int32 ProxyA = 0; ProxyA < Proxies.Num(); ++ProxyA)
+	{
+		if (!Proxies[ProxyA].Primitive)
+		{
+			continue;
+		}
+
+		for (int32 ProxyB = ProxyA + 1; ProxyB < Proxies.Num(); ++ProxyB)
+		{
+			if (!Proxies[ProxyB].Primitive || Proxies[ProxyA].Owner == Proxies[ProxyB].Owner)
+			{
+				continue;
+			}
+
+			const bool bOverlapping = TestOverlapOtherAxes(0, ProxyA, ProxyB) &&
+				Proxies[ProxyA].MinEndpoint[0] < Proxies[ProxyB].MaxEndpoint[0] &&
+				Proxies[ProxyB].MinEndpoint[0] < Proxies[ProxyA].MaxEndpoint[0];
+			if (bOverlapping != PairLookup.Contains(MakePairKey(ProxyA, ProxyB)))
+			{
+				return false;
+			}
+			ExpectedPairCount += bOverlapping ? 1 : 0;
+		}
+	}
+
+	return ExpectedPairCount == Pairs.Num() && Pairs.Num() == PairLookup.Num();
+}
+
+uint64 FOverlapBroadphase::MakePairKey(int32 ProxyA, int32 ProxyB)
+{
+	const uint32 Low = static_cast<uint32>(std::min(ProxyA, ProxyB));
+	const uint32 High = static_cast<uint32>(std::max(ProxyA, ProxyB));
+	return (static_cast<uint64>(Low) << 32) | High;
+}
+
+bool FOverlapBroadphase::TestOverlapOtherAxes(int32 Axis, int32 ProxyA, int32 ProxyB) const
+{
+	const FBroadphaseProxy& A = Proxies[ProxyA];
+	const FBroadphaseProxy& B = Proxies[ProxyB];
+
+	// Axis를 제외한 나머지 두 축 (0 → 1, 2 / 1 → 2, 0 / 2 → 0, 1)
+	const int32 Axis1 = (1 << Axis) & 3;
+	const int32 Axis2 = (1 << Axis1) & 3;
+
+	if (A.MaxEndpoint[Axis1] < B.MinEndpoint[Axis1] || B.MaxEndpoint[Axis1] < A.MinEndpoint[Axis1])
+	{
+		return false;
+	}
+	if (A.MaxEndpoint[Axis2] < B.MinEndpoint[Axis2] || B.MaxEndpoint[Axis2] < A.MinEndpoint[Axis2])
+	{
+		return false;
+	}
+	return true;
+}
+
+void FOverlapBroadphase::AddPair(int32 ProxyA, int32 ProxyB)
+{
+	if (Proxies[ProxyA].Owner == Proxies[ProxyB].Owner)
+	{
+		return;
+	}
+
+	const uint64 Key = MakePairKey(ProxyA, ProxyB);
+	if (PairLookup.Contains(Key))
+	{
+		return;
+	}
+
+	FBroadphasePair Pair;
+	Pair.ProxyA = std::min(ProxyA, ProxyB);
+	Pair.ProxyB = std::max(ProxyA, ProxyB);
+	PairLookup.Add(Key, Pairs.Add(Pair));
+}
+
+void FOverlapBroadphase::RemovePair(int32 ProxyA, int32 ProxyB)
+{
+	const uint64 Key = MakePairKey(ProxyA, ProxyB);
+	int32 PairIndex;
+	if (!PairLookup.RemoveAndCopyValue(Key, PairIndex))
+	{
+		return;
+	}
+
+	if (Pairs[PairIndex].bOverlapping)
+	{
+		EndedPairs.Add(Pairs[PairIndex]);
+	}
+
+	// 마지막 pair를 빈 자리로 옮긴다
+	const int32 LastIndex = Pairs.Num() - 1;
+	if (PairIndex != LastIndex)
+	{
+		Pairs[PairIndex] = Pairs[LastIndex];
+		*PairLookup.Find(MakePairKey(Pairs[PairIndex].ProxyA, Pairs[PairIndex].ProxyB)) = PairIndex;
+	}
+	Pairs.Pop();
+}
+
+void FOverlapBroadphase::SetEndpoint(int32 Axis, int32 EndpointIndex, const FSweepEndpoint& InEndpoint)
+{
+	Endpoints[Axis][EndpointIndex] = InEndpoint;
+
+	FBroadphaseProxy& Proxy = Proxies[InEndpoint.GetProxyIndex()];
+	if (InEndpoint.IsMax())
+	{
+		Proxy.MaxEndpoint[Axis] = EndpointIndex;
+	}
+	else
+	{
+		Proxy.MinEndpoint[Axis] = EndpointIndex;
+	}
+}
+
+void FOverlapBroadphase::SortMinDown(int32 Axis, int32 EndpointIndex, bool bUpdatePairs)
+{
+	TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+	const FSweepEndpoint Moving = AxisEndpoints[EndpointIndex];
+	const int32 ProxyIndex = Moving.GetProxyIndex();
+
+	// 지나친 끝점을 한 칸씩 밀고 마지막에 이동 중인 끝점을 기록한다
+	while (EndpointIndex > 0 && AxisEndpoints[EndpointIndex - 1].Value > Moving.Value)
+	{
+		// Min이 다른 proxy의 Max 앞으로 이동하면 이 축에서 겹치기 시작한다
+		const FSweepEndpoint Previous = AxisEndpoints[EndpointIndex - 1];
+		if (bUpdatePairs && Previous.IsMax() && TestOverlapOtherAxes(Axis, ProxyIndex, Previous.GetProxyIndex()))
+		{
+			AddPair(ProxyIndex, Previous.GetProxyIndex());
+		}
+
+		SetEndpoint(Axis, EndpointIndex, Previous);
+		--EndpointIndex;
+	}
+	SetEndpoint(Axis, EndpointIndex, Moving);
+}
+
+void FOverlapBroadphase::SortMinUp(int32 Axis, int32 EndpointIndex, bool bUpdatePairs)
+{
+	TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+	const FSweepEndpoint Moving = AxisEndpoints[EndpointIndex];
+	const int32 ProxyIndex = Moving.GetProxyIndex();
+
+	while (EndpointIndex + 1 < AxisEndpoints.Num() && AxisEndpoints[EndpointIndex + 1].Value < Moving.Value)
+	{
+		// Min이 다른 proxy의 Max 뒤로 이동하면 이 축에서 떨어진다
+		const FSweepEndpoint Next = AxisEndpoints[EndpointIndex + 1];
+		if (bUpdatePairs && Next.IsMax() && TestOverlapOtherAxes(Axis, ProxyIndex, Next.GetProxyIndex()))
+		{
+			RemovePair(ProxyIndex, Next.GetProxyIndex());
+		}
+
+		SetEndpoint(Axis, EndpointIndex, Next);
+		++EndpointIndex;
+	}
+	SetEndpoint(Axis, EndpointIndex, Moving);
+}
+
+void FOverlapBroadphase::SortMaxDown(int32 Axis, int32 EndpointIndex, bool bUpdatePairs)
+{
+	TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+	const FSweepEndpoint Moving = AxisEndpoints[EndpointIndex];
+	const int32 ProxyIndex = Moving.GetProxyIndex();
+
+	while (EndpointIndex > 0 && AxisEndpoints[EndpointIndex - 1].Value > Moving.Value)
+	{
+		// Max가 다른 proxy의 Min 앞으로 이동하면 이 축에서 떨어진다
+		const FSweepEndpoint Previous = AxisEndpoints[EndpointIndex - 1];
+		if (bUpdatePairs && !Previous.IsMax() && TestOverlapOtherAxes(Axis, ProxyIndex, Previous.GetProxyIndex()))
+		{
+			RemovePair(ProxyIndex, Previous.GetProxyIndex());
+		}
+
+		SetEndpoint(Axis, EndpointIndex, Previous);
+		--EndpointIndex;
+	}
+	SetEndpoint(Axis, EndpointIndex, Moving);
+}
+
+void FOverlapBroadphase::SortMaxUp(int32 Axis, int32 EndpointIndex, bool bUpdatePairs)
+{
+	TArray<FSweepEndpoint>& AxisEndpoints = Endpoints[Axis];
+	const FSweepEndpoint Moving = AxisEndpoints[EndpointIndex];
+	const int32 ProxyIndex = Moving.GetProxyIndex();
+
+	while (EndpointIndex + 1 < AxisEndpoints.Num() && AxisEndpoints[EndpointIndex + 1].Value < Moving.Value)
+	{
+		// Max가 다른 proxy의 Min 뒤로 이동하면 이 축에서 겹치기 시작한다
+		const FSweepEndpoint Next = AxisEndpoints[EndpointIndex + 1];
+		if (bUpdatePairs && !Next.IsMax() && TestOverlapOtherAxes(Axis, ProxyIndex, Next.GetProxyIndex()))
+		{
+			AddPair(ProxyIndex, Next.GetProxyIndex());
+		}
+
+		SetEndpoint(Axis, EndpointIndex, Next);
+		++EndpointIndex;
+	}
+	SetEndpoint(Axis, EndpointIndex, Moving);
+}
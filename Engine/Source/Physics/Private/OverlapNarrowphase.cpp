@@ -0,0 +1,9 @@
+#include "pch.h"
+#include "Physics/Public/OverlapNarrowphase.h"
+#include "Physics/Public/CollisionHelper.h"
+
+bool FOverlapNarrowphase::TestOverlap(const FOverlapTestTask& Task)
+{
+	// Shape가 없으면 overlap이 아님
+	return FCollisionHelper::TestOverlap(Task.ShapeA, Task.ShapeB);
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "Physics/Public/Bounds.h"
+
+class AActor;
+class UPrimitiveComponent;
+
+/**
+* @brief Sweep-and-prune 축 배열에 저장되는 AABB 끝점
+* @note Data의 최하위 비트는 Max 끝점 여부, 나머지 비트는 proxy 인덱스
+*/
+struct FSweepEndpoint
+{
+	float Value;
+	uint32 Data;
+
+	int32 GetProxyIndex() const { return static_cast<int32>(Data >> 1); }
+	bool IsMax() const { return (Data & 1) != 0; }
+};
+
+/**
+* @brief Broadphase에 등록된 프리미티브. MinEndpoint/MaxEndpoint는 각 축 배열에서 끝점의 위치
+*/
+struct FBroadphaseProxy
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	AActor* Owner = nullptr;           // 같은 액터의 컴포넌트끼리는 pair를 만들지 않음
+	int32 MinEndpoint[3] = { -1, -1, -1 };
+	int32 MaxEndpoint[3] = { -1, -1, -1 };
+	int32 NextFree = -1;
+	bool bMoved = false;               // 마지막 ClearMovedProxies 이후 이동했는지 여부
+};
+
+/**
+* @brief AABB가 겹치는 두 proxy. bOverlapping은 마지막 narrow phase 결과
+*/
+struct FBroadphasePair
+{
+	int32 ProxyA = -1;                 // 항상 ProxyA < ProxyB
+	int32 ProxyB = -1;
+	bool bOverlapping = false;
+};
+
+/**
+* @brief 3축 incremental sort-and-sweep broadphase (Bullet btAxisSweep3 방식)
+* @note 축마다 끝점 배열을 정렬된 상태로 유지하고, proxy가 움직이면 그 끝점만 삽입 정렬로 이동시킨다.
+*       끝점이 다른 proxy의 끝점을 지나칠 때 AABB overlap pair를 추가/제거하므로 pair cache는 항상
+*       현재 AABB 기준의 겹침 목록과 같고, 정지한 proxy에는 아무 비용이 들지 않는다.
+*       narrow phase에서 겹쳐 있던 pair가 제거되면 EndedPairs에 기록해 EndOverlap을 보낼 수 있게 한다.
+*/
+class FOverlapBroadphase
+{
+public:
+	//@return 새 proxy 인덱스. 새 proxy는 이동한 상태로 표시된다.
+	int32 CreateProxy(UPrimitiveComponent* InPrimitive, const FBounds& InBounds);
+
+	/**
+	* @brief Proxy와 proxy가 속한 pair를 모두 제거
+	* @param OutOverlappingPrimitives: narrow phase 기준으로 겹쳐 있던 상대 프리미티브 목록 (output)
+	*/
+	void DestroyProxy(int32 ProxyIndex, TArray<UPrimitiveComponent*>& OutOverlappingPrimitives);
+
+	//@brief 다음 UpdateProxy 대상으로 표시 (한 프레임에 여러 번 호출되어도 한 번만 기록)
+	void MarkProxyMoved(int32 ProxyIndex);
+
+	//@brief Proxy의 AABB를 갱신하고 끝점을 재정렬하며 pair를 추가/제거
+	void UpdateProxy(int32 ProxyIndex, const FBounds& InBounds);
+
+	const TArray<int32>& GetMovedProxies() const { return MovedProxies; }
+	void ClearMovedProxies();
+
+	UPrimitiveComponent* GetPrimitive(int32 ProxyIndex) const { return Proxies[ProxyIndex].Primitive; }
+	bool IsProxyMoved(int32 ProxyIndex) const { return Proxies[ProxyIndex].bMoved; }
+
+	TArray<FBroadphasePair>& GetPairs() { return Pairs; }
+	const TArray<FBroadphasePair>& GetPairs() const { return Pairs; }
+
+	// narrow phase에서 겹쳐 있다가 AABB가 떨어져 제거된 pair
+	const TArray<FBroadphasePair>& GetEndedPairs() const { return EndedPairs; }
+	void ClearEndedPairs() { EndedPairs.Empty(); }
+
+	void Clear();
+
+	int32 GetProxyCount() const { return ProxyCount; }
+	int32 GetPairCount() const { return Pairs.Num(); }
+
+	/**
+	* @brief: 끝점 정렬, 끝점 ↔ proxy 역참조, pair cache가 전수 검사 결과와 일치하는지 검사.
+	*/
+	bool CheckValidity() const;
+
+private:
+	static uint64 MakePairKey(int32 ProxyA, int32 ProxyB);
+
+	//@brief 나머지 두 축에서 두 proxy의 끝점 구간이 겹치는지 검사
+	bool TestOverlapOtherAxes(int32 Axis, int32 ProxyA, int32 ProxyB) const;
+
+	void AddPair(int32 ProxyA, int32 ProxyB);
+	void RemovePair(int32 ProxyA, int32 ProxyB);
+
+	//@brief 끝점을 기록하고 해당 proxy의 끝점 위치를 갱신
+	void SetEndpoint(int32 Axis, int32 EndpointIndex, const FSweepEndpoint& InEndpoint);
+
+	/**
+	* @brief 끝점을 삽입 정렬로 이동. bUpdatePairs가 true이면 다른 proxy의 끝점을 지날 때 pair를 추가/제거한다.
+	* @note 한 proxy의 축들은 순서대로 갱신되므로, 이미 갱신된 축과 아직 갱신되지 않은 축의 위치로 나머지 두 축을
+	*       검사하면 pair 추가/제거가 모두 정확하다. (제거 시에도 검사해 불필요한 pair 조회를 피한다)
+	*/
+	void SortMinDown(int32 Axis, int32 EndpointIndex, bool bUpdatePairs);
+	void SortMinUp(int32 Axis, int32 EndpointIndex, bool bUpdatePairs);
+	void SortMaxDown(int32 Axis, int32 EndpointIndex, bool bUpdatePairs);
+	void SortMaxUp(int32 Axis, int32 EndpointIndex, bool bUpdatePairs);
+
+	TArray<FBroadphaseProxy> Proxies;
+	int32 FreeProxyHead = -1;
+	int32 ProxyCount = 0;
+
+	TArray<FSweepEndpoint> Endpoints[3];
+
+	TArray<FBroadphasePair> Pairs;
+	TFlatMap<uint64, int32> PairLookup;    // MakePairKey → Pairs 인덱스
+	TArray<FBroadphasePair> EndedPairs;
+
+	TArray<int32> MovedProxies;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+class IBoundingVolume;
+
+constexpr int32 OVERLAP_NARROWPHASE_CHUNK_SIZE = 64;           // ParallelFor 조각 크기
+constexpr int32 OVERLAP_NARROWPHASE_PARALLEL_MIN_TASKS = 256;  // 이보다 적으면 호출 스레드에서 바로 검사
+
+/**
+* @brief 정밀 검사할 pair 하나
+* @note Shape는 게임 스레드에서 world 변환을 끝낸 상태여야 한다. (검사 중에는 읽기만 함)
+*/
+struct FOverlapTestTask
+{
+	const IBoundingVolume* ShapeA = nullptr;
+	const IBoundingVolume* ShapeB = nullptr;
+	int32 PairIndex = -1;              // 호출자가 결과를 되찾기 위한 값 (narrow phase에서는 사용하지 않음)
+	bool bWasOverlapping = false;
+};
+
+/**
+* @brief overlap 상태가 바뀐 작업. TaskIndex는 입력 작업 배열의 위치
+*/
+struct FOverlapTestResult
+{
+	int32 TaskIndex;
+	bool bIsOverlapping;
+};
+
+/**
+* @brief 서로 독립인 pair 정밀 검사를 FTaskScheduler의 스레드들에 나눠 실행
+* @note 각 스레드는 자기 결과 버퍼에만 기록하고, 합친 결과를 TaskIndex로 정렬한다.
+*       따라서 결과 순서는 스레드 수나 스케줄링과 무관하게 입력 순서를 따른다.
+*/
+class FOverlapNarrowphase
+{
+public:
+	/**
+	* @brief 모든 작업을 검사하고 이전 상태와 달라진 결과만 TaskIndex 순서로 반환
+	* @param bAllowParallel: false이면 호출 스레드에서만 실행 (결정성 비교용)
+	* @note 매 프레임 부르는 쪽은 TFrameArray를 넘길 수 있다. 스레드별 결과 버퍼도 프레임 메모리를 쓴다
+	*/
+	template <typename TaskAllocatorType, typename ResultAllocatorType>
+	static void Run(const TArray<FOverlapTestTask, TaskAllocatorType>& Tasks, bool bAllowParallel,
+		TArray<FOverlapTestResult, ResultAllocatorType>& OutChangedResults);
+
+private:
+	// 스레드별 결과 버퍼. 다른 스레드의 버퍼와 캐시 라인을 공유하지 않도록 정렬
+	struct alignas(64) FThreadResultBuffer
+	{
+		TFrameArray<FOverlapTestResult> Results;
+	};
+
+	template <typename ResultAllocatorType>
+	static void TestRange(const FOverlapTestTask* Tasks, int32 Begin, int32 End, TArray<FOverlapTestResult, ResultAllocatorType>& OutChangedResults);
+
+	static bool TestOverlap(const FOverlapTestTask& Task);
+};
+
+template <typename TaskAllocatorType, typename ResultAllocatorType>
+void FOverlapNarrowphase::Run(const TArray<FOverlapTestTask, TaskAllocatorType>& Tasks, bool bAllowParallel,
+	TArray<FOverlapTestResult, ResultAllocatorType>& OutChangedResults)
+{
+	OutChangedResults.Empty();
+
+	const int32 TaskCount = Tasks.Num();
+	if (TaskCount == 0)
+	{
+		return;
+	}
+
+	// 작업이 적으면 태스크 분배 비용이 검사 비용보다 크다
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	if (!bAllowParallel || TaskCount < OVERLAP_NARROWPHASE_PARALLEL_MIN_TASKS || !Scheduler.IsRunning())
+	{
+		TestRange(Tasks.GetData(), 0, TaskCount, OutChangedResults);
+		return;
+	}
+
+	// 1. 병렬 단계: 조각 단위로 검사하고 실행한 스레드의 버퍼에만 기록
+	// - 스케줄러 밖의 스레드(-1)에서 호출될 수 있으므로 버퍼 인덱스는 스레드 인덱스 + 1
+	TFrameArray<FThreadResultBuffer> ThreadResults;
+	ThreadResults.SetNum(Scheduler.GetThreadCount() + 1);
+	const FOverlapTestTask* TaskData = Tasks.GetData();
+	Scheduler.ParallelFor(TaskCount, OVERLAP_NARROWPHASE_CHUNK_SIZE, [&](int32 Begin, int32 End)
+	{
+		TestRange(TaskData, Begin, End, ThreadResults[FTaskScheduler::GetCurrentThreadIndex() + 1].Results);
+	});
+
+	// 2. 결정적 단계: 스레드 버퍼를 합친 뒤 입력 순서로 정렬
+	for (const FThreadResultBuffer& Buffer : ThreadResults)
+	{
+		OutChangedResults.Append(Buffer.Results.GetData(), Buffer.Results.Num());
+	}
+	std::sort(OutChangedResults.begin(), OutChangedResults.end(), [](const FOverlapTestResult& A, const FOverlapTestResult& B)
+	{
+		return A.TaskIndex < B.TaskIndex;
+	});
+}
+
+template <typename ResultAllocatorType>
+void FOverlapNarrowphase::TestRange(const FOverlapTestTask* Tasks, int32 Begin, int32 End, TArray<FOverlapTestResult, ResultAllocatorType>& OutChangedResults)
+{
+	for (int32 TaskIndex = Begin; TaskIndex < End; ++TaskIndex)
+	{
+		const FOverlapTestTask& Task = Tasks[TaskIndex];
+		const bool bIsOverlapping = TestOverlap(Task);
+		if (bIsOverlapping != Task.bWasOverlapping)
+		{
+			OutChangedResults.Add({ TaskIndex, bIsOverlapping });
+		}
+	}
+}
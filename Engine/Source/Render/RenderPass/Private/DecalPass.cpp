@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Component/Public/DecalComponent.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
@@ -162,8 +163,6 @@ void FDecalPass::Execute(FRenderingContext& Context)
     uint32 RenderedDecal = 0;
     uint32 CollidedComps = 0;
 
-    TArray<UPrimitiveComponent*> DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-
     // --- Render Decals ---
     for (UDecalComponent* Decal : Context.Decals)
     {
@@ -202,13 +201,13 @@ void FDecalPass::Execute(FRenderingContext& Context)
             Pipeline->SetSamplerState(1, EShaderType::PS, FadeTexture->GetTextureSampler());
         }
 
-        TArray<UPrimitiveComponent*> Primitives;
+        TFrameArray<UPrimitiveComponent*> Primitives;
 
         // --- Enable Octree Optimization ---
         ULevel* CurrentLevel = GWorld->GetLevel();
 
         Query(CurrentLevel->GetStaticOctree(), Decal, Primitives);
-        Primitives.Append(DynamicPrimitives);
+        Query(CurrentLevel->GetDynamicPrimitiveTree(), Decal, Primitives);
 
         // --- Disable Octree Optimization ---
         // Primitives = Context.DefaultPrimitives;
@@ -256,26 +255,36 @@ void FDecalPass::Release()
     SafeRelease(ConstantBufferDecal);
 }
 
-void FDecalPass::Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives)
+void FDecalPass::Query(FOctree* InOctree, UDecalComponent* InDecal, TFrameArray<UPrimitiveComponent*>& OutPrimitives)
 {
     /** @todo Use polymorphism to gracefully handle collsion between decal and octree. For now, use explicit casting. */
     auto BoundingBox = static_cast<const FOBB*>(InDecal->GetBoundingBox());
 
-    if (!BoundingBox->Intersects(InOctree->GetBoundingBox()))
-    {
-        return;
-    }
-
-    auto Primitives = InOctree->GetPrimitives();
-    OutPrimitives.Append(Primitives);
-    if (InOctree->IsLeafNode())
-    {
-        return;
-    }
+    InOctree->Traverse(
+        [BoundingBox](const FAABB& NodeBounds)
+        {
+            return BoundingBox->Intersects(NodeBounds) ? EOctreeVisit::Visit : EOctreeVisit::Skip;
+        },
+        [&OutPrimitives](UPrimitiveComponent* Primitive, const FAABB& Bounds, bool bAcceptedByNode)
+        {
+            OutPrimitives.Add(Primitive);
+        });
+}
 
+void FDecalPass::Query(FDynamicAABBTree* InTree, UDecalComponent* InDecal, TFrameArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    auto BoundingBox = static_cast<const FOBB*>(InDecal->GetBoundingBox());
 
-    for (auto Child : InOctree->GetChildren())
-    {
-        Query(Child, InDecal, OutPrimitives);
-    }
+    InTree->Traverse(
+        [BoundingBox](const FAABB& NodeBounds)
+        {
+            return BoundingBox->Intersects(NodeBounds) ? EOctreeVisit::Visit : EOctreeVisit::Skip;
+        },
+        [BoundingBox, &OutPrimitives](UPrimitiveComponent* Primitive, const FAABB& FatBounds, bool bAcceptedByNode)
+        {
+            if (BoundingBox->Intersects(FatBounds))
+            {
+                OutPrimitives.Add(Primitive);
+            }
+        });
 }
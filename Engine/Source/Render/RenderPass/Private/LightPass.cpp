@@ -124,8 +124,8 @@ void FLightPass::Execute(FRenderingContext& Context)
 
 	// Setup lighting constant buffer from scene lights
 	FGlobalLightConstant GlobalLightData = {};
-	TArray<FPointLightInfo> PointLightDatas;
-	TArray<FSpotLightInfo> SpotLightDatas;
+	TFrameArray<FPointLightInfo> PointLightDatas;
+	TFrameArray<FSpotLightInfo> SpotLightDatas;
 	// 수정 필요: Context에서 가져오기
 	if (!Context.AmbientLights.IsEmpty())
 	{
@@ -9,12 +9,37 @@
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Mesh/Public/SkeletalMeshComponent.h"
 #include "Render/Shadow/Public/PSMCalculator.h"
+#include "Level/Public/Level.h"
 
 #define MAX_LIGHT_NUM 8
 #define X_OFFSET 1024.0f
 #define Y_OFFSET 1024.0f
 #define SHADOW_MAP_RESOLUTION 1024.0f
 
+namespace
+{
+	/**
+	 * @brief 카메라 경로와 같은 기준으로 그림자를 드리울 메시인지 판단
+	 * 숨겨진 컴포넌트, 에디터 시각화용 컴포넌트, 쇼 플래그로 끈 메시 종류는 그림자도 드리우지 않는다.
+	 */
+	bool IsShadowCaster(const UPrimitiveComponent* InPrimitive, uint64 InShowFlags)
+	{
+		if (!InPrimitive->IsVisible() || InPrimitive->IsVisualizationComponent())
+		{
+			return false;
+		}
+		if (InPrimitive->IsA(UStaticMeshComponent::StaticClass()))
+		{
+			return (InShowFlags & EEngineShowFlags::SF_StaticMesh) != 0;
+		}
+		if (InPrimitive->IsA(USkeletalMeshComponent::StaticClass()))
+		{
+			return (InShowFlags & EEngineShowFlags::SF_SkeletalMesh) != 0;
+		}
+		return false;
+	}
+}
+
 FShadowMapPass::FShadowMapPass(UPipeline* InPipeline,
 	ID3D11Buffer* InConstantBufferCamera,
 	ID3D11Buffer* InConstantBufferModel,
@@ -173,24 +198,61 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 	DeviceContext->ClearRenderTargetView(ShadowAtlas.VarianceShadowRTV.Get(), ClearColor);
 	DeviceContext->ClearDepthStencilView(ShadowAtlas.ShadowDSV.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
 
-	// Phase 1: Directional Lights
-	ActiveDirectionalLightCount = 0;
-	ActiveDirectionalCascadeCount = 0;
+	// 카메라 컬링 결과와 무관하게 그림자를 드리울 수 있는 모든 메시 (레벨이 없을 때와 PSM 계열의 캐스터)
+	AllShadowCasters.Empty();
+	for (UStaticMeshComponent* Mesh : Context.StaticMeshes)
+	{
+		if (IsShadowCaster(Mesh, Context.ShowFlags))
+		{
+			AllShadowCasters.Add(Mesh);
+		}
+	}
+	for (USkeletalMeshComponent* Mesh : Context.SkeletalMeshes)
+	{
+		if (IsShadowCaster(Mesh, Context.ShowFlags))
+		{
+			AllShadowCasters.Add(Mesh);
+		}
+	}
+
+	// Phase 0: 유효한 라이트를 모으고 모든 라이트 절두체(캐스케이드, 스팟, 포인트 6면)를 ShadowCuller에 등록
+	ShadowCuller.Reset();
+
+	// Directional Light
+	UDirectionalLightComponent* ShadowDirLight = nullptr;
 	for (auto DirLight : Context.DirectionalLights)
 	{
 		if (DirLight->GetCastShadows() && DirLight->GetLightEnabled())
 		{
 			// 유효한 첫번째 Dir Light만 사용
-			RenderDirectionalShadowMap(DirLight, Context.StaticMeshes, Context.SkeletalMeshes, Context.ViewInfo);
-			ActiveDirectionalLightCount = 1;
-			ActiveDirectionalCascadeCount = UCascadeManager::GetInstance().GetSplitNum();
+			ShadowDirLight = DirLight;
 			break;
 		}
 	}
 
-	// Phase 2: Spot Lights
-	// 유효한 Spot Light를 수집한다. 8개가 상한이다.
-	TArray<USpotLightComponent*> ValidSpotLights;
+	FCascadeShadowMapData CascadeShadowMapData;
+	int32 NumCascades = 0;
+	int32 DirectionalFirstView = -1;
+	if (ShadowDirLight)
+	{
+		NumCascades = CalculateDirectionalShadowData(ShadowDirLight, Context.StaticMeshes, Context.SkeletalMeshes,
+			Context.ViewInfo, CascadeShadowMapData);
+
+		// PSM 계열(모드 1~3)의 원근 후 공간은 w가 음수인 영역까지 뒤집어 쓰므로 평면 추출로 컬링하지 않는다
+		const uint8 ProjectionMode = ShadowDirLight->GetShadowProjectionMode();
+		if (ProjectionMode == 0 || ProjectionMode == 4)
+		{
+			DirectionalFirstView = ShadowCuller.GetViewCount();
+			for (int32 i = 0; i < NumCascades; i++)
+			{
+				ShadowCuller.AddView(CascadeShadowMapData.View * CascadeShadowMapData.Proj[i]);
+			}
+		}
+	}
+
+	// Spot Light: 유효한 Spot Light를 수집한다. 8개가 상한이다.
+	// 라이트 수가 상한으로 묶여 있으므로 매 프레임 모으는 배열은 인라인 버퍼를 쓴다
+	TArray<USpotLightComponent*, TInlineAllocator<MAX_LIGHT_NUM>> ValidSpotLights;
 	for (USpotLightComponent* SpotLight : Context.SpotLights)
 	{
 		if (ValidSpotLights.Num() >= MAX_LIGHT_NUM)
@@ -202,14 +264,19 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 		}
 	}
 
-	ActiveSpotLightCount = static_cast<uint32>(ValidSpotLights.Num());
+	TArray<FMatrix, TInlineAllocator<MAX_LIGHT_NUM>> SpotLightViews;
+	TArray<FMatrix, TInlineAllocator<MAX_LIGHT_NUM>> SpotLightProjs;
+	SpotLightViews.SetNum(ValidSpotLights.Num());
+	SpotLightProjs.SetNum(ValidSpotLights.Num());
+	const int32 SpotFirstView = ShadowCuller.GetViewCount();
 	for (int32 i = 0; i < ValidSpotLights.Num(); i++)
 	{
-		RenderSpotShadowMap(ValidSpotLights[i], i, Context.StaticMeshes, Context.SkeletalMeshes);
+		CalculateSpotLightViewProj(ValidSpotLights[i], SpotLightViews[i], SpotLightProjs[i]);
+		ShadowCuller.AddView(SpotLightViews[i] * SpotLightProjs[i]);
 	}
 
-	// Phase 3: Point Lights
-	TArray<UPointLightComponent*> ValidPointLights;
+	// Point Light: 유효한 Point Light를 수집한다. 8개가 상한이다.
+	TArray<UPointLightComponent*, TInlineAllocator<MAX_LIGHT_NUM>> ValidPointLights;
 	for (UPointLightComponent* PointLight : Context.PointLights)
 	{
 		if (ValidPointLights.Num() >= MAX_LIGHT_NUM)
@@ -221,20 +288,123 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 		}
 	}
 
+	TArray<FMatrix, TInlineAllocator<MAX_LIGHT_NUM * 6>> PointLightViewProjs;
+	PointLightViewProjs.SetNum(ValidPointLights.Num() * 6);
+	const int32 PointFirstView = ShadowCuller.GetViewCount();
+	for (int32 i = 0; i < ValidPointLights.Num(); i++)
+	{
+		CalculatePointLightViewProj(ValidPointLights[i], PointLightViewProjs.GetData() + i * 6);
+		for (int32 Face = 0; Face < 6; Face++)
+		{
+			ShadowCuller.AddView(PointLightViewProjs[i * 6 + Face]);
+		}
+	}
+
+	// 모든 라이트 뷰를 트리 한 번의 순회로 컬링
+	GatherShadowCasters(Context.Level, Context.ShowFlags);
+
+	// Phase 1: Directional Lights
+	ActiveDirectionalLightCount = 0;
+	ActiveDirectionalCascadeCount = 0;
+	if (ShadowDirLight)
+	{
+		RenderDirectionalShadowMap(ShadowDirLight, CascadeShadowMapData, NumCascades,
+			DirectionalFirstView != -1 ? ShadowCasters.GetData() + DirectionalFirstView : &AllShadowCasters);
+		ActiveDirectionalLightCount = 1;
+		ActiveDirectionalCascadeCount = UCascadeManager::GetInstance().GetSplitNum();
+	}
+
+	// Phase 2: Spot Lights
+	ActiveSpotLightCount = static_cast<uint32>(ValidSpotLights.Num());
+	for (int32 i = 0; i < ValidSpotLights.Num(); i++)
+	{
+		RenderSpotShadowMap(ValidSpotLights[i], i, SpotLightViews[i], SpotLightProjs[i], ShadowCasters[SpotFirstView + i]);
+	}
+
+	// Phase 3: Point Lights
 	ActivePointLightCount = static_cast<uint32>(ValidPointLights.Num());
 	for (int32 i = 0; i < ValidPointLights.Num(); i++)
 	{
-		RenderPointShadowMap(ValidPointLights[i], i, Context.StaticMeshes, Context.SkeletalMeshes);
+		RenderPointShadowMap(ValidPointLights[i], i, PointLightViewProjs.GetData() + i * 6,
+			ShadowCasters.GetData() + PointFirstView + i * 6);
 	}
 
 	SetShadowAtlasTilePositionStructuredBuffer();
 }
 
-void FShadowMapPass::RenderDirectionalShadowMap(
+void FShadowMapPass::GatherShadowCasters(ULevel* InLevel, uint64 InShowFlags)
+{
+	ShadowCasters.SetNum(ShadowCuller.GetViewCount());
+	if (!InLevel)
+	{
+		for (TArray<const UMeshComponent*>& Casters : ShadowCasters)
+		{
+			Casters = AllShadowCasters;
+		}
+		return;
+	}
+
+	ShadowCuller.Cull(InLevel->GetStaticOctree(), InLevel->GetDynamicPrimitiveTree());
+	for (int32 ViewIndex = 0; ViewIndex < ShadowCuller.GetViewCount(); ViewIndex++)
+	{
+		TArray<const UMeshComponent*>& Casters = ShadowCasters[ViewIndex];
+		Casters.Empty();
+		ShadowCuller.ForEachVisible(ViewIndex, [&Casters, InShowFlags](UPrimitiveComponent* Primitive)
+		{
+			if (IsShadowCaster(Primitive, InShowFlags))
+			{
+				Casters.Add(static_cast<const UMeshComponent*>(Primitive));
+			}
+		});
+	}
+}
+
+int32 FShadowMapPass::CalculateDirectionalShadowData(
 	UDirectionalLightComponent* Light,
 	const TArray<UStaticMeshComponent*>& StaticMeshes,
 	const TArray<USkeletalMeshComponent*>& SkeletalMeshes,
-	const FMinimalViewInfo& InViewInfo
+	const FMinimalViewInfo& InViewInfo,
+	FCascadeShadowMapData& OutCascadeShadowMapData)
+{
+	// 그림자 매핑 모드 확인
+	// 0 = Uniform SM (단일), 1~3 = PSM / LiSPSM / TSM (단일), 4 = CSM (캐스케이드)
+	uint8 ProjectionMode = Light->GetShadowProjectionMode();
+
+	UCascadeManager& CascadeManager = UCascadeManager::GetInstance();
+
+	if (ProjectionMode == 4)
+	{
+		// 모드 4: Cascaded Shadow Maps (다중 캐스케이드)
+		OutCascadeShadowMapData = CascadeManager.GetCascadeShadowMapData(InViewInfo, Light);
+		return CascadeManager.GetSplitNum();
+	}
+
+	FMatrix LightView, LightProj;
+	if (ProjectionMode >= 1 && ProjectionMode <= 3)
+	{
+		// 모드 1, 2, 3: PSM / LiSPSM / TSM (단일 원근 그림자 맵)
+		// CalculateDirectionalLightViewProj 내부에서 PSMCalculator를 통해 모드별로 분기
+		CalculateDirectionalLightViewProj(Light, StaticMeshes, SkeletalMeshes, InViewInfo, LightView, LightProj);
+	}
+	else  // ProjectionMode == 0
+	{
+		// 모드 0: Uniform Shadow Map (단일 직교 그림자 맵)
+		// Sample 버전 사용: 모든 메시의 AABB 기반으로 계산
+		CalculateUniformShadowMapViewProj(Light, StaticMeshes, SkeletalMeshes, LightView, LightProj);
+	}
+
+	OutCascadeShadowMapData.SplitNum = 1;
+	OutCascadeShadowMapData.View = LightView;
+	OutCascadeShadowMapData.Proj[0] = LightProj;
+	OutCascadeShadowMapData.SplitDistance[0] = FVector4(InViewInfo.FarClipPlane, 0, 0, 0);
+	return 1;
+}
+
+void FShadowMapPass::RenderDirectionalShadowMap(
+	UDirectionalLightComponent* Light,
+	const FCascadeShadowMapData& CascadeShadowMapData,
+	int32 NumCascades,
+	const TArray<const UMeshComponent*>* CascadeCasters
 	)
 {
 	// FShadowMapResource* ShadowMap = GetOrCreateShadowMap(Light);
@@ -287,52 +457,6 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 	};
 	Pipeline->UpdatePipeline(ShadowPipelineInfo);
 
-	// 그림자 매핑 모드 확인
-	// 0 = Uniform SM (단일), 1 = PSM (단일), 2 = CSM (캐스케이드)
-	uint8 ProjectionMode = Light->GetShadowProjectionMode();
-
-	UCascadeManager& CascadeManager = UCascadeManager::GetInstance();
-	FCascadeShadowMapData CascadeShadowMapData;
-	int NumCascades = 1;
-
-	// CSM split 수 임시 저장
-	int32 OriginalSplitNum = CascadeManager.GetSplitNum();
-
-	if (ProjectionMode == 4)
-	{
-		// 모드 4: Cascaded Shadow Maps (다중 캐스케이드)
-		CascadeShadowMapData = CascadeManager.GetCascadeShadowMapData(InViewInfo, Light);
-		NumCascades = OriginalSplitNum;
-	}
-	else if (ProjectionMode >= 1 && ProjectionMode <= 3)
-	{
-		// 모드 1, 2, 3: PSM / LiSPSM / TSM (단일 원근 그림자 맵)
-		// CalculateDirectionalLightViewProj 내부에서 PSMCalculator를 통해 모드별로 분기
-		CascadeShadowMapData.SplitNum = 1;
-
-		FMatrix LightView, LightProj;
-		CalculateDirectionalLightViewProj(Light, StaticMeshes, SkeletalMeshes, InViewInfo, LightView, LightProj);
-
-		CascadeShadowMapData.View = LightView;
-		CascadeShadowMapData.Proj[0] = LightProj;
-		CascadeShadowMapData.SplitDistance[0] = FVector4(InViewInfo.FarClipPlane, 0, 0, 0);
-		NumCascades = 1;
-	}
-	else  // ProjectionMode == 0
-	{
-		// 모드 0: Uniform Shadow Map (단일 직교 그림자 맵)
-		// Sample 버전 사용: 모든 메시의 AABB 기반으로 계산
-		CascadeShadowMapData.SplitNum = 1;
-
-		FMatrix LightView, LightProj;
-		CalculateUniformShadowMapViewProj(Light, StaticMeshes, SkeletalMeshes, LightView, LightProj);
-
-		CascadeShadowMapData.View = LightView;
-		CascadeShadowMapData.Proj[0] = LightProj;
-		CascadeShadowMapData.SplitDistance[0] = FVector4(InViewInfo.FarClipPlane, 0, 0, 0);
-		NumCascades = 1;
-	}
-
 	FRenderResourceFactory::UpdateConstantBufferData(ConstantCascadeData, CascadeShadowMapData);
 	Pipeline->SetConstantBuffer(6, EShaderType::VS | EShaderType::PS, ConstantCascadeData);
 
@@ -358,21 +482,10 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 		// Cascade는 ViewProj가 여러개라서 추후 수정하던가 날려야 함 - HSH
 		// Light->SetShadowViewProjection(LightViewProj);
 
-		// 5. 각 메시 렌더링
-		for (auto Mesh : StaticMeshes)
-		{
-			if (Mesh->IsVisible())
-			{
-				RenderMeshDepth(Mesh, LightView, LightProj);
-			}
-		}
-
-		for (auto Mesh : SkeletalMeshes)
+		// 5. 캐스케이드 절두체에 걸친 메시만 렌더링
+		for (const UMeshComponent* Mesh : CascadeCasters[i])
 		{
-			if (Mesh->IsVisible())
-			{
-				RenderMeshDepth(Mesh, LightView, LightProj);
-			}
+			RenderMeshDepth(Mesh, LightView, LightProj);
 		}
 	}
 
@@ -395,8 +508,9 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 void FShadowMapPass::RenderSpotShadowMap(
 	USpotLightComponent* Light,
 	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& StaticMeshes,
-	const TArray<USkeletalMeshComponent*>& SkeletalMeshes
+	const FMatrix& LightView,
+	const FMatrix& LightProj,
+	const TArray<const UMeshComponent*>& Casters
 	)
 {
 	// FShadowMapResource* ShadowMap = GetOrCreateShadowMap(Light);
@@ -459,10 +573,7 @@ void FShadowMapPass::RenderSpotShadowMap(
 	};
 	Pipeline->UpdatePipeline(ShadowPipelineInfo);
 
-	// 4. Light view-projection 계산 (Perspective projection for cone-shaped frustum)
-	FMatrix LightView, LightProj;
-	CalculateSpotLightViewProj(Light, LightView, LightProj);
-
+	// 4. Light view-projection은 Execute에서 컬링과 함께 계산 (Perspective projection for cone-shaped frustum)
 	// Store the calculated shadow view-projection matrix in the light component
 	FMatrix LightViewProj = LightView * LightProj;
 	Light->SetShadowViewProjection(LightViewProj);  // Will be added to SpotLightComponent in Phase 6
@@ -473,21 +584,10 @@ void FShadowMapPass::RenderSpotShadowMap(
 	FRenderResourceFactory::UpdateConstantBufferData(PointLightShadowParamsBuffer, Params);
 	Pipeline->SetConstantBuffer(2, EShaderType::PS, PointLightShadowParamsBuffer);
 
-	// 5. 각 메시 렌더링
-	for (auto Mesh : StaticMeshes)
-	{
-		if (Mesh->IsVisible())
-		{
-			RenderMeshDepth(Mesh, LightView, LightProj);
-		}
-	}
-
-	for (auto Mesh : SkeletalMeshes)
+	// 5. 라이트 절두체에 걸친 메시만 렌더링
+	for (const UMeshComponent* Mesh : Casters)
 	{
-		if (Mesh->IsVisible())
-		{
-			RenderMeshDepth(Mesh, LightView, LightProj);
-		}
+		RenderMeshDepth(Mesh, LightView, LightProj);
 	}
 
 	// 6. 상태 복원
@@ -509,8 +609,8 @@ void FShadowMapPass::RenderSpotShadowMap(
 void FShadowMapPass::RenderPointShadowMap(
 	UPointLightComponent* Light,
 	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& StaticMeshes,
-	const TArray<USkeletalMeshComponent*>& SkeletalMeshes
+	const FMatrix* ViewProj,
+	const TArray<const UMeshComponent*>* FaceCasters
 )
 {
 	// FCubeShadowMapResource* ShadowMap = GetOrCreateCubeShadowMap(Light);
@@ -558,10 +658,7 @@ void FShadowMapPass::RenderPointShadowMap(
 	FRenderResourceFactory::UpdateConstantBufferData(PointLightShadowParamsBuffer, Params);
 	Pipeline->SetConstantBuffer(2, EShaderType::PS, PointLightShadowParamsBuffer);
 
-	// 3. 6개 View-Projection 계산
-	FMatrix ViewProj[6];
-	CalculatePointLightViewProj(Light, ViewProj);
-
+	// 3. 6개 View-Projection은 Execute에서 컬링과 함께 계산
 	// 하나의 Atlas에 모두 작성하므로
 	// RenderTarget은 변경될 일이 없어 먼저 Set한다.
 	Pipeline->SetRenderTargets(1, ShadowAtlas.VarianceShadowRTV.GetAddressOf(), ShadowAtlas.ShadowDSV.Get());
@@ -592,55 +689,27 @@ void FShadowMapPass::RenderPointShadowMap(
 		FRenderResourceFactory::UpdateConstantBufferData(ShadowViewProjConstantBuffer, CBData);
 		Pipeline->SetConstantBuffer(1, EShaderType::VS, ShadowViewProjConstantBuffer);
 
-		// 4-3. 메시 렌더링
-		for (auto Mesh : StaticMeshes)
-		{
-			if (Mesh->IsVisible())
-			{
-				// Model transform 업데이트
-				FMatrix WorldMatrix = Mesh->GetWorldTransformMatrix();
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
-				Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
-
-				// Vertex/Index buffer 바인딩
-				ID3D11Buffer* VertexBuffer = Mesh->GetVertexBuffer();
-				ID3D11Buffer* IndexBuffer = Mesh->GetIndexBuffer();
-				uint32 IndexCount = Mesh->GetNumIndices();
-
-				if (!VertexBuffer || !IndexBuffer || IndexCount == 0)
-					continue;
-
-				Pipeline->SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
-				Pipeline->SetIndexBuffer(IndexBuffer, 0);
-
-				// Draw call
-				Pipeline->DrawIndexed(IndexCount, 0, 0);
-			}
-		}
-
-		for (auto Mesh : SkeletalMeshes)
+		// 4-3. 이 면의 절두체에 걸친 메시만 렌더링
+		for (const UMeshComponent* Mesh : FaceCasters[Face])
 		{
-			if (Mesh->IsVisible())
-			{
-				// Model transform 업데이트
-				FMatrix WorldMatrix = Mesh->GetWorldTransformMatrix();
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
-				Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+			// Model transform 업데이트
+			FMatrix WorldMatrix = Mesh->GetWorldTransformMatrix();
+			FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
+			Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
 
-				// Vertex/Index buffer 바인딩
-				ID3D11Buffer* VertexBuffer = Mesh->GetVertexBuffer();
-				ID3D11Buffer* IndexBuffer = Mesh->GetIndexBuffer();
-				uint32 IndexCount = Mesh->GetNumIndices();
+			// Vertex/Index buffer 바인딩
+			ID3D11Buffer* VertexBuffer = Mesh->GetVertexBuffer();
+			ID3D11Buffer* IndexBuffer = Mesh->GetIndexBuffer();
+			uint32 IndexCount = Mesh->GetNumIndices();
 
-				if (!VertexBuffer || !IndexBuffer || IndexCount == 0)
-					continue;
+			if (!VertexBuffer || !IndexBuffer || IndexCount == 0)
+				continue;
 
-				Pipeline->SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
-				Pipeline->SetIndexBuffer(IndexBuffer, 0);
+			Pipeline->SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
+			Pipeline->SetIndexBuffer(IndexBuffer, 0);
 
-				// Draw call
-				Pipeline->DrawIndexed(IndexCount, 0, 0);
-			}
+			// Draw call
+			Pipeline->DrawIndexed(IndexCount, 0, 0);
 		}
 	}
 
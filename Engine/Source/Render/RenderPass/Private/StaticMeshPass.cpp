@@ -73,37 +73,51 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	Pipeline->SetConstantBuffer(1, EShaderType::VS | EShaderType::PS, ConstantBufferCamera);
 
 	if (!(Context.ShowFlags & EEngineShowFlags::SF_StaticMesh)) { return; }
-	TArray<UStaticMeshComponent*>& MeshComponents = Context.StaticMeshes;
-	sort(MeshComponents.begin(), MeshComponents.end(),
-		[](UStaticMeshComponent* A, UStaticMeshComponent* B) {
-			int32 MeshA = A->GetStaticMesh() ? A->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			int32 MeshB = B->GetStaticMesh() ? B->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			return MeshA < MeshB;
-		});
 
-	FStaticMesh* CurrentMeshAsset = nullptr;
-	UMaterial* CurrentMaterial = nullptr;
+	// 1. Draw 목록 구성: 섹션마다 (머티리얼, 메시, 깊이) 키를 만든다. 셰이더는 위에서 한 번만 바인딩한다
+	DrawList.Reset();
+	DrawPrimitives.Empty();
+	DrawMeshes.Empty();
+	DrawMaterials.Empty();
+	MeshIds.Reset();
+	MaterialIds[0].Reset();
+	MaterialIds[1].Reset();
 
-	for (UStaticMeshComponent* MeshComp : MeshComponents)
+	for (UStaticMeshComponent* MeshComp : Context.StaticMeshes)
 	{
 		if (!MeshComp->IsVisible()) { continue; }
 		if (!MeshComp->GetStaticMesh()) { continue; }
 		FStaticMesh* MeshAsset = MeshComp->GetStaticMesh()->GetStaticMeshAsset();
 		if (!MeshAsset) { continue; }
 
-		if (CurrentMeshAsset != MeshAsset)
+		FMeshDrawItem Item;
+		Item.PrimitiveId = static_cast<uint32>(DrawPrimitives.Num());
+		DrawPrimitives.Add(MeshComp);
+
+		// 같은 FStaticMesh를 쓰는 컴포넌트는 정점/인덱스 버퍼를 공유한다
+		if (const uint32* MeshId = MeshIds.Find(MeshAsset))
 		{
-			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
-			Pipeline->SetIndexBuffer(MeshComp->GetIndexBuffer(), 0);
-			CurrentMeshAsset = MeshAsset;
+			Item.MeshId = *MeshId;
+		}
+		else
+		{
+			Item.MeshId = static_cast<uint32>(DrawMeshes.Num());
+			MeshIds.Add(MeshAsset, Item.MeshId);
+			DrawMeshes.Add(MeshComp);
 		}
 
-		FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, MeshComp->GetWorldTransformMatrix());
-		Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+		FVector BoundsMin, BoundsMax;
+		MeshComp->GetWorldAABB(BoundsMin, BoundsMax);
+		Item.Depth = ((BoundsMin + BoundsMax) * 0.5f - Context.ViewInfo.Location).LengthSquared();
+
+		// 이 뷰에서의 화면 크기로 고른 LOD (인덱스 버퍼는 모든 LOD가 공유)
+		const int32 LODIndex = SelectLOD(MeshComp->GetStaticMesh(), BoundsMin, BoundsMax, Context.ViewInfo.CameraConstants);
 
 		if (MeshAsset->MaterialInfo.IsEmpty() || MeshComp->GetStaticMesh()->GetNumMaterials() == 0)
 		{
-			Pipeline->DrawIndexed(static_cast<uint32>(MeshAsset->Indices.Num()), 0, 0);
+			Item.MaterialId = MESH_DRAW_NO_MATERIAL;
+			MeshComp->GetStaticMesh()->GetLODIndexRange(LODIndex, Item.StartIndex, Item.IndexCount);
+			DrawList.AddDraw(Item);
 			continue;
 		}
 
@@ -112,64 +126,37 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 			MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
 		}
 
-		for (const FMeshSection& Section : MeshAsset->Sections)
+		for (const FMeshSection& Section : MeshComp->GetStaticMesh()->GetLODSections(LODIndex))
+		{
+			Item.MaterialId = GetDrawMaterialId(MeshComp->GetMaterial(Section.MaterialSlot), MeshComp);
+			Item.StartIndex = Section.StartIndex;
+			Item.IndexCount = Section.IndexCount;
+			DrawList.AddDraw(Item);
+		}
+	}
+
+	// 2. 키로 정렬하고 직전 draw와 같은 상태는 생략한 명령을 재생
+	DrawList.Build();
+
+	for (const FMeshDrawCommand& Command : DrawList.GetCommands())
+	{
+		if (Command.StateFlags & MDS_Mesh)
+		{
+			UStaticMeshComponent* MeshComp = DrawMeshes[Command.MeshId];
+			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
+			Pipeline->SetIndexBuffer(MeshComp->GetIndexBuffer(), 0);
+		}
+		if (Command.StateFlags & MDS_Primitive)
+		{
+			FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, DrawPrimitives[Command.PrimitiveId]->GetWorldTransformMatrix());
+			Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+		}
+		if (Command.StateFlags & MDS_Material)
 		{
-			UMaterial* Material = MeshComp->GetMaterial(Section.MaterialSlot);
-			if (CurrentMaterial != Material) {
-				FMaterialConstants MaterialConstants = {};
-				FVector AmbientColor = Material->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
-				FVector DiffuseColor = Material->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
-				FVector SpecularColor = Material->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
-				MaterialConstants.Ns = Material->GetSpecularExponent();
-				MaterialConstants.Ni = Material->GetRefractionIndex();
-				MaterialConstants.D = Material->GetDissolveFactor();
-				MaterialConstants.MaterialFlags = 0;
-				if (Material->GetDiffuseTexture())  { MaterialConstants.MaterialFlags |= HAS_DIFFUSE_MAP; }
-				if (Material->GetAmbientTexture())  { MaterialConstants.MaterialFlags |= HAS_AMBIENT_MAP; }
-				if (Material->GetSpecularTexture()) { MaterialConstants.MaterialFlags |= HAS_SPECULAR_MAP; }
-				if (Material->GetNormalTexture())   { MaterialConstants.MaterialFlags |= HAS_NORMAL_MAP; }
-				if (!MeshComp->IsNormalMapEnabled())
-				{
-					MaterialConstants.MaterialFlags &= ~HAS_NORMAL_MAP;
-				}
-				if (Material->GetAlphaTexture())    { MaterialConstants.MaterialFlags |= HAS_ALPHA_MAP; }
-				if (Material->GetBumpTexture())     { MaterialConstants.MaterialFlags |= HAS_BUMP_MAP; }
-				MaterialConstants.Time = MeshComp->GetElapsedTime();
-
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferMaterial, MaterialConstants);
-				Pipeline->SetConstantBuffer(2, EShaderType::VS | EShaderType::PS, ConstantBufferMaterial);
-
-				if (UTexture* DiffuseTexture = Material->GetDiffuseTexture())
-				{
-					Pipeline->SetShaderResourceView(0, EShaderType::PS, DiffuseTexture->GetTextureSRV());
-					Pipeline->SetSamplerState(0, EShaderType::PS, DiffuseTexture->GetTextureSampler());
-				}
-				if (UTexture* AmbientTexture = Material->GetAmbientTexture())
-				{
-					Pipeline->SetShaderResourceView(1, EShaderType::PS, AmbientTexture->GetTextureSRV());
-				}
-				if (UTexture* SpecularTexture = Material->GetSpecularTexture())
-				{
-					Pipeline->SetShaderResourceView(2, EShaderType::PS, SpecularTexture->GetTextureSRV());
-				}
-				if (Material->GetNormalTexture() && MeshComp->IsNormalMapEnabled())
-				{
-					Pipeline->SetShaderResourceView(3, EShaderType::PS, Material->GetNormalTexture()->GetTextureSRV());
-				}
-				if (UTexture* AlphaTexture = Material->GetAlphaTexture())
-				{
-					Pipeline->SetShaderResourceView(4, EShaderType::PS, AlphaTexture->GetTextureSRV());
-				}
-				if (UTexture* BumpTexture = Material->GetBumpTexture())
-				{ // 범프 텍스처 추가 그러나 범프 텍스처 사용하지 않아서 없을 것임. 무시 ㄱㄱ
-					Pipeline->SetShaderResourceView(5, EShaderType::PS, BumpTexture->GetTextureSRV());
-					// 필요한 경우 샘플러 지정
-					// Pipeline->SetSamplerState(5, false, BumpTexture->GetTextureSampler());
-				}
-				CurrentMaterial = Material;
-			}
-				Pipeline->DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
+			const FDrawMaterial& DrawMaterial = DrawMaterials[Command.MaterialId - 1];
+			BindMaterial(DrawMaterial.Material, DrawMaterial.Component);
 		}
+		Pipeline->DrawIndexed(Command.IndexCount, Command.StartIndex, 0);
 	}
 	Pipeline->SetConstantBuffer(2, EShaderType::PS, nullptr);
 
@@ -181,6 +168,112 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	Pipeline->SetShaderResourceView(14, EShaderType::PS, nullptr);  // Point Light Tile Position
 }
 
+/**
+ * @brief 바운딩 구의 투영 반경(화면 높이의 절반 기준)으로 LOD를 고른다. 카메라가 구 안에 있으면 LOD0
+ * 컬링 여부와 관계없이 모든 렌더 경로에서 돌고, 뷰마다 따로 고르므로 컴포넌트에 상태를 남기지 않는다.
+ */
+int32 FStaticMeshPass::SelectLOD(const UStaticMesh* InStaticMesh, const FVector& InBoundsMin, const FVector& InBoundsMax, const FCameraConstants& InView)
+{
+	if (InStaticMesh->GetNumLODs() <= 1)
+	{
+		return 0;
+	}
+
+	const FVector Center = (InBoundsMin + InBoundsMax) * 0.5f;
+	const float Radius = (InBoundsMax - InBoundsMin).Length() * 0.5f;
+	const float ProjectionScale = InView.Projection.Data[1][1];
+	float ScreenSize = FLT_MAX;
+	if (InView.Projection.Data[3][3] == 1.0f)
+	{
+		ScreenSize = Radius * ProjectionScale;
+	}
+	else
+	{
+		const float Distance = (Center - InView.ViewWorldLocation).Length();
+		if (Distance > Radius)
+		{
+			ScreenSize = Radius * ProjectionScale / Distance;
+		}
+	}
+
+	return InStaticMesh->GetLODForScreenSize(ScreenSize);
+}
+
+uint32 FStaticMeshPass::GetDrawMaterialId(UMaterial* InMaterial, UStaticMeshComponent* InMeshComp)
+{
+	// 머티리얼 상수는 컴포넌트의 노멀 맵 설정과 스크롤 시간에 따라 달라지므로 그만큼 나누어 ID를 준다
+	TFlatMap<UMaterial*, uint32>* IdMap = InMeshComp->IsScrollEnabled() ? nullptr : &MaterialIds[InMeshComp->IsNormalMapEnabled() ? 1 : 0];
+	if (IdMap)
+	{
+		if (const uint32* MaterialId = IdMap->Find(InMaterial))
+		{
+			return *MaterialId;
+		}
+	}
+
+	DrawMaterials.Add({ InMaterial, InMeshComp });
+	const uint32 MaterialId = static_cast<uint32>(DrawMaterials.Num()); // 0은 MESH_DRAW_NO_MATERIAL
+	if (IdMap)
+	{
+		IdMap->Add(InMaterial, MaterialId);
+	}
+	return MaterialId;
+}
+
+void FStaticMeshPass::BindMaterial(UMaterial* Material, const UStaticMeshComponent* MeshComp)
+{
+	FMaterialConstants MaterialConstants = {};
+	FVector AmbientColor = Material->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
+	FVector DiffuseColor = Material->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
+	FVector SpecularColor = Material->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
+	MaterialConstants.Ns = Material->GetSpecularExponent();
+	MaterialConstants.Ni = Material->GetRefractionIndex();
+	MaterialConstants.D = Material->GetDissolveFactor();
+	MaterialConstants.MaterialFlags = 0;
+	if (Material->GetDiffuseTexture())  { MaterialConstants.MaterialFlags |= HAS_DIFFUSE_MAP; }
+	if (Material->GetAmbientTexture())  { MaterialConstants.MaterialFlags |= HAS_AMBIENT_MAP; }
+	if (Material->GetSpecularTexture()) { MaterialConstants.MaterialFlags |= HAS_SPECULAR_MAP; }
+	if (Material->GetNormalTexture())   { MaterialConstants.MaterialFlags |= HAS_NORMAL_MAP; }
+	if (!MeshComp->IsNormalMapEnabled())
+	{
+		MaterialConstants.MaterialFlags &= ~HAS_NORMAL_MAP;
+	}
+	if (Material->GetAlphaTexture())    { MaterialConstants.MaterialFlags |= HAS_ALPHA_MAP; }
+	if (Material->GetBumpTexture())     { MaterialConstants.MaterialFlags |= HAS_BUMP_MAP; }
+	MaterialConstants.Time = MeshComp->GetElapsedTime();
+
+	FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferMaterial, MaterialConstants);
+	Pipeline->SetConstantBuffer(2, EShaderType::VS | EShaderType::PS, ConstantBufferMaterial);
+
+	if (UTexture* DiffuseTexture = Material->GetDiffuseTexture())
+	{
+		Pipeline->SetShaderResourceView(0, EShaderType::PS, DiffuseTexture->GetTextureSRV());
+		Pipeline->SetSamplerState(0, EShaderType::PS, DiffuseTexture->GetTextureSampler());
+	}
+	if (UTexture* AmbientTexture = Material->GetAmbientTexture())
+	{
+		Pipeline->SetShaderResourceView(1, EShaderType::PS, AmbientTexture->GetTextureSRV());
+	}
+	if (UTexture* SpecularTexture = Material->GetSpecularTexture())
+	{
+		Pipeline->SetShaderResourceView(2, EShaderType::PS, SpecularTexture->GetTextureSRV());
+	}
+	if (Material->GetNormalTexture() && MeshComp->IsNormalMapEnabled())
+	{
+		Pipeline->SetShaderResourceView(3, EShaderType::PS, Material->GetNormalTexture()->GetTextureSRV());
+	}
+	if (UTexture* AlphaTexture = Material->GetAlphaTexture())
+	{
+		Pipeline->SetShaderResourceView(4, EShaderType::PS, AlphaTexture->GetTextureSRV());
+	}
+	if (UTexture* BumpTexture = Material->GetBumpTexture())
+	{ // 범프 텍스처 추가 그러나 범프 텍스처 사용하지 않아서 없을 것임. 무시 ㄱㄱ
+		Pipeline->SetShaderResourceView(5, EShaderType::PS, BumpTexture->GetTextureSRV());
+		// 필요한 경우 샘플러 지정
+		// Pipeline->SetSamplerState(5, false, BumpTexture->GetTextureSampler());
+	}
+}
+
 void FStaticMeshPass::Release()
 {
 	SafeRelease(ConstantBufferMaterial);
@@ -1,6 +1,8 @@
 #pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
 
+class FDynamicAABBTree;
+
 // Matches the layout in DecalShader.hlsl
 struct FModelConstants
 {
@@ -36,7 +38,8 @@ public:
 
 private:
 	// --- Octree Optimization ---
-	void Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives);
+	void Query(FOctree* InOctree, UDecalComponent* InDecal, TFrameArray<UPrimitiveComponent*>& OutPrimitives);
+	void Query(FDynamicAABBTree* InTree, UDecalComponent* InDecal, TFrameArray<UPrimitiveComponent*>& OutPrimitives);
 
 	ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
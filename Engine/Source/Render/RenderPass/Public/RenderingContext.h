@@ -21,7 +21,9 @@ struct FRenderingContext
     D3D11_VIEWPORT LocalViewport;
     FVector2 RenderTargetSize;
 
-    TArray<class UPrimitiveComponent*> AllPrimitives;
+    // 렌더링 중인 레벨. 그림자 패스가 라이트 절두체마다 캐스터를 레벨의 공간 분할 트리에서 다시 컬링할 때 사용
+    class ULevel* Level = nullptr;
+
     // Components By Render Pass
     TArray<class UStaticMeshComponent*> StaticMeshes;
 	TArray<class USkeletalMeshComponent*> SkeletalMeshes;
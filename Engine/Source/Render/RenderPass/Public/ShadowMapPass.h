@@ -4,6 +4,7 @@
 #include "Global/Types.h"
 #include "Render/RenderPass/Public/ShadowData.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Optimization/Public/MultiViewCuller.h"
 
 class UMeshComponent;
 class ULightComponent;
@@ -11,6 +12,7 @@ class UDirectionalLightComponent;
 class USpotLightComponent;
 class UPointLightComponent;
 class UStaticMeshComponent;
+class ULevel;
 
 /**
  * @brief Shadow map 렌더링 전용 pass
@@ -21,6 +23,8 @@ class UStaticMeshComponent;
  * - Point Light: Cube shadow map (6면, omnidirectional)
  *
  * StaticMeshPass 이전에 실행되어 depth map을 준비합니다.
+ * 모든 라이트 뷰(캐스케이드, 스팟, 포인트 6면)는 FMultiViewCuller로 레벨의 공간 분할 트리를 한 번만 순회해
+ * 뷰마다 캐스터 목록을 만듭니다.
  */
 class FShadowMapPass : public FRenderPass
 {
@@ -126,47 +130,68 @@ private:
 	/**
 	 * @brief Directional light의 shadow map을 렌더링합니다.
 	 * @param Light Directional light component
-	 * @param StaticMeshes 렌더링할 static mesh 목록
-	 * @param SkeletalMeshes 렌더링할 skeletal mesh 목록
+	 * @param CascadeShadowMapData CalculateDirectionalShadowData로 계산한 캐스케이드 데이터
+	 * @param NumCascades 렌더링할 캐스케이드 수
+	 * @param CascadeCasters 캐스케이드마다 렌더링할 메시 목록 (NumCascades개)
 	 */
 	void RenderDirectionalShadowMap(
 		UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& StaticMeshes,
-		const TArray<USkeletalMeshComponent*>& SkeletalMeshes,
-		const FMinimalViewInfo& InViewInfo
+		const FCascadeShadowMapData& CascadeShadowMapData,
+		int32 NumCascades,
+		const TArray<const UMeshComponent*>* CascadeCasters
 		);
 
 	// --- Spot Light Shadow Rendering ---
 	/**
 	 * @brief Spot light의 shadow map을 렌더링합니다.
 	 * @param Light Spot light component
-	 * @param StaticMeshes 렌더링할 static mesh 목록
-	 * @param SkeletalMeshes 렌더링할 skeletal mesh 목록
+	 * @param LightView, LightProj CalculateSpotLightViewProj로 계산한 행렬
+	 * @param Casters 라이트 절두체에 걸친 메시 목록
 	 */
 	void RenderSpotShadowMap(
 		USpotLightComponent* Light,
 		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& StaticMeshes,
-		const TArray<USkeletalMeshComponent*>& SkeletalMeshes
+		const FMatrix& LightView,
+		const FMatrix& LightProj,
+		const TArray<const UMeshComponent*>& Casters
 	);
 
 	// --- Point Light Shadow Rendering (6 faces) ---
 	/**
 	 * @brief Point light의 cube shadow map을 렌더링합니다 (6면).
 	 * @param Light Point light component
-	 * @param StaticMeshes 렌더링할 static mesh 목록
-	 * @param SkeletalMeshes 렌더링할 skeletal mesh 목록
+	 * @param ViewProj CalculatePointLightViewProj로 계산한 6면의 view-projection 행렬
+	 * @param FaceCasters 면마다 렌더링할 메시 목록 (6개)
 	 */
 	void RenderPointShadowMap(
 		UPointLightComponent* Light,
 		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& StaticMeshes,
-		const TArray<USkeletalMeshComponent*>& SkeletalMeshes
+		const FMatrix* ViewProj,
+		const TArray<const UMeshComponent*>* FaceCasters
 	);
 
+	/**
+	 * @brief ShadowCuller에 등록된 라이트 뷰를 한 번에 컬링하고 뷰마다 ShadowCasters를 채웁니다.
+	 * @param InLevel 캐스터를 찾을 레벨. nullptr이면 모든 뷰가 AllShadowCasters를 사용합니다.
+	 * @param InShowFlags 카메라 경로와 같이 꺼진 메시 종류는 캐스터에서 뺍니다.
+	 */
+	void GatherShadowCasters(ULevel* InLevel, uint64 InShowFlags);
+
 	void SetShadowAtlasTilePositionStructuredBuffer();
 
 	// --- Helper Functions ---
+	/**
+	 * @brief Directional light의 그림자 투영 모드에 맞춰 캐스케이드 데이터를 계산합니다.
+	 * @param OutCascadeShadowMapData 출력 캐스케이드 데이터 (CSM이 아니면 1개)
+	 * @return 캐스케이드 수
+	 */
+	int32 CalculateDirectionalShadowData(
+		UDirectionalLightComponent* Light,
+		const TArray<UStaticMeshComponent*>& StaticMeshes,
+		const TArray<USkeletalMeshComponent*>& SkeletalMeshes,
+		const FMinimalViewInfo& InViewInfo,
+		FCascadeShadowMapData& OutCascadeShadowMapData);
+
 	/**
 	 * @brief Directional light의 view-projection 행렬을 계산합니다.
 	 * @param Light Directional light component
@@ -324,4 +349,9 @@ private:
 
 	// Handle Cascade Data
 	ID3D11Buffer* ConstantCascadeData = nullptr;
+
+	// 라이트 뷰 컬링 (매 프레임 재사용)
+	FMultiViewCuller ShadowCuller;
+	TArray<TArray<const UMeshComponent*>> ShadowCasters; // ShadowCuller의 뷰 인덱스마다 캐스터 목록
+	TArray<const UMeshComponent*> AllShadowCasters;      // 컬링하지 않는 뷰에서 쓰는 전체 캐스터 목록
 };
@@ -1,5 +1,12 @@
 ﻿#pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
+#include "Render/Renderer/Public/MeshDrawList.h"
+
+struct FCameraConstants;
+struct FStaticMesh;
+class UMaterial;
+class UStaticMesh;
+class UStaticMeshComponent;
 
 class FStaticMeshPass : public FRenderPass
 {
@@ -16,11 +23,33 @@ public:
 	void SetPixelShader(ID3D11PixelShader* InPS) { PS = InPS; }
 	void SetInputLayout(ID3D11InputLayout* InLayout) { InputLayout = InLayout; }
 
+	// 마지막 Execute에서 정렬한 draw 목록의 상태 변경 통계
+	const FMeshDrawListStats& GetDrawListStats() const { return DrawList.GetStats(); }
+
 private:
+	//@brief 뷰의 카메라에서 본 월드 AABB의 화면 크기로 LOD 선택
+	static int32 SelectLOD(const UStaticMesh* InStaticMesh, const FVector& InBoundsMin, const FVector& InBoundsMax, const FCameraConstants& InView);
+	//@brief 머티리얼 상수가 같은 (머티리얼, 컴포넌트 설정) 조합마다 하나의 ID (1부터)
+	uint32 GetDrawMaterialId(UMaterial* InMaterial, UStaticMeshComponent* InMeshComp);
+	void BindMaterial(UMaterial* Material, const UStaticMeshComponent* MeshComp);
+
     ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
     ID3D11InputLayout* InputLayout = nullptr;
     ID3D11DepthStencilState* DS = nullptr;
 
     ID3D11Buffer* ConstantBufferMaterial = nullptr;
+
+	// Draw 목록과 ID가 가리키는 대상 (프레임마다 재사용)
+	struct FDrawMaterial
+	{
+		UMaterial* Material;
+		UStaticMeshComponent* Component; // 노멀 맵 설정과 스크롤 시간
+	};
+	FMeshDrawList DrawList;
+	TArray<UStaticMeshComponent*> DrawPrimitives;  // PrimitiveId
+	TArray<UStaticMeshComponent*> DrawMeshes;      // MeshId, 그 FStaticMesh의 버퍼를 가진 첫 컴포넌트
+	TArray<FDrawMaterial> DrawMaterials;           // MaterialId - 1
+	TFlatMap<FStaticMesh*, uint32> MeshIds;
+	TFlatMap<UMaterial*, uint32> MaterialIds[2];       // 노멀 맵 사용 여부마다
 };
@@ -0,0 +1,154 @@
+#include "pch.h"
+#include "Render/Renderer/Public/MeshDrawList.h"
+
+namespace
+{
+	constexpr int32 RADIX_BITS = 8;
+	constexpr int32 RADIX_BUCKET_COUNT = 1 << RADIX_BITS;
+	constexpr int32 RADIX_PASS_COUNT = 64 / RADIX_BITS;
+
+	uint64 PackKeyField(uint64 InKey, uint32 InValue, uint32 InBits)
+	{
+		return (InKey << InBits) | (static_cast<uint64>(InValue) & ((1ull << InBits) - 1));
+	}
+
+	/**
+	 * @brief 거리를 깊이 필드로 양자화
+	 * @note 양수 float의 비트 패턴은 값과 같은 순서이므로 상위 비트(지수 8비트 + 가수 상위 11비트)만 남긴다
+	 */
+	uint32 QuantizeDepth(float InDepth)
+	{
+		if (!(InDepth > 0.0f))
+		{
+			return 0; // 음수와 NaN
+		}
+
+		uint32 Bits;
+		std::memcpy(&Bits, &InDepth, sizeof(Bits));
+		return Bits >> (32 - MESH_DRAW_KEY_DEPTH_BITS);
+	}
+}
+
+void FMeshDrawList::Reset()
+{
+	Items.Empty();
+	SortEntries.Empty();
+	Commands.Empty();
+	Stats = FMeshDrawListStats();
+}
+
+uint64 FMeshDrawList::MakeSortKey(const FMeshDrawItem& InItem)
+{
+	uint64 Key = 0;
+	Key = PackKeyField(Key, InItem.Pass, MESH_DRAW_KEY_PASS_BITS);
+	Key = PackKeyField(Key, InItem.MaterialId, MESH_DRAW_KEY_MATERIAL_BITS);
+	Key = PackKeyField(Key, InItem.MeshId, MESH_DRAW_KEY_MESH_BITS);
+	Key = PackKeyField(Key, QuantizeDepth(InItem.Depth), MESH_DRAW_KEY_DEPTH_BITS);
+	return Key;
+}
+
+void FMeshDrawList::Build(bool bSortByState)
+{
+	const int32 ItemCount = Items.Num();
+	SortEntries.SetNum(ItemCount);
+	for (int32 Index = 0; Index < ItemCount; ++Index)
+	{
+		SortEntries[Index] = { bSortByState ? MakeSortKey(Items[Index]) : 0ull, static_cast<uint32>(Index) };
+	}
+
+	if (bSortByState)
+	{
+		RadixSort();
+	}
+
+	// 직전 명령과 다른 상태만 플래그로 남긴다. 첫 명령은 모든 상태를 바인딩한다
+	Commands.SetNum(ItemCount);
+	Stats = FMeshDrawListStats();
+	Stats.DrawCount = ItemCount;
+
+	const FMeshDrawItem* Previous = nullptr;
+	uint32 CurrentMaterialId = MESH_DRAW_NO_MATERIAL;
+	for (int32 Index = 0; Index < ItemCount; ++Index)
+	{
+		const FMeshDrawItem& Item = Items[SortEntries[Index].ItemIndex];
+		FMeshDrawCommand& Command = Commands[Index];
+		Command.MaterialId = Item.MaterialId;
+		Command.MeshId = Item.MeshId;
+		Command.PrimitiveId = Item.PrimitiveId;
+		Command.StartIndex = Item.StartIndex;
+		Command.IndexCount = Item.IndexCount;
+		Command.StateFlags = 0;
+
+		if (Item.MaterialId != MESH_DRAW_NO_MATERIAL && Item.MaterialId != CurrentMaterialId)
+		{
+			Command.StateFlags |= MDS_Material;
+			++Stats.MaterialChangeCount;
+			CurrentMaterialId = Item.MaterialId;
+		}
+		if (!Previous || Previous->MeshId != Item.MeshId)
+		{
+			Command.StateFlags |= MDS_Mesh;
+			++Stats.MeshChangeCount;
+		}
+		if (!Previous || Previous->PrimitiveId != Item.PrimitiveId)
+		{
+			Command.StateFlags |= MDS_Primitive;
+			++Stats.PrimitiveChangeCount;
+		}
+		Previous = &Item;
+	}
+}
+
+void FMeshDrawList::RadixSort()
+{
+	const int32 EntryCount = SortEntries.Num();
+	if (EntryCount < 2)
+	{
+		return;
+	}
+	SortScratch.SetNum(EntryCount);
+
+	// 모든 자리의 히스토그램을 한 번에 센다
+	uint32 Histograms[RADIX_PASS_COUNT][RADIX_BUCKET_COUNT] = {};
+	for (const FSortEntry& Entry : SortEntries)
+	{
+		for (int32 Pass = 0; Pass < RADIX_PASS_COUNT; ++Pass)
+		{
+			++Histograms[Pass][(Entry.Key >> (Pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1)];
+		}
+	}
+
+	FSortEntry* Source = SortEntries.GetData();
+	FSortEntry* Destination = SortScratch.GetData();
+	for (int32 Pass = 0; Pass < RADIX_PASS_COUNT; ++Pass)
+	{
+		const int32 Shift = Pass * RADIX_BITS;
+		uint32* Histogram = Histograms[Pass];
+
+		// 모든 키가 이 자리에서 같으면 순서가 바뀌지 않는다 (ID가 작아 상위 바이트가 0인 경우가 흔하다)
+		if (Histogram[(Source[0].Key >> Shift) & (RADIX_BUCKET_COUNT - 1)] == static_cast<uint32>(EntryCount))
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < RADIX_BUCKET_COUNT; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 Index = 0; Index < EntryCount; ++Index)
+		{
+			const FSortEntry& Entry = Source[Index];
+			Destination[Histogram[(Entry.Key >> Shift) & (RADIX_BUCKET_COUNT - 1)]++] = Entry;
+		}
+		std::swap(Source, Destination);
+	}
+
+	if (Source != SortEntries.GetData())
+	{
+		std::memcpy(SortEntries.GetData(), Source, sizeof(FSortEntry) * EntryCount);
+	}
+}
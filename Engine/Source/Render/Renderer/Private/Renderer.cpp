@@ -14,6 +14,7 @@
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/Editor.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/GameInstance.h"
 #include "Level/Public/Level.h"
 #include "Manager/UI/Public/UIManager.h"
@@ -46,6 +47,34 @@
 
 class UGameInstance;
 
+namespace
+{
+	/**
+	 * @brief 레벨의 옥트리 원소 풀과 동적 트리 leaf를 제자리에서 훑으며 보이는 프리미티브마다 Function(UPrimitiveComponent*) 호출
+	 * 컬링 없이 그리는 경로가 프레임마다 장면 전체를 임시 배열에 모았다가 다시 복사하지 않도록 한다.
+	 */
+	template <typename FunctionType>
+	void ForEachVisiblePrimitive(ULevel* InLevel, FunctionType&& Function)
+	{
+		auto VisitIfVisible = [&Function](UPrimitiveComponent* Primitive)
+		{
+			if (Primitive && Primitive->IsVisible())
+			{
+				Function(Primitive);
+			}
+		};
+
+		if (FOctree* StaticOctree = InLevel->GetStaticOctree())
+		{
+			StaticOctree->ForEachPrimitive(VisitIfVisible);
+		}
+		if (FDynamicAABBTree* DynamicPrimitiveTree = InLevel->GetDynamicPrimitiveTree())
+		{
+			DynamicPrimitiveTree->ForEachPrimitive(VisitIfVisible);
+		}
+	}
+}
+
 IMPLEMENT_SINGLETON_CLASS(URenderer, UObject)
 
 URenderer::URenderer() = default;
@@ -1000,41 +1029,6 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 	const FCameraConstants& ViewProj = ViewInfo.CameraConstants;
 
 	static bool bCullingEnabled = false; // 임시 토글(초기값: 컬링 비활성)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
-	if (!bCullingEnabled)
-	{
-		// 1) 옥트리(정적 프리미티브) 전부 수집
-		if (FOctree* StaticOctree = WorldToRender->GetLevel()->GetStaticOctree())
-		{
-			TArray<UPrimitiveComponent*> AllStatics;
-			StaticOctree->GetAllPrimitives(AllStatics);
-
-			for (UPrimitiveComponent* Primitive : AllStatics)
-			{
-				if (Primitive && Primitive->IsVisible())
-				{
-					FinalVisiblePrims.Add(Primitive);
-				}
-			}
-		}
-		// 2) 동적 프리미티브 전부 수집
-		TArray<UPrimitiveComponent*> DynamicPrimitives = WorldToRender->GetLevel()->GetDynamicPrimitives();
-
-		for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				FinalVisiblePrims.Add(Primitive);
-			}
-		}
-	}
-	else
-	{
-		// Perform view frustum culling using ViewportClient's culler
-		// ViewportClient manages its own culler and handles Editor/PIE mode automatically
-		InViewport->GetViewportClient()->UpdateVisiblePrimitives(WorldToRender);
-		FinalVisiblePrims = InViewport->GetViewportClient()->GetVisiblePrimitives();
-	}
 
 	RenderingContext = FRenderingContext(
 		ViewInfo,
@@ -1043,10 +1037,10 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 		InViewport->GetRenderRect(),
 		{DeviceResources->GetViewportInfo().Width, DeviceResources->GetViewportInfo().Height}
 		);
+	RenderingContext.Level = WorldToRender->GetLevel();
 
 	// 1. Sort visible primitive components
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	auto AddVisiblePrimitive = [&](UPrimitiveComponent* Prim)
 	{
 		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
 		{
@@ -1086,6 +1080,22 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 		{
 			RenderingContext.Decals.Add(Decal);
 		}
+	};
+
+	if (!bCullingEnabled)
+	{
+		// 컬링 없이 옥트리와 동적 트리의 프리미티브를 제자리에서 훑는다
+		ForEachVisiblePrimitive(WorldToRender->GetLevel(), AddVisiblePrimitive);
+	}
+	else
+	{
+		// Perform view frustum culling using ViewportClient's culler
+		// ViewportClient manages its own culler and handles Editor/PIE mode automatically
+		InViewport->GetViewportClient()->UpdateVisiblePrimitives(WorldToRender);
+		for (UPrimitiveComponent* Prim : InViewport->GetViewportClient()->GetVisiblePrimitives())
+		{
+			AddVisiblePrimitive(Prim);
+		}
 	}
 
 	for (const auto& LightComponent : CurrentLevel->GetLightComponents())
@@ -1361,35 +1371,8 @@ void URenderer::RenderHitProxyPass(UCamera* InCamera, const D3D11_VIEWPORT& InVi
 		FVector2(InViewport.Width, InViewport.Height)
 	);
 
-	// 모든 Primitive 컴포넌트 수집
-	TArray<UPrimitiveComponent*> AllVisiblePrims;
-
-	// Static Octree에서 정적 프리미티브 수집
-	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
-	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-		for (UPrimitiveComponent* Primitive : AllStatics)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				AllVisiblePrims.Add(Primitive);
-			}
-		}
-	}
-
-	// 동적 프리미티브 수집
-	TArray<UPrimitiveComponent*> DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	{
-		if (Primitive && Primitive->IsVisible())
-		{
-			AllVisiblePrims.Add(Primitive);
-		}
-	}
-
-	// Primitive 타입별로 분류
-	for (auto& Prim : AllVisiblePrims)
+	// 보이는 Primitive를 옥트리와 동적 트리에서 제자리로 훑으며 타입별로 분류
+	ForEachVisiblePrimitive(CurrentLevel, [&](UPrimitiveComponent* Prim)
 	{
 		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
 		{
@@ -1421,7 +1404,7 @@ void URenderer::RenderHitProxyPass(UCamera* InCamera, const D3D11_VIEWPORT& InVi
 			Context.BillBoards.Add(BillBoard);
 		}
 		// 필요하면 다른 타입도 추가 가능
-	}
+	});
 
 	// HitProxyPass 실행
 	HitProxyPass->SetRenderTargets(DeviceResources);
@@ -1473,34 +1456,6 @@ void URenderer::RenderLevelForGameInstance(UWorld* InWorld, const FSceneView* In
 		D3DViewport.MaxDepth = 1.0f;
 	}
 
-	// Visible primitives 수집 (컬링 없이 전체 수집)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
-
-	// 1) Static primitives from Octree
-	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
-	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-
-		for (UPrimitiveComponent* Primitive : AllStatics)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				FinalVisiblePrims.Add(Primitive);
-			}
-		}
-	}
-
-	// 2) Dynamic primitives
-	TArray<UPrimitiveComponent*> DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	{
-		if (Primitive && Primitive->IsVisible())
-		{
-			FinalVisiblePrims.Add(Primitive);
-		}
-	}
-
 	// Legacy Camera for D2D overlay (used by Lua debug drawing)
 	UCamera* LegacyCamera = nullptr;
 	UGameViewportClient* ViewportClient = InGameInstance->GetViewportClient();
@@ -1532,10 +1487,11 @@ void URenderer::RenderLevelForGameInstance(UWorld* InWorld, const FSceneView* In
 		D3DViewport,
 		{DeviceResources->GetViewportInfo().Width, DeviceResources->GetViewportInfo().Height}
 	);
+	RenderingContext.Level = CurrentLevel;
 
 	// Primitives 분류 (Editor 요소 제외)
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	// 컬링 없이 옥트리와 동적 트리의 보이는 프리미티브를 제자리에서 훑는다
+	ForEachVisiblePrimitive(CurrentLevel, [&](UPrimitiveComponent* Prim)
 	{
 		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
 		{
@@ -1561,7 +1517,7 @@ void URenderer::RenderLevelForGameInstance(UWorld* InWorld, const FSceneView* In
 		{
 			RenderingContext.Decals.Add(Decal);
 		}
-	}
+	});
 
 	// Light Components 수집
 	for (const auto& LightComponent : CurrentLevel->GetLightComponents())
@@ -1691,34 +1647,6 @@ void URenderer::RenderPreviewWorld(UWorld* InPreviewWorld, const FSceneView* InS
 	ViewProj.NearClip = InSceneView->GetNearClippingPlane();
 	ViewProj.FarClip = InSceneView->GetFarClippingPlane();
 
-	// Visible primitives 수집
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
-
-	// 1) Static primitives from Octree
-	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
-	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-
-		for (UPrimitiveComponent* Primitive : AllStatics)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				FinalVisiblePrims.Add(Primitive);
-			}
-		}
-	}
-
-	// 2) Dynamic primitives
-	TArray<UPrimitiveComponent*> DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	{
-		if (Primitive && Primitive->IsVisible())
-		{
-			FinalVisiblePrims.Add(Primitive);
-		}
-	}
-
 	// Build FMinimalViewInfo from SceneView
 	FMinimalViewInfo ViewInfo;
 	ViewInfo.Location = InSceneView->GetViewLocation();
@@ -1742,10 +1670,11 @@ void URenderer::RenderPreviewWorld(UWorld* InPreviewWorld, const FSceneView* InS
 		InViewport,
 		ViewportSize
 	);
+	RenderingContext.Level = CurrentLevel;
 
 	// Primitives 분류
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	// 컬링 없이 옥트리와 동적 트리의 보이는 프리미티브를 제자리에서 훑는다
+	ForEachVisiblePrimitive(CurrentLevel, [&](UPrimitiveComponent* Prim)
 	{
 		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
 		{
@@ -1770,7 +1699,7 @@ void URenderer::RenderPreviewWorld(UWorld* InPreviewWorld, const FSceneView* InS
 		{
 			RenderingContext.Decals.Add(Decal);
 		}
-	}
+	});
 
 	// Light Components 수집
 	for (const auto& LightComponent : CurrentLevel->GetLightComponents())
@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+* @brief 정렬 키 비트 배치 (상위 비트부터 pass, material, mesh, depth)
+* @note 상태를 바꾸는 비용이 큰 순서로 묶이고, 같은 메시 안에서는 앞에서 뒤로 그린다.
+*       셰이더는 패스가 뷰 모드마다 한 쌍만 쓰므로 키에 넣지 않는다. 패스마다 셰이더가 다르면 Pass로 나눈다.
+*       ID가 필드 폭을 넘으면 잘린 값으로 정렬될 뿐, 상태 변경 판단은 FMeshDrawItem의 실제 ID로 한다.
+*/
+constexpr uint32 MESH_DRAW_KEY_DEPTH_BITS = 20;
+constexpr uint32 MESH_DRAW_KEY_MESH_BITS = 20;
+constexpr uint32 MESH_DRAW_KEY_MATERIAL_BITS = 20;
+constexpr uint32 MESH_DRAW_KEY_PASS_BITS = 4;
+static_assert(MESH_DRAW_KEY_DEPTH_BITS + MESH_DRAW_KEY_MESH_BITS + MESH_DRAW_KEY_MATERIAL_BITS
+	+ MESH_DRAW_KEY_PASS_BITS == 64, "정렬 키는 64비트를 모두 사용한다");
+
+constexpr uint32 MESH_DRAW_NO_MATERIAL = 0; // 머티리얼을 바인딩하지 않는 draw (이전 머티리얼을 그대로 쓴다)
+
+/**
+* @brief Draw 하나를 만드는 데 필요한 상태의 ID. ID의 의미(어떤 머티리얼, 버퍼인지)는 목록을 채운 패스가 정한다.
+*/
+struct FMeshDrawItem
+{
+	uint32 Pass = 0;
+	uint32 MaterialId = MESH_DRAW_NO_MATERIAL;
+	uint32 MeshId = 0;        // 정점/인덱스 버퍼
+	uint32 PrimitiveId = 0;   // 모델 상수 버퍼 (월드 행렬)
+	float Depth = 0.0f;       // 카메라까지의 거리 (음수는 0으로 취급)
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+};
+
+enum EMeshDrawStateFlags : uint32
+{
+	MDS_Material = 1 << 0,
+	MDS_Mesh = 1 << 1,
+	MDS_Primitive = 1 << 2,
+};
+constexpr int32 MESH_DRAW_STATE_COUNT = 3;
+
+/**
+* @brief 재생할 draw 하나. StateFlags에 있는 상태만 바인딩하고 나머지는 직전 명령의 상태를 그대로 쓴다.
+*/
+struct FMeshDrawCommand
+{
+	uint32 StateFlags = 0; // EMeshDrawStateFlags
+	uint32 MaterialId = MESH_DRAW_NO_MATERIAL;
+	uint32 MeshId = 0;
+	uint32 PrimitiveId = 0;
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+};
+
+struct FMeshDrawListStats
+{
+	int32 DrawCount = 0;
+	int32 MaterialChangeCount = 0;
+	int32 MeshChangeCount = 0;
+	int32 PrimitiveChangeCount = 0;
+
+	//@brief draw마다 모든 상태를 바인딩했을 때와 비교해 생략한 상태 변경 수
+	int32 GetSkippedStateChangeCount() const
+	{
+		return DrawCount * MESH_DRAW_STATE_COUNT - (MaterialChangeCount + MeshChangeCount + PrimitiveChangeCount);
+	}
+};
+
+/**
+* @brief 패스가 모은 draw를 64비트 키로 radix 정렬하고 중복 상태 변경을 뺀 명령 목록으로 만드는 CPU 측 draw 목록
+* @note D3D 타입을 쓰지 않으므로 목록 구성과 정렬은 렌더러 없이 검증할 수 있다 (bench drawlist).
+*       실제 바인딩은 명령을 재생하는 패스가 UPipeline으로 수행한다. 메모리는 프레임마다 재사용한다.
+*/
+class FMeshDrawList
+{
+public:
+	void Reset();
+	void AddDraw(const FMeshDrawItem& InItem) { Items.Add(InItem); }
+	int32 Num() const { return Items.Num(); }
+
+	/**
+	* @brief 명령 목록과 상태 변경 통계를 만든다
+	* @param bSortByState false이면 추가한 순서 그대로 명령을 만든다 (비교용)
+	*/
+	void Build(bool bSortByState = true);
+
+	const TArray<FMeshDrawCommand>& GetCommands() const { return Commands; }
+	const FMeshDrawListStats& GetStats() const { return Stats; }
+
+	static uint64 MakeSortKey(const FMeshDrawItem& InItem);
+
+private:
+	struct FSortEntry
+	{
+		uint64 Key;
+		uint32 ItemIndex;
+	};
+
+	//@brief SortEntries를 키 기준으로 안정 정렬 (8비트씩 8회 LSD radix, 모든 키가 같은 자리는 건너뛴다)
+	void RadixSort();
+
+	TArray<FMeshDrawItem> Items;
+	TArray<FSortEntry> SortEntries;
+	TArray<FSortEntry> SortScratch;
+	TArray<FMeshDrawCommand> Commands;
+	FMeshDrawListStats Stats;
+};
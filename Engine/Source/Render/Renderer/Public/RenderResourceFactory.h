@@ -53,8 +53,8 @@ public:
 		memcpy(MappedResource.pData, &Data, sizeof(T));
 		URenderer::GetInstance().GetDeviceContext()->Unmap(Buffer, 0);
 	}
-	template<typename T>
-	static void UpdateStructuredBuffer(ID3D11Buffer* Buffer, const TArray<T>& Datas)
+	template<typename T, typename AllocatorType>
+	static void UpdateStructuredBuffer(ID3D11Buffer* Buffer, const TArray<T, AllocatorType>& Datas)
 	{
 		D3D11_MAPPED_SUBRESOURCE MappedResource = {};
 		URenderer::GetInstance().GetDeviceContext()->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
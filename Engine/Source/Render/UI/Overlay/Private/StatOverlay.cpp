@@ -4,6 +4,9 @@
 #include "Render/Renderer/Public/Renderer.h"
 #include "Render/UI/Overlay/Public/D2DOverlayManager.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/ObjectPool.h"
+#include "Runtime/Core/Public/Memory/FrameMemory.h"
 
 IMPLEMENT_SINGLETON_CLASS(UStatOverlay, UObject)
 
@@ -46,6 +49,14 @@ void UStatOverlay::Render()
     {
         RenderShadowInfo();
     }
+    if (IsStatEnabled(EStatType::Overlap))
+    {
+        RenderOverlapInfo();
+    }
+    if (IsStatEnabled(EStatType::Tasks))
+    {
+        RenderTaskInfo();
+    }
 }
 
 void UStatOverlay::RenderFPS()
@@ -69,13 +80,65 @@ void UStatOverlay::RenderMemory()
 {
     float MemoryMB = static_cast<float>(TotalAllocationBytes.load(std::memory_order_relaxed)) / (1024.0f * 1024.0f);
 
-    char Buf[64];
-    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount.load(std::memory_order_relaxed));
+    // 스태틱 메시 정점: 로드 시 FNormalVertex로 풀어 올리는 정점 버퍼 크기와 쿠킹 파일에 저장된 정점 스트림 크기.
+    // 압축은 쿠킹 파일에만 적용되므로 앞의 값(상주 메모리)은 압축 여부와 관계없다
+    const uint64 VertexBytes = UStaticMesh::GetTotalVertexBytes();
+    const uint64 DiskVertexBytes = UStaticMesh::GetTotalDiskVertexBytes();
+
+    // 지난 프레임의 힙 할당 횟수와 프레임 메모리(TFrameArray) 사용량
+    const FFrameMemoryStats& FrameStats = FFrameMemory::GetInstance().GetLastFrameStats();
+
+    char Buf[256];
+    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects) | Mesh VB: %.1f MB (FNormalVertex) | Cooked Vertices: %.1f MB | Heap Allocs/Frame: %llu | Frame Memory: %.1f / %.1f KB",
+        MemoryMB, TotalAllocationCount.load(std::memory_order_relaxed),
+        static_cast<float>(VertexBytes) / (1024.0f * 1024.0f), static_cast<float>(DiskVertexBytes) / (1024.0f * 1024.0f),
+        static_cast<unsigned long long>(FrameStats.HeapAllocationCount),
+        static_cast<float>(FrameStats.UsedBytes + FrameStats.OverflowBytes) / 1024.0f, static_cast<float>(FrameStats.Capacity) / 1024.0f);
     FString text = Buf;
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
     RenderText(text, OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 0.0f);
+
+    // 클래스별 객체 풀: 전체 합계와 살아 있는 객체가 많은 클래스 몇 개의 live/peak
+    constexpr int32 MaxPoolClasses = 4;
+    TArray<TPair<UClass*, FObjectPoolStats>> PoolStats;
+    uint32 TotalLive = 0;
+    uint32 TotalPeak = 0;
+    uint64 TotalSlabBytes = 0;
+    for (UClass* Class : UClass::FindClasses(UObject::StaticClass()))
+    {
+        const FObjectPool* Pool = Class->GetObjectPool();
+        if (!Pool)
+        {
+            continue;
+        }
+
+        const FObjectPoolStats Stats = Pool->GetStats();
+        if (Stats.PeakCount == 0)
+        {
+            continue;
+        }
+        TotalLive += Stats.LiveCount;
+        TotalPeak += Stats.PeakCount;
+        TotalSlabBytes += static_cast<uint64>(Stats.SlabCount) * Stats.SlotsPerSlab * Stats.SlotSize;
+        PoolStats.Add({ Class, Stats });
+    }
+    std::sort(PoolStats.begin(), PoolStats.end(), [](const TPair<UClass*, FObjectPoolStats>& A, const TPair<UClass*, FObjectPoolStats>& B)
+    {
+        return A.second.LiveCount > B.second.LiveCount;
+    });
+
+    FString PoolText;
+    (void)sprintf_s(Buf, sizeof(Buf), "Object Pools: %u live / %u peak in %.1f KB slabs", TotalLive, TotalPeak, static_cast<float>(TotalSlabBytes) / 1024.0f);
+    PoolText = Buf;
+    for (int32 Index = 0; Index < std::min(PoolStats.Num(), MaxPoolClasses); ++Index)
+    {
+        (void)sprintf_s(Buf, sizeof(Buf), "%s %s %u/%u", Index == 0 ? " |" : ",",
+            PoolStats[Index].first->GetName().ToString().c_str(), PoolStats[Index].second.LiveCount, PoolStats[Index].second.PeakCount);
+        PoolText += Buf;
+    }
+    RenderText(PoolText, OverlayX, OverlayY + OffsetY + 20.0f, 1.0f, 1.0f, 0.0f);
 }
 
 void UStatOverlay::RenderPicking()
@@ -89,7 +152,7 @@ void UStatOverlay::RenderPicking()
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
 
     float r = 0.0f, g = 1.0f, b = 0.8f;
     if (LastPickingTimeMs > 5.0f) { r = 1.0f; g = 0.0f; b = 0.0f; }
@@ -107,7 +170,7 @@ void UStatOverlay::RenderDecalInfo()
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))      OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory))   OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory))   OffsetY += 40.0f;
     if (IsStatEnabled(EStatType::Picking))  OffsetY += 20.0f;
 
     float r = 0.5f, g = 1.0f, b = 0.5f;
@@ -129,7 +192,7 @@ void UStatOverlay::RenderTimeInfo()
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
     if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Shadow))
@@ -142,6 +205,12 @@ void UStatOverlay::RenderTimeInfo()
             OffsetY += 60.0f;
         }
     }
+    if (IsStatEnabled(EStatType::Overlap)) OffsetY += 40.0f;
+    if (IsStatEnabled(EStatType::Tasks))
+    {
+        // 요약 1줄 + 스레드당 1줄
+        OffsetY += 20.0f * (1 + TaskWorkerStats.Num());
+    }
 
     float CurrentY = OverlayY + OffsetY;
     const float LineHeight = 20.0f;
@@ -166,7 +235,7 @@ void UStatOverlay::RenderShadowInfo()
 {
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
     if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
     if (IsStatEnabled(EStatType::Decal))  OffsetY += 40.0f;
 
@@ -314,6 +383,120 @@ void UStatOverlay::RenderShadowInfo()
     }
 }
 
+void UStatOverlay::RenderOverlapInfo()
+{
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Shadow))
+    {
+        OffsetY += 140.0f;
+        if (DirectionalLightCount > 0)
+        {
+            OffsetY += 60.0f;
+        }
+    }
+
+    float CurrentY = OverlayY + OffsetY;
+    constexpr float LineHeight = 20.0f;
+
+    // Broad phase: 등록된 proxy, 이번 프레임에 이동한 proxy, AABB overlap pair 수
+    {
+        char Buf[256];
+        (void)sprintf_s(Buf, sizeof(Buf), "Overlap Broadphase: %u proxies, %u moved, %u pairs (%.3f ms)",
+            OverlapProxyCount, OverlapMovedProxyCount, OverlapPairCount, OverlapBroadphaseMs);
+        FString Text = Buf;
+        float r = 0.5f, g = 0.8f, b = 1.0f;
+        if (OverlapBroadphaseMs > 1.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
+        RenderText(Text, OverlayX, CurrentY, r, g, b);
+        CurrentY += LineHeight;
+    }
+
+    // Narrow phase: shape 테스트 수와 발생한 Begin/End 이벤트 수
+    {
+        char Buf[256];
+        (void)sprintf_s(Buf, sizeof(Buf), "Overlap Narrowphase: %u tests, %u begin, %u end (%.3f ms)",
+            OverlapNarrowTestCount, BeginOverlapCount, EndOverlapCount, OverlapNarrowphaseMs);
+        FString Text = Buf;
+        float r = 0.5f, g = 0.8f, b = 1.0f;
+        if (OverlapNarrowphaseMs > 1.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
+        RenderText(Text, OverlayX, CurrentY, r, g, b);
+    }
+}
+
+void UStatOverlay::RenderTaskInfo()
+{
+    FTaskScheduler::GetInstance().SampleWorkerStats(TaskWorkerStats, TaskSampleElapsedMs);
+
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Shadow))
+    {
+        OffsetY += 140.0f;
+        if (DirectionalLightCount > 0)
+        {
+            OffsetY += 60.0f;
+        }
+    }
+    if (IsStatEnabled(EStatType::Overlap)) OffsetY += 40.0f;
+
+    float CurrentY = OverlayY + OffsetY;
+    constexpr float LineHeight = 20.0f;
+
+    if (TaskWorkerStats.IsEmpty() || TaskSampleElapsedMs <= 0.0)
+    {
+        RenderText("Task Scheduler: not running", OverlayX, CurrentY, 0.8f, 0.8f, 0.8f);
+        return;
+    }
+
+    // 요약: 전체 스레드의 평균 사용률 (태스크를 실행한 시간 / 경과 시간)
+    uint32 TotalTasks = 0;
+    double TotalBusyMs = 0.0;
+    for (const FTaskWorkerStats& Stats : TaskWorkerStats)
+    {
+        TotalTasks += Stats.TaskCount;
+        TotalBusyMs += Stats.BusyMs;
+    }
+    {
+        const double AverageUtilization = TotalBusyMs / (TaskSampleElapsedMs * TaskWorkerStats.Num()) * 100.0;
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "Task Scheduler: %d threads, %u tasks, %.1f%% avg utilization",
+            TaskWorkerStats.Num(), TotalTasks, AverageUtilization);
+        FString Text = Buf;
+        RenderText(Text, OverlayX, CurrentY, 0.6f, 1.0f, 0.6f);
+        CurrentY += LineHeight;
+    }
+
+    // 스레드별 사용률. 0번은 메인 스레드가 Wait/ParallelFor 중에 실행한 태스크만 포함
+    for (int32 ThreadIndex = 0; ThreadIndex < TaskWorkerStats.Num(); ++ThreadIndex)
+    {
+        const FTaskWorkerStats& Stats = TaskWorkerStats[ThreadIndex];
+        const double Utilization = std::min(Stats.BusyMs / TaskSampleElapsedMs * 100.0, 100.0);
+
+        char Buf[128];
+        if (ThreadIndex == 0)
+        {
+            (void)sprintf_s(Buf, sizeof(Buf), "  Main    : %5.1f%% | %u tasks, %u steals", Utilization, Stats.TaskCount, Stats.StealCount);
+        }
+        else
+        {
+            (void)sprintf_s(Buf, sizeof(Buf), "  Worker %d: %5.1f%% | %u tasks, %u steals", ThreadIndex, Utilization, Stats.TaskCount, Stats.StealCount);
+        }
+        FString Text = Buf;
+
+        float r = 0.8f, g = 0.8f, b = 0.8f;
+        if (Utilization > 50.0) { r = 0.5f; g = 1.0f; b = 0.5f; }
+        if (Utilization > 90.0) { r = 1.0f; g = 1.0f; b = 0.0f; }
+        RenderText(Text, OverlayX, CurrentY, r, g, b);
+        CurrentY += LineHeight;
+    }
+}
+
 void UStatOverlay::RenderText(const FString& Text, float x, float y, float r, float g, float b)
 {
     if (Text.empty())
@@ -389,3 +572,15 @@ void UStatOverlay::RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPo
     UsedAtlasTiles = InUsedAtlasTiles;
     MaxAtlasTiles = InMaxAtlasTiles;
 }
+
+void UStatOverlay::RecordOverlapStats(uint32 InProxyCount, uint32 InMovedProxyCount, uint32 InPairCount, uint32 InNarrowTestCount, uint32 InBeginOverlapCount, uint32 InEndOverlapCount, float InBroadphaseMs, float InNarrowphaseMs)
+{
+    OverlapProxyCount = InProxyCount;
+    OverlapMovedProxyCount = InMovedProxyCount;
+    OverlapPairCount = InPairCount;
+    OverlapNarrowTestCount = InNarrowTestCount;
+    BeginOverlapCount = InBeginOverlapCount;
+    EndOverlapCount = InEndOverlapCount;
+    OverlapBroadphaseMs = InBroadphaseMs;
+    OverlapNarrowphaseMs = InNarrowphaseMs;
+}
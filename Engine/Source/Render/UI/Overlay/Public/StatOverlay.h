@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
 
 enum class EStatType : uint8
 {
@@ -10,7 +11,9 @@ enum class EStatType : uint8
 	Decal =		1 << 3,  // 8
 	Time =		1 << 4,	 // 16
 	Shadow =	1 << 5,  // 32
-	All = FPS | Memory | Picking | Time | Decal | Shadow
+	Overlap =	1 << 6,  // 64
+	Tasks =		1 << 7,  // 128
+	All = FPS | Memory | Picking | Time | Decal | Shadow | Overlap | Tasks
 };
 
 UCLASS()
@@ -31,6 +34,8 @@ public:
 	void ToggleTime() { IsStatEnabled(EStatType::Time) ? DisableStat(EStatType::Time) : EnableStat(EStatType::Time); }
 	void ToggleDecal() { IsStatEnabled(EStatType::Decal) ? DisableStat(EStatType::Decal) : EnableStat(EStatType::Decal); }
 	void ToggleShadow() { IsStatEnabled(EStatType::Shadow) ? DisableStat(EStatType::Shadow) : EnableStat(EStatType::Shadow); }
+	void ToggleOverlap() { IsStatEnabled(EStatType::Overlap) ? DisableStat(EStatType::Overlap) : EnableStat(EStatType::Overlap); }
+	void ToggleTasks() { IsStatEnabled(EStatType::Tasks) ? DisableStat(EStatType::Tasks) : EnableStat(EStatType::Tasks); }
 	void ToggleAll() { IsStatEnabled(EStatType::All) ? DisableStat(EStatType::All) : EnableStat(EStatType::All); }
 
 	// Stat control methods (명시적 켜기/끄기)
@@ -40,6 +45,8 @@ public:
 	void ShowTime() { EnableStat(EStatType::Time); }
 	void ShowDecal() { EnableStat(EStatType::Decal); }
 	void ShowShadow() { EnableStat(EStatType::Shadow); }
+	void ShowOverlap() { EnableStat(EStatType::Overlap); }
+	void ShowTasks() { EnableStat(EStatType::Tasks); }
 	void ShowAll() { EnableStat(EStatType::All); }
 	void HideAll() { SetStatType(EStatType::None); }
 
@@ -47,6 +54,7 @@ public:
 	void RecordPickingStats(float ElapsedMS);
 	void RecordDecalStats(uint32 InRenderedDecal, uint32 InCollidedCompCount);
 	void RecordShadowStats(uint32 InDirectionalLightCount, uint32 InPointLightCount, uint32 InSpotLightCount, uint32 InAmbientLightCount, uint64 InShadowMapMemoryBytes, uint64 InRenderTargetMemoryBytes, uint32 InUsedAtlasTiles, uint32 InMaxAtlasTiles);
+	void RecordOverlapStats(uint32 InProxyCount, uint32 InMovedProxyCount, uint32 InPairCount, uint32 InNarrowTestCount, uint32 InBeginOverlapCount, uint32 InEndOverlapCount, float InBroadphaseMs, float InNarrowphaseMs);
 
 private:
 	void RenderFPS();
@@ -55,6 +63,8 @@ private:
 	void RenderDecalInfo();
 	void RenderTimeInfo();
 	void RenderShadowInfo();
+	void RenderOverlapInfo();
+	void RenderTaskInfo();
 	void RenderText(const FString& Text, float X, float Y, float R, float G, float B);
 
 	// FPS Stats
@@ -80,6 +90,20 @@ private:
 	uint32 UsedAtlasTiles = 0;
 	uint32 MaxAtlasTiles = 0;
 
+	// Overlap Stats
+	uint32 OverlapProxyCount = 0;
+	uint32 OverlapMovedProxyCount = 0;
+	uint32 OverlapPairCount = 0;
+	uint32 OverlapNarrowTestCount = 0;
+	uint32 BeginOverlapCount = 0;
+	uint32 EndOverlapCount = 0;
+	float OverlapBroadphaseMs = 0.0f;
+	float OverlapNarrowphaseMs = 0.0f;
+
+	// Task Scheduler Stats (RenderTaskInfo에서 매 프레임 샘플링)
+	TArray<FTaskWorkerStats> TaskWorkerStats;
+	double TaskSampleElapsedMs = 0.0;
+
 	// Rendering position
 	float OverlayX = 18.0f;
 	float OverlayY = 135.0f;
@@ -255,7 +255,7 @@ FMinimalViewInfo FViewportClient::GetViewInfo() const
 
 const TArray<UPrimitiveComponent*>& FViewportClient::GetVisiblePrimitives() const
 {
-    return ViewFrustumCuller.GetRenderableObjects();
+    return VisiblePrimitives;
 }
 
 void FViewportClient::UpdateVisiblePrimitives(UWorld* InWorld)
@@ -269,10 +269,13 @@ void FViewportClient::UpdateVisiblePrimitives(UWorld* InWorld)
     const FCameraConstants& CameraConst = GetCameraConstants();
 
     // Perform frustum culling
-    TArray<UPrimitiveComponent*> DynamicPrimitives = InWorld->GetLevel()->GetDynamicPrimitives();
     ViewFrustumCuller.Cull(
         InWorld->GetLevel()->GetStaticOctree(),
-        DynamicPrimitives,
+        InWorld->GetLevel()->GetDynamicPrimitiveTree(),
         CameraConst
     );
+
+    // Perform occlusion culling on the frustum result
+    OcclusionCuller.InitializeCuller(CameraConst.View, CameraConst.Projection);
+    VisiblePrimitives = OcclusionCuller.PerformCulling(ViewFrustumCuller.GetRenderableObjects(), CameraConst.ViewWorldLocation);
 }
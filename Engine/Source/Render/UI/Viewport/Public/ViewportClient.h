@@ -2,6 +2,7 @@
 
 #include "Editor/Public/Camera.h"
 #include "Optimization/Public/ViewVolumeCuller.h"
+#include "Optimization/Public/OcclusionCuller.h"
 
 class FViewport;
 class APlayerCameraManager;
@@ -82,14 +83,14 @@ public:
     FMinimalViewInfo GetViewInfo() const;
 
     /**
-     * Get visible primitives after frustum culling
-     * Returns the cached result of view frustum culling performed in PrepareCamera()
+     * Get visible primitives after frustum and occlusion culling
+     * Returns the cached result of culling performed in UpdateVisiblePrimitives()
      * @return Array of visible primitive components
      */
     const TArray<class UPrimitiveComponent*>& GetVisiblePrimitives() const;
 
     /**
-     * Perform view frustum culling for the current world
+     * Perform view frustum culling, then occlusion culling against the largest on-screen occluders
      * Should be called before rendering to update visible primitives
      * @param InWorld World to cull primitives from
      */
@@ -122,4 +123,8 @@ private:
 
     // View frustum culling (독립적으로 관리)
     ViewVolumeCuller ViewFrustumCuller;
+
+    // 프러스텀 컬링 결과에서 가려진 메시를 제외
+    COcclusionCuller OcclusionCuller;
+    TArray<class UPrimitiveComponent*> VisiblePrimitives;
 };
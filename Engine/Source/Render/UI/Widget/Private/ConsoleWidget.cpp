@@ -8,6 +8,8 @@
 #include "Utility/Public/UELogParser.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Utility/Public/LogFileWriter.h"
+#include "Utility/Public/EngineBenchmark.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
 
 // #define IMGUI_DEFINE_MATH_OPERATORS
 // #include "ImGui/imgui_internal.h"
@@ -112,6 +114,8 @@ streamsize ConsoleStreamBuffer::xsputn(const char* InString, streamsize InCount)
 
 void UConsoleWidget::RenderWidget()
 {
+	FlushWorkerLogs();
+
 	// 버튼 색상을 검은색으로 설정
 	ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 0.0f, 0.0f, 1.0f));
 	ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
@@ -408,6 +412,7 @@ void UConsoleWidget::Update()
 {
 	// 필요한 경우 여기에 업데이트 로직 추가할 것
 	// ImGui 위주라서 필요하지 않을 것으로 보이긴 함...
+	FlushWorkerLogs();
 }
 
 void UConsoleWidget::ClearLog()
@@ -534,36 +539,79 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 
 	// Log buffer 복사 후 제거
 	LogEntry.Message = FString(Buffer);
+	delete[] Buffer;
+
+	// 워커 스레드(에셋 로딩 태스크 등)의 로그는 메인 스레드가 옮겨 담을 때까지 따로 보관
+	// LogItems는 렌더링 중에 순회되므로 메인 스레드에서만 수정한다
+	if (FTaskScheduler::GetCurrentThreadIndex() > 0)
+	{
+		std::lock_guard<std::mutex> Lock(WorkerLogMutex);
+		WorkerLogs.push_back(std::move(LogEntry));
+		return;
+	}
 
+	FlushWorkerLogs();
+	AppendLogEntry(LogEntry);
+}
+
+/**
+ * @brief 완성된 로그를 파일(또는 임시 버퍼)과 화면 목록에 추가. 메인 스레드 전용
+ */
+void UConsoleWidget::AppendLogEntry(const FLogEntry& InLogEntry)
+{
 	// 파일에 로그 작성 또는 임시 버퍼에 저장
 	if (LogFileWriter && LogFileWriter->IsInitialized())
 	{
 		// LogFileWriter가 초기화되었으면 파일에 작성
-		FString FileLog = GetLogTypePrefix(InType);
+		FString FileLog = GetLogTypePrefix(InLogEntry.Type);
 		FileLog += " ";
-		FileLog += Buffer;
+		FileLog += InLogEntry.Message;
 		LogFileWriter->AddLog(FileLog);
 	}
 	else
 	{
 		// 아직 초기화되지 않았으면 임시 버퍼에 저장
-		PendingLogs.push_back(LogEntry);
+		PendingLogs.push_back(InLogEntry);
 	}
 
-	delete[] Buffer;
-
 	// 200개 초과 시 가장 오래된 로그 제거
 	if (LogItems.size() >= 200)
 	{
 		LogItems.pop_front();
 	}
 
-	LogItems.push_back(LogEntry);
+	LogItems.push_back(InLogEntry);
 
 	// Auto Scroll
 	bIsScrollToBottom = true;
 }
 
+/**
+ * @brief 워커 스레드가 남긴 로그를 기록된 순서대로 옮겨 담음. 메인 스레드 전용
+ */
+void UConsoleWidget::FlushWorkerLogs()
+{
+	if (FTaskScheduler::GetCurrentThreadIndex() > 0)
+	{
+		return;
+	}
+
+	std::deque<FLogEntry> Logs;
+	{
+		std::lock_guard<std::mutex> Lock(WorkerLogMutex);
+		if (WorkerLogs.empty())
+		{
+			return;
+		}
+		std::swap(Logs, WorkerLogs);
+	}
+
+	for (const FLogEntry& LogEntry : Logs)
+	{
+		AppendLogEntry(LogEntry);
+	}
+}
+
 /**
  * @brief 시스템 로그들을 처리하기 위한 멤버 함수
  * @param InText log text
@@ -799,6 +847,19 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Bench 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench ")
+	{
+		FString BenchName = CommandLower.substr(6);
+		if (!FEngineBenchmark::Run(BenchName))
+		{
+			AddLog(ELogType::Error, "Unknown benchmark: %s", BenchName.data());
+			FEngineBenchmark::PrintAvailable();
+		}
+	}
+
 	// shadow_filter 명령어 처리
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -983,7 +1044,10 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT SHADOW - Show light and shadow map stats");
+		AddLog(ELogType::Info, "  STAT OVERLAP - Show overlap broadphase/narrowphase stats");
+		AddLog(ELogType::Info, "  STAT TASKS - Show task scheduler per-thread utilization");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH <name> - Run CPU benchmark (bvh, raycast, overlap, skinning, dualquat, anim, cook, obj, meshopt, lod, vertex, occlusion, frustum, multiview, drawlist, name, alloc, hashmap, objpool, cast)");
 		AddLog(ELogType::Info, "  SHADOW_FILTER <filter> - Apply shadow filter to all lights");
 		AddLog(ELogType::Debug, "    Available filters: VSM, PCF, UnFiltered, VSM_BOX, VSM_GAUSSIAN, SAVSM");
 		AddLog(ELogType::Debug, "    Example: shadow_filter VSM");
@@ -1049,6 +1113,16 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowShadow();
 		AddLog(ELogType::Success, "Shadow overlay enabled");
 	}
+	else if (StatCommand == "overlap")
+	{
+		StatOverlay.ShowOverlap();
+		AddLog(ELogType::Success, "Overlap overlay enabled");
+	}
+	else if (StatCommand == "tasks")
+	{
+		StatOverlay.ShowTasks();
+		AddLog(ELogType::Success, "Task scheduler overlay enabled");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll();
@@ -1062,7 +1136,7 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.data());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, all, none");
+		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, overlap, tasks, all, none");
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "Core/Public/ObjectIterator.h"
 #include "Level/Public/Level.h"
 #include "Render/UI/Widget/Public/SkeletalMeshComponentWidget.h"
+#include "Runtime/Engine/Public/AnimSequence.h"
 #include "Runtime/Engine/Public/SkeletalMesh.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
@@ -51,6 +52,8 @@ void USkeletalMeshComponentWidget::RenderWidget()
 	RenderMaterialSections();
 	ImGui::Separator();
 	RenderOptions();
+	ImGui::Separator();
+	RenderAnimationControls();
 
 	ImGui::PopStyleColor(5);
 }
@@ -258,6 +261,89 @@ void USkeletalMeshComponentWidget::RenderOptions()
 			SkeletalMeshComponent->DisableNormalMap();
 		}
 	}
+
+	const char* SkinningMethodNames[] = { "Linear Blend", "Dual Quaternion" };
+	int32 SkinningMethodIndex = static_cast<int32>(SkeletalMeshComponent->GetSkinningMethod());
+	if (ImGui::Combo("Skinning Method", &SkinningMethodIndex, SkinningMethodNames, IM_ARRAYSIZE(SkinningMethodNames)))
+	{
+		SkeletalMeshComponent->SetSkinningMethod(static_cast<ESkinningMethod>(SkinningMethodIndex));
+	}
+}
+
+void USkeletalMeshComponentWidget::RenderAnimationControls()
+{
+	USkeletalMesh* CurrentSkeletalMesh = SkeletalMeshComponent->GetSkeletalMeshAsset();
+	if (!CurrentSkeletalMesh || CurrentSkeletalMesh->GetAnimSequences().IsEmpty())
+	{
+		ImGui::TextUnformatted("No Animation");
+		return;
+	}
+
+	UAnimSequence* CurrentAnimSequence = SkeletalMeshComponent->GetAnimSequence();
+	FString PreviewName = CurrentAnimSequence ? CurrentAnimSequence->GetSequenceName().ToString() : "None";
+
+	if (ImGui::BeginCombo("Animation", PreviewName.c_str()))
+	{
+		if (ImGui::Selectable("None", CurrentAnimSequence == nullptr))
+		{
+			SkeletalMeshComponent->PlayAnimation(nullptr, SkeletalMeshComponent->IsLoopingAnimation());
+		}
+
+		for (UAnimSequence* Sequence : CurrentSkeletalMesh->GetAnimSequences())
+		{
+			const bool bIsSelected = (Sequence == CurrentAnimSequence);
+			if (ImGui::Selectable(Sequence->GetSequenceName().ToString().c_str(), bIsSelected))
+			{
+				SkeletalMeshComponent->PlayAnimation(Sequence, SkeletalMeshComponent->IsLoopingAnimation());
+			}
+
+			if (bIsSelected)
+			{
+				ImGui::SetItemDefaultFocus();
+			}
+		}
+		ImGui::EndCombo();
+	}
+
+	if (!CurrentAnimSequence)
+	{
+		return;
+	}
+
+	if (SkeletalMeshComponent->IsPlayingAnimation())
+	{
+		if (ImGui::Button("Stop"))
+		{
+			SkeletalMeshComponent->StopAnimation();
+		}
+	}
+	else if (ImGui::Button("Play"))
+	{
+		SkeletalMeshComponent->PlayAnimation(CurrentAnimSequence, SkeletalMeshComponent->IsLoopingAnimation());
+	}
+
+	ImGui::SameLine();
+	bool bLooping = SkeletalMeshComponent->IsLoopingAnimation();
+	if (ImGui::Checkbox("Loop", &bLooping))
+	{
+		SkeletalMeshComponent->SetLoopingAnimation(bLooping);
+	}
+
+	float PlayRate = SkeletalMeshComponent->GetPlayRate();
+	if (ImGui::DragFloat("Play Rate", &PlayRate, 0.01f, -4.0f, 4.0f, "%.2f"))
+	{
+		SkeletalMeshComponent->SetPlayRate(PlayRate);
+	}
+
+	// 정지 상태에서는 슬라이더로 원하는 프레임의 포즈를 확인할 수 있다
+	float Position = SkeletalMeshComponent->GetAnimationPosition();
+	if (ImGui::SliderFloat("Position", &Position, 0.0f, CurrentAnimSequence->GetPlayLength(), "%.2f s"))
+	{
+		SkeletalMeshComponent->SetAnimationPosition(Position);
+	}
+
+	ImGui::Text("Frames: %d (%.1f fps), Size: %.1f / %.1f KB", CurrentAnimSequence->GetNumFrames(), CurrentAnimSequence->GetFrameRate(),
+		CurrentAnimSequence->GetCompressedSize() / 1024.0f, CurrentAnimSequence->GetRawSize() / 1024.0f);
 }
 
 FString USkeletalMeshComponentWidget::GetMaterialDisplayName(UMaterial* Material) const
@@ -113,9 +113,15 @@ private:
 	// 초기화 전 로그 임시 버퍼
 	std::deque<FLogEntry> PendingLogs;
 
+	// 워커 스레드 로그 (메인 스레드가 FlushWorkerLogs에서 LogItems로 옮김)
+	std::mutex WorkerLogMutex;
+	std::deque<FLogEntry> WorkerLogs;
+
 	// Helper functions
 	static ImVec4 GetColorByLogType(ELogType InType);
 	static const char* GetLogTypePrefix(ELogType InType);
 
 	void AddLogInternal(ELogType InType, const char* fmt, va_list InArguments);
+	void AppendLogEntry(const FLogEntry& InLogEntry);
+	void FlushWorkerLogs();
 };
@@ -23,6 +23,7 @@ private:
 	void RenderMaterialSections();
 	void RenderAvailableMaterials(int32 TargetSlotIndex);
 	void RenderOptions();
+	void RenderAnimationControls();
 
 	// Material utility functions
 	FString GetMaterialDisplayName(UMaterial* Material) const;
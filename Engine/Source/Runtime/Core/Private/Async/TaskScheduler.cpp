@@ -0,0 +1,487 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+namespace
+{
+	// 메인 스레드 0, 워커 1..N, 스케줄러 밖의 스레드 -1
+	thread_local int32 GTaskThreadIndex = -1;
+
+	// 잠들기 전에 일을 다시 찾아보는 횟수 (짧은 공백마다 잠들고 깨는 비용을 줄임)
+	constexpr int32 WORKER_SPIN_COUNT = 64;
+}
+
+/*-----------------------------------------------------------------------------
+	FTaskRef
+-----------------------------------------------------------------------------*/
+
+FTaskRef::FTaskRef(FTask* InTask)
+	: Task(InTask)
+{
+	if (Task)
+	{
+		Task->AddRef();
+	}
+}
+
+FTaskRef::FTaskRef(const FTaskRef& Other)
+	: Task(Other.Task)
+{
+	if (Task)
+	{
+		Task->AddRef();
+	}
+}
+
+FTaskRef::FTaskRef(FTaskRef&& Other) noexcept
+	: Task(Other.Task)
+{
+	Other.Task = nullptr;
+}
+
+FTaskRef::~FTaskRef()
+{
+	if (Task)
+	{
+		Task->Release();
+	}
+}
+
+FTaskRef& FTaskRef::operator=(const FTaskRef& Other)
+{
+	if (this != &Other)
+	{
+		FTaskRef Temp(Other);
+		std::swap(Task, Temp.Task);
+	}
+	return *this;
+}
+
+FTaskRef& FTaskRef::operator=(FTaskRef&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		FTaskRef Temp(std::move(Other));
+		std::swap(Task, Temp.Task);
+	}
+	return *this;
+}
+
+bool FTaskRef::IsCompleted() const
+{
+	return !Task || Task->IsCompleted();
+}
+
+/*-----------------------------------------------------------------------------
+	FTaskScheduler
+-----------------------------------------------------------------------------*/
+
+FTaskScheduler::~FTaskScheduler()
+{
+	Shutdown();
+}
+
+void FTaskScheduler::Startup(int32 InWorkerCount)
+{
+	if (IsRunning())
+	{
+		return;
+	}
+
+	if (InWorkerCount <= 0)
+	{
+		const int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+		InWorkerCount = std::max(HardwareThreads - 1, 1);
+	}
+
+	Contexts = new FThreadContext[InWorkerCount + 1];
+	for (int32 ThreadIndex = 0; ThreadIndex <= InWorkerCount; ++ThreadIndex)
+	{
+		Contexts[ThreadIndex].RandomState = 0x9E3779B9u * (ThreadIndex + 1);
+	}
+
+	ThreadCount = InWorkerCount + 1;
+	GTaskThreadIndex = 0;
+	bShutdownRequested.store(false);
+	LastSampleCycles = FPlatformTime::Cycles64();
+
+	Workers.Reserve(InWorkerCount);
+	for (int32 ThreadIndex = 1; ThreadIndex <= InWorkerCount; ++ThreadIndex)
+	{
+		Workers.Emplace(&FTaskScheduler::WorkerMain, this, ThreadIndex);
+	}
+
+	UE_LOG_SYSTEM("TaskScheduler: %d worker threads started", InWorkerCount);
+}
+
+void FTaskScheduler::Shutdown()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		bShutdownRequested.store(true);
+	}
+	SleepCondition.notify_all();
+
+	// 워커는 큐가 빌 때까지 실행한 뒤 종료된다
+	for (std::thread& Worker : Workers)
+	{
+		Worker.join();
+	}
+	Workers.Empty();
+
+	// 메인 스레드 deque와 MainThread 큐에 남은 태스크 처리
+	while (FTask* Task = FindTask(0))
+	{
+		Execute(Task, 0);
+	}
+	ProcessMainThreadTasks();
+
+	delete[] Contexts;
+	Contexts = nullptr;
+	ThreadCount = 1;
+}
+
+FTaskRef FTaskScheduler::Dispatch(TFunction<void()> InWork, const TArray<FTaskRef>& Prerequisites, ETaskThread InThread)
+{
+	FTask* Task = new FTask(std::move(InWork), InThread);
+	FTaskRef Result(Task);
+
+	for (const FTaskRef& Prerequisite : Prerequisites)
+	{
+		FTask* PrerequisiteTask = Prerequisite.Get();
+		if (!PrerequisiteTask)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> Lock(PrerequisiteTask->SubsequentsMutex);
+		if (!PrerequisiteTask->bSubsequentsClosed)
+		{
+			Task->PendingCount.fetch_add(1, std::memory_order_relaxed);
+			Task->AddRef();
+			PrerequisiteTask->Subsequents.Add(Task);
+		}
+	}
+
+	// Dispatch가 잡고 있던 1을 해제. 선행 태스크가 모두 끝났다면 바로 큐에 넣는다
+	if (Task->PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Task->AddRef();
+		Enqueue(Task);
+	}
+
+	return Result;
+}
+
+void FTaskScheduler::Wait(const FTaskRef& InTask)
+{
+	const int32 ThreadIndex = GetCurrentThreadIndex();
+	while (!InTask.IsCompleted())
+	{
+		// 기다리는 태스크가 (직접 또는 선행 태스크로) MainThread 태스크일 수 있으므로 메인 스레드는 함께 처리
+		if (ThreadIndex == 0)
+		{
+			ProcessMainThreadTasks();
+		}
+
+		if (FTask* Task = FindTask(ThreadIndex))
+		{
+			Execute(Task, ThreadIndex);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FTaskScheduler::WaitAll(const TArray<FTaskRef>& InTasks)
+{
+	for (const FTaskRef& Task : InTasks)
+	{
+		Wait(Task);
+	}
+}
+
+void FTaskScheduler::ParallelFor(int32 Num, int32 GrainSize, const TFunction<void(int32, int32)>& Body)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	GrainSize = std::max(GrainSize, 1);
+	const int32 ChunkCount = (Num + GrainSize - 1) / GrainSize;
+	if (ChunkCount == 1 || !IsRunning())
+	{
+		Body(0, Num);
+		return;
+	}
+
+	// 조각을 미리 태스크로 만들지 않고, 보조 태스크들이 공유 카운터에서 조각을 가져가게 한다
+	// (늦게 시작한 보조 태스크는 남은 조각이 없으면 바로 끝남)
+	std::atomic<int32> NextChunk(0);
+	auto RunChunks = [&]()
+	{
+		while (true)
+		{
+			const int32 Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed);
+			if (Chunk >= ChunkCount)
+			{
+				break;
+			}
+			const int32 Begin = Chunk * GrainSize;
+			Body(Begin, std::min(Begin + GrainSize, Num));
+		}
+	};
+
+	const int32 HelperCount = std::min(ChunkCount, GetThreadCount()) - 1;
+	TArray<FTaskRef> Helpers;
+	Helpers.Reserve(HelperCount);
+	for (int32 HelperIndex = 0; HelperIndex < HelperCount; ++HelperIndex)
+	{
+		Helpers.Add(Dispatch(RunChunks));
+	}
+
+	RunChunks();
+
+	// 보조 태스크가 스택의 RunChunks를 참조하므로 모두 끝날 때까지 반환하지 않는다
+	WaitAll(Helpers);
+}
+
+void FTaskScheduler::ProcessMainThreadTasks()
+{
+	if (GetCurrentThreadIndex() != 0)
+	{
+		return;
+	}
+
+	TArray<FTask*> Tasks;
+	{
+		std::lock_guard<std::mutex> Lock(MainThreadQueueMutex);
+		if (MainThreadQueue.IsEmpty())
+		{
+			return;
+		}
+		std::swap(Tasks, MainThreadQueue);
+	}
+
+	for (FTask* Task : Tasks)
+	{
+		Execute(Task, 0);
+	}
+}
+
+int32 FTaskScheduler::GetCurrentThreadIndex()
+{
+	return GTaskThreadIndex;
+}
+
+void FTaskScheduler::SampleWorkerStats(TArray<FTaskWorkerStats>& OutStats, double& OutElapsedMs)
+{
+	OutStats.Empty();
+	OutElapsedMs = 0.0;
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	const uint64 CurrentCycles = FPlatformTime::Cycles64();
+	OutElapsedMs = FPlatformTime::ToMilliseconds(CurrentCycles - LastSampleCycles);
+	LastSampleCycles = CurrentCycles;
+
+	for (int32 ThreadIndex = 0; ThreadIndex < GetThreadCount(); ++ThreadIndex)
+	{
+		FThreadContext& Context = Contexts[ThreadIndex];
+		FTaskWorkerStats Stats;
+		Stats.BusyMs = FPlatformTime::ToMilliseconds(Context.BusyCycles.exchange(0, std::memory_order_relaxed));
+		Stats.TaskCount = Context.TaskCount.exchange(0, std::memory_order_relaxed);
+		Stats.StealCount = Context.StealCount.exchange(0, std::memory_order_relaxed);
+		OutStats.Add(Stats);
+	}
+}
+
+void FTaskScheduler::WorkerMain(int32 ThreadIndex)
+{
+	GTaskThreadIndex = ThreadIndex;
+
+	while (true)
+	{
+		FTask* Task = FindTask(ThreadIndex);
+		for (int32 Spin = 0; !Task && Spin < WORKER_SPIN_COUNT; ++Spin)
+		{
+			std::this_thread::yield();
+			Task = FindTask(ThreadIndex);
+		}
+
+		if (Task)
+		{
+			Execute(Task, ThreadIndex);
+			continue;
+		}
+
+		// SleepingWorkerCount 증가 후 QueuedTaskCount를 확인하고, Enqueue는 반대 순서로 확인하므로 깨우기를 놓치지 않는다
+		std::unique_lock<std::mutex> Lock(SleepMutex);
+		SleepingWorkerCount.fetch_add(1);
+		SleepCondition.wait(Lock, [this]()
+		{
+			return QueuedTaskCount.load() > 0 || bShutdownRequested.load();
+		});
+		SleepingWorkerCount.fetch_sub(1);
+
+		if (bShutdownRequested.load() && QueuedTaskCount.load() == 0)
+		{
+			break;
+		}
+	}
+}
+
+void FTaskScheduler::Enqueue(FTask* InTask)
+{
+	if (InTask->Thread == ETaskThread::MainThread)
+	{
+		std::lock_guard<std::mutex> Lock(MainThreadQueueMutex);
+		MainThreadQueue.Add(InTask);
+		return;
+	}
+
+	// 스케줄러가 꺼져 있으면 호출한 스레드에서 바로 실행
+	if (!Contexts)
+	{
+		Execute(InTask, -1);
+		return;
+	}
+
+	QueuedTaskCount.fetch_add(1);
+
+	const int32 ThreadIndex = GetCurrentThreadIndex();
+	if (ThreadIndex < 0 || !Contexts[ThreadIndex].Queue.Push(InTask))
+	{
+		std::lock_guard<std::mutex> Lock(SharedQueueMutex);
+		SharedQueue.Add(InTask);
+		SharedQueueCount.fetch_add(1, std::memory_order_release);
+	}
+
+	WakeWorker();
+}
+
+FTask* FTaskScheduler::FindTask(int32 ThreadIndex)
+{
+	if (!Contexts)
+	{
+		return nullptr;
+	}
+
+	FTask* Task = nullptr;
+
+	// 1. 자기 deque (최근에 넣은 태스크부터)
+	if (ThreadIndex >= 0)
+	{
+		Task = Contexts[ThreadIndex].Queue.Pop();
+	}
+
+	// 2. 스케줄러 밖의 스레드가 넣은 태스크
+	if (!Task && SharedQueueCount.load(std::memory_order_acquire) > 0)
+	{
+		std::lock_guard<std::mutex> Lock(SharedQueueMutex);
+		if (!SharedQueue.IsEmpty())
+		{
+			Task = SharedQueue.Last();
+			SharedQueue.Pop();
+			SharedQueueCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	// 3. 다른 스레드의 deque에서 훔쳐 옴 (매번 같은 희생자에 몰리지 않도록 임의의 위치부터)
+	if (!Task)
+	{
+		const int32 ThreadCount = GetThreadCount();
+		uint32 Start = 0;
+		if (ThreadIndex >= 0)
+		{
+			uint32& State = Contexts[ThreadIndex].RandomState;
+			State ^= State << 13;
+			State ^= State >> 17;
+			State ^= State << 5;
+			Start = State;
+		}
+
+		for (int32 Offset = 0; Offset < ThreadCount && !Task; ++Offset)
+		{
+			const int32 Victim = static_cast<int32>((Start + Offset) % ThreadCount);
+			if (Victim == ThreadIndex)
+			{
+				continue;
+			}
+
+			Task = Contexts[Victim].Queue.Steal();
+			if (Task && ThreadIndex >= 0)
+			{
+				Contexts[ThreadIndex].StealCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	if (Task)
+	{
+		QueuedTaskCount.fetch_sub(1);
+	}
+	return Task;
+}
+
+void FTaskScheduler::Execute(FTask* InTask, int32 ThreadIndex)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	InTask->Work();
+	// 캡처한 자원을 태스크 참조가 모두 사라지기 전에 해제
+	InTask->Work = nullptr;
+	Complete(InTask);
+
+	if (Contexts && ThreadIndex >= 0)
+	{
+		FThreadContext& Context = Contexts[ThreadIndex];
+		Context.BusyCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+		Context.TaskCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// 큐가 가지고 있던 참조 해제
+	InTask->Release();
+}
+
+void FTaskScheduler::Complete(FTask* InTask)
+{
+	TArray<FTask*> Subsequents;
+	{
+		std::lock_guard<std::mutex> Lock(InTask->SubsequentsMutex);
+		InTask->bCompleted.store(true, std::memory_order_release);
+		InTask->bSubsequentsClosed = true;
+		std::swap(Subsequents, InTask->Subsequents);
+	}
+
+	for (FTask* Subsequent : Subsequents)
+	{
+		// 마지막 선행 태스크였다면 Subsequents가 가지고 있던 참조를 그대로 큐에 넘긴다
+		if (Subsequent->PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Enqueue(Subsequent);
+		}
+		else
+		{
+			Subsequent->Release();
+		}
+	}
+}
+
+void FTaskScheduler::WakeWorker()
+{
+	if (SleepingWorkerCount.load() > 0)
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		SleepCondition.notify_one();
+	}
+}
@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Memory/FrameMemory.h"
+
+#include <new>
+
+namespace
+{
+	constexpr size_t FRAME_MEMORY_INITIAL_CAPACITY = 2 * 1024 * 1024;
+	constexpr size_t FRAME_MEMORY_MAX_CAPACITY = 256 * 1024 * 1024;
+	constexpr size_t FRAME_MEMORY_BLOCK_ALIGNMENT = 64;
+
+	bool IsOverAligned(size_t InAlignment)
+	{
+		return InAlignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	}
+}
+
+FFrameMemory& FFrameMemory::GetInstance()
+{
+	static FFrameMemory Instance;
+	return Instance;
+}
+
+FFrameMemory::FFrameMemory()
+{
+	AllocateBlock(FRAME_MEMORY_INITIAL_CAPACITY);
+	FrameStartAllocationCount = CumulativeAllocationCount.load(std::memory_order_relaxed);
+}
+
+FFrameMemory::~FFrameMemory()
+{
+	::operator delete(Block, std::align_val_t(FRAME_MEMORY_BLOCK_ALIGNMENT));
+}
+
+void FFrameMemory::AllocateBlock(size_t InCapacity)
+{
+	if (Block)
+	{
+		::operator delete(Block, std::align_val_t(FRAME_MEMORY_BLOCK_ALIGNMENT));
+	}
+	Block = static_cast<uint8*>(::operator new(InCapacity, std::align_val_t(FRAME_MEMORY_BLOCK_ALIGNMENT)));
+	Capacity = InCapacity;
+}
+
+void* FFrameMemory::Allocate(size_t InSize, size_t InAlignment)
+{
+	size_t Current = Offset.load(std::memory_order_relaxed);
+	while (true)
+	{
+		const size_t AlignedOffset = (Current + InAlignment - 1) & ~(InAlignment - 1);
+		const size_t NewOffset = AlignedOffset + InSize;
+		if (NewOffset > Capacity)
+		{
+			break;
+		}
+
+		if (Offset.compare_exchange_weak(Current, NewOffset, std::memory_order_relaxed))
+		{
+			return Block + AlignedOffset;
+		}
+	}
+
+	// 블록이 모자라면 이번 프레임은 힙으로 넘기고 EndFrame에서 블록을 키운다
+	OverflowBytes.fetch_add(InSize, std::memory_order_relaxed);
+	OverflowCount.fetch_add(1, std::memory_order_relaxed);
+	return IsOverAligned(InAlignment) ? ::operator new(InSize, std::align_val_t(InAlignment)) : ::operator new(InSize);
+}
+
+void FFrameMemory::Deallocate(void* InMemory, size_t InAlignment)
+{
+	// 블록 안의 메모리는 EndFrame에서 한꺼번에 되돌린다
+	if (!InMemory || Owns(InMemory))
+	{
+		return;
+	}
+
+	if (IsOverAligned(InAlignment))
+	{
+		::operator delete(InMemory, std::align_val_t(InAlignment));
+	}
+	else
+	{
+		::operator delete(InMemory);
+	}
+}
+
+bool FFrameMemory::Owns(const void* InMemory) const
+{
+	const uint8* Memory = static_cast<const uint8*>(InMemory);
+	return Memory >= Block && Memory < Block + Capacity;
+}
+
+void FFrameMemory::EndFrame()
+{
+	const size_t FrameOverflowBytes = OverflowBytes.load(std::memory_order_relaxed);
+
+	LastFrameStats.HeapAllocationCount = CumulativeAllocationCount.load(std::memory_order_relaxed) - FrameStartAllocationCount;
+	LastFrameStats.UsedBytes = std::min(Offset.load(std::memory_order_relaxed), Capacity);
+	LastFrameStats.OverflowBytes = FrameOverflowBytes;
+	LastFrameStats.OverflowCount = OverflowCount.load(std::memory_order_relaxed);
+	LastFrameStats.Capacity = Capacity;
+
+	// 넘친 프레임이 있었다면 그 사용량이 들어가도록 2의 거듭제곱으로 키운다
+	if (FrameOverflowBytes > 0 && Capacity < FRAME_MEMORY_MAX_CAPACITY)
+	{
+		const size_t RequiredBytes = LastFrameStats.UsedBytes + FrameOverflowBytes;
+		size_t NewCapacity = Capacity;
+		while (NewCapacity < RequiredBytes && NewCapacity < FRAME_MEMORY_MAX_CAPACITY)
+		{
+			NewCapacity *= 2;
+		}
+		AllocateBlock(NewCapacity);
+		UE_LOG_WARNING("FrameMemory: 프레임 블록 부족 (%zu bytes 초과), %zu KB로 확장", FrameOverflowBytes, NewCapacity / 1024);
+	}
+
+	Offset.store(0, std::memory_order_relaxed);
+	OverflowBytes.store(0, std::memory_order_relaxed);
+	OverflowCount.store(0, std::memory_order_relaxed);
+	FrameStartAllocationCount = CumulativeAllocationCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,204 @@
+#pragma once
+#include "Runtime/Core/Public/Async/WorkStealingQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class FTask;
+class FTaskScheduler;
+
+/**
+ * @brief 태스크를 실행할 수 있는 스레드
+ */
+enum class ETaskThread : uint8
+{
+	AnyThread,   // 워커 또는 대기 중인 스레드 어디서든 실행
+	MainThread,  // FTaskScheduler::ProcessMainThreadTasks()를 호출하는 메인 스레드에서만 실행 (UObject, D3D 접근 등)
+};
+
+/**
+ * @brief FTask에 대한 참조 (intrusive 참조 카운트)
+ * Dispatch()가 반환하며, 완료 여부 확인과 다른 태스크의 선행 조건 지정에 사용한다.
+ */
+class FTaskRef
+{
+public:
+	FTaskRef() = default;
+	explicit FTaskRef(FTask* InTask);
+	FTaskRef(const FTaskRef& Other);
+	FTaskRef(FTaskRef&& Other) noexcept;
+	~FTaskRef();
+
+	FTaskRef& operator=(const FTaskRef& Other);
+	FTaskRef& operator=(FTaskRef&& Other) noexcept;
+
+	bool IsValid() const { return Task != nullptr; }
+	bool IsCompleted() const;
+
+	FTask* Get() const { return Task; }
+
+private:
+	FTask* Task = nullptr;
+};
+
+/**
+ * @brief 스케줄러가 실행하는 작업 단위
+ * @note PendingCount = (완료되지 않은 선행 태스크 수) + 1. 마지막 1은 Dispatch가 끝날 때 해제되며,
+ *       0이 되는 순간 큐에 들어간다. 완료되면 Subsequents를 닫고 각 후속 태스크의 PendingCount를 줄인다.
+ */
+class FTask
+{
+public:
+	bool IsCompleted() const { return bCompleted.load(std::memory_order_acquire); }
+
+private:
+	friend class FTaskRef;
+	friend class FTaskScheduler;
+
+	FTask(TFunction<void()>&& InWork, ETaskThread InThread)
+		: Work(std::move(InWork)), Thread(InThread)
+	{
+	}
+
+	void AddRef() { RefCount.fetch_add(1, std::memory_order_relaxed); }
+	void Release()
+	{
+		if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			delete this;
+		}
+	}
+
+	TFunction<void()> Work;
+	ETaskThread Thread;
+
+	std::atomic<int32> RefCount{ 0 };
+	std::atomic<int32> PendingCount{ 1 };
+	std::atomic<bool> bCompleted{ false };
+
+	std::mutex SubsequentsMutex;
+	TArray<FTask*> Subsequents;        // 참조를 하나씩 보유
+	bool bSubsequentsClosed = false;
+};
+
+/**
+ * @brief 워커 하나의 구간 통계 (SampleWorkerStats 호출 사이)
+ */
+struct FTaskWorkerStats
+{
+	double BusyMs = 0.0;
+	uint32 TaskCount = 0;
+	uint32 StealCount = 0;
+};
+
+/**
+ * @brief 엔진 전역 work-stealing 태스크 스케줄러
+ *
+ * - 메인 스레드(0번)와 워커 스레드(1..N)가 각자 Chase-Lev deque를 가지며, 자기 deque가 비면
+ *   다른 스레드의 deque에서 훔쳐 온다. 스케줄러 밖의 스레드가 만든 태스크는 공유 큐로 들어간다.
+ * - 태스크는 선행 태스크 목록을 받아 의존성 그래프를 만들 수 있다.
+ * - Wait()는 기다리는 동안 다른 태스크를 실행하므로 태스크 안에서 호출해도 교착되지 않는다.
+ * - MainThread 태스크는 메인 스레드가 프레임마다(또는 Wait 중에) 처리한다.
+ */
+class FTaskScheduler
+{
+public:
+	static FTaskScheduler& GetInstance()
+	{
+		static FTaskScheduler Instance;
+		return Instance;
+	}
+
+	/**
+	 * @brief 워커 스레드 시작. 호출한 스레드가 메인 스레드가 된다.
+	 * @param InWorkerCount: 0 이하이면 (하드웨어 스레드 수 - 1)
+	 */
+	void Startup(int32 InWorkerCount = 0);
+	//@brief 남은 태스크를 모두 실행한 뒤 워커 스레드 종료
+	void Shutdown();
+
+	bool IsRunning() const { return Contexts != nullptr; }
+
+	/**
+	 * @brief 태스크 생성 및 예약
+	 * @param Prerequisites: 모두 완료된 뒤에 실행됨 (유효하지 않은 참조는 무시)
+	 * @note 스케줄러가 시작되지 않았다면 선행 태스크가 끝나는 즉시 그 스레드에서 실행한다. (MainThread 태스크 제외)
+	 */
+	FTaskRef Dispatch(TFunction<void()> InWork, const TArray<FTaskRef>& Prerequisites = {}, ETaskThread InThread = ETaskThread::AnyThread);
+
+	//@brief 태스크가 완료될 때까지 다른 태스크를 실행하며 대기
+	void Wait(const FTaskRef& InTask);
+	void WaitAll(const TArray<FTaskRef>& InTasks);
+
+	/**
+	 * @brief [0, Num) 구간을 GrainSize 크기의 조각으로 나눠 병렬 실행하고 모두 끝날 때까지 대기
+	 * @param Body: void(int32 Begin, int32 End). 조각마다 한 번 호출되며 서로 다른 스레드에서 동시에 실행될 수 있다.
+	 * @note 호출 스레드도 조각을 처리한다. 조각이 하나뿐이거나 스케줄러가 꺼져 있으면 그대로 실행한다.
+	 */
+	void ParallelFor(int32 Num, int32 GrainSize, const TFunction<void(int32, int32)>& Body);
+
+	//@brief 메인 스레드 전용. 대기 중인 MainThread 태스크를 모두 실행
+	void ProcessMainThreadTasks();
+
+	// 메인 스레드 포함 스레드 수
+	int32 GetThreadCount() const { return ThreadCount; }
+	// 현재 스레드의 인덱스 (메인 0, 워커 1..N, 그 외 -1)
+	static int32 GetCurrentThreadIndex();
+	bool IsInMainThread() const { return GetCurrentThreadIndex() == 0; }
+
+	/**
+	 * @brief 스레드별 통계를 반환하고 초기화 (인덱스 0은 메인 스레드)
+	 * @param OutElapsedMs: 직전 호출 이후 경과 시간
+	 */
+	void SampleWorkerStats(TArray<FTaskWorkerStats>& OutStats, double& OutElapsedMs);
+
+private:
+	FTaskScheduler() = default;
+	~FTaskScheduler();
+
+	FTaskScheduler(const FTaskScheduler&) = delete;
+	FTaskScheduler& operator=(const FTaskScheduler&) = delete;
+
+	struct alignas(64) FThreadContext
+	{
+		TWorkStealingQueue<FTask> Queue;
+		std::atomic<uint64> BusyCycles{ 0 };
+		std::atomic<uint32> TaskCount{ 0 };
+		std::atomic<uint32> StealCount{ 0 };
+		uint32 RandomState = 0;
+	};
+
+	void WorkerMain(int32 ThreadIndex);
+
+	//@brief 실행 가능한 태스크를 큐에 넣음 (큐가 참조를 가져감)
+	void Enqueue(FTask* InTask);
+	//@brief 자기 deque → 공유 큐 → 다른 스레드 순으로 태스크를 찾음
+	FTask* FindTask(int32 ThreadIndex);
+	void Execute(FTask* InTask, int32 ThreadIndex);
+	void Complete(FTask* InTask);
+
+	void WakeWorker();
+
+	// 워커가 읽는 값이므로 워커 시작 전에 설정하고 모든 워커가 끝난 뒤에 해제한다
+	FThreadContext* Contexts = nullptr;  // [0]: 메인 스레드, [1..N]: 워커
+	int32 ThreadCount = 1;
+	TArray<std::thread> Workers;
+
+	std::mutex SharedQueueMutex;
+	TArray<FTask*> SharedQueue;
+	std::atomic<int32> SharedQueueCount{ 0 };
+
+	std::mutex MainThreadQueueMutex;
+	TArray<FTask*> MainThreadQueue;
+
+	// 잠든 워커를 깨우기 위한 상태
+	std::mutex SleepMutex;
+	std::condition_variable SleepCondition;
+	std::atomic<int32> QueuedTaskCount{ 0 };
+	std::atomic<int32> SleepingWorkerCount{ 0 };
+	std::atomic<bool> bShutdownRequested{ false };
+
+	uint64 LastSampleCycles = 0;
+};
@@ -0,0 +1,118 @@
+#pragma once
+#include <atomic>
+
+/**
+ * @brief Chase-Lev work-stealing deque (고정 용량)
+ *
+ * 소유 스레드만 Bottom 쪽에서 Push/Pop(LIFO)하고, 다른 스레드는 Top 쪽에서 Steal(FIFO)한다.
+ * 소유자는 최근에 넣은(캐시에 남아 있는) 작업을 먼저 처리하고, 도둑은 오래된 큰 작업을 가져간다.
+ * 메모리 순서는 Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (2013)을 따른다.
+ * 버퍼 재할당이 없으므로 가득 차면 Push가 false를 반환하고, 호출자가 공유 큐로 넘겨야 한다.
+ *
+ * @tparam T 요소 포인터가 가리키는 타입 (큐에는 T*만 저장)
+ * @tparam Capacity 용량 (2의 거듭제곱)
+ */
+template <typename T, int32 Capacity = 4096>
+class TWorkStealingQueue
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	TWorkStealingQueue()
+	{
+		for (std::atomic<T*>& Slot : Buffer)
+		{
+			Slot.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	TWorkStealingQueue(const TWorkStealingQueue&) = delete;
+	TWorkStealingQueue& operator=(const TWorkStealingQueue&) = delete;
+
+	/**
+	 * @brief 소유 스레드 전용
+	 * @return 큐가 가득 찼으면 false
+	 */
+	bool Push(T* InItem)
+	{
+		const int64 B = Bottom.load(std::memory_order_relaxed);
+		const int64 T0 = Top.load(std::memory_order_acquire);
+		if (B - T0 >= Capacity)
+		{
+			return false;
+		}
+
+		Buffer[B & Mask].store(InItem, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Bottom.store(B + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/**
+	 * @brief 소유 스레드 전용. 가장 최근에 넣은 요소를 꺼냄
+	 * @return 비어 있거나 마지막 요소를 도둑에게 빼앗겼으면 nullptr
+	 */
+	T* Pop()
+	{
+		const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+		Bottom.store(B, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 T0 = Top.load(std::memory_order_relaxed);
+
+		if (T0 > B)
+		{
+			// 비어 있음
+			Bottom.store(B + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		T* Item = Buffer[B & Mask].load(std::memory_order_relaxed);
+		if (T0 == B)
+		{
+			// 마지막 요소: 도둑과 Top을 두고 경쟁
+			if (!Top.compare_exchange_strong(T0, T0 + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				Item = nullptr;
+			}
+			Bottom.store(B + 1, std::memory_order_relaxed);
+		}
+		return Item;
+	}
+
+	/**
+	 * @brief 임의 스레드에서 호출 가능. 가장 오래된 요소를 꺼냄
+	 * @return 비어 있거나 다른 스레드와의 경쟁에서 졌으면 nullptr
+	 */
+	T* Steal()
+	{
+		int64 T0 = Top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 B = Bottom.load(std::memory_order_acquire);
+
+		if (T0 >= B)
+		{
+			return nullptr;
+		}
+
+		T* Item = Buffer[T0 & Mask].load(std::memory_order_relaxed);
+		if (!Top.compare_exchange_strong(T0, T0 + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return Item;
+	}
+
+	//@brief 근사값 (다른 스레드가 동시에 수정 중일 수 있음)
+	bool IsEmpty() const
+	{
+		return Bottom.load(std::memory_order_relaxed) <= Top.load(std::memory_order_relaxed);
+	}
+
+private:
+	static constexpr int64 Mask = Capacity - 1;
+
+	// Top은 도둑들이, Bottom은 소유자가 주로 쓰므로 서로 다른 캐시 라인에 둔다
+	alignas(64) std::atomic<int64> Top{ 0 };
+	alignas(64) std::atomic<int64> Bottom{ 0 };
+	alignas(64) std::atomic<T*> Buffer[Capacity];
+};
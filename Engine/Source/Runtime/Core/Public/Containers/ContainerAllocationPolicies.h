@@ -0,0 +1,153 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "Runtime/Core/Public/Memory/FrameMemory.h"
+
+/**
+ * @brief TArray의 AllocatorType 자리에 넘기는 할당 정책
+ * std 할당자(std::allocator<T> 등)를 그대로 넘기거나, 원소 타입마다 할당자를 고르는 정책 타입을 넘길 수 있다.
+ * 정책 타입은 template<typename T> using ForElementType = ...; 로 실제 std 호환 할당자를 알려준다.
+ */
+
+/**
+ * @brief N개까지는 할당자 안의 버퍼를 쓰고, 넘치면 힙으로 옮기는 할당자
+ * @note 버퍼가 할당자 안에 있으므로 vector가 포인터를 훔쳐 가면 안 된다.
+ * 인라인 버퍼 이동은 TArray가 원소 단위로 처리하고, 힙 버퍼만 vector에 맡겨 포인터째 옮긴다.
+ * 그래서 operator==는 힙 버퍼끼리 주고받을 수 있다는 의미로 항상 true이다. ToStdVector()로 직접 옮기지 말 것.
+ */
+template<typename T, int32 NumInlineElements>
+class TInlineElementAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    // vector 내부 보조 객체(MSVC 디버그 프록시 등)는 임시 할당자로 만들어지므로 인라인 버퍼를 쓰지 않는다
+    template<typename OtherType>
+    struct rebind
+    {
+        using other = std::conditional_t<std::is_same_v<OtherType, T>, TInlineElementAllocator, std::allocator<OtherType>>;
+    };
+
+    TInlineElementAllocator() noexcept = default;
+
+    // 복사한 할당자는 자기 버퍼를 새로 가진다
+    TInlineElementAllocator(const TInlineElementAllocator&) noexcept {}
+    TInlineElementAllocator& operator=(const TInlineElementAllocator&) noexcept { return *this; }
+
+    template<typename OtherType>
+    operator std::allocator<OtherType>() const noexcept { return {}; }
+
+    T* allocate(size_t InCount)
+    {
+        if (!bInlineInUse && InCount <= static_cast<size_t>(NumInlineElements))
+        {
+            bInlineInUse = true;
+            return GetInlineData();
+        }
+        return std::allocator<T>().allocate(InCount);
+    }
+
+    void deallocate(T* InData, size_t InCount) noexcept
+    {
+        if (InData == GetInlineData())
+        {
+            bInlineInUse = false;
+            return;
+        }
+        std::allocator<T>().deallocate(InData, InCount);
+    }
+
+    bool operator==(const TInlineElementAllocator&) const noexcept { return true; }
+    bool operator!=(const TInlineElementAllocator&) const noexcept { return false; }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineData); }
+
+    alignas(T) uint8 InlineData[sizeof(T) * NumInlineElements];
+    bool bInlineInUse = false;
+};
+
+/**
+ * @brief FFrameMemory에서 받는 할당자. 해제는 프레임 끝까지 미뤄진다
+ */
+template<typename T>
+class TFrameElementAllocator
+{
+public:
+    using value_type = T;
+
+    TFrameElementAllocator() noexcept = default;
+
+    template<typename OtherType>
+    TFrameElementAllocator(const TFrameElementAllocator<OtherType>&) noexcept {}
+
+    T* allocate(size_t InCount)
+    {
+        return static_cast<T*>(FFrameMemory::GetInstance().Allocate(InCount * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* InData, size_t) noexcept
+    {
+        FFrameMemory::GetInstance().Deallocate(InData, alignof(T));
+    }
+
+    template<typename OtherType>
+    bool operator==(const TFrameElementAllocator<OtherType>&) const noexcept { return true; }
+    template<typename OtherType>
+    bool operator!=(const TFrameElementAllocator<OtherType>&) const noexcept { return false; }
+};
+
+/**
+ * @brief 작은 임시 배열용 정책. NumInlineElements개까지는 힙 할당이 없다
+ * 예) TArray<FString, TInlineAllocator<8>>
+ */
+template<int32 NumInlineElements>
+struct TInlineAllocator
+{
+    static_assert(NumInlineElements > 0, "NumInlineElements must be positive");
+
+    static constexpr int32 InlineCapacity = NumInlineElements;
+
+    template<typename T>
+    using ForElementType = TInlineElementAllocator<T, NumInlineElements>;
+};
+
+/**
+ * @brief 한 프레임 안에서만 쓰는 배열용 정책 (TFrameArray)
+ */
+struct FFrameAllocator
+{
+    template<typename T>
+    using ForElementType = TFrameElementAllocator<T>;
+};
+
+// 정책 타입이면 ForElementType<T>, std 할당자면 그대로
+template<typename AllocatorType, typename T, typename = void>
+struct TArrayElementAllocator
+{
+    using Type = AllocatorType;
+};
+
+template<typename AllocatorType, typename T>
+struct TArrayElementAllocator<AllocatorType, T, std::void_t<typename AllocatorType::template ForElementType<T>>>
+{
+    using Type = typename AllocatorType::template ForElementType<T>;
+};
+
+template<typename AllocatorType, typename = void>
+struct TArrayInlineCapacity
+{
+    static constexpr int32 Value = 0;
+};
+
+template<typename AllocatorType>
+struct TArrayInlineCapacity<AllocatorType, std::void_t<decltype(AllocatorType::InlineCapacity)>>
+{
+    static constexpr int32 Value = AllocatorType::InlineCapacity;
+};
@@ -0,0 +1,576 @@
+#pragma once
+
+#include <bit>
+#include <cstring>
+#include <emmintrin.h>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 플랫 해시 테이블의 제어 바이트 그룹 (Swiss table 방식)
+ * 슬롯마다 1바이트 제어 값을 두고 16개씩 SSE2로 한 번에 비교한다.
+ * 제어 값: 0~127 = 사용 중(해시 하위 7비트), Empty = -128, Deleted = -2 (최상위 비트가 켜져 있으면 비어 있는 슬롯)
+ */
+struct FFlatHashGroup
+{
+    static constexpr int8 Empty = -128;
+    static constexpr int8 Deleted = -2;
+    static constexpr size_t Width = 16;
+
+    explicit FFlatHashGroup(const int8* InControl)
+        : Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(InControl)))
+    {
+    }
+
+    // 제어 값이 H2인 슬롯의 비트 마스크
+    uint32 Match(int8 InH2) const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(InH2), Control)));
+    }
+
+    uint32 MatchEmpty() const
+    {
+        return Match(Empty);
+    }
+
+    uint32 MatchEmptyOrDeleted() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(Control));
+    }
+
+    uint32 MatchFull() const
+    {
+        return ~static_cast<uint32>(_mm_movemask_epi8(Control)) & 0xFFFFu;
+    }
+
+    __m128i Control;
+};
+
+/**
+ * @brief TFlatMap/TFlatSet이 공유하는 오픈 어드레싱 해시 테이블
+ * 원소를 노드 없이 하나의 배열에 두고, 제어 바이트 그룹을 SIMD로 훑어 후보 슬롯만 키를 비교한다.
+ * @param KeyFuncsType 원소에서 키를 꺼내는 static const KeyType& GetKey(const ElementType&)를 제공
+ * @note 삽입으로 크기가 바뀌면 모든 원소가 옮겨지므로 Find가 돌려준 포인터/반복자는 다음 삽입 전까지만 유효하다.
+ * 제거는 원소를 옮기지 않으므로 순회 중 현재 원소를 지우는 것은 안전하다.
+ */
+template<typename ElementType, typename KeyType, typename KeyFuncsType, typename HasherType, typename KeyEqualType>
+class TFlatHashTable
+{
+    static_assert(alignof(ElementType) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "TFlatHashTable은 기본 new 정렬보다 큰 정렬을 지원하지 않는다");
+
+public:
+    using SizeType = int32;
+
+    template<bool bConst>
+    class TBaseIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+
+        TBaseIterator() = default;
+
+        TBaseIterator(const int8* InControl, ElementType* InSlots, size_t InCapacity, size_t InIndex)
+            : Control(InControl), Slots(InSlots), Capacity(InCapacity), Index(InIndex)
+        {
+            SkipEmptySlots();
+        }
+
+        // 비 const 반복자에서 const 반복자로의 변환
+        operator TBaseIterator<true>() const requires (!bConst)
+        {
+            return TBaseIterator<true>(Control, Slots, Capacity, Index);
+        }
+
+        reference operator*() const { return Slots[Index]; }
+        pointer operator->() const { return &Slots[Index]; }
+
+        TBaseIterator& operator++()
+        {
+            ++Index;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        TBaseIterator operator++(int)
+        {
+            TBaseIterator Previous = *this;
+            ++*this;
+            return Previous;
+        }
+
+        bool operator==(const TBaseIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TBaseIterator& Other) const { return Index != Other.Index; }
+
+    private:
+        // 그룹 단위로 빈 슬롯을 건너뛴다. 끝 너머의 복제 제어 바이트에 걸리면 끝으로 맞춘다
+        void SkipEmptySlots()
+        {
+            while (Index < Capacity)
+            {
+                const uint32 FullMask = FFlatHashGroup(Control + Index).MatchFull();
+                if (FullMask != 0)
+                {
+                    Index += static_cast<size_t>(std::countr_zero(FullMask));
+                    if (Index > Capacity)
+                    {
+                        Index = Capacity;
+                    }
+                    return;
+                }
+                Index += FFlatHashGroup::Width;
+            }
+            Index = Capacity;
+        }
+
+        const int8* Control = nullptr;
+        ElementType* Slots = nullptr;
+        size_t Capacity = 0;
+        size_t Index = 0;
+    };
+
+    using Iterator = TBaseIterator<false>;
+    using ConstIterator = TBaseIterator<true>;
+
+    TFlatHashTable() = default;
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            Release();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Release();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    ~TFlatHashTable()
+    {
+        Release();
+    }
+
+    SizeType Num() const { return static_cast<SizeType>(Size); }
+    bool IsEmpty() const { return Size == 0; }
+    SizeType GetCapacity() const { return static_cast<SizeType>(Capacity); }
+
+    ElementType* FindElement(const KeyType& Key)
+    {
+        const size_t Index = FindIndex(Key);
+        return Index != Capacity ? &Slots[Index] : nullptr;
+    }
+
+    const ElementType* FindElement(const KeyType& Key) const
+    {
+        const size_t Index = FindIndex(Key);
+        return Index != Capacity ? &Slots[Index] : nullptr;
+    }
+
+    /**
+     * @brief 키가 없을 때만 Args로 원소를 만들어 넣는다
+     * @return 원소 포인터와 새로 넣었는지 여부
+     */
+    template<typename... ArgsType>
+    std::pair<ElementType*, bool> FindOrEmplace(const KeyType& Key, ArgsType&&... Args)
+    {
+        const size_t Hash = HashKey(Key);
+        const size_t Found = FindIndex(Key, Hash);
+        if (Found != Capacity)
+        {
+            return { &Slots[Found], false };
+        }
+
+        const size_t Index = PrepareInsert(Hash);
+        ::new (static_cast<void*>(&Slots[Index])) ElementType(std::forward<ArgsType>(Args)...);
+        return { &Slots[Index], true };
+    }
+
+    bool RemoveKey(const KeyType& Key)
+    {
+        const size_t Index = FindIndex(Key);
+        if (Index == Capacity)
+        {
+            return false;
+        }
+        RemoveAt(Index);
+        return true;
+    }
+
+    void RemoveElement(const ElementType* InElement)
+    {
+        RemoveAt(static_cast<size_t>(InElement - Slots));
+    }
+
+    /**
+     * @brief 조건에 맞는 원소를 모두 제거한다. 제거는 원소를 옮기지 않으므로 한 번의 순회로 끝난다
+     */
+    template<typename PredicateType>
+    SizeType RemoveIf(PredicateType Predicate)
+    {
+        SizeType RemovedCount = 0;
+        for (size_t Index = 0; Index < Capacity; ++Index)
+        {
+            if (Control[Index] >= 0 && Predicate(Slots[Index]))
+            {
+                RemoveAt(Index);
+                ++RemovedCount;
+            }
+        }
+        return RemovedCount;
+    }
+
+    // 원소를 모두 지우고 메모리는 유지한다
+    void Reset()
+    {
+        DestroyElements();
+        ResetControl();
+    }
+
+    // 원소를 모두 지우고 ExpectedNumElements에 맞는 크기로 다시 잡는다
+    void Empty(SizeType ExpectedNumElements)
+    {
+        const size_t NewCapacity = ExpectedNumElements > 0 ? CapacityForCount(static_cast<size_t>(ExpectedNumElements)) : 0;
+        if (NewCapacity == Capacity)
+        {
+            Reset();
+            return;
+        }
+        Release();
+        if (NewCapacity > 0)
+        {
+            Allocate(NewCapacity);
+        }
+    }
+
+    void Reserve(SizeType Number)
+    {
+        if (Number <= 0)
+        {
+            return;
+        }
+        const size_t NewCapacity = CapacityForCount(static_cast<size_t>(Number));
+        if (NewCapacity > Capacity)
+        {
+            Resize(NewCapacity);
+        }
+    }
+
+    void Shrink()
+    {
+        if (Size == 0)
+        {
+            Release();
+            return;
+        }
+        const size_t NewCapacity = CapacityForCount(Size);
+        if (NewCapacity < Capacity || GrowthLeft + Size < GrowthForCapacity(Capacity))
+        {
+            Resize(NewCapacity);
+        }
+    }
+
+    Iterator begin() { return Iterator(Control, Slots, Capacity, 0); }
+    Iterator end() { return Iterator(Control, Slots, Capacity, Capacity); }
+    ConstIterator begin() const { return ConstIterator(Control, Slots, Capacity, 0); }
+    ConstIterator end() const { return ConstIterator(Control, Slots, Capacity, Capacity); }
+
+private:
+    // 포인터 키는 하위 비트가 정렬로 0이라 std::hash 결과를 그대로 쓰면 H2가 몰리므로 섞어 쓴다
+    static size_t HashKey(const KeyType& Key)
+    {
+        uint64 Hash = static_cast<uint64>(HasherType{}(Key));
+        Hash *= 0x9E3779B97F4A7C15ull;
+        Hash ^= Hash >> 32;
+        return static_cast<size_t>(Hash);
+    }
+
+    static size_t H1(size_t Hash) { return Hash >> 7; }
+    static int8 H2(size_t Hash) { return static_cast<int8>(Hash & 0x7F); }
+
+    // 최대 적재율 7/8
+    static size_t GrowthForCapacity(size_t InCapacity) { return InCapacity - InCapacity / 8; }
+
+    static size_t CapacityForCount(size_t InCount)
+    {
+        size_t NewCapacity = FFlatHashGroup::Width;
+        while (GrowthForCapacity(NewCapacity) < InCount)
+        {
+            NewCapacity *= 2;
+        }
+        return NewCapacity;
+    }
+
+    size_t FindIndex(const KeyType& Key) const
+    {
+        return Capacity == 0 ? Capacity : FindIndex(Key, HashKey(Key));
+    }
+
+    /**
+     * @brief 그룹 단위 삼각수 탐사. 용량이 그룹 폭의 2의 거듭제곱 배이므로 모든 그룹을 한 번씩 방문한다
+     * @return 찾은 슬롯 인덱스, 없으면 Capacity
+     */
+    size_t FindIndex(const KeyType& Key, size_t Hash) const
+    {
+        if (Capacity == 0)
+        {
+            return Capacity;
+        }
+
+        const size_t Mask = Capacity - 1;
+        const int8 Tag = H2(Hash);
+        size_t Position = H1(Hash) & Mask;
+        size_t Step = 0;
+        while (true)
+        {
+            const FFlatHashGroup Group(Control + Position);
+            for (uint32 MatchMask = Group.Match(Tag); MatchMask != 0; MatchMask &= MatchMask - 1)
+            {
+                const size_t Index = (Position + std::countr_zero(MatchMask)) & Mask;
+                if (KeyEqualType{}(KeyFuncsType::GetKey(Slots[Index]), Key))
+                {
+                    return Index;
+                }
+            }
+            if (Group.MatchEmpty() != 0)
+            {
+                return Capacity;
+            }
+            Step += FFlatHashGroup::Width;
+            Position = (Position + Step) & Mask;
+        }
+    }
+
+    // 처음 만나는 빈 슬롯(Empty 또는 Deleted)
+    size_t FindFirstNonFull(size_t Hash) const
+    {
+        const size_t Mask = Capacity - 1;
+        size_t Position = H1(Hash) & Mask;
+        size_t Step = 0;
+        while (true)
+        {
+            const uint32 FreeMask = FFlatHashGroup(Control + Position).MatchEmptyOrDeleted();
+            if (FreeMask != 0)
+            {
+                return (Position + std::countr_zero(FreeMask)) & Mask;
+            }
+            Step += FFlatHashGroup::Width;
+            Position = (Position + Step) & Mask;
+        }
+    }
+
+    // 새 원소가 들어갈 슬롯을 잡고 제어 바이트를 쓴다. 원소 생성은 호출자가 한다
+    size_t PrepareInsert(size_t Hash)
+    {
+        size_t Index = Capacity > 0 ? FindFirstNonFull(Hash) : 0;
+        if (Capacity == 0 || (GrowthLeft == 0 && Control[Index] != FFlatHashGroup::Deleted))
+        {
+            // 제거 자국이 대부분이면 같은 용량으로 다시 배치해 정리한다
+            const size_t NewCapacity = (Capacity == 0) ? FFlatHashGroup::Width
+                : (Size * 2 < GrowthForCapacity(Capacity) ? Capacity : Capacity * 2);
+            Resize(NewCapacity);
+            Index = FindFirstNonFull(Hash);
+        }
+
+        if (Control[Index] == FFlatHashGroup::Empty)
+        {
+            --GrowthLeft;
+        }
+        SetControl(Index, H2(Hash));
+        ++Size;
+        return Index;
+    }
+
+    // 복제 제어 바이트(용량 뒤 Width - 1개)는 앞쪽 슬롯과 같게 유지해 끝을 넘는 그룹 로드가 이어지게 한다
+    void SetControl(size_t Index, int8 Value)
+    {
+        Control[Index] = Value;
+        if (Index < FFlatHashGroup::Width - 1)
+        {
+            Control[Capacity + Index] = Value;
+        }
+    }
+
+    /**
+     * @brief 슬롯을 비운다. 이 슬롯을 포함하는 어떤 16칸 창도 가득 찬 적이 없다면
+     * 탐사가 여기를 지나쳐 간 적이 없으므로 제거 자국 없이 Empty로 돌려 놓는다
+     */
+    void RemoveAt(size_t Index)
+    {
+        Slots[Index].~ElementType();
+        --Size;
+
+        const size_t Mask = Capacity - 1;
+        const size_t IndexBefore = (Index - FFlatHashGroup::Width) & Mask;
+        const uint32 EmptyAfter = FFlatHashGroup(Control + Index).MatchEmpty();
+        const uint32 EmptyBefore = FFlatHashGroup(Control + IndexBefore).MatchEmpty();
+        const bool bWasNeverFull = EmptyBefore != 0 && EmptyAfter != 0
+            && static_cast<size_t>(std::countr_zero(EmptyAfter) + std::countl_zero(static_cast<uint16>(EmptyBefore))) < FFlatHashGroup::Width;
+
+        if (bWasNeverFull)
+        {
+            SetControl(Index, FFlatHashGroup::Empty);
+            ++GrowthLeft;
+        }
+        else
+        {
+            SetControl(Index, FFlatHashGroup::Deleted);
+        }
+    }
+
+    void Allocate(size_t InCapacity)
+    {
+        const size_t ControlBytes = InCapacity + FFlatHashGroup::Width;
+        const size_t SlotOffset = (ControlBytes + alignof(ElementType) - 1) & ~(alignof(ElementType) - 1);
+        uint8* Memory = static_cast<uint8*>(::operator new(SlotOffset + InCapacity * sizeof(ElementType)));
+
+        Control = reinterpret_cast<int8*>(Memory);
+        Slots = reinterpret_cast<ElementType*>(Memory + SlotOffset);
+        Capacity = InCapacity;
+        ResetControl();
+    }
+
+    void ResetControl()
+    {
+        if (Capacity > 0)
+        {
+            std::memset(Control, static_cast<uint8>(FFlatHashGroup::Empty), Capacity + FFlatHashGroup::Width);
+        }
+        Size = 0;
+        GrowthLeft = GrowthForCapacity(Capacity);
+    }
+
+    /**
+     * @brief 새 배열로 옮겨 다시 배치한다
+     * @note 맵 원소의 키는 const이지만 옮긴 직후 원본을 파괴하므로 키도 이동 생성한다
+     */
+    void Resize(size_t NewCapacity)
+    {
+        int8* OldControl = Control;
+        ElementType* OldSlots = Slots;
+        const size_t OldCapacity = Capacity;
+        const size_t OldSize = Size;
+
+        Allocate(NewCapacity);
+
+        for (size_t OldIndex = 0; OldIndex < OldCapacity; ++OldIndex)
+        {
+            if (OldControl[OldIndex] < 0)
+            {
+                continue;
+            }
+
+            ElementType& OldElement = OldSlots[OldIndex];
+            const size_t Hash = HashKey(KeyFuncsType::GetKey(OldElement));
+            const size_t Index = FindFirstNonFull(Hash);
+            SetControl(Index, H2(Hash));
+            KeyFuncsType::MoveConstruct(&Slots[Index], OldElement);
+            OldElement.~ElementType();
+        }
+        Size = OldSize;
+        GrowthLeft = GrowthForCapacity(Capacity) - Size;
+
+        if (OldControl)
+        {
+            ::operator delete(OldControl);
+        }
+    }
+
+    void CopyFrom(const TFlatHashTable& Other)
+    {
+        if (Other.Size == 0)
+        {
+            return;
+        }
+
+        // 키가 서로 다름을 알고 있으므로 비교 없이 빈 슬롯에 바로 넣는다
+        Allocate(CapacityForCount(Other.Size));
+        for (size_t OtherIndex = 0; OtherIndex < Other.Capacity; ++OtherIndex)
+        {
+            if (Other.Control[OtherIndex] < 0)
+            {
+                continue;
+            }
+
+            const ElementType& OtherElement = Other.Slots[OtherIndex];
+            const size_t Hash = HashKey(KeyFuncsType::GetKey(OtherElement));
+            const size_t Index = FindFirstNonFull(Hash);
+            SetControl(Index, H2(Hash));
+            ::new (static_cast<void*>(&Slots[Index])) ElementType(OtherElement);
+            ++Size;
+            --GrowthLeft;
+        }
+    }
+
+    void StealFrom(TFlatHashTable& Other)
+    {
+        Control = Other.Control;
+        Slots = Other.Slots;
+        Capacity = Other.Capacity;
+        Size = Other.Size;
+        GrowthLeft = Other.GrowthLeft;
+
+        Other.Control = nullptr;
+        Other.Slots = nullptr;
+        Other.Capacity = 0;
+        Other.Size = 0;
+        Other.GrowthLeft = 0;
+    }
+
+    void DestroyElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (size_t Index = 0; Index < Capacity; ++Index)
+            {
+                if (Control[Index] >= 0)
+                {
+                    Slots[Index].~ElementType();
+                }
+            }
+        }
+    }
+
+    void Release()
+    {
+        if (Control)
+        {
+            DestroyElements();
+            ::operator delete(Control);
+        }
+        Control = nullptr;
+        Slots = nullptr;
+        Capacity = 0;
+        Size = 0;
+        GrowthLeft = 0;
+    }
+
+    int8* Control = nullptr;
+    ElementType* Slots = nullptr;
+    size_t Capacity = 0;
+    size_t Size = 0;
+    size_t GrowthLeft = 0;
+};
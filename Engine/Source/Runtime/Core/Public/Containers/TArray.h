@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Runtime/Core/Public/Containers/ContainerAllocationPolicies.h"
+
 using std::vector;
 using std::allocator;
 using std::initializer_list;
@@ -8,6 +10,7 @@ using std::is_trivially_constructible_v;
 /**
  * @brief 언리얼 엔진 스타일의 동적 배열 컨테이너
  * 언리얼 호환성을 위하여 vector를 대체할 목적으로 추가 구현
+ * AllocatorType에는 std 할당자 또는 TInlineAllocator<N>, FFrameAllocator 같은 정책을 넘긴다 (ContainerAllocationPolicies.h)
  */
 template<typename T, typename AllocatorType = allocator<T>>
 class TArray
@@ -17,40 +20,69 @@ public:
     using ElementType = T;
     using SizeType = int32;
     using IndexType = int32;
-    using Iterator = typename vector<T, AllocatorType>::iterator;
-    using ConstIterator = typename vector<T, AllocatorType>::const_iterator;
-    using ReverseIterator = typename vector<T, AllocatorType>::reverse_iterator;
-    using ConstReverseIterator = typename vector<T, AllocatorType>::const_reverse_iterator;
+    using ElementAllocatorType = typename TArrayElementAllocator<AllocatorType, T>::Type;
+    using Iterator = typename vector<T, ElementAllocatorType>::iterator;
+    using ConstIterator = typename vector<T, ElementAllocatorType>::const_iterator;
+    using ReverseIterator = typename vector<T, ElementAllocatorType>::reverse_iterator;
+    using ConstReverseIterator = typename vector<T, ElementAllocatorType>::const_reverse_iterator;
+
+    // 인라인 버퍼 크기 (TInlineAllocator가 아니면 0)
+    static constexpr SizeType InlineCapacity = TArrayInlineCapacity<AllocatorType>::Value;
 
     // Constructors
-    TArray() = default;
+    // 인라인 할당자는 처음부터 버퍼 전체를 잡아 두어야 N개까지 자라는 동안 힙으로 옮겨 가지 않는다
+    TArray()
+    {
+        ReserveInline();
+    }
 
     explicit TArray(SizeType InNum)
-        : Data(static_cast<size_t>(InNum))
     {
+        ReserveInline(InNum);
+        Data.resize(static_cast<size_t>(InNum));
     }
 
     TArray(SizeType InNum, const ElementType& Value)
-        : Data(static_cast<size_t>(InNum), Value)
     {
+        ReserveInline(InNum);
+        Data.assign(static_cast<size_t>(InNum), Value);
     }
 
     TArray(initializer_list<ElementType> InitList)
-        : Data(InitList)
     {
+        ReserveInline(static_cast<SizeType>(InitList.size()));
+        Data.assign(InitList);
     }
 
     template<typename OtherAllocator>
     TArray(const TArray<ElementType, OtherAllocator>& Other)
-        : Data(Other.begin(), Other.end())
     {
+        ReserveInline(Other.Num());
+        Data.assign(Other.begin(), Other.end());
     }
 
     // Copy and Move constructors/assignments
-    TArray(const TArray&) = default;
-    TArray(TArray&&) noexcept = default;
+    TArray(const TArray& Other)
+    {
+        ReserveInline(Other.Num());
+        Data.assign(Other.Data.begin(), Other.Data.end());
+    }
+
+    TArray(TArray&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
     TArray& operator=(const TArray&) = default;
-    TArray& operator=(TArray&&) noexcept = default;
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            MoveFrom(Other);
+        }
+        return *this;
+    }
 
     // Destructor
     ~TArray() = default;
@@ -148,7 +180,17 @@ public:
 
     void Shrink()
     {
-        Data.shrink_to_fit();
+        if constexpr (InlineCapacity > 0)
+        {
+            // shrink_to_fit은 구현에 따라 할당자 사본으로 재할당하므로, 버퍼를 내보낸 뒤 필요한 만큼만 다시 잡는다
+            TArray Shrunk(std::move(*this));
+            ReserveInline(Shrunk.Num());
+            Data.assign(make_move_iterator(Shrunk.Data.begin()), make_move_iterator(Shrunk.Data.end()));
+        }
+        else
+        {
+            Data.shrink_to_fit();
+        }
     }
 
     void Reserve(SizeType Number)
@@ -619,12 +661,12 @@ public:
     ConstReverseIterator crend() const { return Data.crend(); }
 
     // Conversion to STL
-    const vector<T, AllocatorType>& ToStdVector() const
+    const vector<T, ElementAllocatorType>& ToStdVector() const
     {
         return Data;
     }
 
-    vector<T, AllocatorType>& ToStdVector()
+    vector<T, ElementAllocatorType>& ToStdVector()
     {
         return Data;
     }
@@ -641,13 +683,62 @@ public:
     }
 
 private:
-	vector<T, AllocatorType> Data;
+    void ReserveInline(SizeType MinCapacity = 0)
+    {
+        if constexpr (InlineCapacity > 0)
+        {
+            Data.reserve(static_cast<size_t>(std::max(InlineCapacity, MinCapacity)));
+        }
+    }
+
+    /**
+     * @brief 힙 버퍼는 포인터째 가져오고, 인라인 버퍼는 원소 단위로 옮긴다
+     * @note 인라인 버퍼의 용량은 InlineCapacity를 넘지 않으므로 용량만으로 구분할 수 있다.
+     * vector는 이동 대입에서 기존 버퍼를 할당자 사본으로 해제할 수 있으므로, 이쪽 버퍼도 힙이거나 없을 때만 포인터를 가져온다
+     */
+    void MoveFrom(TArray& Other)
+    {
+        if constexpr (InlineCapacity > 0)
+        {
+            const size_t InlineSize = static_cast<size_t>(InlineCapacity);
+            const bool bBothOnHeap = Other.Data.capacity() > InlineSize && (Data.capacity() == 0 || Data.capacity() > InlineSize);
+            if (!bBothOnHeap)
+            {
+                ReserveInline(Other.Num());
+                Data.assign(make_move_iterator(Other.Data.begin()), make_move_iterator(Other.Data.end()));
+                Other.Data.clear();
+                return;
+            }
+        }
+
+        Data = std::move(Other.Data);
+        Other.ReserveInline();
+    }
+
+	vector<T, ElementAllocatorType> Data;
     static constexpr IndexType INDEX_NONE = -1;
 };
 
+/**
+ * @brief 프레임이 끝나면 메모리가 한꺼번에 회수되는 임시 배열
+ * @note 다음 프레임까지 보관하면 안 된다. 보관해야 하면 TArray<T>로 복사할 것
+ */
+template<typename T>
+using TFrameArray = TArray<T, FFrameAllocator>;
+
 // Utility functions for TArray
 template<typename T, typename AllocatorType>
 void Swap(TArray<T, AllocatorType>& A, TArray<T, AllocatorType>& B)
 {
-    A.ToStdVector().swap(B.ToStdVector());
+    if constexpr (TArray<T, AllocatorType>::InlineCapacity > 0)
+    {
+        // 인라인 버퍼는 포인터를 바꿀 수 없으므로 이동으로 교환
+        TArray<T, AllocatorType> Temp(std::move(A));
+        A = std::move(B);
+        B = std::move(Temp);
+    }
+    else
+    {
+        A.ToStdVector().swap(B.ToStdVector());
+    }
 }
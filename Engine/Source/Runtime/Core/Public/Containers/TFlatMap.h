@@ -0,0 +1,292 @@
+#pragma once
+
+#include <tuple>
+
+#include "Runtime/Core/Public/Containers/FlatHashTable.h"
+
+/**
+ * @brief TMap과 같은 인터페이스의 오픈 어드레싱 맵
+ * 키-값 쌍을 노드 없이 하나의 배열에 두므로 조회가 포인터를 따라가지 않고, Reset()은 메모리를 유지한다.
+ * 매 프레임 갱신되는 포인터/정수 키 테이블처럼 조회와 갱신이 잦은 곳에 쓴다.
+ * @note 삽입 중 재배치가 일어나면 Find가 돌려준 포인터와 반복자가 무효가 된다 (TMap은 노드 기반이라 유지된다).
+ * 값의 주소를 오래 들고 있어야 하는 곳은 TMap을 쓸 것.
+ */
+template<typename KeyType, typename ValueType, typename HasherType = hash<KeyType>, typename KeyEqualType = equal_to<KeyType>>
+class TFlatMap
+{
+public:
+    // Type definitions
+    using ElementType = pair<const KeyType, ValueType>;
+    using KeyInitType = KeyType;
+    using ValueInitType = ValueType;
+    using SizeType = int32;
+
+private:
+    struct FKeyFuncs
+    {
+        static const KeyType& GetKey(const ElementType& Element)
+        {
+            return Element.first;
+        }
+
+        // 옮긴 직후 원본을 파괴하므로 const 키도 이동한다
+        static void MoveConstruct(ElementType* Dest, ElementType& Source)
+        {
+            ::new (static_cast<void*>(Dest)) ElementType(std::move(const_cast<KeyType&>(Source.first)), std::move(Source.second));
+        }
+    };
+
+    using TableType = TFlatHashTable<ElementType, KeyType, FKeyFuncs, HasherType, KeyEqualType>;
+
+public:
+    using Iterator = typename TableType::Iterator;
+    using ConstIterator = typename TableType::ConstIterator;
+
+    // Constructors
+    TFlatMap() = default;
+
+    explicit TFlatMap(SizeType ExpectedNumElements)
+    {
+        Data.Reserve(ExpectedNumElements);
+    }
+
+    TFlatMap(std::initializer_list<ElementType> InitList)
+    {
+        Data.Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element.first, Element.second);
+        }
+    }
+
+    // Copy and Move constructors/assignments
+    TFlatMap(const TFlatMap&) = default;
+    TFlatMap(TFlatMap&&) noexcept = default;
+    TFlatMap& operator=(const TFlatMap&) = default;
+    TFlatMap& operator=(TFlatMap&&) noexcept = default;
+
+    // Destructor
+    ~TFlatMap() = default;
+
+    // Element access
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    ValueType& operator[](KeyType&& Key)
+    {
+        return FindOrAdd(std::move(Key));
+    }
+
+    /**
+     * @brief 키에 해당하는 값을 찾아 반환 (언리얼 스타일)
+     * @param Key 찾을 키
+     * @return 값에 대한 포인터 (없으면 nullptr)
+     */
+    ValueType* Find(const KeyType& Key)
+    {
+        ElementType* Element = Data.FindElement(Key);
+        return Element ? &Element->second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const ElementType* Element = Data.FindElement(Key);
+        return Element ? &Element->second : nullptr;
+    }
+
+    /**
+     * @brief 키에 해당하는 값을 찾아 반환 (언리얼 스타일, 기본값 포함)
+     * @param Key 찾을 키
+     * @param DefaultValue 키가 없을 때 반환할 기본값
+     * @return 찾은 값 또는 기본값
+     */
+    ValueType FindRef(const KeyType& Key, const ValueType& DefaultValue = ValueType{}) const
+    {
+        const ElementType* Element = Data.FindElement(Key);
+        return Element ? Element->second : DefaultValue;
+    }
+
+    /**
+     * @brief 키를 찾거나 추가하고 값의 참조를 반환 (언리얼 스타일)
+     * @param Key 찾거나 추가할 키
+     * @return 값에 대한 참조 (없으면 기본 생성된 값 추가 후 반환)
+     */
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        return Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple()).first->second;
+    }
+
+    ValueType& FindOrAdd(KeyType&& Key)
+    {
+        return Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(std::move(Key)), std::forward_as_tuple()).first->second;
+    }
+
+    /**
+     * @brief 키를 찾거나 지정된 값으로 추가하고 참조를 반환 (언리얼 스타일)
+     * @param Key 찾거나 추가할 키
+     * @param Value 키가 없을 때 추가할 값
+     * @return 값에 대한 참조
+     */
+    ValueType& FindOrAdd(const KeyType& Key, const ValueType& Value)
+    {
+        return Data.FindOrEmplace(Key, Key, Value).first->second;
+    }
+
+    ValueType& FindOrAdd(KeyType&& Key, ValueType&& Value)
+    {
+        return Data.FindOrEmplace(Key, std::move(Key), std::move(Value)).first->second;
+    }
+
+    /**
+     * @brief 키가 존재하는지 확인 (언리얼 스타일)
+     */
+    bool Contains(const KeyType& Key) const
+    {
+        return Data.FindElement(Key) != nullptr;
+    }
+
+    // Size and capacity
+    SizeType Num() const
+    {
+        return Data.Num();
+    }
+
+    bool IsEmpty() const
+    {
+        return Data.IsEmpty();
+    }
+
+    // Modifiers
+    void Empty(SizeType ExpectedNumElements = 0)
+    {
+        Data.Empty(ExpectedNumElements);
+    }
+
+    // TMap과 달리 슬롯 배열을 유지하므로 매 프레임 다시 채우는 테이블은 Reset을 쓴다
+    void Reset()
+    {
+        Data.Reset();
+    }
+
+    void Shrink()
+    {
+        Data.Shrink();
+    }
+
+    void Reserve(SizeType Number)
+    {
+        Data.Reserve(Number);
+    }
+
+    /**
+     * @brief 키-값 쌍을 추가 (언리얼 스타일)
+     * @param Key 추가할 키
+     * @param Value 추가할 값
+     * @return 추가된 값에 대한 참조
+     */
+    ValueType& Add(const KeyType& Key, const ValueType& Value)
+    {
+        return FindOrAdd(Key) = Value;
+    }
+
+    ValueType& Add(const KeyType& Key, ValueType&& Value)
+    {
+        return FindOrAdd(Key) = std::move(Value);
+    }
+
+    ValueType& Add(KeyType&& Key, const ValueType& Value)
+    {
+        return FindOrAdd(std::move(Key)) = Value;
+    }
+
+    ValueType& Add(KeyType&& Key, ValueType&& Value)
+    {
+        return FindOrAdd(std::move(Key)) = std::move(Value);
+    }
+
+    /**
+     * @brief 키-값 쌍을 안전하게 추가 (언리얼 스타일)
+     * @param Key 추가할 키
+     * @param Value 추가할 값
+     * @return 추가된 값에 대한 참조 (키가 이미 있으면 기존 값)
+     */
+    ValueType& Emplace(const KeyType& Key, const ValueType& Value)
+    {
+        return Data.FindOrEmplace(Key, Key, Value).first->second;
+    }
+
+    ValueType& Emplace(KeyType&& Key, ValueType&& Value)
+    {
+        return Data.FindOrEmplace(Key, std::move(Key), std::move(Value)).first->second;
+    }
+
+    template<typename... ArgsType>
+    ValueType& Emplace(const KeyType& Key, ArgsType&&... Args)
+    {
+        return Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgsType>(Args)...)).first->second;
+    }
+
+    /**
+     * @brief 키에 해당하는 항목을 제거 (언리얼 스타일)
+     * @param Key 제거할 키
+     * @return 제거된 항목의 개수 (0 또는 1)
+     */
+    SizeType Remove(const KeyType& Key)
+    {
+        return Data.RemoveKey(Key) ? 1 : 0;
+    }
+
+    /**
+     * @brief 키에 해당하는 항목을 제거하고 값을 반환 (언리얼 스타일)
+     * @param Key 제거할 키
+     * @param OutValue 제거된 값을 받을 변수
+     * @return 항목이 제거되었는지 여부
+     */
+    bool RemoveAndCopyValue(const KeyType& Key, ValueType& OutValue)
+    {
+        ElementType* Element = Data.FindElement(Key);
+        if (Element)
+        {
+            OutValue = std::move(Element->second);
+            Data.RemoveElement(Element);
+            return true;
+        }
+        return false;
+    }
+
+    // Iterators
+    Iterator begin() { return Data.begin(); }
+    Iterator end() { return Data.end(); }
+    ConstIterator begin() const { return Data.begin(); }
+    ConstIterator end() const { return Data.end(); }
+
+    ConstIterator CreateConstIterator() const { return Data.begin(); }
+    Iterator CreateIterator() { return Data.begin(); }
+
+    /**
+     * @brief 키-값 쌍을 순회하는 언리얼 스타일 함수
+     * @param Func 각 쌍에 대해 실행할 함수 (KeyType, ValueType 매개변수)
+     */
+    template<typename FuncType>
+    void ForEach(FuncType Func) const
+    {
+        for (const auto& Pair : Data)
+        {
+            Func(Pair.first, Pair.second);
+        }
+    }
+
+    template<typename FuncType>
+    void ForEach(FuncType Func)
+    {
+        for (auto& Pair : Data)
+        {
+            Func(Pair.first, Pair.second);
+        }
+    }
+
+private:
+    TableType Data;
+};
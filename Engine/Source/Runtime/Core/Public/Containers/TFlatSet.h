@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Runtime/Core/Public/Containers/FlatHashTable.h"
+
+/**
+ * @brief TSet과 같은 인터페이스의 오픈 어드레싱 Set
+ * 원소를 노드 없이 하나의 배열에 두므로 조회가 포인터를 따라가지 않고, Reset()은 메모리를 유지한다.
+ * @note 삽입 중 재배치가 일어나면 Find가 돌려준 포인터와 반복자가 무효가 된다.
+ */
+template<typename ElementType, typename HasherType = hash<ElementType>, typename KeyEqualType = equal_to<ElementType>>
+class TFlatSet
+{
+public:
+    // Type definitions
+    using KeyType = ElementType;
+    using SizeType = int32;
+
+private:
+    struct FKeyFuncs
+    {
+        static const ElementType& GetKey(const ElementType& Element)
+        {
+            return Element;
+        }
+
+        static void MoveConstruct(ElementType* Dest, ElementType& Source)
+        {
+            ::new (static_cast<void*>(Dest)) ElementType(std::move(Source));
+        }
+    };
+
+    using TableType = TFlatHashTable<ElementType, KeyType, FKeyFuncs, HasherType, KeyEqualType>;
+
+public:
+    // Set의 원소는 키이므로 반복자로 고칠 수 없다
+    using Iterator = typename TableType::ConstIterator;
+    using ConstIterator = typename TableType::ConstIterator;
+
+    // Constructors
+    TFlatSet() = default;
+
+    explicit TFlatSet(SizeType ExpectedNumElements)
+    {
+        Data.Reserve(ExpectedNumElements);
+    }
+
+    TFlatSet(std::initializer_list<ElementType> InitList)
+    {
+        Data.Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element);
+        }
+    }
+
+    // Copy and Move constructors/assignments
+    TFlatSet(const TFlatSet&) = default;
+    TFlatSet(TFlatSet&&) noexcept = default;
+    TFlatSet& operator=(const TFlatSet&) = default;
+    TFlatSet& operator=(TFlatSet&&) noexcept = default;
+
+    // Destructor
+    ~TFlatSet() = default;
+
+    /**
+     * @brief 요소를 Set에 추가 (언리얼 스타일)
+     * @param InElement 추가할 요소
+     * @return 추가 성공 여부
+     */
+    bool Add(const ElementType& InElement)
+    {
+        return Data.FindOrEmplace(InElement, InElement).second;
+    }
+
+    bool Add(ElementType&& InElement)
+    {
+        return Data.FindOrEmplace(InElement, std::move(InElement)).second;
+    }
+
+    /**
+     * @brief 요소를 안전하게 추가 (언리얼 스타일)
+     * @param InElement 추가할 요소
+     * @return 추가 성공 여부
+     */
+    bool Emplace(const ElementType& InElement)
+    {
+        return Add(InElement);
+    }
+
+    bool Emplace(ElementType&& InElement)
+    {
+        return Add(std::move(InElement));
+    }
+
+    template<typename... ArgsType>
+    bool Emplace(ArgsType&&... Args)
+    {
+        return Add(ElementType(std::forward<ArgsType>(Args)...));
+    }
+
+    /**
+     * @brief 요소가 Set에 포함되어 있는지 확인 (언리얼 스타일)
+     */
+    bool Contains(const ElementType& InElement) const
+    {
+        return Data.FindElement(InElement) != nullptr;
+    }
+
+    /**
+     * @brief 요소를 Set에서 제거 (언리얼 스타일)
+     * @param InElement 제거할 요소
+     * @return 제거된 항목의 개수 (0 또는 1)
+     */
+    SizeType Remove(const ElementType& InElement)
+    {
+        return Data.RemoveKey(InElement) ? 1 : 0;
+    }
+
+    /**
+     * @brief 요소를 찾아서 반환 (언리얼 스타일)
+     * @param InElement 찾을 요소
+     * @return 요소에 대한 포인터 (없으면 nullptr)
+     */
+    const ElementType* Find(const ElementType& InElement) const
+    {
+        return Data.FindElement(InElement);
+    }
+
+    ElementType* Find(const ElementType& InElement)
+    {
+        return Data.FindElement(InElement);
+    }
+
+    // Size and capacity
+    SizeType Num() const
+    {
+        return Data.Num();
+    }
+
+    bool IsEmpty() const
+    {
+        return Data.IsEmpty();
+    }
+
+    // Modifiers
+    void Empty(SizeType ExpectedNumElements = 0)
+    {
+        Data.Empty(ExpectedNumElements);
+    }
+
+    // TSet과 달리 슬롯 배열을 유지하므로 매 프레임 다시 채우는 Set은 Reset을 쓴다
+    void Reset()
+    {
+        Data.Reset();
+    }
+
+    void Shrink()
+    {
+        Data.Shrink();
+    }
+
+    void Reserve(SizeType Number)
+    {
+        Data.Reserve(Number);
+    }
+
+    // Iterators
+    Iterator begin() { return Data.begin(); }
+    Iterator end() { return Data.end(); }
+    ConstIterator begin() const { return Data.begin(); }
+    ConstIterator end() const { return Data.end(); }
+
+    ConstIterator CreateConstIterator() const { return Data.begin(); }
+    Iterator CreateIterator() { return Data.begin(); }
+
+    /**
+     * @brief 각 요소에 대해 함수를 실행하는 언리얼 스타일 함수
+     * @param Func 각 요소에 대해 실행할 함수
+     */
+    template<typename FuncType>
+    void ForEach(FuncType Func) const
+    {
+        for (const auto& Element : Data)
+        {
+            Func(Element);
+        }
+    }
+
+    /**
+     * @brief 조건에 맞는 모든 요소를 제거
+     * @param Predicate 제거 조건을 판단하는 함수
+     * @return 제거된 요소의 개수
+     */
+    template<typename PredicateType>
+    SizeType RemoveAll(PredicateType Predicate)
+    {
+        return Data.RemoveIf(Predicate);
+    }
+
+private:
+    TableType Data;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+
+/**
+ * @brief 프레임 하나의 힙/프레임 메모리 사용량
+ * @param HeapAllocationCount 프레임 동안 전역 operator new가 불린 횟수 (CumulativeAllocationCount의 증가량)
+ * @param UsedBytes 프레임 블록에서 나간 바이트 (정렬 패딩 포함)
+ * @param OverflowBytes 블록이 모자라 일반 힙으로 넘긴 바이트
+ */
+struct FFrameMemoryStats
+{
+	uint64 HeapAllocationCount = 0;
+	size_t UsedBytes = 0;
+	size_t OverflowBytes = 0;
+	uint32 OverflowCount = 0;
+	size_t Capacity = 0;
+};
+
+/**
+ * @brief 한 프레임 동안만 쓰는 임시 배열(TFrameArray)을 위한 선형(bump) 할당자
+ * @note 할당은 원자적 오프셋 증가 하나로 끝나고 개별 해제는 하지 않는다. 엔진 루프가 프레임 끝에 EndFrame()으로 한꺼번에 되돌린다.
+ * 블록이 모자라면 그 프레임에는 일반 힙을 쓰고, 다음 EndFrame()에서 블록을 넘친 만큼 키운다.
+ * 여기서 받은 메모리는 프레임을 넘겨 보관하면 안 된다.
+ */
+class FFrameMemory
+{
+public:
+	static FFrameMemory& GetInstance();
+
+	void* Allocate(size_t InSize, size_t InAlignment);
+	void Deallocate(void* InMemory, size_t InAlignment);
+
+	/**
+	 * @brief 블록을 처음으로 되돌리고 이번 프레임 통계를 남긴다
+	 * @note 프레임 메모리를 쓰는 코드(태스크 포함)가 모두 끝난 뒤 게임 스레드에서 호출해야 한다
+	 */
+	void EndFrame();
+
+	bool Owns(const void* InMemory) const;
+	const FFrameMemoryStats& GetLastFrameStats() const { return LastFrameStats; }
+
+	FFrameMemory(const FFrameMemory&) = delete;
+	FFrameMemory& operator=(const FFrameMemory&) = delete;
+
+private:
+	FFrameMemory();
+	~FFrameMemory();
+
+	void AllocateBlock(size_t InCapacity);
+
+	uint8* Block = nullptr;
+	size_t Capacity = 0;
+	std::atomic<size_t> Offset = 0;
+	std::atomic<size_t> OverflowBytes = 0;
+	std::atomic<uint32> OverflowCount = 0;
+
+	uint64 FrameStartAllocationCount = 0;
+	FFrameMemoryStats LastFrameStats;
+};
@@ -0,0 +1,289 @@
+#include "pch.h"
+
+#include "Runtime/Engine/Public/AnimSequence.h"
+
+IMPLEMENT_CLASS(UAnimSequence, UObject)
+
+namespace
+{
+	constexpr float QUANTIZED_QUAT_RANGE = 0.70710678f;  // smallest-three 성분의 최대 절댓값 (1/√2)
+	constexpr float QUANTIZED_QUAT_SCALE = 32767.0f;     // 15비트
+
+	// 모든 키가 첫 키와 이 오차 안이면 상수 트랙으로 취급
+	constexpr float CONSTANT_TRANSLATION_TOLERANCE = 1.e-4f;
+	constexpr float CONSTANT_SCALE_TOLERANCE = 1.e-5f;
+	constexpr float CONSTANT_ROTATION_DOT_TOLERANCE = 1.e-7f;
+
+	bool IsConstantTrack(const TArray<FVector>& Keys, float Tolerance)
+	{
+		for (const FVector& Key : Keys)
+		{
+			if (std::abs(Key.X - Keys[0].X) > Tolerance || std::abs(Key.Y - Keys[0].Y) > Tolerance || std::abs(Key.Z - Keys[0].Z) > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	float QuatDot(const FQuaternion& A, const FQuaternion& B)
+	{
+		return A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+	}
+
+	bool IsConstantTrack(const TArray<FQuaternion>& Keys)
+	{
+		for (const FQuaternion& Key : Keys)
+		{
+			// q와 -q는 같은 회전
+			if (std::abs(QuatDot(Key, Keys[0])) < 1.0f - CONSTANT_ROTATION_DOT_TOLERANCE)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	FQuaternion NormalizedQuat(FQuaternion Quat)
+	{
+		Quat.Normalize();
+		return Quat;
+	}
+
+	/**
+	 * @brief 채널 하나의 트랙을 상수/애니메이션으로 분류하고 애니메이션 키를 프레임 우선으로 배치
+	 * @param GetKeys: 본 트랙에서 이 채널의 키 배열을 반환
+	 * @param IsConstant: 키 배열이 상수 트랙인지 판단
+	 * @param Store: 원본 키를 저장 형식으로 변환
+	 */
+	template <typename TStoredKey, typename TValue, typename FGetKeys, typename FIsConstant, typename FStore>
+	void BuildChannel(const TArray<FRawAnimSequenceTrack>& BoneTracks, int32 NumFrames, TAnimChannelTracks<TStoredKey, TValue>& OutChannel,
+		const FGetKeys& GetKeys, const FIsConstant& IsConstant, const FStore& Store)
+	{
+		OutChannel.Empty();
+
+		for (int32 BoneIndex = 0; BoneIndex < BoneTracks.Num(); ++BoneIndex)
+		{
+			const TArray<TValue>& Keys = GetKeys(BoneTracks[BoneIndex]);
+			if (Keys.Num() != NumFrames || NumFrames == 0)
+			{
+				continue;
+			}
+
+			if (IsConstant(Keys))
+			{
+				OutChannel.ConstantBones.Add(static_cast<FBoneIndexType>(BoneIndex));
+				OutChannel.ConstantValues.Add(Keys[0]);
+			}
+			else
+			{
+				OutChannel.AnimatedBones.Add(static_cast<FBoneIndexType>(BoneIndex));
+			}
+		}
+
+		const int32 NumAnimated = OutChannel.AnimatedBones.Num();
+		OutChannel.Keys.SetNum(NumAnimated * NumFrames);
+		for (int32 Slot = 0; Slot < NumAnimated; ++Slot)
+		{
+			const TArray<TValue>& Keys = GetKeys(BoneTracks[OutChannel.AnimatedBones[Slot]]);
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				OutChannel.Keys[Frame * NumAnimated + Slot] = Store(Keys[Frame]);
+			}
+		}
+	}
+}
+
+FQuantizedQuat FQuantizedQuat::Quantize(const FQuaternion& InQuat)
+{
+	const FQuaternion Quat = NormalizedQuat(InQuat);
+	const float Components[4] = { Quat.X, Quat.Y, Quat.Z, Quat.W };
+
+	int32 Largest = 0;
+	for (int32 i = 1; i < 4; ++i)
+	{
+		if (std::abs(Components[i]) > std::abs(Components[Largest]))
+		{
+			Largest = i;
+		}
+	}
+
+	// 버린 성분이 항상 양수가 되도록 부호를 맞춘다 (q와 -q는 같은 회전)
+	const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+
+	uint16 Quantized[3];
+	int32 Count = 0;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (i == Largest)
+		{
+			continue;
+		}
+
+		const float Normalized = std::clamp((Components[i] * Sign / QUANTIZED_QUAT_RANGE + 1.0f) * 0.5f, 0.0f, 1.0f);
+		Quantized[Count++] = static_cast<uint16>(Normalized * QUANTIZED_QUAT_SCALE + 0.5f);
+	}
+
+	FQuantizedQuat Result;
+	Result.A = static_cast<uint16>(Quantized[0] | ((Largest & 1) << 15));
+	Result.B = static_cast<uint16>(Quantized[1] | ((Largest >> 1) << 15));
+	Result.C = Quantized[2];
+	return Result;
+}
+
+FQuaternion FQuantizedQuat::Dequantize() const
+{
+	const int32 Largest = (A >> 15) | ((B >> 15) << 1);
+
+	auto Decode = [](uint16 Value)
+	{
+		return (static_cast<float>(Value & 0x7FFF) / QUANTIZED_QUAT_SCALE * 2.0f - 1.0f) * QUANTIZED_QUAT_RANGE;
+	};
+
+	const float V0 = Decode(A);
+	const float V1 = Decode(B);
+	const float V2 = Decode(C);
+	const float Restored = std::sqrt(std::max(0.0f, 1.0f - V0 * V0 - V1 * V1 - V2 * V2));
+
+	float Components[4];
+	int32 Count = 0;
+	const float Stored[3] = { V0, V1, V2 };
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Components[i] = i == Largest ? Restored : Stored[Count++];
+	}
+
+	return FQuaternion(Components[0], Components[1], Components[2], Components[3]);
+}
+
+void UAnimSequence::Build(const FName& InSequenceName, float InFrameRate, int32 InNumFrames, const TArray<FRawAnimSequenceTrack>& InBoneTracks)
+{
+	SequenceName = InSequenceName;
+	FrameRate = InFrameRate > 0.0f ? InFrameRate : 30.0f;
+	NumFrames = std::max(InNumFrames, 0);
+	NumBones = InBoneTracks.Num();
+	RawSize = static_cast<size_t>(NumBones) * NumFrames * (sizeof(FVector) * 2 + sizeof(FQuaternion));
+
+	BuildChannel(InBoneTracks, NumFrames, TranslationTracks,
+		[](const FRawAnimSequenceTrack& Track) -> const TArray<FVector>& { return Track.PosKeys; },
+		[](const TArray<FVector>& Keys) { return IsConstantTrack(Keys, CONSTANT_TRANSLATION_TOLERANCE); },
+		[](const FVector& Key) { return Key; });
+
+	BuildChannel(InBoneTracks, NumFrames, RotationTracks,
+		[](const FRawAnimSequenceTrack& Track) -> const TArray<FQuaternion>& { return Track.RotKeys; },
+		[](const TArray<FQuaternion>& Keys) { return IsConstantTrack(Keys); },
+		[](const FQuaternion& Key) { return FQuantizedQuat::Quantize(Key); });
+
+	BuildChannel(InBoneTracks, NumFrames, ScaleTracks,
+		[](const FRawAnimSequenceTrack& Track) -> const TArray<FVector>& { return Track.ScaleKeys; },
+		[](const TArray<FVector>& Keys) { return IsConstantTrack(Keys, CONSTANT_SCALE_TOLERANCE); },
+		[](const FVector& Key) { return Key; });
+
+	// 상수 회전은 양자화하지 않으므로 정규화만 한다
+	for (FQuaternion& Rotation : RotationTracks.ConstantValues)
+	{
+		Rotation.Normalize();
+	}
+
+	UE_LOG("[AnimSequence] '%s' 압축 완료: %d 프레임, 애니메이션 트랙 (이동 %d, 회전 %d, 스케일 %d) / %d 본, %zu -> %zu bytes",
+		SequenceName.ToString().c_str(), NumFrames,
+		TranslationTracks.AnimatedBones.Num(), RotationTracks.AnimatedBones.Num(), ScaleTracks.AnimatedBones.Num(), NumBones,
+		RawSize, GetCompressedSize());
+}
+
+void UAnimSequence::SamplePose(float InTime, bool bInLooping, TArray<FTransform>& InOutBoneSpaceTransforms) const
+{
+	if (NumFrames == 0 || InOutBoneSpaceTransforms.Num() < NumBones)
+	{
+		return;
+	}
+
+	// 1. 시간 -> 인접한 두 프레임과 보간 비율
+	const int32 LastFrame = NumFrames - 1;
+	float FramePosition = InTime * FrameRate;
+	if (LastFrame == 0)
+	{
+		FramePosition = 0.0f;
+	}
+	else if (bInLooping)
+	{
+		FramePosition = std::fmod(FramePosition, static_cast<float>(LastFrame));
+		if (FramePosition < 0.0f)
+		{
+			FramePosition += static_cast<float>(LastFrame);
+		}
+	}
+	else
+	{
+		FramePosition = std::clamp(FramePosition, 0.0f, static_cast<float>(LastFrame));
+	}
+
+	const int32 Frame0 = std::min(static_cast<int32>(FramePosition), LastFrame);
+	const int32 Frame1 = std::min(Frame0 + 1, LastFrame);
+	const float Alpha = FramePosition - static_cast<float>(Frame0);
+
+	FTransform* OutTransforms = InOutBoneSpaceTransforms.GetData();
+
+	// 2. 상수 트랙
+	for (int32 i = 0; i < TranslationTracks.ConstantBones.Num(); ++i)
+	{
+		OutTransforms[TranslationTracks.ConstantBones[i]].Translation = TranslationTracks.ConstantValues[i];
+	}
+	for (int32 i = 0; i < RotationTracks.ConstantBones.Num(); ++i)
+	{
+		OutTransforms[RotationTracks.ConstantBones[i]].Rotation = RotationTracks.ConstantValues[i];
+	}
+	for (int32 i = 0; i < ScaleTracks.ConstantBones.Num(); ++i)
+	{
+		OutTransforms[ScaleTracks.ConstantBones[i]].Scale = ScaleTracks.ConstantValues[i];
+	}
+
+	// 3. 애니메이션 트랙: 두 프레임의 키 블록을 순차적으로 읽으며 보간
+	auto SampleVectorChannel = [&](const TAnimChannelTracks<FVector, FVector>& Channel, FVector FTransform::* Member)
+	{
+		const int32 NumAnimated = Channel.AnimatedBones.Num();
+		if (NumAnimated == 0)
+		{
+			return;
+		}
+
+		const FVector* Keys0 = Channel.Keys.GetData() + Frame0 * NumAnimated;
+		const FVector* Keys1 = Channel.Keys.GetData() + Frame1 * NumAnimated;
+		for (int32 Slot = 0; Slot < NumAnimated; ++Slot)
+		{
+			OutTransforms[Channel.AnimatedBones[Slot]].*Member = Keys0[Slot] + (Keys1[Slot] - Keys0[Slot]) * Alpha;
+		}
+	};
+
+	SampleVectorChannel(TranslationTracks, &FTransform::Translation);
+	SampleVectorChannel(ScaleTracks, &FTransform::Scale);
+
+	const int32 NumAnimatedRotations = RotationTracks.AnimatedBones.Num();
+	if (NumAnimatedRotations > 0)
+	{
+		const FQuantizedQuat* Keys0 = RotationTracks.Keys.GetData() + Frame0 * NumAnimatedRotations;
+		const FQuantizedQuat* Keys1 = RotationTracks.Keys.GetData() + Frame1 * NumAnimatedRotations;
+		for (int32 Slot = 0; Slot < NumAnimatedRotations; ++Slot)
+		{
+			const FQuaternion A = Keys0[Slot].Dequantize();
+			const FQuaternion B = Keys1[Slot].Dequantize();
+
+			// 인접 프레임 사이의 각도는 작으므로 최단 경로 nlerp로 충분하다
+			const float BlendB = QuatDot(A, B) < 0.0f ? -Alpha : Alpha;
+			const float BlendA = 1.0f - Alpha;
+			FQuaternion Result(
+				A.X * BlendA + B.X * BlendB,
+				A.Y * BlendA + B.Y * BlendB,
+				A.Z * BlendA + B.Z * BlendB,
+				A.W * BlendA + B.W * BlendB);
+			Result.Normalize();
+
+			OutTransforms[RotationTracks.AnimatedBones[Slot]].Rotation = Result;
+		}
+	}
+}
+
+size_t UAnimSequence::GetCompressedSize() const
+{
+	return TranslationTracks.GetAllocatedSize() + RotationTracks.GetAllocatedSize() + ScaleTracks.GetAllocatedSize();
+}
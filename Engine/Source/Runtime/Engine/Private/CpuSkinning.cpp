@@ -0,0 +1,400 @@
+#include "pch.h"
+#include "Runtime/Engine/Public/CpuSkinning.h"
+#include "Runtime/Engine/Public/SkeletalMesh.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+
+namespace
+{
+	// (X, Y, Z, W) -> (Y, Z, X, W)
+	inline __m128 ShuffleYZX(__m128 V)
+	{
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	inline __m128 Cross3(__m128 A, __m128 B)
+	{
+		const __m128 C = _mm_sub_ps(_mm_mul_ps(A, ShuffleYZX(B)), _mm_mul_ps(ShuffleYZX(A), B));
+		return ShuffleYZX(C);
+	}
+
+	// 결과를 모든 레인에 채워 반환
+	inline __m128 Dot4(__m128 A, __m128 B)
+	{
+		__m128 M = _mm_mul_ps(A, B);
+		M = _mm_add_ps(M, _mm_shuffle_ps(M, M, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(M, _mm_shuffle_ps(M, M, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// 결과를 모든 레인에 채워 반환 (W 레인은 0이어야 함)
+	inline __m128 Dot3(__m128 A, __m128 B)
+	{
+		__m128 M = _mm_mul_ps(A, B);
+		M = _mm_add_ps(M, _mm_shuffle_ps(M, M, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(M, _mm_shuffle_ps(M, M, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	inline __m128 SplatW(__m128 V)
+	{
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, 3, 3, 3));
+	}
+
+	// 단위 쿼터니언 Q로 V(W = 0)를 회전: V + 2W(Q x V) + Q x (2(Q x V))
+	inline __m128 RotateByQuat(__m128 Q, __m128 V)
+	{
+		const __m128 T = _mm_add_ps(Cross3(Q, V), Cross3(Q, V));
+		return _mm_add_ps(_mm_add_ps(V, _mm_mul_ps(SplatW(Q), T)), Cross3(Q, T));
+	}
+
+	inline __m128 Normalize3(__m128 V)
+	{
+		const __m128 LengthSquared = _mm_max_ps(Dot3(V, V), _mm_set1_ps(1.e-12f));
+		return _mm_div_ps(V, _mm_sqrt_ps(LengthSquared));
+	}
+
+	// V.X * Row0 + V.Y * Row1 + V.Z * Row2
+	inline __m128 TransformByRows(__m128 V, __m128 Row0, __m128 Row1, __m128 Row2)
+	{
+		__m128 Result = _mm_mul_ps(_mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0)), Row0);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1)), Row1));
+		return _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2)), Row2));
+	}
+
+	inline __m128 LoadVector3(const FVector& V)
+	{
+		return _mm_set_ps(0.0f, V.Z, V.Y, V.X);
+	}
+
+	inline FVector StoreVector3(__m128 V)
+	{
+		alignas(16) float Result[4];
+		_mm_store_ps(Result, V);
+		return FVector(Result[0], Result[1], Result[2]);
+	}
+}
+
+void FCpuSkinning::BuildMatrixPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FSkinMatrix3x4>& OutPalette)
+{
+	OutPalette.SetNum(SkinningMatrices.Num());
+
+	for (int32 BoneIndex = 0; BoneIndex < SkinningMatrices.Num(); ++BoneIndex)
+	{
+		const FMatrix& M = SkinningMatrices[BoneIndex];
+		FSkinMatrix3x4& Out = OutPalette[BoneIndex];
+
+		for (int32 Col = 0; Col < 3; ++Col)
+		{
+			Out.Column[Col] = _mm_set_ps(M.Data[3][Col], M.Data[2][Col], M.Data[1][Col], M.Data[0][Col]);
+		}
+	}
+}
+
+void FCpuSkinning::BuildDualQuatPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FSkinDualQuat>& OutPalette)
+{
+	OutPalette.SetNum(SkinningMatrices.Num());
+
+	for (int32 BoneIndex = 0; BoneIndex < SkinningMatrices.Num(); ++BoneIndex)
+	{
+		const FMatrix& M = SkinningMatrices[BoneIndex];
+
+		// 1. 각 행(기저 벡터)을 정규화해 스케일 제거
+		float R[3][3];
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			const float Length = std::sqrt(M.Data[Row][0] * M.Data[Row][0] + M.Data[Row][1] * M.Data[Row][1] + M.Data[Row][2] * M.Data[Row][2]);
+			const float InvLength = Length > 1.e-8f ? 1.0f / Length : 0.0f;
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				R[Row][Col] = M.Data[Row][Col] * InvLength;
+			}
+		}
+
+		// 2. 회전 행렬 -> 쿼터니언. 행 벡터 규약(v' = v * R)이므로 열 벡터 규약 공식의 전치를 사용한다.
+		float X, Y, Z, W;
+		const float Trace = R[0][0] + R[1][1] + R[2][2];
+		if (Trace > 0.0f)
+		{
+			const float S = std::sqrt(Trace + 1.0f) * 2.0f;
+			W = 0.25f * S;
+			X = (R[1][2] - R[2][1]) / S;
+			Y = (R[2][0] - R[0][2]) / S;
+			Z = (R[0][1] - R[1][0]) / S;
+		}
+		else if (R[0][0] > R[1][1] && R[0][0] > R[2][2])
+		{
+			const float S = std::sqrt(1.0f + R[0][0] - R[1][1] - R[2][2]) * 2.0f;
+			W = (R[1][2] - R[2][1]) / S;
+			X = 0.25f * S;
+			Y = (R[1][0] + R[0][1]) / S;
+			Z = (R[2][0] + R[0][2]) / S;
+		}
+		else if (R[1][1] > R[2][2])
+		{
+			const float S = std::sqrt(1.0f + R[1][1] - R[0][0] - R[2][2]) * 2.0f;
+			W = (R[2][0] - R[0][2]) / S;
+			X = (R[1][0] + R[0][1]) / S;
+			Y = 0.25f * S;
+			Z = (R[2][1] + R[1][2]) / S;
+		}
+		else
+		{
+			const float S = std::sqrt(1.0f + R[2][2] - R[0][0] - R[1][1]) * 2.0f;
+			W = (R[0][1] - R[1][0]) / S;
+			X = (R[2][0] + R[0][2]) / S;
+			Y = (R[2][1] + R[1][2]) / S;
+			Z = 0.25f * S;
+		}
+
+		const float InvLength = 1.0f / std::sqrt(X * X + Y * Y + Z * Z + W * W);
+		X *= InvLength;
+		Y *= InvLength;
+		Z *= InvLength;
+		W *= InvLength;
+
+		// 3. Dual = 0.5 * (T, 0) * Real = 0.5 * (W * T + T x Q, -T . Q)
+		const float TX = M.Data[3][0];
+		const float TY = M.Data[3][1];
+		const float TZ = M.Data[3][2];
+
+		FSkinDualQuat& Out = OutPalette[BoneIndex];
+		Out.Real = _mm_set_ps(W, Z, Y, X);
+		Out.Dual = _mm_set_ps(
+			-0.5f * (TX * X + TY * Y + TZ * Z),
+			0.5f * (W * TZ + TX * Y - TY * X),
+			0.5f * (W * TY + TZ * X - TX * Z),
+			0.5f * (W * TX + TY * Z - TZ * Y));
+	}
+}
+
+template <typename FRangeFunction>
+void FCpuSkinning::DispatchRanges(int32 NumInfluences, int32 NumVertices, bool bAllowParallel, const FRangeFunction& RangeFunction)
+{
+	if (NumVertices == 0)
+	{
+		return;
+	}
+
+	// 슬롯 수를 템플릿 인자로 고정해 영향 본 루프를 펼친다
+	auto SkinChunk = [&](int32 Begin, int32 End)
+	{
+		if (NumInfluences == 4)
+		{
+			RangeFunction(std::integral_constant<int32, 4>(), Begin, End);
+		}
+		else
+		{
+			RangeFunction(std::integral_constant<int32, FSkinWeightStream::MAX_COMPACT_INFLUENCES>(), Begin, End);
+		}
+	};
+
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	if (!bAllowParallel || NumVertices < CPU_SKINNING_PARALLEL_MIN_VERTICES || !Scheduler.IsRunning())
+	{
+		SkinChunk(0, NumVertices);
+		return;
+	}
+
+	Scheduler.ParallelFor(NumVertices, CPU_SKINNING_CHUNK_SIZE, SkinChunk);
+}
+
+void FCpuSkinning::SkinVertices(const FSkinWeightStream& WeightStream, const TArray<FSkinMatrix3x4>& Palette,
+	const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, bool bAllowParallel)
+{
+	const int32 NumVertices = std::min(SourceVertices.Num(), WeightStream.GetNumVertices());
+	DispatchRanges(WeightStream.MaxInfluences, NumVertices, bAllowParallel, [&](auto NumInfluences, int32 Begin, int32 End)
+	{
+		SkinRange<decltype(NumInfluences)::value>(WeightStream, Palette, SourceVertices, OutVertices, Begin, End);
+	});
+}
+
+void FCpuSkinning::SkinVerticesDualQuat(const FSkinWeightStream& WeightStream, const TArray<FSkinDualQuat>& Palette,
+	const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, bool bAllowParallel)
+{
+	const int32 NumVertices = std::min(SourceVertices.Num(), WeightStream.GetNumVertices());
+	DispatchRanges(WeightStream.MaxInfluences, NumVertices, bAllowParallel, [&](auto NumInfluences, int32 Begin, int32 End)
+	{
+		SkinRangeDualQuat<decltype(NumInfluences)::value>(WeightStream, Palette, SourceVertices, OutVertices, Begin, End);
+	});
+}
+
+template <int32 NumInfluences>
+void FCpuSkinning::SkinRange(const FSkinWeightStream& WeightStream, const TArray<FSkinMatrix3x4>& Palette,
+	const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, int32 Begin, int32 End)
+{
+	const FBoneIndexType* BoneIndices = WeightStream.BoneIndices.GetData();
+	const float* Weights = WeightStream.Weights.GetData();
+	const FSkinMatrix3x4* Matrices = Palette.GetData();
+
+	for (int32 VertexIndex = Begin; VertexIndex < End; ++VertexIndex)
+	{
+		const FBoneIndexType* Bones = BoneIndices + VertexIndex * NumInfluences;
+		const float* VertexWeights = Weights + VertexIndex * NumInfluences;
+
+		// 1. 3x4 행렬 가중 합산. 가중치는 내림차순이므로 0을 만나면 나머지도 0이다.
+		const FSkinMatrix3x4& First = Matrices[Bones[0]];
+		const __m128 FirstWeight = _mm_set1_ps(VertexWeights[0]);
+		__m128 Column0 = _mm_mul_ps(First.Column[0], FirstWeight);
+		__m128 Column1 = _mm_mul_ps(First.Column[1], FirstWeight);
+		__m128 Column2 = _mm_mul_ps(First.Column[2], FirstWeight);
+
+		for (int32 i = 1; i < NumInfluences; ++i)
+		{
+			if (VertexWeights[i] == 0.0f)
+			{
+				break;
+			}
+
+			const FSkinMatrix3x4& Matrix = Matrices[Bones[i]];
+			const __m128 Weight = _mm_set1_ps(VertexWeights[i]);
+			Column0 = _mm_add_ps(Column0, _mm_mul_ps(Matrix.Column[0], Weight));
+			Column1 = _mm_add_ps(Column1, _mm_mul_ps(Matrix.Column[1], Weight));
+			Column2 = _mm_add_ps(Column2, _mm_mul_ps(Matrix.Column[2], Weight));
+		}
+
+		// 2. 열 -> 행 전치. Row3는 이동 성분이며 모든 행의 W 레인은 0이 된다.
+		__m128 Row0 = Column0;
+		__m128 Row1 = Column1;
+		__m128 Row2 = Column2;
+		__m128 Row3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+
+		const FNormalVertex& Vertex = SourceVertices[VertexIndex];
+		const __m128 Position = LoadVector3(Vertex.Position);
+		const __m128 Normal = LoadVector3(Vertex.Normal);
+		const __m128 Tangent = _mm_set_ps(0.0f, Vertex.Tangent.Z, Vertex.Tangent.Y, Vertex.Tangent.X);
+
+		// 3. 위치/탄젠트는 합산 행렬, 노말은 여인수 행렬 (= det * 역전치)로 변환. det 부호로 미러링을 보정한다.
+		const __m128 SkinnedPosition = _mm_add_ps(TransformByRows(Position, Row0, Row1, Row2), Row3);
+
+		const __m128 Cofactor0 = Cross3(Row1, Row2);
+		const __m128 Cofactor1 = Cross3(Row2, Row0);
+		const __m128 Cofactor2 = Cross3(Row0, Row1);
+		const __m128 DetSign = _mm_and_ps(Dot3(Row0, Cofactor0), _mm_set1_ps(-0.0f));
+		const __m128 SkinnedNormal = Normalize3(_mm_xor_ps(TransformByRows(Normal, Cofactor0, Cofactor1, Cofactor2), DetSign));
+
+		// Gram-Schmidt로 노말과 직교화
+		__m128 SkinnedTangent = TransformByRows(Tangent, Row0, Row1, Row2);
+		SkinnedTangent = _mm_sub_ps(SkinnedTangent, _mm_mul_ps(Dot3(SkinnedNormal, SkinnedTangent), SkinnedNormal));
+		SkinnedTangent = Normalize3(SkinnedTangent);
+
+		FNormalVertex& ResultVertex = OutVertices[VertexIndex];
+		ResultVertex.Position = StoreVector3(SkinnedPosition);
+		ResultVertex.Normal = StoreVector3(SkinnedNormal);
+		ResultVertex.Tangent = FVector4(StoreVector3(SkinnedTangent), Vertex.Tangent.W);
+		ResultVertex.Color = Vertex.Color;
+		ResultVertex.TexCoord = Vertex.TexCoord;
+	}
+}
+
+template <int32 NumInfluences>
+void FCpuSkinning::SkinRangeDualQuat(const FSkinWeightStream& WeightStream, const TArray<FSkinDualQuat>& Palette,
+	const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, int32 Begin, int32 End)
+{
+	const FBoneIndexType* BoneIndices = WeightStream.BoneIndices.GetData();
+	const float* Weights = WeightStream.Weights.GetData();
+	const FSkinDualQuat* DualQuats = Palette.GetData();
+
+	for (int32 VertexIndex = Begin; VertexIndex < End; ++VertexIndex)
+	{
+		const FBoneIndexType* Bones = BoneIndices + VertexIndex * NumInfluences;
+		const float* VertexWeights = Weights + VertexIndex * NumInfluences;
+
+		// 1. 듀얼 쿼터니언 가중 합산. q와 -q는 같은 회전이므로 첫 번째(가장 큰 가중치) 본과 같은 반구로 맞춘다.
+		const FSkinDualQuat& First = DualQuats[Bones[0]];
+		const __m128 FirstWeight = _mm_set1_ps(VertexWeights[0]);
+		__m128 Real = _mm_mul_ps(First.Real, FirstWeight);
+		__m128 Dual = _mm_mul_ps(First.Dual, FirstWeight);
+
+		for (int32 i = 1; i < NumInfluences; ++i)
+		{
+			if (VertexWeights[i] == 0.0f)
+			{
+				break;
+			}
+
+			const FSkinDualQuat& DualQuat = DualQuats[Bones[i]];
+			const __m128 SignMask = _mm_and_ps(Dot4(First.Real, DualQuat.Real), _mm_set1_ps(-0.0f));
+			const __m128 Weight = _mm_xor_ps(_mm_set1_ps(VertexWeights[i]), SignMask);
+			Real = _mm_add_ps(Real, _mm_mul_ps(DualQuat.Real, Weight));
+			Dual = _mm_add_ps(Dual, _mm_mul_ps(DualQuat.Dual, Weight));
+		}
+
+		// 2. 정규화 후 이동 성분 복원: T = 2 * (Real.W * Dual.XYZ - Dual.W * Real.XYZ + Real.XYZ x Dual.XYZ)
+		const __m128 InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_max_ps(Dot4(Real, Real), _mm_set1_ps(1.e-12f))));
+		Real = _mm_mul_ps(Real, InvLength);
+		Dual = _mm_mul_ps(Dual, InvLength);
+
+		__m128 Translation = _mm_sub_ps(_mm_mul_ps(SplatW(Real), Dual), _mm_mul_ps(SplatW(Dual), Real));
+		Translation = _mm_add_ps(Translation, Cross3(Real, Dual));
+		Translation = _mm_add_ps(Translation, Translation);
+
+		const FNormalVertex& Vertex = SourceVertices[VertexIndex];
+		const __m128 Position = LoadVector3(Vertex.Position);
+		const __m128 Normal = LoadVector3(Vertex.Normal);
+		const __m128 Tangent = _mm_set_ps(0.0f, Vertex.Tangent.Z, Vertex.Tangent.Y, Vertex.Tangent.X);
+
+		// 3. 회전은 길이와 직교성을 보존하므로 노말/탄젠트도 같은 회전만 적용하면 된다
+		const __m128 SkinnedPosition = _mm_add_ps(RotateByQuat(Real, Position), Translation);
+		const __m128 SkinnedNormal = Normalize3(RotateByQuat(Real, Normal));
+		const __m128 SkinnedTangent = Normalize3(RotateByQuat(Real, Tangent));
+
+		FNormalVertex& ResultVertex = OutVertices[VertexIndex];
+		ResultVertex.Position = StoreVector3(SkinnedPosition);
+		ResultVertex.Normal = StoreVector3(SkinnedNormal);
+		ResultVertex.Tangent = FVector4(StoreVector3(SkinnedTangent), Vertex.Tangent.W);
+		ResultVertex.Color = Vertex.Color;
+		ResultVertex.TexCoord = Vertex.TexCoord;
+	}
+}
+
+void FCpuSkinning::SkinVerticesReference(const TArray<FRawSkinWeight>& SkinWeights, const TArray<FMatrix>& SkinningMatrices,
+	const TArray<FMatrix>& InvTransSkinningMatrices, const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices)
+{
+	for (int32 VertexIndex = 0; VertexIndex < SourceVertices.Num(); ++VertexIndex)
+	{
+		const FNormalVertex& Vertex = SourceVertices[VertexIndex];
+		const FRawSkinWeight& SkinWeight = SkinWeights[VertexIndex];
+
+		FVector FinalPosition(0.0f, 0.0f, 0.0f);
+		FVector FinalNormal(0.0f, 0.0f, 0.0f);
+		FVector FinalTangent(0.0f, 0.0f, 0.0f);
+
+		uint32 TotalWeight = 0;
+		for (int32 InfluenceIndex = 0; InfluenceIndex < FRawSkinWeight::MAX_TOTAL_INFLUENCES; ++InfluenceIndex)
+		{
+			const FBoneIndexType BoneIndex = SkinWeight.InfluenceBones[InfluenceIndex];
+			if (BoneIndex == static_cast<FBoneIndexType>(-1))
+			{
+				continue;
+			}
+			const uint16 Weight = SkinWeight.InfluenceWeights[InfluenceIndex];
+			TotalWeight += Weight;
+
+			if (Weight == 0)
+			{
+				continue;
+			}
+
+			const FMatrix& FinalMatrix = SkinningMatrices[BoneIndex];
+			const FMatrix& FinalInvTransMatrix = InvTransSkinningMatrices[BoneIndex];
+
+			FinalPosition += FinalMatrix.TransformPosition(Vertex.Position) * Weight;
+			FinalNormal += FinalInvTransMatrix.TransformVector(Vertex.Normal) * Weight;
+			FinalTangent += FinalMatrix.TransformVector(FVector(Vertex.Tangent)) * Weight;
+		}
+		FinalPosition = FinalPosition / TotalWeight;
+
+		FinalNormal = FinalNormal / TotalWeight;
+		FinalNormal.Normalize();
+
+		FinalTangent = FinalTangent / TotalWeight;
+		FinalTangent = FinalTangent - (FinalNormal.Dot(FinalTangent)) * FinalNormal;
+		FinalTangent.Normalize();
+
+		FNormalVertex& ResultVertex = OutVertices[VertexIndex];
+		ResultVertex.Position = FinalPosition;
+		ResultVertex.Normal = FinalNormal;
+		ResultVertex.Tangent = FVector4(FinalTangent, Vertex.Tangent.W);
+		ResultVertex.Color = Vertex.Color;
+		ResultVertex.TexCoord = Vertex.TexCoord;
+	}
+}
@@ -1,9 +1,103 @@
 #include "pch.h"
 
 #include "Runtime/Engine/Public/SkeletalMesh.h"
+#include "Runtime/Engine/Public/AnimSequence.h"
 
 IMPLEMENT_CLASS(USkeletalMesh, USkinnedAsset)
 
+void FSkeletalMeshRenderData::BuildSkinWeightStream()
+{
+	struct FInfluence
+	{
+		FBoneIndexType Bone;
+		uint16 Weight;
+	};
+
+	constexpr FBoneIndexType InvalidBone = static_cast<FBoneIndexType>(-1);
+
+	// 1. 슬롯 수 결정: 한 정점이라도 4개를 넘으면 8슬롯
+	int32 MaxUsedInfluences = 0;
+	for (const FRawSkinWeight& Raw : SkinWeightVertices)
+	{
+		int32 UsedInfluences = 0;
+		for (uint32 i = 0; i < FRawSkinWeight::MAX_TOTAL_INFLUENCES; ++i)
+		{
+			if (Raw.InfluenceBones[i] != InvalidBone && Raw.InfluenceWeights[i] > 0)
+			{
+				++UsedInfluences;
+			}
+		}
+		MaxUsedInfluences = std::max(MaxUsedInfluences, UsedInfluences);
+	}
+
+	const int32 NumSlots = MaxUsedInfluences <= 4 ? 4 : FSkinWeightStream::MAX_COMPACT_INFLUENCES;
+	const int32 NumVertices = SkinWeightVertices.Num();
+
+	SkinWeightStream.MaxInfluences = NumSlots;
+	SkinWeightStream.BoneIndices.SetNum(NumVertices * NumSlots);
+	SkinWeightStream.Weights.SetNum(NumVertices * NumSlots);
+
+	// 2. 정점마다 유효한 영향만 모아 내림차순 정렬 후 상위 NumSlots개를 정규화
+	int32 TruncatedVertexCount = 0;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		const FRawSkinWeight& Raw = SkinWeightVertices[VertexIndex];
+
+		FInfluence Influences[FRawSkinWeight::MAX_TOTAL_INFLUENCES];
+		int32 NumInfluences = 0;
+		for (uint32 i = 0; i < FRawSkinWeight::MAX_TOTAL_INFLUENCES; ++i)
+		{
+			if (Raw.InfluenceBones[i] != InvalidBone && Raw.InfluenceWeights[i] > 0)
+			{
+				Influences[NumInfluences++] = { Raw.InfluenceBones[i], Raw.InfluenceWeights[i] };
+			}
+		}
+
+		std::sort(Influences, Influences + NumInfluences, [](const FInfluence& A, const FInfluence& B)
+		{
+			return A.Weight > B.Weight;
+		});
+
+		if (NumInfluences > NumSlots)
+		{
+			NumInfluences = NumSlots;
+			++TruncatedVertexCount;
+		}
+
+		uint32 TotalWeight = 0;
+		for (int32 i = 0; i < NumInfluences; ++i)
+		{
+			TotalWeight += Influences[i].Weight;
+		}
+
+		FBoneIndexType* OutBones = &SkinWeightStream.BoneIndices[VertexIndex * NumSlots];
+		float* OutWeights = &SkinWeightStream.Weights[VertexIndex * NumSlots];
+
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			OutBones[i] = i < NumInfluences ? Influences[i].Bone : 0;
+			OutWeights[i] = i < NumInfluences ? static_cast<float>(Influences[i].Weight) / static_cast<float>(TotalWeight) : 0.0f;
+		}
+
+		// 가중치가 없는 정점은 루트 본에 고정
+		if (NumInfluences == 0)
+		{
+			OutWeights[0] = 1.0f;
+		}
+	}
+
+	UE_LOG("[SkeletalMesh] 스킨 가중치 압축 완료: %d 정점, %d 슬롯 (최대 영향 본 %d개, 잘린 정점 %d개)",
+		NumVertices, NumSlots, MaxUsedInfluences, TruncatedVertexCount);
+}
+
+USkeletalMesh::~USkeletalMesh()
+{
+	for (UAnimSequence*& AnimSequence : AnimSequences)
+	{
+		SafeDelete(AnimSequence);
+	}
+}
+
 FSkeletalMeshRenderData* USkeletalMesh::GetSkeletalMeshRenderData() const
 {
 	return SkeletalMeshRenderData.Get();
@@ -90,3 +184,23 @@ FMatrix USkeletalMesh::GetComposedRefPoseMatrix(int32 InBoneIndex)
 {
 	return GetCachedComposedRefPoseMatrices()[InBoneIndex];
 }
+
+void USkeletalMesh::AddAnimSequence(UAnimSequence* InAnimSequence)
+{
+	if (InAnimSequence)
+	{
+		AnimSequences.Add(InAnimSequence);
+	}
+}
+
+UAnimSequence* USkeletalMesh::FindAnimSequence(const FName& InSequenceName) const
+{
+	for (UAnimSequence* AnimSequence : AnimSequences)
+	{
+		if (AnimSequence->GetSequenceName() == InSequenceName)
+		{
+			return AnimSequence;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Global/CoreTypes.h"
+#include "ReferenceSkeleton.h"
+#include "SkinnedAsset.h"
+
+/**
+ * @brief 임포트한 본 하나의 원본 키 (프레임마다 1개씩)
+ * @note 키가 하나도 없는 채널은 애니메이션되지 않으며, 샘플링 시 해당 본의 값을 덮어쓰지 않는다.
+ */
+struct FRawAnimSequenceTrack
+{
+	TArray<FVector> PosKeys;
+	TArray<FQuaternion> RotKeys;
+	TArray<FVector> ScaleKeys;
+};
+
+/**
+ * @brief smallest-three 방식으로 48비트에 압축한 단위 쿼터니언
+ * 절댓값이 가장 큰 성분을 버리고(단위 길이로 복원) 남은 세 성분을 [-1/√2, 1/√2] 범위의 15비트로 양자화한다.
+ * 버린 성분의 인덱스(2비트)는 A, B의 최상위 비트에 나눠 담는다.
+ */
+struct FQuantizedQuat
+{
+	uint16 A;
+	uint16 B;
+	uint16 C;
+
+	static FQuantizedQuat Quantize(const FQuaternion& InQuat);
+	FQuaternion Dequantize() const;
+};
+
+/**
+ * @brief 채널 하나(이동/회전/스케일)의 압축 트랙 모음
+ *
+ * - 모든 프레임의 값이 같은 트랙은 값 하나만 남긴다. (Constant Track Elimination)
+ * - 나머지 트랙의 키는 프레임 우선(SoA)으로 저장한다. Keys[Frame * AnimatedBones.Num() + Slot]
+ *   포즈 하나를 샘플링할 때 인접한 두 프레임의 키 블록만 순차적으로 읽는다.
+ */
+template <typename TStoredKey, typename TValue>
+struct TAnimChannelTracks
+{
+	TArray<FBoneIndexType> AnimatedBones;
+	TArray<TStoredKey> Keys;
+
+	TArray<FBoneIndexType> ConstantBones;
+	TArray<TValue> ConstantValues;
+
+	void Empty()
+	{
+		AnimatedBones.Empty();
+		Keys.Empty();
+		ConstantBones.Empty();
+		ConstantValues.Empty();
+	}
+
+	size_t GetAllocatedSize() const
+	{
+		return (AnimatedBones.Num() + ConstantBones.Num()) * sizeof(FBoneIndexType)
+			+ Keys.Num() * sizeof(TStoredKey) + ConstantValues.Num() * sizeof(TValue);
+	}
+};
+
+/**
+ * @brief 스켈레톤의 본 로컬 트랜스폼을 시간에 따라 기록한 애니메이션 에셋
+ * @note 트랙은 임포트한 스켈레탈 메시의 본 인덱스를 사용하므로 같은 스켈레톤에서만 재생할 수 있다.
+ */
+UCLASS()
+class UAnimSequence : public UObject
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UAnimSequence, UObject)
+
+public:
+	UAnimSequence() = default;
+	virtual ~UAnimSequence() = default;
+
+	/**
+	 * @brief 원본 키로부터 압축 트랙을 생성한다.
+	 * @param InBoneTracks: 본 인덱스 순서의 트랙. 각 채널의 키 수는 0 또는 InNumFrames여야 한다.
+	 */
+	void Build(const FName& InSequenceName, float InFrameRate, int32 InNumFrames, const TArray<FRawAnimSequenceTrack>& InBoneTracks);
+
+	/**
+	 * @brief InTime 시점의 포즈를 샘플링해 본 로컬 트랜스폼에 기록한다. 트랙이 없는 채널은 기존 값을 유지한다.
+	 * @param bInLooping: true이면 재생 길이로 감싸고, false이면 [0, 재생 길이]로 자른다.
+	 * @param InOutBoneSpaceTransforms: 스켈레톤의 본 수 이상이어야 한다.
+	 */
+	void SamplePose(float InTime, bool bInLooping, TArray<FTransform>& InOutBoneSpaceTransforms) const;
+
+	const FName& GetSequenceName() const { return SequenceName; }
+	float GetFrameRate() const { return FrameRate; }
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 GetNumBones() const { return NumBones; }
+
+	/** 재생 길이 (초). 마지막 프레임이 끝 시점이다. */
+	float GetPlayLength() const { return NumFrames > 1 ? static_cast<float>(NumFrames - 1) / FrameRate : 0.0f; }
+
+	/** 압축 전(프레임마다 이동/회전/스케일 전체) 크기와 압축 후 크기 (바이트) */
+	size_t GetRawSize() const { return RawSize; }
+	size_t GetCompressedSize() const;
+
+private:
+	FName SequenceName;
+	float FrameRate = 30.0f;
+	int32 NumFrames = 0;
+	int32 NumBones = 0;
+	size_t RawSize = 0;
+
+	TAnimChannelTracks<FVector, FVector> TranslationTracks;
+	TAnimChannelTracks<FQuantizedQuat, FQuaternion> RotationTracks;
+	TAnimChannelTracks<FVector, FVector> ScaleTracks;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+struct FMatrix;
+struct FNormalVertex;
+struct FRawSkinWeight;
+struct FSkinWeightStream;
+
+constexpr int32 CPU_SKINNING_CHUNK_SIZE = 1024;             // ParallelFor 조각 크기 (정점 수)
+constexpr int32 CPU_SKINNING_PARALLEL_MIN_VERTICES = 4096;  // 이보다 적으면 호출 스레드에서 바로 스키닝
+
+/**
+ * @brief 정점 스키닝 방식
+ */
+enum class ESkinningMethod : uint8
+{
+	LinearBlend,     // 3x4 행렬 가중 합산. 비틀린 관절에서 부피가 줄어드는 candy-wrapper 현상이 있다.
+	DualQuaternion,  // 듀얼 쿼터니언 가중 합산. 강체 변환만 표현하므로 본의 스케일/미러링은 무시된다.
+};
+
+/**
+ * @brief 스키닝 팔레트 항목. FMatrix(행 벡터 규약)의 앞 3열만 전치해서 보관한다.
+ * Column[j] = (M[0][j], M[1][j], M[2][j], M[3][j])이므로 가중 합산이 행렬당 SSE 곱셈-덧셈 3번으로 끝난다.
+ */
+struct alignas(16) FSkinMatrix3x4
+{
+	__m128 Column[3];
+};
+
+/**
+ * @brief 듀얼 쿼터니언 팔레트 항목 (8 float)
+ * Real = 회전 쿼터니언 (X, Y, Z, W), Dual = 0.5 * (이동, 0) * Real
+ */
+struct alignas(16) FSkinDualQuat
+{
+	__m128 Real;
+	__m128 Dual;
+};
+
+/**
+ * @brief CPU 스키닝 커널
+ *
+ * - 정점마다 영향 본의 3x4 행렬을 먼저 가중 합산한 뒤 위치/탄젠트를 한 번만 변환한다. (Linear Blend Skinning)
+ * - 노말은 합산된 행렬의 여인수(cofactor) 행렬로 변환하므로 본별 역전치 행렬이 필요 없다.
+ * - 정점 구간은 FTaskScheduler의 스레드들에 나눠 실행한다. 정점마다 자기 출력만 쓰므로 결과는 스레드 수와 무관하다.
+ */
+class FCpuSkinning
+{
+public:
+	//@brief SkinningMatrices를 스키닝 팔레트로 변환 (포즈가 바뀔 때 한 번)
+	static void BuildMatrixPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FSkinMatrix3x4>& OutPalette);
+
+	//@brief SkinningMatrices를 듀얼 쿼터니언 팔레트로 변환 (행의 길이로 스케일을 제거한 회전과 이동만 사용)
+	static void BuildDualQuatPalette(const TArray<FMatrix>& SkinningMatrices, TArray<FSkinDualQuat>& OutPalette);
+
+	/**
+	 * @brief 압축된 가중치 스트림으로 정점을 스키닝
+	 * @param OutVertices: SourceVertices와 같은 크기여야 한다.
+	 * @param bAllowParallel: false이면 호출 스레드에서만 실행 (벤치마크 비교용)
+	 */
+	static void SkinVertices(const FSkinWeightStream& WeightStream, const TArray<FSkinMatrix3x4>& Palette,
+		const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, bool bAllowParallel);
+
+	/**
+	 * @brief 압축된 가중치 스트림과 듀얼 쿼터니언 팔레트로 정점을 스키닝 (Kavan et al., "Skinning with Dual Quaternions")
+	 * @note 영향마다 8 float만 합산하며, 합산 결과를 정규화해 회전+이동으로 적용하므로 비틀림에서도 부피가 유지된다.
+	 */
+	static void SkinVerticesDualQuat(const FSkinWeightStream& WeightStream, const TArray<FSkinDualQuat>& Palette,
+		const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, bool bAllowParallel);
+
+	//@brief 원본 가중치와 4x4 행렬을 영향 본마다 적용하는 기존 스칼라 경로 (가중치 스트림이 없을 때 및 비교용)
+	static void SkinVerticesReference(const TArray<FRawSkinWeight>& SkinWeights, const TArray<FMatrix>& SkinningMatrices,
+		const TArray<FMatrix>& InvTransSkinningMatrices, const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices);
+
+private:
+	//@brief [0, NumVertices)를 슬롯 수에 맞는 RangeFunction<4/8>로 조각내 실행 (필요하면 병렬)
+	template <typename FRangeFunction>
+	static void DispatchRanges(int32 NumInfluences, int32 NumVertices, bool bAllowParallel, const FRangeFunction& RangeFunction);
+
+	template <int32 NumInfluences>
+	static void SkinRangeDualQuat(const FSkinWeightStream& WeightStream, const TArray<FSkinDualQuat>& Palette,
+		const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, int32 Begin, int32 End);
+
+	template <int32 NumInfluences>
+	static void SkinRange(const FSkinWeightStream& WeightStream, const TArray<FSkinMatrix3x4>& Palette,
+		const TArray<FNormalVertex>& SourceVertices, TArray<FNormalVertex>& OutVertices, int32 Begin, int32 End);
+};
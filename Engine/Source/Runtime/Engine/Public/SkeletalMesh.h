@@ -5,6 +5,8 @@
 #include "Component/Mesh/Public/StaticMesh.h"
 #include "SkinnedAsset.h"
 
+class UAnimSequence;
+
 /** 컨테이너 타입 정의 */
 using FVertexArray = TArray<FVertex>;
 
@@ -33,6 +35,24 @@ struct FRawSkinWeight
 	uint16 InfluenceWeights[MAX_TOTAL_INFLUENCES];
 };
 
+/**
+ * @brief CPU 스키닝용으로 압축한 정점별 가중치 스트림
+ * @note 정점마다 MaxInfluences개(4 또는 8)의 슬롯을 가지며, 가중치 내림차순으로 정렬되고 합이 1이 되도록 정규화되어 있다.
+ *		 빈 슬롯은 (본 0, 가중치 0)으로 채워지므로 스키닝 루프에서 유효성 분기가 필요 없다.
+ *		 i번째 정점의 슬롯은 [i * MaxInfluences, (i + 1) * MaxInfluences) 구간이다.
+ */
+struct FSkinWeightStream
+{
+	static constexpr int32 MAX_COMPACT_INFLUENCES = 8;
+
+	int32 MaxInfluences = 0;
+	TArray<FBoneIndexType> BoneIndices;
+	TArray<float> Weights;
+
+	int32 GetNumVertices() const { return MaxInfluences > 0 ? Weights.Num() / MaxInfluences : 0; }
+	bool IsEmpty() const { return MaxInfluences == 0; }
+};
+
 /**
  * @brief GPU에 전송될 런타임용 데이터를 저장한다.
  * @note 언리얼 엔진에서는 'FSkeletalMeshLODRenderData'의 배열을 통해서 LOD를 이용하지만, 복잡성을 줄이기 위해 직접 FSkeletalMeshRenderData가 정보를 관리한다.
@@ -46,6 +66,15 @@ public:
 	 *		 언리얼 엔진에서는 이 정보를 압축해서 GPU로 전달하지만, 여기에서는 직접 전달한다.
 	 */
 	TArray<FRawSkinWeight> SkinWeightVertices;
+
+	/** SkinWeightVertices를 압축한 CPU 스키닝용 가중치. 임포트 시 BuildSkinWeightStream()으로 생성한다. */
+	FSkinWeightStream SkinWeightStream;
+
+	/**
+	 * @brief SkinWeightVertices로부터 SkinWeightStream을 생성한다.
+	 * 모든 정점의 영향 본이 4개 이하이면 4슬롯, 아니면 8슬롯을 사용하며 초과분은 가중치가 작은 것부터 버리고 재정규화한다.
+	 */
+	void BuildSkinWeightStream();
 };
 
 /*-----------------------------------------------------------------------------
@@ -65,7 +94,7 @@ class USkeletalMesh : public USkinnedAsset
 
 public:
 	USkeletalMesh() = default;
-	virtual ~USkeletalMesh() = default;
+	virtual ~USkeletalMesh();
 
 	/*-----------------------------------------------------------------------------
 		FSkeletalMeshRenderData (런타임에 사용되는 렌더링 리소스)
@@ -152,4 +181,22 @@ private:
 	TArray<FMatrix> CachedComposedRefPoseMatrices;
 
 	TArray<FMatrix> RefBasesInvMatrix;
+
+	/*-----------------------------------------------------------------------------
+		UAnimSequence (같은 파일에서 임포트한 애니메이션)
+	 -----------------------------------------------------------------------------*/
+public:
+	/** 애니메이션을 추가한다. 스켈레탈 메시가 소유권을 가진다. */
+	void AddAnimSequence(UAnimSequence* InAnimSequence);
+
+	const TArray<UAnimSequence*>& GetAnimSequences() const
+	{
+		return AnimSequences;
+	}
+
+	/** 이름으로 애니메이션을 찾는다. 없으면 nullptr */
+	UAnimSequence* FindAnimSequence(const FName& InSequenceName) const;
+
+private:
+	TArray<UAnimSequence*> AnimSequences;
 };
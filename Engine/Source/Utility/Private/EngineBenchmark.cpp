@@ -0,0 +1,2995 @@
+/**
+ * @file EngineBenchmark.cpp
+ * @brief 엔진 벤치마크 구현
+ */
+
+#include "pch.h"
+#include "Utility/Public/EngineBenchmark.h"
+
+#include "Core/Public/ObjectIterator.h"
+#include "Core/Public/ObjectPool.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/BoxComponent.h"
+#include "Component/Public/LightComponent.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/ShapeComponent.h"
+#include "Component/Public/SphereComponent.h"
+#include "Global/DynamicAABBTree.h"
+#include "Global/Octree.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Physics/Public/BoundingSphere.h"
+#include "Physics/Public/Capsule.h"
+#include "Physics/Public/OBB.h"
+#include "Physics/Public/OverlapNarrowphase.h"
+#include "Manager/Asset/Public/FbxManager.h"
+#include "Manager/Asset/Public/MeshOptimizer.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/StaticMeshCooker.h"
+#include "Manager/Asset/Public/VertexQuantizer.h"
+#include "Optimization/Public/MultiViewCuller.h"
+#include "Optimization/Public/OcclusionCuller.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Render/Renderer/Public/MeshDrawList.h"
+#include "Runtime/Core/Public/Async/TaskScheduler.h"
+#include "Runtime/Engine/Public/AnimSequence.h"
+#include "Runtime/Engine/Public/CpuSkinning.h"
+#include "Runtime/Engine/Public/SkeletalMesh.h"
+
+#include <numeric>
+#include <random>
+
+namespace
+{
+	// Incremental 빌더는 삽입마다 전체 cost를 다시 계산하므로 큰 메시는 비교에서 제외
+	constexpr int32 INCREMENTAL_BVH_MAX_TRIANGLES = 50000;
+
+	// Raycast 벤치마크: 메시마다 4x4 격자 Ray 묶음을 이 개수만큼 생성
+	constexpr int32 RAYCAST_GRID_COUNT = 256;
+	constexpr int32 RAYCAST_GRID_SIZE = 4;
+
+	// Overlap 벤치마크: 좁은 공간에 shape를 흩뿌려 임의 pair의 일부만 겹치도록 함
+	constexpr int32 OVERLAP_SHAPE_COUNT = 4096;
+	constexpr int32 OVERLAP_TASK_COUNT = 32768;
+	constexpr int32 OVERLAP_ITERATION_COUNT = 16;
+	constexpr float OVERLAP_SCENE_EXTENT = 8.0f;
+
+	// Skinning 벤치마크: 레퍼런스 포즈의 본마다 이 범위(도) 안에서 무작위 회전을 더한 포즈를 사용
+	constexpr int32 SKINNING_ITERATION_COUNT = 32;
+	constexpr float SKINNING_POSE_MAX_DEGREES = 30.0f;
+
+	// Dual quaternion 벤치마크: 모든 본을 로컬 X축으로 비틀어 candy-wrapper 현상을 유도
+	constexpr const char* DUAL_QUAT_MESH_PATH = "Data/DefaultSkeletalMesh.fbx";
+	constexpr float DUAL_QUAT_TWIST_DEGREES = 90.0f;
+
+	// Animation 벤치마크: 로드된 시퀀스가 없으면 이 메시들을 불러와 임포트된 시퀀스를 사용
+	constexpr const char* ANIM_SAMPLING_MESH_PATHS[] = { "Data/Soldier.fbx", "Data/TutorialTPP.fbx", "Data/DefaultSkeletalMesh.fbx" };
+	constexpr int32 ANIM_SAMPLING_INSTANCE_COUNT = 512;
+	constexpr int32 ANIM_SAMPLING_FRAME_COUNT = 16;
+	constexpr float ANIM_SAMPLING_DELTA_TIME = 1.0f / 60.0f;
+	constexpr int32 ANIM_SAMPLING_CHUNK_SIZE = 16;
+
+	// Cooked mesh 벤치마크: 쿠킹 파일 로드는 짧으므로 여러 번 반복해 평균
+	constexpr const char* COOKED_MESH_DATA_DIRECTORY = "Data/";
+	constexpr int32 COOKED_MESH_WARM_ITERATION_COUNT = 8;
+
+	// OBJ 파싱 벤치마크: 작은 파일은 측정 오차가 크므로 반복해 평균
+	constexpr int32 OBJ_PARSE_ITERATION_COUNT = 4;
+
+	// Mesh optimize 벤치마크: 하드웨어마다 다른 post-transform 캐시 크기를 함께 보고
+	constexpr uint32 MESH_OPTIMIZE_CACHE_SIZES[] = { 16, 32 };
+
+	// Static mesh LOD 벤치마크: quadric 오차는 평균 거리이므로 실제 최대 편차는 한도의 이 배수까지 허용
+	constexpr float STATIC_MESH_LOD_DEVIATION_TOLERANCE = 2.0f;
+	constexpr int32 STATIC_MESH_LOD_MAX_SAMPLES = 2048;  // 편차를 측정할 원본 정점 수 상한
+
+	// Vertex quantize 벤치마크: 위치는 반올림이므로 단계의 절반, 방향은 octahedral SNORM16 (tangent는 15비트) 오차까지 허용
+	constexpr float VERTEX_QUANTIZE_POSITION_TOLERANCE = 0.5f + 1.0e-3f;
+	constexpr float VERTEX_QUANTIZE_MAX_DEGREES = 0.1f;
+	constexpr float VERTEX_QUANTIZE_COLOR_TOLERANCE = 0.5f / 255.0f + 1.0e-6f;
+
+	// Occlusion 벤치마크: 레벨 바운드로 정하는 고정 카메라 경로 (궤도 + 가로지르기)를 실행마다 같게 재생
+	constexpr int32 OCCLUSION_PATH_FRAME_COUNT = 64;           // 경로마다
+	constexpr float OCCLUSION_PATH_ORBIT_RADIUS_RATIO = 0.6f;  // 레벨 수평 반경 대비 궤도 반경
+	constexpr float OCCLUSION_PATH_HEIGHT_RATIO = 0.15f;       // 레벨 바닥에서의 시점 높이 비율 (가림이 많은 낮은 시점)
+	constexpr float OCCLUSION_PATH_FOV_DEGREES = 90.0f;
+	constexpr float OCCLUSION_PATH_ASPECT = 16.0f / 9.0f;
+	constexpr float OCCLUSION_PATH_NEAR = 0.1f;
+	constexpr float OCCLUSION_DEPTH_TOLERANCE = 1.0e-5f;       // 타일 깊이와 픽셀 깊이의 부동소수점 오차
+
+	// Frustum 벤치마크: 4분할 뷰포트처럼 90도씩 어긋난 시점 4개가 레벨 중심을 보며 궤도를 돈다 (카메라 설정은 Occlusion과 공유)
+	constexpr int32 FRUSTUM_FRAME_COUNT = 64;
+	constexpr int32 FRUSTUM_VIEW_COUNT = 4;
+
+	// MultiView 벤치마크: Frustum 벤치마크의 시점 4개 + 첫 시점을 감싸는 직교 캐스케이드 4개 + 레벨 중심 포인트 라이트 6면
+	constexpr int32 MULTIVIEW_CASCADE_COUNT = 4;
+	constexpr int32 MULTIVIEW_POINT_FACE_COUNT = 6;
+	constexpr int32 MULTIVIEW_VIEW_COUNT = FRUSTUM_VIEW_COUNT + MULTIVIEW_CASCADE_COUNT + MULTIVIEW_POINT_FACE_COUNT;
+	constexpr float MULTIVIEW_POINT_LIGHT_RADIUS_RATIO = 0.5f; // 레벨 수평 반경 대비 포인트 라이트 반경
+
+	// DrawList 벤치마크: 레벨 없이 만든 스태틱 메시 draw (프리미티브마다 섹션 1~4개)
+	constexpr int32 DRAWLIST_PRIMITIVE_COUNT = 10000;
+	constexpr int32 DRAWLIST_MESH_COUNT = 200;
+	constexpr int32 DRAWLIST_MATERIAL_COUNT = 64;
+	constexpr int32 DRAWLIST_MAX_SECTION_COUNT = 4;
+	constexpr int32 DRAWLIST_ITERATION_COUNT = 32;
+
+	// Name 벤치마크: 클래스 이름 몇 개로 오브젝트를 대량 스폰하듯 GetUniqueName을 반복 호출
+	constexpr int32 NAME_CLASS_COUNT = 128;
+	constexpr int32 NAME_SPAWN_COUNT = 200000;
+	constexpr int32 NAME_LOOKUP_COUNT = 1000000;
+	constexpr int32 NAME_CHUNK_SIZE = 1024;
+
+	// Alloc 벤치마크: 프레임마다 프리미티브 전체 수집 배열 하나와 OBJ 면 같은 작은 배열 여러 개를 만든다
+	constexpr int32 ALLOC_FRAME_COUNT = 256;
+	constexpr int32 ALLOC_PRIMITIVE_COUNT = 8192;
+	constexpr int32 ALLOC_FACE_COUNT = 1024;
+	constexpr int32 ALLOC_FACE_CORNER_COUNT = 4;
+
+	// HashMap 벤치마크: 키 종류마다 이 개수를 넣고, 같은 수의 없는 키를 섞어 조회한다
+	constexpr int32 HASHMAP_KEY_COUNT = 16384;
+	constexpr int32 HASHMAP_ROUND_COUNT = 8;
+	constexpr int32 HASHMAP_ITERATE_COUNT = 16;
+
+	// ObjectPool 벤치마크: 라운드마다 이만큼 스폰하고, 절반을 파괴했다 다시 채운 뒤 전부 파괴한다
+	constexpr int32 OBJPOOL_ROUND_COUNT = 64;
+	constexpr int32 OBJPOOL_BURST_COUNT = 4096;
+
+	// Cast 벤치마크: 레벨 객체와 직접 스폰한 컴포넌트를 섞은 모집단에서 뽑은 객체 수와 반복 횟수
+	constexpr int32 CAST_SPAWN_COUNT = 1024;
+	constexpr int32 CAST_OBJECT_COUNT = 65536;
+	constexpr int32 CAST_ROUND_COUNT = 32;
+
+	template <typename T>
+	bool IsSameArray(const TArray<T>& A, const TArray<T>& B)
+	{
+		return A.Num() == B.Num() && memcmp(A.GetData(), B.GetData(), sizeof(T) * A.Num()) == 0;
+	}
+
+	bool IsSameObjInfo(const FObjInfo& A, const FObjInfo& B)
+	{
+		if (!IsSameArray(A.VertexList, B.VertexList) || !IsSameArray(A.NormalList, B.NormalList)
+			|| !IsSameArray(A.TexCoordList, B.TexCoordList) || A.ObjectInfoList.Num() != B.ObjectInfoList.Num()
+			|| A.ObjectMaterialInfoList.Num() != B.ObjectMaterialInfoList.Num())
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < A.ObjectInfoList.Num(); ++i)
+		{
+			const FObjectInfo& ObjectA = A.ObjectInfoList[i];
+			const FObjectInfo& ObjectB = B.ObjectInfoList[i];
+			if (ObjectA.Name != ObjectB.Name
+				|| !IsSameArray(ObjectA.VertexIndexList, ObjectB.VertexIndexList)
+				|| !IsSameArray(ObjectA.NormalIndexList, ObjectB.NormalIndexList)
+				|| !IsSameArray(ObjectA.TexCoordIndexList, ObjectB.TexCoordIndexList)
+				|| ObjectA.GroupNameList != ObjectB.GroupNameList || !IsSameArray(ObjectA.GroupIndexList, ObjectB.GroupIndexList)
+				|| ObjectA.MaterialNameList != ObjectB.MaterialNameList || !IsSameArray(ObjectA.MaterialIndexList, ObjectB.MaterialIndexList))
+			{
+				return false;
+			}
+		}
+
+		for (int32 i = 0; i < A.ObjectMaterialInfoList.Num(); ++i)
+		{
+			const FObjectMaterialInfo& MaterialA = A.ObjectMaterialInfoList[i];
+			const FObjectMaterialInfo& MaterialB = B.ObjectMaterialInfoList[i];
+			if (MaterialA.Name != MaterialB.Name || MaterialA.Kd != MaterialB.Kd || MaterialA.KdMap != MaterialB.KdMap
+				|| MaterialA.BumpMap != MaterialB.BumpMap || MaterialA.D != MaterialB.D)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool IsSameStaticMesh(const FStaticMesh& A, const FStaticMesh& B)
+	{
+		return A.Vertices.Num() == B.Vertices.Num() && A.Indices.Num() == B.Indices.Num()
+			&& A.Sections.Num() == B.Sections.Num() && A.MaterialInfo.Num() == B.MaterialInfo.Num()
+			&& memcmp(A.Vertices.GetData(), B.Vertices.GetData(), sizeof(FNormalVertex) * A.Vertices.Num()) == 0
+			&& memcmp(A.Indices.GetData(), B.Indices.GetData(), sizeof(uint32) * A.Indices.Num()) == 0
+			&& A.BVH.GetFlatNodes().Num() == B.BVH.GetFlatNodes().Num();
+	}
+
+	// UCamera::UpdateMatrixByPers와 같은 방식으로 Eye에서 Target을 보는 카메라 구성
+	FCameraConstants MakeBenchmarkCamera(const FVector& Eye, const FVector& Target, float FarZ)
+	{
+		FVector Forward = Target - Eye;
+		Forward.Normalize();
+		FVector Right = FVector(0, 0, 1).Cross(Forward);
+		if (Right.LengthSquared() < MATH_EPSILON)
+		{
+			Right = FVector(0, 1, 0);
+		}
+		Right.Normalize();
+		FVector Up = Forward.Cross(Right);
+		Up.Normalize();
+
+		FCameraConstants Camera;
+		Camera.View = FMatrix::TranslationMatrixInverse(Eye) * FMatrix(Right, Up, Forward).Transpose();
+
+		const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(OCCLUSION_PATH_FOV_DEGREES) * 0.5f);
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = F / OCCLUSION_PATH_ASPECT;
+		Projection.Data[1][1] = F;
+		Projection.Data[2][2] = FarZ / (FarZ - OCCLUSION_PATH_NEAR);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = (-OCCLUSION_PATH_NEAR * FarZ) / (FarZ - OCCLUSION_PATH_NEAR);
+		Projection.Data[3][3] = 0.0f;
+		Camera.Projection = Projection;
+
+		Camera.ViewWorldLocation = Eye;
+		Camera.NearClip = OCCLUSION_PATH_NEAR;
+		Camera.FarClip = FarZ;
+		return Camera;
+	}
+
+	// 레벨의 모든 프리미티브(옥트리 + 동적 트리)와 그 World AABB를 합친 바운드. 프리미티브가 없으면 false
+	bool GetLevelPrimitiveBounds(ULevel* Level, TArray<UPrimitiveComponent*>& OutPrimitives, FVector& OutMin, FVector& OutMax)
+	{
+		Level->GetStaticOctree()->GetAllPrimitives(OutPrimitives);
+		if (Level->GetDynamicPrimitiveTree())
+		{
+			Level->GetDynamicPrimitiveTree()->GetAllPrimitives(OutPrimitives);
+		}
+
+		OutMin = FVector(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		OutMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (UPrimitiveComponent* Primitive : OutPrimitives)
+		{
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			OutMin = FVector(std::min(OutMin.X, Min.X), std::min(OutMin.Y, Min.Y), std::min(OutMin.Z, Min.Z));
+			OutMax = FVector(std::max(OutMax.X, Max.X), std::max(OutMax.Y, Max.Y), std::max(OutMax.Z, Max.Z));
+		}
+		return !OutPrimitives.IsEmpty();
+	}
+
+	/**
+	 * @brief SoA 이전 방식의 스칼라 절두체 컬링: 트리를 순회하며 프리미티브마다 FFrustum::CheckIntersection 호출
+	 * @note 동적 프리미티브는 트리에 저장된 값 대신 GetWorldAABB로 검사해 SoA 풀이 최신인지도 함께 확인한다
+	 */
+	void CullFrustumScalar(ULevel* Level, const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutVisible)
+	{
+		auto ClassifyNode = [&Frustum](const FAABB& NodeBounds)
+		{
+			switch (Frustum.CheckIntersection(NodeBounds))
+			{
+			case EBoundCheckResult::Outside:
+				return EOctreeVisit::Skip;
+			case EBoundCheckResult::Inside:
+				return EOctreeVisit::VisitAll;
+			default:
+				return EOctreeVisit::Visit;
+			}
+		};
+
+		Level->GetStaticOctree()->Traverse(ClassifyNode,
+			[&](UPrimitiveComponent* Primitive, const FAABB& Bounds, bool bAcceptedByNode)
+			{
+				if (Primitive && Primitive->IsVisible()
+					&& (bAcceptedByNode || Frustum.CheckIntersection(Bounds) != EBoundCheckResult::Outside))
+				{
+					OutVisible.Add(Primitive);
+				}
+			});
+
+		if (Level->GetDynamicPrimitiveTree())
+		{
+			Level->GetDynamicPrimitiveTree()->Traverse(ClassifyNode,
+				[&](UPrimitiveComponent* Primitive, const FAABB&, bool bAcceptedByNode)
+				{
+					if (!Primitive || !Primitive->IsVisible())
+					{
+						return;
+					}
+
+					FVector Min, Max;
+					Primitive->GetWorldAABB(Min, Max);
+					if (bAcceptedByNode || Frustum.CheckIntersection(FAABB(Min, Max)) != EBoundCheckResult::Outside)
+					{
+						OutVisible.Add(Primitive);
+					}
+				});
+		}
+	}
+
+	// 순서와 관계없이 같은 프리미티브 집합인지 비교
+	bool IsSamePrimitiveSet(TArray<UPrimitiveComponent*> A, TArray<UPrimitiveComponent*> B)
+	{
+		A.Sort();
+		B.Sort();
+		return IsSameArray(A, B);
+	}
+
+	/**
+	 * @brief 오클루더 삼각형을 픽셀마다 래스터라이즈해 가장 가까운 깊이를 구하고, 그 최댓값이 타일 ZMax0보다 먼 타일 수를 센다
+	 * @note 0이 아니면 타일 깊이가 보수적이지 않다. 모서리 함수는 COcclusionCuller와 같은 순서로 계산한다.
+	 */
+	int32 CountOcclusionDepthViolations(const COcclusionCuller& Culler)
+	{
+		constexpr int32 Width = COcclusionCuller::Z_BUFFER_WIDTH;
+		constexpr int32 TileWidth = COcclusionCuller::TILE_WIDTH;
+		constexpr int32 TileHeight = COcclusionCuller::TILE_HEIGHT;
+
+		TArray<float> PixelDepths;
+		PixelDepths.SetNum(Width * COcclusionCuller::Z_BUFFER_HEIGHT, 1.0f);
+		for (const FOcclusionTriangle& Triangle : Culler.GetTriangles())
+		{
+			for (int32 TileY = Triangle.MinTileY; TileY <= Triangle.MaxTileY; ++TileY)
+			{
+				const float TileTop = static_cast<float>(TileY * TileHeight);
+				for (int32 TileX = Triangle.MinTileX; TileX <= Triangle.MaxTileX; ++TileX)
+				{
+					const float TileLeft = static_cast<float>(TileX * TileWidth);
+					for (int32 Row = 0; Row < TileHeight; ++Row)
+					{
+						const float PixelY = TileTop + Row + 0.5f;
+						for (int32 Column = 0; Column < TileWidth; ++Column)
+						{
+							bool bInside = true;
+							for (int32 Edge = 0; Edge < 3; ++Edge)
+							{
+								const float RowBase = Triangle.EdgeA[Edge] * TileLeft + Triangle.EdgeB[Edge] * PixelY + Triangle.EdgeC[Edge];
+								bInside = bInside && RowBase + Triangle.EdgeA[Edge] * (Column + 0.5f) >= 0.0f;
+							}
+							if (!bInside)
+							{
+								continue;
+							}
+
+							const float PixelX = TileLeft + Column + 0.5f;
+							const float Depth = std::clamp(Triangle.DepthDx * PixelX + Triangle.DepthDy * PixelY + Triangle.DepthC,
+								Triangle.MinDepth, Triangle.MaxDepth);
+							float& PixelDepth = PixelDepths[(TileY * TileHeight + Row) * Width + TileX * TileWidth + Column];
+							PixelDepth = std::min(PixelDepth, Depth);
+						}
+					}
+				}
+			}
+		}
+
+		int32 ViolationCount = 0;
+		const TArray<float>& TileDepths = Culler.GetTileDepths();
+		for (int32 TileY = 0; TileY < COcclusionCuller::TILES_Y; ++TileY)
+		{
+			for (int32 TileX = 0; TileX < COcclusionCuller::TILES_X; ++TileX)
+			{
+				float MaxPixelDepth = 0.0f;
+				for (int32 Row = 0; Row < TileHeight; ++Row)
+				{
+					for (int32 Column = 0; Column < TileWidth; ++Column)
+					{
+						MaxPixelDepth = std::max(MaxPixelDepth, PixelDepths[(TileY * TileHeight + Row) * Width + TileX * TileWidth + Column]);
+					}
+				}
+				ViolationCount += MaxPixelDepth > TileDepths[TileY * COcclusionCuller::TILES_X + TileX] + OCCLUSION_DEPTH_TOLERANCE ? 1 : 0;
+			}
+		}
+		return ViolationCount;
+	}
+
+	// 인덱스 삼각형들의 부호 있는 부피 (닫힌 메시가 아니어도 상대 비교용으로 사용)
+	double ComputeSignedVolume(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+	{
+		double Volume = 0.0;
+		for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+		{
+			const FVector& P0 = Vertices[Indices[i]].Position;
+			const FVector& P1 = Vertices[Indices[i + 1]].Position;
+			const FVector& P2 = Vertices[Indices[i + 2]].Position;
+			Volume += P0.Dot(P1.Cross(P2));
+		}
+		return Volume / 6.0;
+	}
+
+	// 섹션마다 삼각형(정점 값 기준) 집합이 같은지 검사. 삼각형과 정점의 순서는 무시하고 감기 방향은 구분
+	bool IsSameTriangleSet(const FStaticMesh& A, const FStaticMesh& B)
+	{
+		if (A.Indices.Num() != B.Indices.Num() || A.Sections.Num() != B.Sections.Num())
+		{
+			return false;
+		}
+
+		auto CompareTriangles = [](const FStaticMesh& MeshA, uint32 TriangleA, const FStaticMesh& MeshB, uint32 TriangleB)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int Result = memcmp(&MeshA.Vertices[MeshA.Indices[TriangleA * 3 + Corner]],
+					&MeshB.Vertices[MeshB.Indices[TriangleB * 3 + Corner]], sizeof(FNormalVertex));
+				if (Result != 0)
+				{
+					return Result;
+				}
+			}
+			return 0;
+		};
+
+		auto SortTriangles = [&CompareTriangles](const FStaticMesh& Mesh, const FMeshSection& Section)
+		{
+			TArray<uint32> Triangles;
+			Triangles.SetNum(Section.IndexCount / 3);
+			std::iota(Triangles.begin(), Triangles.end(), Section.StartIndex / 3);
+			Triangles.Sort([&](uint32 Left, uint32 Right) { return CompareTriangles(Mesh, Left, Mesh, Right) < 0; });
+			return Triangles;
+		};
+
+		for (int32 SectionIndex = 0; SectionIndex < A.Sections.Num(); ++SectionIndex)
+		{
+			const FMeshSection& SectionA = A.Sections[SectionIndex];
+			const FMeshSection& SectionB = B.Sections[SectionIndex];
+			if (SectionA.StartIndex != SectionB.StartIndex || SectionA.IndexCount != SectionB.IndexCount
+				|| SectionA.MaterialSlot != SectionB.MaterialSlot)
+			{
+				return false;
+			}
+
+			const TArray<uint32> TrianglesA = SortTriangles(A, SectionA);
+			const TArray<uint32> TrianglesB = SortTriangles(B, SectionB);
+			for (int32 i = 0; i < TrianglesA.Num(); ++i)
+			{
+				if (CompareTriangles(A, TrianglesA[i], B, TrianglesB[i]) != 0)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// 점과 삼각형 사이의 최단 거리 (Ericson, Real-Time Collision Detection 5.1.5)
+	float ComputePointTriangleDistance(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+	{
+		const FVector AB = B - A;
+		const FVector AC = C - A;
+		const FVector AP = P - A;
+		const float D1 = AB.Dot(AP);
+		const float D2 = AC.Dot(AP);
+		if (D1 <= 0.0f && D2 <= 0.0f)
+		{
+			return (P - A).Length();
+		}
+
+		const FVector BP = P - B;
+		const float D3 = AB.Dot(BP);
+		const float D4 = AC.Dot(BP);
+		if (D3 >= 0.0f && D4 <= D3)
+		{
+			return (P - B).Length();
+		}
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			return (P - (A + AB * (D1 / (D1 - D3)))).Length();
+		}
+
+		const FVector CP = P - C;
+		const float D5 = AB.Dot(CP);
+		const float D6 = AC.Dot(CP);
+		if (D6 >= 0.0f && D5 <= D6)
+		{
+			return (P - C).Length();
+		}
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			return (P - (A + AC * (D2 / (D2 - D6)))).Length();
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && D4 - D3 >= 0.0f && D5 - D6 >= 0.0f)
+		{
+			return (P - (B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6))))).Length();
+		}
+
+		const float Denominator = 1.0f / (VA + VB + VC);
+		return (P - (A + AB * (VB * Denominator) + AC * (VC * Denominator))).Length();
+	}
+
+	// 위치가 같은 정점을 하나로 보고 삼각형 하나에만 속한 edge 수를 센다 (단순화가 구멍을 만들었는지 검사)
+	int32 CountOpenEdges(const TArray<FNormalVertex>& Vertices, const uint32* Indices, uint32 IndexCount)
+	{
+		TArray<uint32> Order;
+		Order.SetNum(Vertices.Num());
+		std::iota(Order.begin(), Order.end(), 0u);
+		auto LessPosition = [&Vertices](uint32 A, uint32 B)
+		{
+			const FVector& PA = Vertices[A].Position;
+			const FVector& PB = Vertices[B].Position;
+			return std::tie(PA.X, PA.Y, PA.Z) < std::tie(PB.X, PB.Y, PB.Z);
+		};
+		Order.Sort(LessPosition);
+
+		TArray<uint32> PositionIds;
+		PositionIds.SetNum(Vertices.Num());
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			PositionIds[Order[i]] = i > 0 && !LessPosition(Order[i - 1], Order[i]) ? PositionIds[Order[i - 1]] : Order[i];
+		}
+
+		TArray<uint64> Edges;
+		Edges.Reserve(IndexCount);
+		for (uint32 i = 0; i + 2 < IndexCount; i += 3)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint64 A = PositionIds[Indices[i + Corner]];
+				const uint64 B = PositionIds[Indices[i + (Corner + 1) % 3]];
+				if (A != B)
+				{
+					Edges.Add(std::min(A, B) << 32 | std::max(A, B));
+				}
+			}
+		}
+		Edges.Sort([](uint64 A, uint64 B) { return A < B; });
+
+		int32 OpenEdgeCount = 0;
+		for (int32 Begin = 0; Begin < Edges.Num();)
+		{
+			int32 End = Begin + 1;
+			while (End < Edges.Num() && Edges[End] == Edges[Begin])
+			{
+				++End;
+			}
+			OpenEdgeCount += End - Begin == 1 ? 1 : 0;
+			Begin = End;
+		}
+		return OpenEdgeCount;
+	}
+
+	/**
+	 * @brief 한 프레임 동안 만드는 임시 배열 흉내. 배열 타입만 바꿔 힙 할당 수를 비교한다
+	 */
+	template <typename GatherArrayType, typename FaceArrayType>
+	int64 BuildFrameTemporaries(const TArray<int32>& InValues, const TArray<FString>& InFaceTokens)
+	{
+		int64 Checksum = 0;
+
+		// GetAllPrimitives처럼 전부 모은 뒤 걸러낸다
+		GatherArrayType Gathered;
+		Gathered.Reserve(InValues.Num());
+		for (int32 Value : InValues)
+		{
+			Gathered.Add(Value);
+		}
+		for (int32 Value : Gathered)
+		{
+			Checksum += (Value & 1) ? Value : 0;
+		}
+
+		// OBJ 면처럼 줄마다 토큰 몇 개짜리 배열을 만든다
+		for (int32 Face = 0; Face + ALLOC_FACE_CORNER_COUNT <= InFaceTokens.Num(); Face += ALLOC_FACE_CORNER_COUNT)
+		{
+			FaceArrayType Tokens;
+			for (int32 Corner = 0; Corner < ALLOC_FACE_CORNER_COUNT; ++Corner)
+			{
+				Tokens.Add(InFaceTokens[Face + Corner]);
+			}
+			Checksum += Tokens.Num() + static_cast<int64>(Tokens[0].size());
+		}
+		return Checksum;
+	}
+
+	/**
+	 * @brief 비교용으로 남겨 둔 기존 FNameTable 방식. 호출마다 락을 잡고 소문자 복사본을 만들어 TMap을 두 번 찾는다
+	 */
+	class FLegacyNameTable
+	{
+	public:
+		TPair<int32, int32> FindOrAddName(const FString& Str)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			return FindOrAddNameLocked(Str);
+		}
+
+		FString GetUniqueNameString(const FString& BaseStr)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			const TPair<int32, int32> Indices = FindOrAddNameLocked(BaseStr);
+			const int32 Number = NextNumberMap[BaseStr];
+			NextNumberMap[BaseStr]++;
+			return DisplayStringPool[Indices.second] + "_" + to_string(Number);
+		}
+
+	private:
+		TPair<int32, int32> FindOrAddNameLocked(const FString& Str)
+		{
+			FString LowerStr = Str;
+			std::ranges::transform(LowerStr, LowerStr.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+			int32 ComparisonIndex;
+			if (int32* Found = ComparisonMap.Find(LowerStr))
+			{
+				ComparisonIndex = *Found;
+			}
+			else
+			{
+				ComparisonIndex = ComparisonStringPool.Num();
+				ComparisonStringPool.Add(LowerStr);
+				ComparisonMap[LowerStr] = ComparisonIndex;
+			}
+
+			int32 DisplayIndex;
+			if (int32* Found = DisplayMap.Find(Str))
+			{
+				DisplayIndex = *Found;
+			}
+			else
+			{
+				DisplayIndex = DisplayStringPool.Num();
+				DisplayStringPool.Add(Str);
+				DisplayMap[Str] = DisplayIndex;
+			}
+			return { ComparisonIndex, DisplayIndex };
+		}
+
+		std::mutex Mutex;
+		TArray<FString> ComparisonStringPool;
+		TArray<FString> DisplayStringPool;
+		TMap<FString, int32> ComparisonMap;
+		TMap<FString, int32> DisplayMap;
+		TMap<FString, int32> NextNumberMap;
+	};
+
+	// Overlap 상태처럼 두 컴포넌트의 약한 참조 쌍을 키로 쓰는 테이블 흉내
+	using FWeakComponentPair = TPair<TWeakObjectPtr<UPrimitiveComponent>, TWeakObjectPtr<UPrimitiveComponent>>;
+
+	struct FWeakComponentPairHasher
+	{
+		size_t operator()(const FWeakComponentPair& InPair) const noexcept
+		{
+			const size_t HashA = std::hash<FObjectHandle>{}(InPair.first.GetHandle());
+			const size_t HashB = std::hash<FObjectHandle>{}(InPair.second.GetHandle());
+			return HashA ^ (HashB + 0x9E3779B9 + (HashA << 6) + (HashA >> 2));
+		}
+	};
+
+	struct FHashTableTimings
+	{
+		double InsertMs = 0.0;
+		double FindMs = 0.0;
+		double EraseMs = 0.0;
+		double IterateMs = 0.0;
+		int64 Checksum = 0;
+	};
+
+	/**
+	 * @brief 넣기 / 조회(절반은 없는 키) / 전체 순회 / 절반 제거를 라운드마다 반복해 시간을 잰다
+	 * @param InKeys 앞 절반은 넣을 키, 뒤 절반은 없는 키
+	 * @param InLookups 조회 순서 (InKeys를 섞은 것)
+	 */
+	template <typename ContainerType, typename KeyType>
+	FHashTableTimings MeasureHashTable(const TArray<KeyType>& InKeys, const TArray<KeyType>& InLookups)
+	{
+		constexpr bool bIsMap = requires(ContainerType& Container, const KeyType& Key) { Container.Add(Key, 0); };
+		const int32 InsertCount = InKeys.Num() / 2;
+
+		FHashTableTimings Timings;
+		for (int32 Round = 0; Round < HASHMAP_ROUND_COUNT; ++Round)
+		{
+			ContainerType Container;
+
+			FScopeCycleCounter InsertCounter;
+			for (int32 Index = 0; Index < InsertCount; ++Index)
+			{
+				if constexpr (bIsMap)
+				{
+					Container.Add(InKeys[Index], Index);
+				}
+				else
+				{
+					Container.Add(InKeys[Index]);
+				}
+			}
+			Timings.InsertMs += InsertCounter.Finish();
+
+			FScopeCycleCounter FindCounter;
+			for (const KeyType& Key : InLookups)
+			{
+				if constexpr (bIsMap)
+				{
+					const int32* Value = Container.Find(Key);
+					Timings.Checksum += Value ? *Value : -1;
+				}
+				else
+				{
+					Timings.Checksum += Container.Contains(Key) ? 1 : -1;
+				}
+			}
+			Timings.FindMs += FindCounter.Finish();
+
+			FScopeCycleCounter IterateCounter;
+			for (int32 Pass = 0; Pass < HASHMAP_ITERATE_COUNT; ++Pass)
+			{
+				for (const auto& Element : Container)
+				{
+					if constexpr (bIsMap)
+					{
+						Timings.Checksum += Element.second;
+					}
+					else
+					{
+						Timings.Checksum += 1;
+					}
+				}
+			}
+			Timings.IterateMs += IterateCounter.Finish();
+
+			FScopeCycleCounter EraseCounter;
+			for (int32 Index = 0; Index < InsertCount; Index += 2)
+			{
+				Timings.Checksum += Container.Remove(InKeys[Index]);
+			}
+			Timings.EraseMs += EraseCounter.Finish();
+			Timings.Checksum += Container.Num();
+		}
+		return Timings;
+	}
+
+	/**
+	 * @brief 같은 키로 노드 기반 테이블과 플랫 테이블을 재고 한 줄로 출력한다
+	 * @return 두 테이블의 결과가 같은지 여부
+	 */
+	template <typename NodeTableType, typename FlatTableType, typename KeyType>
+	bool CompareHashTables(const char* InLabel, const TArray<KeyType>& InKeys, std::mt19937& InRandom)
+	{
+		TArray<KeyType> Lookups = InKeys;
+		std::shuffle(Lookups.begin(), Lookups.end(), InRandom);
+
+		const FHashTableTimings Node = MeasureHashTable<NodeTableType>(InKeys, Lookups);
+		const FHashTableTimings Flat = MeasureHashTable<FlatTableType>(InKeys, Lookups);
+
+		auto PerOperationNs = [](double InMs, int32 InCount)
+		{
+			return InMs * 1000000.0 / (static_cast<double>(InCount) * HASHMAP_ROUND_COUNT);
+		};
+		const int32 InsertCount = InKeys.Num() / 2;
+		UE_LOG_INFO("  %-28s insert %5.1f -> %5.1f | find %5.1f -> %5.1f | erase %5.1f -> %5.1f | iterate %5.2f -> %5.2f ns/op",
+			InLabel,
+			PerOperationNs(Node.InsertMs, InsertCount), PerOperationNs(Flat.InsertMs, InsertCount),
+			PerOperationNs(Node.FindMs, Lookups.Num()), PerOperationNs(Flat.FindMs, Lookups.Num()),
+			PerOperationNs(Node.EraseMs, InsertCount / 2), PerOperationNs(Flat.EraseMs, InsertCount / 2),
+			PerOperationNs(Node.IterateMs, InsertCount * HASHMAP_ITERATE_COUNT), PerOperationNs(Flat.IterateMs, InsertCount * HASHMAP_ITERATE_COUNT));
+
+		if (Node.Checksum != Flat.Checksum)
+		{
+			UE_LOG_ERROR("  %s: checksum mismatch (%lld vs %lld)", InLabel, static_cast<long long>(Node.Checksum), static_cast<long long>(Flat.Checksum));
+			return false;
+		}
+		return true;
+	}
+
+	// 풀을 쓰는 경로(NewObject와 같은 new (Class))와 힙 경로(클래스 풀 없이 new)
+	template <typename T>
+	UObject* SpawnChurnObject(bool bInPooled)
+	{
+		return bInPooled ? static_cast<UObject*>(new (T::StaticClass()) T()) : static_cast<UObject*>(new T());
+	}
+
+	using FChurnSpawnFunction = UObject* (*)(bool);
+
+	// 적/투사체 스폰처럼 충돌체와 씬 컴포넌트가 섞인 객체 묶음
+	const FChurnSpawnFunction ChurnSpawnFunctions[] =
+	{
+		&SpawnChurnObject<USceneComponent>,
+		&SpawnChurnObject<USphereComponent>,
+		&SpawnChurnObject<UBoxComponent>,
+		&SpawnChurnObject<UObject>,
+	};
+
+	// 구간 번호를 쓰기 전의 IsChildOf: 부모를 따라 올라가며 이름을 비교
+	bool IsChildOfByWalk(const UClass* InClass, const UClass* InSuperClass)
+	{
+		for (const UClass* Class = InClass; Class; Class = Class->GetSuperClass())
+		{
+			if (Class->GetName() == InSuperClass->GetName())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief 같은 객체 배열에 부모 따라가기 판정과 Cast<T>를 돌려 시간을 출력한다
+	 * @return 두 방식의 성공 횟수가 같은지 여부
+	 */
+	template <typename T>
+	bool MeasureCast(const char* InLabel, const TArray<UObject*>& InObjects)
+	{
+		UClass* TargetClass = T::StaticClass();
+
+		int64 WalkHitCount = 0;
+		FScopeCycleCounter WalkCounter;
+		for (int32 Round = 0; Round < CAST_ROUND_COUNT; ++Round)
+		{
+			for (UObject* Object : InObjects)
+			{
+				WalkHitCount += IsChildOfByWalk(Object->GetClass(), TargetClass) ? 1 : 0;
+			}
+		}
+		const double WalkMs = WalkCounter.Finish();
+
+		int64 CastHitCount = 0;
+		FScopeCycleCounter CastCounter;
+		for (int32 Round = 0; Round < CAST_ROUND_COUNT; ++Round)
+		{
+			for (UObject* Object : InObjects)
+			{
+				CastHitCount += Cast<T>(Object) ? 1 : 0;
+			}
+		}
+		const double CastMs = CastCounter.Finish();
+
+		const double CastCount = static_cast<double>(InObjects.Num()) * CAST_ROUND_COUNT;
+		UE_LOG_INFO("  %-22s walk %5.2f -> range %5.2f ns/cast (%.1f%% hit)",
+			InLabel, WalkMs * 1000000.0 / CastCount, CastMs * 1000000.0 / CastCount, 100.0 * static_cast<double>(CastHitCount) / CastCount);
+
+		if (WalkHitCount != CastHitCount)
+		{
+			UE_LOG_ERROR("  %s: hit count mismatch (%lld vs %lld)", InLabel, static_cast<long long>(WalkHitCount), static_cast<long long>(CastHitCount));
+			return false;
+		}
+		return true;
+	}
+}
+
+bool FEngineBenchmark::Run(const FString& InName)
+{
+	if (InName == "bvh")
+	{
+		RunBVHBuild();
+		return true;
+	}
+	if (InName == "raycast")
+	{
+		RunBVHRaycast();
+		return true;
+	}
+	if (InName == "overlap")
+	{
+		RunOverlapNarrowphase();
+		return true;
+	}
+	if (InName == "skinning")
+	{
+		RunSkinning();
+		return true;
+	}
+	if (InName == "dualquat")
+	{
+		RunDualQuatSkinning();
+		return true;
+	}
+	if (InName == "anim")
+	{
+		RunAnimSampling();
+		return true;
+	}
+	if (InName == "cook")
+	{
+		RunCookedMeshLoad();
+		return true;
+	}
+	if (InName == "obj")
+	{
+		RunObjParse();
+		return true;
+	}
+	if (InName == "meshopt")
+	{
+		RunMeshOptimize();
+		return true;
+	}
+	if (InName == "lod")
+	{
+		RunStaticMeshLOD();
+		return true;
+	}
+	if (InName == "vertex")
+	{
+		RunVertexQuantize();
+		return true;
+	}
+	if (InName == "occlusion")
+	{
+		RunOcclusionCulling();
+		return true;
+	}
+	if (InName == "frustum")
+	{
+		RunFrustumCulling();
+		return true;
+	}
+	if (InName == "multiview")
+	{
+		RunMultiViewCulling();
+		return true;
+	}
+	if (InName == "drawlist")
+	{
+		RunDrawList();
+		return true;
+	}
+	if (InName == "name")
+	{
+		RunNameTable();
+		return true;
+	}
+	if (InName == "alloc")
+	{
+		RunFrameAllocation();
+		return true;
+	}
+	if (InName == "hashmap")
+	{
+		RunHashTable();
+		return true;
+	}
+	if (InName == "objpool")
+	{
+		RunObjectPool();
+		return true;
+	}
+	if (InName == "cast")
+	{
+		RunCast();
+		return true;
+	}
+
+	return false;
+}
+
+void FEngineBenchmark::PrintAvailable()
+{
+	UE_LOG_INFO("Available benchmarks:");
+	UE_LOG_INFO("  bvh - Static mesh BVH build time and cost (incremental vs binned SAH)");
+	UE_LOG_INFO("  raycast - Static mesh BVH ray queries (all candidates vs closest-hit vs 4-ray packet)");
+	UE_LOG_INFO("  overlap - Overlap narrow phase single-threaded vs multi-threaded (with result order check)");
+	UE_LOG_INFO("  skinning - Skeletal mesh CPU skinning (scalar per-influence vs SIMD blended matrix, 1 thread vs all threads)");
+	UE_LOG_INFO("  dualquat - Linear blend vs dual quaternion skinning on a twisted DefaultSkeletalMesh pose (time per influence, volume)");
+	UE_LOG_INFO("  anim - Compressed animation sampling for many instances (time per bone, 1 thread vs all threads, compression ratio)");
+	UE_LOG_INFO("  cook - Static mesh startup cost: source import (cold) vs objbin/fbxbin vs memory-mapped cooked mesh (warm)");
+	UE_LOG_INFO("  obj - OBJ/MTL parse throughput in MB/s (1 thread vs parallel chunks, results compared)");
+	UE_LOG_INFO("  meshopt - Static mesh vertex cache/overdraw/vertex fetch optimization (ACMR, ATVR, overfetch before vs after)");
+	UE_LOG_INFO("  lod - Static mesh LOD chain generation (triangle reduction, quadric vs sampled error, screen size, open edges)");
+	UE_LOG_INFO("  vertex - Static mesh vertex quantization (encode/decode time, position/normal/tangent/UV/color error, bytes per vertex)");
+	UE_LOG_INFO("  occlusion - Masked software occlusion culling on fixed camera paths through the level (1 thread vs binned parallel, conservativeness check)");
+	UE_LOG_INFO("  frustum   - Scalar tree walk vs SoA SIMD frustum culling, 4 views one by one vs batched");
+	UE_LOG_INFO("  multiview - Split viewport cameras + cascades + point light faces: one culler per view vs one shared multi-view pass");
+	UE_LOG_INFO("  drawlist  - Mesh draw list sort keys: radix sort vs std::sort, state changes in submission order vs sorted");
+	UE_LOG_INFO("  name      - Object spawn naming: legacy locked TMap table vs lock-free FName pool, 1 thread vs all threads (uniqueness check)");
+	UE_LOG_INFO("  alloc     - Per-frame temporary arrays: heap TArray vs TFrameArray + TInlineAllocator (heap allocations per frame, time)");
+	UE_LOG_INFO("  hashmap   - TMap/TSet (node based) vs TFlatMap/TFlatSet (open addressing) on FName, UPrimitiveComponent* and weak pointer pair keys");
+	UE_LOG_INFO("  objpool   - UObject spawn/destroy churn: heap new vs per-UClass slab pools (time, heap allocations, live count check)");
+	UE_LOG_INFO("  cast      - Cast<T> over a mixed object population: parent walk vs class tree index range (all class pairs checked)");
+}
+
+void FEngineBenchmark::RunBVHBuild()
+{
+	UE_LOG_SYSTEM("BVH Build Benchmark: Incremental vs Binned SAH");
+
+	// 두 빌더의 합계는 둘 다 빌드한 메시만으로 누적한다
+	double TotalIncrementalMs = 0.0;
+	double TotalSAHMs = 0.0;
+	int32 MeshCount = 0;
+	int32 SkippedMeshCount = 0;
+
+	// 여러 UStaticMesh가 같은 FStaticMesh를 공유할 수 있으므로 한 번씩만 측정
+	TSet<FStaticMesh*> VisitedMeshes;
+	for (TObjectIterator<UStaticMesh> It; It; ++It)
+	{
+		FStaticMesh* StaticMesh = It->GetStaticMeshAsset();
+		if (!StaticMesh || VisitedMeshes.Contains(StaticMesh))
+		{
+			continue;
+		}
+		VisitedMeshes.Add(StaticMesh);
+
+		const int32 TriangleCount = StaticMesh->Indices.Num() / 3;
+		if (TriangleCount == 0)
+		{
+			continue;
+		}
+
+		FBVH SAHTree;
+		FScopeCycleCounter SAHCounter;
+		SAHTree.Build(StaticMesh);
+		const double SAHMs = SAHCounter.Finish();
+
+		if (TriangleCount <= INCREMENTAL_BVH_MAX_TRIANGLES)
+		{
+			FBVH IncrementalTree;
+			FScopeCycleCounter IncrementalCounter;
+			IncrementalTree.BuildIncremental(StaticMesh);
+			const double IncrementalMs = IncrementalCounter.Finish();
+
+			// 정규화된 SAH 기대 비용 = 트리 품질 지표 (작을수록 Ray 순회 비용이 낮음). leaf 크기가 달라도 같은 기준
+			const float IncrementalCost = IncrementalTree.GetSAHCost();
+			const float SAHCost = SAHTree.GetSAHCost();
+
+			UE_LOG("  %s: %d tris | Incremental %.2f ms (cost %.1f, %d nodes) | SAH %.2f ms (cost %.1f, %d nodes)",
+				StaticMesh->PathFileName.ToString().c_str(), TriangleCount,
+				IncrementalMs, IncrementalCost, IncrementalTree.GetNodeCount(),
+				SAHMs, SAHCost, SAHTree.GetFlatNodes().Num());
+
+			TotalIncrementalMs += IncrementalMs;
+			TotalSAHMs += SAHMs;
+			++MeshCount;
+		}
+		else
+		{
+			UE_LOG("  %s: %d tris | Incremental skipped | SAH %.2f ms (cost %.1f, %d nodes)",
+				StaticMesh->PathFileName.ToString().c_str(), TriangleCount,
+				SAHMs, SAHTree.GetSAHCost(), SAHTree.GetFlatNodes().Num());
+			++SkippedMeshCount;
+		}
+	}
+
+	UE_LOG_SUCCESS("BVH Build Benchmark: %d meshes, Incremental total %.2f ms, SAH total %.2f ms (%d larger meshes SAH only, not in totals)",
+		MeshCount, TotalIncrementalMs, TotalSAHMs, SkippedMeshCount);
+}
+
+void FEngineBenchmark::RunBVHRaycast()
+{
+	UE_LOG_SYSTEM("BVH Raycast Benchmark: All Candidates vs Closest-Hit vs Packet");
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+	TSet<FStaticMesh*> VisitedMeshes;
+	for (TObjectIterator<UStaticMesh> It; It; ++It)
+	{
+		FStaticMesh* StaticMesh = It->GetStaticMeshAsset();
+		if (!StaticMesh || VisitedMeshes.Contains(StaticMesh) || StaticMesh->Indices.Num() < 3)
+		{
+			continue;
+		}
+		VisitedMeshes.Add(StaticMesh);
+
+		FBVH Tree;
+		Tree.Build(StaticMesh);
+		if (!Tree.IsFlattened())
+		{
+			continue;
+		}
+
+		// 메시 바운드 바깥의 한 점에서 바운드 내부 영역을 향하는, 픽셀 격자처럼 촘촘한 Ray 묶음 생성
+		const FFlatBVHNode& Root = Tree.GetFlatNodes()[0];
+		const FVector Center = (Root.BoundsMin + Root.BoundsMax) * 0.5f;
+		const FVector Extent = Root.BoundsMax - Root.BoundsMin;
+		const float Radius = std::max(Extent.Length(), 0.001f);
+
+		TArray<FRay> Rays;
+		Rays.Reserve(RAYCAST_GRID_COUNT * RAYCAST_GRID_SIZE * RAYCAST_GRID_SIZE);
+		for (int32 Grid = 0; Grid < RAYCAST_GRID_COUNT; ++Grid)
+		{
+			FVector Eye(Unit(Random) - 0.5f, Unit(Random) - 0.5f, Unit(Random) - 0.5f);
+			Eye.Normalize();
+			Eye = Center + Eye * (Radius * 2.0f);
+			const FVector Target = Root.BoundsMin + FVector(Extent.X * Unit(Random), Extent.Y * Unit(Random), Extent.Z * Unit(Random));
+			const float PixelSpread = Radius * 0.002f;
+
+			for (int32 Y = 0; Y < RAYCAST_GRID_SIZE; ++Y)
+			{
+				for (int32 X = 0; X < RAYCAST_GRID_SIZE; ++X)
+				{
+					FVector Direction = Target + FVector(X * PixelSpread, Y * PixelSpread, 0.0f) - Eye;
+					Direction.Normalize();
+
+					FRay Ray;
+					Ray.Origin = FVector4(Eye.X, Eye.Y, Eye.Z, 1.0f);
+					Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+					Rays.Add(Ray);
+				}
+			}
+		}
+
+		int64 CandidateCount = 0;
+		TArray<int32> Candidates;
+		FScopeCycleCounter TraverseCounter;
+		for (const FRay& Ray : Rays)
+		{
+			Tree.TraverseRay(Ray, Candidates);
+			CandidateCount += Candidates.Num();
+		}
+		const double TraverseMs = TraverseCounter.Finish();
+
+		TArray<FBVHRayHit> ClosestHits;
+		ClosestHits.SetNum(Rays.Num());
+		FScopeCycleCounter ClosestCounter;
+		for (int32 i = 0; i < Rays.Num(); ++i)
+		{
+			Tree.RaycastClosest(Rays[i], ClosestHits[i]);
+		}
+		const double ClosestMs = ClosestCounter.Finish();
+
+		TArray<FBVHRayHit> PacketHits;
+		PacketHits.SetNum(Rays.Num());
+		FScopeCycleCounter PacketCounter;
+		Tree.RaycastClosestPacket(Rays.GetData(), Rays.Num(), PacketHits.GetData());
+		const double PacketMs = PacketCounter.Finish();
+
+		int32 HitCount = 0;
+		int32 MismatchCount = 0;
+		for (int32 i = 0; i < Rays.Num(); ++i)
+		{
+			HitCount += ClosestHits[i].IsHit() ? 1 : 0;
+			MismatchCount += ClosestHits[i].TriangleIndex != PacketHits[i].TriangleIndex ? 1 : 0;
+		}
+
+		UE_LOG("  %s: %d rays, %d hits | All candidates %.2f ms (%.1f tris/ray) | Closest %.2f ms | Packet %.2f ms | mismatch %d",
+			StaticMesh->PathFileName.ToString().c_str(), Rays.Num(), HitCount,
+			TraverseMs, static_cast<double>(CandidateCount) / Rays.Num(), ClosestMs, PacketMs, MismatchCount);
+	}
+
+	UE_LOG_SUCCESS("BVH Raycast Benchmark: %d meshes", VisitedMeshes.Num());
+}
+
+void FEngineBenchmark::RunOverlapNarrowphase()
+{
+	const int32 WorkerCount = FTaskScheduler::GetInstance().GetThreadCount();
+	UE_LOG_SYSTEM("Overlap Narrowphase Benchmark: 1 thread vs %d threads", WorkerCount);
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+	auto RandomPoint = [&]()
+	{
+		return FVector(Unit(Random), Unit(Random), Unit(Random)) * OVERLAP_SCENE_EXTENT;
+	};
+	auto RandomRotation = [&]()
+	{
+		return FQuaternion::FromEuler(FVector(Unit(Random), Unit(Random), Unit(Random)) * 360.0f);
+	};
+
+	// Sphere, Box, Capsule을 섞어 모든 shape 조합이 검사되도록 함
+	TArray<FBoundingSphere> Spheres;
+	TArray<FOBB> Boxes;
+	TArray<FCapsule> Capsules;
+	Spheres.Reserve(OVERLAP_SHAPE_COUNT);
+	Boxes.Reserve(OVERLAP_SHAPE_COUNT);
+	Capsules.Reserve(OVERLAP_SHAPE_COUNT);
+
+	TArray<const IBoundingVolume*> Shapes;
+	Shapes.Reserve(OVERLAP_SHAPE_COUNT);
+	for (int32 i = 0; i < OVERLAP_SHAPE_COUNT; ++i)
+	{
+		switch (i % 3)
+		{
+		case 0:
+			Spheres.Add(FBoundingSphere(RandomPoint(), 0.2f + Unit(Random) * 0.5f));
+			Shapes.Add(&Spheres.Last());
+			break;
+		case 1:
+			Boxes.Add(FOBB(RandomPoint(), FVector(0.2f, 0.2f, 0.2f) + FVector(Unit(Random), Unit(Random), Unit(Random)) * 0.5f,
+				RandomRotation().ToRotationMatrix()));
+			Shapes.Add(&Boxes.Last());
+			break;
+		default:
+			Capsules.Add(FCapsule(RandomPoint(), RandomRotation(), 0.1f + Unit(Random) * 0.3f, 0.2f + Unit(Random) * 0.5f));
+			Shapes.Add(&Capsules.Last());
+			break;
+		}
+	}
+
+	TArray<FOverlapTestTask> Tasks;
+	Tasks.Reserve(OVERLAP_TASK_COUNT);
+	std::uniform_int_distribution<int32> ShapeIndex(0, OVERLAP_SHAPE_COUNT - 1);
+	for (int32 i = 0; i < OVERLAP_TASK_COUNT; ++i)
+	{
+		Tasks.Add({ Shapes[ShapeIndex(Random)], Shapes[ShapeIndex(Random)], i, Unit(Random) < 0.5f });
+	}
+
+	// 같은 입력을 단일 스레드와 다중 스레드로 반복 실행하고, 매번 결과 순서를 단일 스레드 결과와 비교
+	TArray<FOverlapTestResult> SingleResults;
+	TArray<FOverlapTestResult> ParallelResults;
+	double SingleMs = 0.0;
+	double ParallelMs = 0.0;
+	int32 MismatchCount = 0;
+	for (int32 Iteration = 0; Iteration < OVERLAP_ITERATION_COUNT; ++Iteration)
+	{
+		FScopeCycleCounter SingleCounter;
+		FOverlapNarrowphase::Run(Tasks, false, SingleResults);
+		SingleMs += SingleCounter.Finish();
+
+		FScopeCycleCounter ParallelCounter;
+		FOverlapNarrowphase::Run(Tasks, true, ParallelResults);
+		ParallelMs += ParallelCounter.Finish();
+
+		bool bMatch = SingleResults.Num() == ParallelResults.Num();
+		for (int32 i = 0; bMatch && i < SingleResults.Num(); ++i)
+		{
+			bMatch = SingleResults[i].TaskIndex == ParallelResults[i].TaskIndex
+				&& SingleResults[i].bIsOverlapping == ParallelResults[i].bIsOverlapping;
+		}
+		MismatchCount += bMatch ? 0 : 1;
+	}
+
+	UE_LOG("  %d pairs, %d state changes | 1 thread %.3f ms | %d threads %.3f ms (x%.2f)",
+		Tasks.Num(), SingleResults.Num(),
+		SingleMs / OVERLAP_ITERATION_COUNT, WorkerCount, ParallelMs / OVERLAP_ITERATION_COUNT,
+		ParallelMs > 0.0 ? SingleMs / ParallelMs : 0.0);
+
+	if (MismatchCount == 0)
+	{
+		UE_LOG_SUCCESS("Overlap Narrowphase Benchmark: event order identical in %d/%d runs", OVERLAP_ITERATION_COUNT, OVERLAP_ITERATION_COUNT);
+	}
+	else
+	{
+		UE_LOG_ERROR("Overlap Narrowphase Benchmark: event order differs in %d/%d runs", MismatchCount, OVERLAP_ITERATION_COUNT);
+	}
+}
+
+void FEngineBenchmark::RunSkinning()
+{
+	const int32 WorkerCount = FTaskScheduler::GetInstance().GetThreadCount();
+	UE_LOG_SYSTEM("Skinning Benchmark: Scalar vs SIMD (1 thread / %d threads)", WorkerCount);
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Angle(-SKINNING_POSE_MAX_DEGREES, SKINNING_POSE_MAX_DEGREES);
+
+	double TotalScalarMs = 0.0;
+	double TotalSimdMs = 0.0;
+	double TotalParallelMs = 0.0;
+	int32 MeshCount = 0;
+
+	for (TObjectIterator<USkeletalMesh> It; It; ++It)
+	{
+		USkeletalMesh* SkeletalMesh = *It;
+		FSkeletalMeshRenderData* RenderData = SkeletalMesh ? SkeletalMesh->GetSkeletalMeshRenderData() : nullptr;
+		if (!RenderData || RenderData->SkinWeightStream.IsEmpty() || !SkeletalMesh->GetStaticMesh())
+		{
+			continue;
+		}
+
+		// 1. 무작위 포즈로 스키닝 행렬 계산 (USkeletalMeshComponent::RefreshBoneTransformsCustom과 동일)
+		const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+		const int32 NumBones = RefSkeleton.GetRawBoneNum();
+
+		TArray<FTransform> BoneSpaceTransforms = RefSkeleton.GetRawRefBonePose();
+		for (FTransform& BoneTransform : BoneSpaceTransforms)
+		{
+			BoneTransform.Rotation = FQuaternion::FromEuler(FVector(Angle(Random), Angle(Random), Angle(Random))) * BoneTransform.Rotation;
+		}
+
+		TArray<FBoneIndexType> RequiredBones(NumBones);
+		std::iota(RequiredBones.begin(), RequiredBones.end(), 0);
+		TArray<FTransform> ComponentSpaceTransforms;
+		ComponentSpaceTransforms.SetNum(NumBones);
+		SkeletalMesh->FillComponentSpaceTransforms(BoneSpaceTransforms, RequiredBones, ComponentSpaceTransforms);
+
+		const TArray<FMatrix>& InvBindMatrices = SkeletalMesh->GetRefBasesInvMatrix();
+		TArray<FMatrix> SkinningMatrices;
+		TArray<FMatrix> InvTransSkinningMatrices;
+		SkinningMatrices.SetNum(NumBones);
+		InvTransSkinningMatrices.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			SkinningMatrices[BoneIndex] = InvBindMatrices[BoneIndex] * ComponentSpaceTransforms[BoneIndex].ToMatrixWithScale();
+			InvTransSkinningMatrices[BoneIndex] = SkinningMatrices[BoneIndex].Inverse().Transpose();
+		}
+
+		// 2. 같은 포즈를 세 경로로 반복 스키닝 (팔레트 변환 비용은 SIMD 경로에 포함)
+		const TArray<FNormalVertex>& SourceVertices = SkeletalMesh->GetVertices();
+		TArray<FNormalVertex> ScalarVertices;
+		TArray<FNormalVertex> SimdVertices;
+		ScalarVertices.SetNum(SourceVertices.Num());
+		SimdVertices.SetNum(SourceVertices.Num());
+		TArray<FSkinMatrix3x4> Palette;
+
+		double ScalarMs = 0.0;
+		double SimdMs = 0.0;
+		double ParallelMs = 0.0;
+		for (int32 Iteration = 0; Iteration < SKINNING_ITERATION_COUNT; ++Iteration)
+		{
+			FScopeCycleCounter ScalarCounter;
+			FCpuSkinning::SkinVerticesReference(RenderData->SkinWeightVertices, SkinningMatrices, InvTransSkinningMatrices, SourceVertices, ScalarVertices);
+			ScalarMs += ScalarCounter.Finish();
+
+			FScopeCycleCounter SimdCounter;
+			FCpuSkinning::BuildMatrixPalette(SkinningMatrices, Palette);
+			FCpuSkinning::SkinVertices(RenderData->SkinWeightStream, Palette, SourceVertices, SimdVertices, false);
+			SimdMs += SimdCounter.Finish();
+
+			FScopeCycleCounter ParallelCounter;
+			FCpuSkinning::BuildMatrixPalette(SkinningMatrices, Palette);
+			FCpuSkinning::SkinVertices(RenderData->SkinWeightStream, Palette, SourceVertices, SimdVertices, true);
+			ParallelMs += ParallelCounter.Finish();
+		}
+
+		// 3. 결과 비교: 가중치 압축(슬롯 수 제한) 및 행렬 합산 후 노말 변환에 의한 차이
+		float MaxPositionError = 0.0f;
+		float MaxNormalErrorDegrees = 0.0f;
+		for (int32 i = 0; i < SourceVertices.Num(); ++i)
+		{
+			MaxPositionError = std::max(MaxPositionError, (ScalarVertices[i].Position - SimdVertices[i].Position).Length());
+			const float NormalDot = std::clamp(ScalarVertices[i].Normal.Dot(SimdVertices[i].Normal), -1.0f, 1.0f);
+			MaxNormalErrorDegrees = std::max(MaxNormalErrorDegrees, FVector::GetRadianToDegree(std::acos(NormalDot)));
+		}
+
+		UE_LOG("  %s: %d verts, %d bones, %d slots | scalar %.3f ms | SIMD %.3f ms (x%.2f) | %d threads %.3f ms (x%.2f) | max error pos %.5f, normal %.3f deg",
+			SkeletalMesh->GetStaticMesh()->GetAssetPathFileName().ToString().c_str(),
+			SourceVertices.Num(), NumBones, RenderData->SkinWeightStream.MaxInfluences,
+			ScalarMs / SKINNING_ITERATION_COUNT,
+			SimdMs / SKINNING_ITERATION_COUNT, SimdMs > 0.0 ? ScalarMs / SimdMs : 0.0,
+			WorkerCount, ParallelMs / SKINNING_ITERATION_COUNT, ParallelMs > 0.0 ? ScalarMs / ParallelMs : 0.0,
+			MaxPositionError, MaxNormalErrorDegrees);
+
+		TotalScalarMs += ScalarMs / SKINNING_ITERATION_COUNT;
+		TotalSimdMs += SimdMs / SKINNING_ITERATION_COUNT;
+		TotalParallelMs += ParallelMs / SKINNING_ITERATION_COUNT;
+		++MeshCount;
+	}
+
+	if (MeshCount == 0)
+	{
+		UE_LOG_ERROR("Skinning Benchmark: 로드된 스켈레탈 메시가 없습니다.");
+		return;
+	}
+
+	UE_LOG_SUCCESS("Skinning Benchmark: %d meshes | scalar %.3f ms | SIMD %.3f ms | %d threads %.3f ms",
+		MeshCount, TotalScalarMs, TotalSimdMs, WorkerCount, TotalParallelMs);
+}
+
+void FEngineBenchmark::RunDualQuatSkinning()
+{
+	UE_LOG_SYSTEM("Dual Quaternion Skinning Benchmark: %s", DUAL_QUAT_MESH_PATH);
+
+	USkeletalMesh* SkeletalMesh = FFbxManager::LoadFbxSkeletalMesh(DUAL_QUAT_MESH_PATH);
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh ? SkeletalMesh->GetSkeletalMeshRenderData() : nullptr;
+	if (!RenderData || RenderData->SkinWeightStream.IsEmpty())
+	{
+		UE_LOG_ERROR("Dual Quaternion Skinning Benchmark: 스켈레탈 메시를 불러오지 못했습니다.");
+		return;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+	const int32 NumBones = RefSkeleton.GetRawBoneNum();
+	const TArray<FNormalVertex>& SourceVertices = SkeletalMesh->GetVertices();
+	const TArray<uint32>& Indices = SkeletalMesh->GetIndices();
+	const FSkinWeightStream& WeightStream = RenderData->SkinWeightStream;
+
+	int32 NumInfluences = 0;
+	for (float Weight : WeightStream.Weights)
+	{
+		NumInfluences += Weight > 0.0f ? 1 : 0;
+	}
+
+	// 본 로컬 포즈 -> 스키닝 행렬 (USkeletalMeshComponent::RefreshBoneTransformsCustom과 동일)
+	TArray<FBoneIndexType> RequiredBones(NumBones);
+	std::iota(RequiredBones.begin(), RequiredBones.end(), 0);
+	auto BuildSkinningMatrices = [&](const TArray<FTransform>& BoneSpaceTransforms, TArray<FMatrix>& OutSkinningMatrices)
+	{
+		TArray<FTransform> ComponentSpaceTransforms;
+		ComponentSpaceTransforms.SetNum(NumBones);
+		SkeletalMesh->FillComponentSpaceTransforms(BoneSpaceTransforms, RequiredBones, ComponentSpaceTransforms);
+
+		const TArray<FMatrix>& InvBindMatrices = SkeletalMesh->GetRefBasesInvMatrix();
+		OutSkinningMatrices.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			OutSkinningMatrices[BoneIndex] = InvBindMatrices[BoneIndex] * ComponentSpaceTransforms[BoneIndex].ToMatrixWithScale();
+		}
+	};
+
+	TArray<FNormalVertex> LinearVertices;
+	TArray<FNormalVertex> DualQuatVertices;
+	LinearVertices.SetNum(SourceVertices.Num());
+	DualQuatVertices.SetNum(SourceVertices.Num());
+	TArray<FSkinMatrix3x4> MatrixPalette;
+	TArray<FSkinDualQuat> DualQuatPalette;
+
+	// 1. 레퍼런스 포즈: 두 방식 모두 원본 정점을 그대로 재현해야 한다
+	TArray<FMatrix> SkinningMatrices;
+	BuildSkinningMatrices(RefSkeleton.GetRawRefBonePose(), SkinningMatrices);
+	FCpuSkinning::BuildMatrixPalette(SkinningMatrices, MatrixPalette);
+	FCpuSkinning::BuildDualQuatPalette(SkinningMatrices, DualQuatPalette);
+	FCpuSkinning::SkinVertices(WeightStream, MatrixPalette, SourceVertices, LinearVertices, false);
+	FCpuSkinning::SkinVerticesDualQuat(WeightStream, DualQuatPalette, SourceVertices, DualQuatVertices, false);
+
+	float MaxRestLinearError = 0.0f;
+	float MaxRestDualQuatError = 0.0f;
+	for (int32 i = 0; i < SourceVertices.Num(); ++i)
+	{
+		MaxRestLinearError = std::max(MaxRestLinearError, (LinearVertices[i].Position - SourceVertices[i].Position).Length());
+		MaxRestDualQuatError = std::max(MaxRestDualQuatError, (DualQuatVertices[i].Position - SourceVertices[i].Position).Length());
+	}
+
+	// 2. 비튼 포즈에서 시간 측정 (팔레트 변환 포함, 단일 스레드)
+	TArray<FTransform> TwistedPose = RefSkeleton.GetRawRefBonePose();
+	const FQuaternion Twist = FQuaternion::FromEuler(FVector(DUAL_QUAT_TWIST_DEGREES, 0.0f, 0.0f));
+	for (FTransform& BoneTransform : TwistedPose)
+	{
+		BoneTransform.Rotation = Twist * BoneTransform.Rotation;
+	}
+	BuildSkinningMatrices(TwistedPose, SkinningMatrices);
+
+	double LinearMs = 0.0;
+	double DualQuatMs = 0.0;
+	for (int32 Iteration = 0; Iteration < SKINNING_ITERATION_COUNT; ++Iteration)
+	{
+		FScopeCycleCounter LinearCounter;
+		FCpuSkinning::BuildMatrixPalette(SkinningMatrices, MatrixPalette);
+		FCpuSkinning::SkinVertices(WeightStream, MatrixPalette, SourceVertices, LinearVertices, false);
+		LinearMs += LinearCounter.Finish();
+
+		FScopeCycleCounter DualQuatCounter;
+		FCpuSkinning::BuildDualQuatPalette(SkinningMatrices, DualQuatPalette);
+		FCpuSkinning::SkinVerticesDualQuat(WeightStream, DualQuatPalette, SourceVertices, DualQuatVertices, false);
+		DualQuatMs += DualQuatCounter.Finish();
+	}
+	LinearMs /= SKINNING_ITERATION_COUNT;
+	DualQuatMs /= SKINNING_ITERATION_COUNT;
+
+	// 3. 수치 비교: 두 방식의 정점 차이와 메시 부피 변화 (LBS는 비틀림에서 부피가 줄어든다)
+	double SumDifference = 0.0;
+	float MaxDifference = 0.0f;
+	for (int32 i = 0; i < SourceVertices.Num(); ++i)
+	{
+		const float Difference = (LinearVertices[i].Position - DualQuatVertices[i].Position).Length();
+		SumDifference += Difference;
+		MaxDifference = std::max(MaxDifference, Difference);
+	}
+
+	const double RestVolume = ComputeSignedVolume(SourceVertices, Indices);
+	const double LinearVolume = ComputeSignedVolume(LinearVertices, Indices);
+	const double DualQuatVolume = ComputeSignedVolume(DualQuatVertices, Indices);
+
+	UE_LOG("  %d verts, %d bones, %d influences (%d slots)", SourceVertices.Num(), NumBones, NumInfluences, WeightStream.MaxInfluences);
+	UE_LOG("  rest pose max error | linear %.6f | dual quat %.6f", MaxRestLinearError, MaxRestDualQuatError);
+	UE_LOG("  twist %.0f deg | linear %.3f ms (%.2f ns/influence) | dual quat %.3f ms (%.2f ns/influence)",
+		DUAL_QUAT_TWIST_DEGREES,
+		LinearMs, NumInfluences > 0 ? LinearMs * 1.0e6 / NumInfluences : 0.0,
+		DualQuatMs, NumInfluences > 0 ? DualQuatMs * 1.0e6 / NumInfluences : 0.0);
+	UE_LOG("  linear vs dual quat position | avg %.5f | max %.5f", SourceVertices.Num() > 0 ? SumDifference / SourceVertices.Num() : 0.0, MaxDifference);
+	UE_LOG("  volume / rest volume | linear %.4f | dual quat %.4f",
+		RestVolume != 0.0 ? LinearVolume / RestVolume : 0.0, RestVolume != 0.0 ? DualQuatVolume / RestVolume : 0.0);
+
+	UE_LOG_SUCCESS("Dual Quaternion Skinning Benchmark 완료");
+}
+
+void FEngineBenchmark::RunAnimSampling()
+{
+	TArray<UAnimSequence*> Sequences;
+	for (TObjectIterator<UAnimSequence> It; It; ++It)
+	{
+		if (*It && (*It)->GetNumFrames() > 1)
+		{
+			Sequences.Add(*It);
+		}
+	}
+
+	if (Sequences.IsEmpty())
+	{
+		for (const char* MeshPath : ANIM_SAMPLING_MESH_PATHS)
+		{
+			USkeletalMesh* SkeletalMesh = FFbxManager::LoadFbxSkeletalMesh(MeshPath);
+			if (!SkeletalMesh)
+			{
+				continue;
+			}
+
+			for (UAnimSequence* Sequence : SkeletalMesh->GetAnimSequences())
+			{
+				if (Sequence->GetNumFrames() > 1)
+				{
+					Sequences.Add(Sequence);
+				}
+			}
+		}
+	}
+
+	if (Sequences.IsEmpty())
+	{
+		UE_LOG_ERROR("Animation Sampling Benchmark: 애니메이션 시퀀스가 없습니다.");
+		return;
+	}
+
+	UE_LOG_SYSTEM("Animation Sampling Benchmark: %d sequences, %d instances x %d frames",
+		Sequences.Num(), ANIM_SAMPLING_INSTANCE_COUNT, ANIM_SAMPLING_FRAME_COUNT);
+
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	const int32 WorkerCount = Scheduler.IsRunning() ? Scheduler.GetThreadCount() : 1;
+
+	for (const UAnimSequence* Sequence : Sequences)
+	{
+		const int32 NumBones = Sequence->GetNumBones();
+		const float PlayLength = Sequence->GetPlayLength();
+
+		// 인스턴스마다 포즈 버퍼를 따로 두고 재생 시작 시점을 엇갈리게 해 캐시 재사용을 줄인다
+		TArray<TArray<FTransform>> InstancePoses(ANIM_SAMPLING_INSTANCE_COUNT);
+		TArray<float> StartTimes(ANIM_SAMPLING_INSTANCE_COUNT);
+		for (int32 Instance = 0; Instance < ANIM_SAMPLING_INSTANCE_COUNT; ++Instance)
+		{
+			InstancePoses[Instance].SetNum(NumBones);
+			StartTimes[Instance] = PlayLength * Instance / ANIM_SAMPLING_INSTANCE_COUNT;
+		}
+
+		auto SampleInstances = [&](int32 Frame, int32 Begin, int32 End)
+		{
+			for (int32 Instance = Begin; Instance < End; ++Instance)
+			{
+				Sequence->SamplePose(StartTimes[Instance] + Frame * ANIM_SAMPLING_DELTA_TIME, true, InstancePoses[Instance]);
+			}
+		};
+
+		FScopeCycleCounter SingleCounter;
+		for (int32 Frame = 0; Frame < ANIM_SAMPLING_FRAME_COUNT; ++Frame)
+		{
+			SampleInstances(Frame, 0, ANIM_SAMPLING_INSTANCE_COUNT);
+		}
+		const double SingleMs = SingleCounter.Finish();
+
+		FScopeCycleCounter ParallelCounter;
+		for (int32 Frame = 0; Frame < ANIM_SAMPLING_FRAME_COUNT; ++Frame)
+		{
+			Scheduler.ParallelFor(ANIM_SAMPLING_INSTANCE_COUNT, ANIM_SAMPLING_CHUNK_SIZE, [&](int32 Begin, int32 End)
+			{
+				SampleInstances(Frame, Begin, End);
+			});
+		}
+		const double ParallelMs = ParallelCounter.Finish();
+
+		const double BoneSamples = static_cast<double>(NumBones) * ANIM_SAMPLING_INSTANCE_COUNT * ANIM_SAMPLING_FRAME_COUNT;
+		const size_t RawSize = Sequence->GetRawSize();
+		const size_t CompressedSize = Sequence->GetCompressedSize();
+
+		UE_LOG_INFO("  %s: %d bones, %d frames | 1 thread %.2f ns/bone (%.3f ms/frame) | %d threads %.2f ns/bone (%.3f ms/frame) | %.1f KB -> %.1f KB (%.1fx)",
+			Sequence->GetSequenceName().ToString().c_str(), NumBones, Sequence->GetNumFrames(),
+			SingleMs * 1.0e6 / BoneSamples, SingleMs / ANIM_SAMPLING_FRAME_COUNT,
+			WorkerCount, ParallelMs * 1.0e6 / BoneSamples, ParallelMs / ANIM_SAMPLING_FRAME_COUNT,
+			RawSize / 1024.0, CompressedSize / 1024.0, CompressedSize > 0 ? static_cast<double>(RawSize) / CompressedSize : 0.0);
+	}
+}
+
+void FEngineBenchmark::RunCookedMeshLoad()
+{
+	UE_LOG_SYSTEM("Cooked Static Mesh Benchmark: %s", COOKED_MESH_DATA_DIRECTORY);
+
+	double TotalColdMs = 0.0;
+	double TotalBinaryMs = 0.0;
+	double TotalWarmMs = 0.0;
+	int32 MeshCount = 0;
+
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(COOKED_MESH_DATA_DIRECTORY))
+	{
+		if (!Entry.is_regular_file())
+		{
+			continue;
+		}
+
+		const FName SourcePath(Entry.path().generic_string());
+		const bool bIsObj = Entry.path().extension() == ".obj";
+		// 스켈레탈 FBX는 쿠킹 대상이 아니다. 시작 시 쿠킹된 FBX만 스태틱 메시로 본다
+		const bool bIsStaticFbx = Entry.path().extension() == ".fbx"
+			&& FStaticMeshCooker::IsUpToDate(SourcePath, FFbxManager::GetCookImportFlags(FFbxImporter::Configuration()));
+		if (!bIsObj && !bIsStaticFbx)
+		{
+			continue;
+		}
+
+		// 1. Cold: 원본 파일에서 임포트 (파싱, 정점 병합, 탄젠트, BVH 빌드)
+		// 2. 기존 중간 캐시(objbin/fbxbin)를 거친 임포트 (정점 병합, 탄젠트, BVH 빌드)
+		std::unique_ptr<FStaticMesh> ColdMesh;
+		std::unique_ptr<FStaticMesh> BinaryMesh;
+		double ColdMs = 0.0;
+		double BinaryMs = 0.0;
+		uint32 ImportFlags = 0;
+		if (bIsObj)
+		{
+			FObjImporter::Configuration Config;
+			ImportFlags = FObjManager::GetCookImportFlags(Config);
+
+			FScopeCycleCounter ColdCounter;
+			ColdMesh = FObjManager::BuildObjStaticMeshAsset(SourcePath, Config);
+			ColdMs = ColdCounter.Finish();
+
+			Config.bIsBinaryEnabled = true;
+			FScopeCycleCounter BinaryCounter;
+			BinaryMesh = FObjManager::BuildObjStaticMeshAsset(SourcePath, Config);
+			BinaryMs = BinaryCounter.Finish();
+		}
+		else
+		{
+			FFbxImporter::Configuration Config;
+			ImportFlags = FFbxManager::GetCookImportFlags(Config);
+
+			FScopeCycleCounter ColdCounter;
+			ColdMesh = FFbxManager::BuildFbxStaticMeshAsset(SourcePath, Config);
+			ColdMs = ColdCounter.Finish();
+
+			Config.bIsBinaryEnabled = true;
+			FScopeCycleCounter BinaryCounter;
+			BinaryMesh = FFbxManager::BuildFbxStaticMeshAsset(SourcePath, Config);
+			BinaryMs = BinaryCounter.Finish();
+		}
+
+		if (!ColdMesh || !BinaryMesh || !FStaticMeshCooker::Save(*ColdMesh, ImportFlags))
+		{
+			UE_LOG_WARNING("  %s: 임포트 또는 쿠킹 실패, 건너뜀", SourcePath.ToString().c_str());
+			continue;
+		}
+
+		// 3. Warm: 쿠킹 파일을 매핑해서 로드
+		double WarmMs = 0.0;
+		bool bSameResult = true;
+		for (int32 Iteration = 0; Iteration < COOKED_MESH_WARM_ITERATION_COUNT; ++Iteration)
+		{
+			FStaticMesh CookedMesh;
+			FScopeCycleCounter WarmCounter;
+			const bool bLoaded = FStaticMeshCooker::Load(SourcePath, ImportFlags, &CookedMesh);
+			WarmMs += WarmCounter.Finish();
+			bSameResult = bSameResult && bLoaded && IsSameStaticMesh(*ColdMesh, CookedMesh);
+		}
+		WarmMs /= COOKED_MESH_WARM_ITERATION_COUNT;
+
+		std::error_code ErrorCode;
+		const uintmax_t CookedSize = std::filesystem::file_size(FStaticMeshCooker::GetCookedFilePath(SourcePath), ErrorCode);
+
+		UE_LOG_INFO("  %s: %d verts, %d tris | cold %.2f ms | %s %.2f ms | cooked %.3f ms (%.1fx vs cold, %.1f KB) | %s",
+			SourcePath.ToString().c_str(), ColdMesh->Vertices.Num(), ColdMesh->Indices.Num() / 3,
+			ColdMs, bIsObj ? "objbin" : "fbxbin", BinaryMs,
+			WarmMs, WarmMs > 0.0 ? ColdMs / WarmMs : 0.0, ErrorCode ? 0.0 : CookedSize / 1024.0,
+			bSameResult ? "match" : "MISMATCH");
+
+		TotalColdMs += ColdMs;
+		TotalBinaryMs += BinaryMs;
+		TotalWarmMs += WarmMs;
+		++MeshCount;
+	}
+
+	UE_LOG_SUCCESS("Cooked Static Mesh Benchmark: %d meshes | cold %.2f ms | objbin/fbxbin %.2f ms | cooked %.2f ms (%.1fx vs cold)",
+		MeshCount, TotalColdMs, TotalBinaryMs, TotalWarmMs, TotalWarmMs > 0.0 ? TotalColdMs / TotalWarmMs : 0.0);
+}
+
+void FEngineBenchmark::RunObjParse()
+{
+	UE_LOG_SYSTEM("OBJ Parse Benchmark: %s (%d threads)", COOKED_MESH_DATA_DIRECTORY, FTaskScheduler::GetInstance().GetThreadCount());
+
+	double TotalMegaBytes = 0.0;
+	double TotalSingleMs = 0.0;
+	double TotalParallelMs = 0.0;
+	int32 FileCount = 0;
+
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(COOKED_MESH_DATA_DIRECTORY))
+	{
+		if (!Entry.is_regular_file() || Entry.path().extension() != ".obj")
+		{
+			continue;
+		}
+
+		FObjImporter::Configuration Config;
+		Config.bIsBinaryEnabled = false;
+
+		FObjImporter::Configuration SingleConfig = Config;
+		SingleConfig.bAllowParallelParse = false;
+
+		double SingleMs = 0.0;
+		double ParallelMs = 0.0;
+		bool bLoaded = true;
+		bool bSameResult = true;
+		for (int32 Iteration = 0; Iteration < OBJ_PARSE_ITERATION_COUNT && bLoaded; ++Iteration)
+		{
+			FObjInfo SingleInfo;
+			FScopeCycleCounter SingleCounter;
+			bLoaded = FObjImporter::LoadObj(Entry.path(), &SingleInfo, SingleConfig);
+			SingleMs += SingleCounter.Finish();
+
+			FObjInfo ParallelInfo;
+			FScopeCycleCounter ParallelCounter;
+			bLoaded = FObjImporter::LoadObj(Entry.path(), &ParallelInfo, Config) && bLoaded;
+			ParallelMs += ParallelCounter.Finish();
+
+			// 조각 단위 병렬 파싱 결과는 한 조각으로 읽은 결과와 같아야 한다
+			bSameResult = bSameResult && IsSameObjInfo(SingleInfo, ParallelInfo);
+		}
+
+		if (!bLoaded)
+		{
+			UE_LOG_WARNING("  %s: 파싱 실패, 건너뜀", Entry.path().generic_string().c_str());
+			continue;
+		}
+
+		SingleMs /= OBJ_PARSE_ITERATION_COUNT;
+		ParallelMs /= OBJ_PARSE_ITERATION_COUNT;
+
+		const double MegaBytes = Entry.file_size() / (1024.0 * 1024.0);
+		auto ToMegaBytesPerSecond = [MegaBytes](double Ms) { return Ms > 0.0 ? MegaBytes * 1000.0 / Ms : 0.0; };
+
+		UE_LOG_INFO("  %s: %.2f MB | single %.1f MB/s | parallel %.1f MB/s (%.1fx) | %s",
+			Entry.path().generic_string().c_str(), MegaBytes,
+			ToMegaBytesPerSecond(SingleMs),
+			ToMegaBytesPerSecond(ParallelMs), ParallelMs > 0.0 ? SingleMs / ParallelMs : 0.0,
+			bSameResult ? "match" : "MISMATCH");
+
+		TotalMegaBytes += MegaBytes;
+		TotalSingleMs += SingleMs;
+		TotalParallelMs += ParallelMs;
+		++FileCount;
+	}
+
+	auto ToMegaBytesPerSecond = [TotalMegaBytes](double Ms) { return Ms > 0.0 ? TotalMegaBytes * 1000.0 / Ms : 0.0; };
+	UE_LOG_SUCCESS("OBJ Parse Benchmark: %d files, %.2f MB | single %.1f MB/s | parallel %.1f MB/s (%.1fx)",
+		FileCount, TotalMegaBytes, ToMegaBytesPerSecond(TotalSingleMs),
+		ToMegaBytesPerSecond(TotalParallelMs), TotalParallelMs > 0.0 ? TotalSingleMs / TotalParallelMs : 0.0);
+}
+
+void FEngineBenchmark::RunMeshOptimize()
+{
+	UE_LOG_SYSTEM("Mesh Optimize Benchmark: %s (cache %u / %u, %u B lines)", COOKED_MESH_DATA_DIRECTORY,
+		MESH_OPTIMIZE_CACHE_SIZES[0], MESH_OPTIMIZE_CACHE_SIZES[1], MESH_OPTIMIZER_FETCH_LINE_SIZE);
+
+	double TotalOptimizeMs = 0.0;
+	uint64 TotalTriangles = 0;
+	double TotalMissesBefore = 0.0;
+	double TotalMissesAfter = 0.0;
+	int32 MeshCount = 0;
+
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(COOKED_MESH_DATA_DIRECTORY))
+	{
+		if (!Entry.is_regular_file())
+		{
+			continue;
+		}
+
+		const FName SourcePath(Entry.path().generic_string());
+		const bool bIsObj = Entry.path().extension() == ".obj";
+		const bool bIsStaticFbx = Entry.path().extension() == ".fbx"
+			&& FFbxImporter::DetermineMeshType(SourcePath.ToString()) == EFbxMeshType::Static;
+		if (!bIsObj && !bIsStaticFbx)
+		{
+			continue;
+		}
+
+		// 최적화하지 않은 임포트 결과 (쿠킹 파일과 중간 캐시는 사용하지 않음)
+		std::unique_ptr<FStaticMesh> SourceMesh;
+		if (bIsObj)
+		{
+			FObjImporter::Configuration Config;
+			Config.bOptimizeMesh = false;
+			SourceMesh = FObjManager::BuildObjStaticMeshAsset(SourcePath, Config);
+		}
+		else
+		{
+			FFbxImporter::Configuration Config;
+			Config.bOptimizeMesh = false;
+			SourceMesh = FFbxManager::BuildFbxStaticMeshAsset(SourcePath, Config);
+		}
+
+		if (!SourceMesh || SourceMesh->Indices.IsEmpty())
+		{
+			UE_LOG_WARNING("  %s: 임포트 실패, 건너뜀", SourcePath.ToString().c_str());
+			continue;
+		}
+
+		FStaticMesh OptimizedMesh = *SourceMesh;
+		FScopeCycleCounter OptimizeCounter;
+		FMeshOptimizer::OptimizeStaticMesh(OptimizedMesh);
+		const double OptimizeMs = OptimizeCounter.Finish();
+
+		const FMeshCacheStatistics Before = FMeshOptimizer::Analyze(*SourceMesh, MESH_OPTIMIZE_CACHE_SIZES[0]);
+		const FMeshCacheStatistics After = FMeshOptimizer::Analyze(OptimizedMesh, MESH_OPTIMIZE_CACHE_SIZES[0]);
+		const FMeshCacheStatistics LargeBefore = FMeshOptimizer::Analyze(*SourceMesh, MESH_OPTIMIZE_CACHE_SIZES[1]);
+		const FMeshCacheStatistics LargeAfter = FMeshOptimizer::Analyze(OptimizedMesh, MESH_OPTIMIZE_CACHE_SIZES[1]);
+		const uint32 TriangleCount = static_cast<uint32>(SourceMesh->Indices.Num() / 3);
+
+		UE_LOG_INFO("  %s: %d verts, %u tris, %d sections | ACMR %.3f -> %.3f (cache %u: %.3f -> %.3f) | ATVR %.3f -> %.3f"
+			" | overfetch %.2f -> %.2f | %.2f ms | %s",
+			SourcePath.ToString().c_str(), SourceMesh->Vertices.Num(), TriangleCount, SourceMesh->Sections.Num(),
+			Before.ACMR, After.ACMR, MESH_OPTIMIZE_CACHE_SIZES[1], LargeBefore.ACMR, LargeAfter.ACMR,
+			Before.ATVR, After.ATVR, Before.Overfetch, After.Overfetch, OptimizeMs,
+			IsSameTriangleSet(*SourceMesh, OptimizedMesh) ? "match" : "MISMATCH");
+
+		TotalOptimizeMs += OptimizeMs;
+		TotalTriangles += TriangleCount;
+		TotalMissesBefore += static_cast<double>(Before.ACMR) * TriangleCount;
+		TotalMissesAfter += static_cast<double>(After.ACMR) * TriangleCount;
+		++MeshCount;
+	}
+
+	const double TotalACMRBefore = TotalTriangles > 0 ? TotalMissesBefore / TotalTriangles : 0.0;
+	const double TotalACMRAfter = TotalTriangles > 0 ? TotalMissesAfter / TotalTriangles : 0.0;
+	UE_LOG_SUCCESS("Mesh Optimize Benchmark: %d meshes, %llu tris | ACMR %.3f -> %.3f (%.1f%% fewer vertex shader invocations) | %.2f ms",
+		MeshCount, static_cast<unsigned long long>(TotalTriangles), TotalACMRBefore, TotalACMRAfter,
+		TotalMissesBefore > 0.0 ? (1.0 - TotalMissesAfter / TotalMissesBefore) * 100.0 : 0.0, TotalOptimizeMs);
+}
+
+void FEngineBenchmark::RunStaticMeshLOD()
+{
+	UE_LOG_SYSTEM("Static Mesh LOD Benchmark: %s (max %d LODs, x%.2f per LOD, deviation tolerance x%.1f)", COOKED_MESH_DATA_DIRECTORY,
+		STATIC_MESH_MAX_LODS, STATIC_MESH_LOD_REDUCTION, STATIC_MESH_LOD_DEVIATION_TOLERANCE);
+
+	double TotalBuildMs = 0.0;
+	int32 MeshCount = 0;
+	int32 LODCount = 0;
+	int32 FailedLODCount = 0;
+
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(COOKED_MESH_DATA_DIRECTORY))
+	{
+		if (!Entry.is_regular_file())
+		{
+			continue;
+		}
+
+		const FName SourcePath(Entry.path().generic_string());
+		const bool bIsObj = Entry.path().extension() == ".obj";
+		const bool bIsStaticFbx = Entry.path().extension() == ".fbx"
+			&& FFbxImporter::DetermineMeshType(SourcePath.ToString()) == EFbxMeshType::Static;
+		if (!bIsObj && !bIsStaticFbx)
+		{
+			continue;
+		}
+
+		// 쿠킹과 같은 임포트 결과에서 LOD만 빼고 구성 (쿠킹 파일과 중간 캐시는 사용하지 않음)
+		std::unique_ptr<FStaticMesh> StaticMesh;
+		if (bIsObj)
+		{
+			FObjImporter::Configuration Config;
+			Config.bGenerateLODs = false;
+			StaticMesh = FObjManager::BuildObjStaticMeshAsset(SourcePath, Config);
+		}
+		else
+		{
+			FFbxImporter::Configuration Config;
+			Config.bGenerateLODs = false;
+			StaticMesh = FFbxManager::BuildFbxStaticMeshAsset(SourcePath, Config);
+		}
+
+		if (!StaticMesh || StaticMesh->Indices.IsEmpty())
+		{
+			UE_LOG_WARNING("  %s: 임포트 실패, 건너뜀", SourcePath.ToString().c_str());
+			continue;
+		}
+
+		FScopeCycleCounter BuildCounter;
+		FMeshSimplifier::BuildLODs(*StaticMesh);
+		const double BuildMs = BuildCounter.Finish();
+
+		const TArray<FNormalVertex>& Vertices = StaticMesh->Vertices;
+		const uint32 BaseTriangleCount = static_cast<uint32>(StaticMesh->Indices.Num() / 3);
+		const int32 BaseOpenEdgeCount = CountOpenEdges(Vertices, StaticMesh->Indices.GetData(), StaticMesh->Indices.Num());
+		UE_LOG_INFO("  %s: %d verts, %u tris, %d sections, %d open edges | %d LODs | %.2f ms",
+			SourcePath.ToString().c_str(), Vertices.Num(), BaseTriangleCount, StaticMesh->Sections.Num(), BaseOpenEdgeCount,
+			StaticMesh->LODs.Num(), BuildMs);
+
+		FVector BoundsMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FNormalVertex& Vertex : Vertices)
+		{
+			BoundsMin = FVector(std::min(BoundsMin.X, Vertex.Position.X), std::min(BoundsMin.Y, Vertex.Position.Y), std::min(BoundsMin.Z, Vertex.Position.Z));
+			BoundsMax = FVector(std::max(BoundsMax.X, Vertex.Position.X), std::max(BoundsMax.Y, Vertex.Position.Y), std::max(BoundsMax.Z, Vertex.Position.Z));
+		}
+		const float Radius = std::max((BoundsMax - BoundsMin).Length() * 0.5f, MATH_EPSILON);
+
+		// LOD 인덱스는 렌더 인덱스 버퍼에서 LOD0 뒤에 이어진다
+		const TArray<uint32> RenderIndices = StaticMesh->GetRenderIndices();
+		const int32 SampleStride = std::max(Vertices.Num() / STATIC_MESH_LOD_MAX_SAMPLES, 1);
+		uint32 PreviousTriangleCount = BaseTriangleCount;
+		for (int32 LODIndex = 0; LODIndex < StaticMesh->LODs.Num(); ++LODIndex)
+		{
+			const FStaticMeshLOD& LOD = StaticMesh->LODs[LODIndex];
+			const uint32* LODIndices = RenderIndices.GetData() + LOD.StartIndex;
+			const uint32 TriangleCount = LOD.IndexCount / 3;
+
+			// 원본 정점에서 LOD 표면까지의 최대 거리 (메시 반경 대비)
+			float MaxDeviation = 0.0f;
+			for (int32 Vertex = 0; Vertex < Vertices.Num(); Vertex += SampleStride)
+			{
+				float Deviation = FLT_MAX;
+				for (uint32 i = 0; i < LOD.IndexCount && Deviation > 0.0f; i += 3)
+				{
+					Deviation = std::min(Deviation, ComputePointTriangleDistance(Vertices[Vertex].Position,
+						Vertices[LODIndices[i]].Position, Vertices[LODIndices[i + 1]].Position, Vertices[LODIndices[i + 2]].Position));
+				}
+				MaxDeviation = std::max(MaxDeviation, Deviation);
+			}
+			MaxDeviation /= Radius;
+
+			const float ErrorLimit = STATIC_MESH_LOD_MAX_ERRORS[LODIndex];
+			const int32 OpenEdgeCount = CountOpenEdges(Vertices, LODIndices, LOD.IndexCount);
+			const bool bIsValid = LOD.Error <= ErrorLimit && MaxDeviation <= ErrorLimit * STATIC_MESH_LOD_DEVIATION_TOLERANCE
+				&& TriangleCount <= PreviousTriangleCount * STATIC_MESH_LOD_MIN_GAIN
+				&& OpenEdgeCount <= BaseOpenEdgeCount && LOD.Sections.Num() == StaticMesh->Sections.Num();
+
+			UE_LOG_INFO("    LOD%d: %u tris (%.1f%%) | error %.4f (limit %.4f), sampled deviation %.4f | screen size %.3f | %d open edges | %s",
+				LODIndex + 1, TriangleCount, 100.0 * TriangleCount / BaseTriangleCount, LOD.Error, ErrorLimit, MaxDeviation,
+				LOD.ScreenSize, OpenEdgeCount, bIsValid ? "ok" : "EXCEEDS");
+
+			PreviousTriangleCount = TriangleCount;
+			FailedLODCount += bIsValid ? 0 : 1;
+			++LODCount;
+		}
+
+		TotalBuildMs += BuildMs;
+		++MeshCount;
+	}
+
+	if (FailedLODCount > 0)
+	{
+		UE_LOG_ERROR("Static Mesh LOD Benchmark: %d / %d LODs exceed the error or reduction bounds", FailedLODCount, LODCount);
+	}
+	UE_LOG_SUCCESS("Static Mesh LOD Benchmark: %d meshes, %d LODs | %.2f ms", MeshCount, LODCount, TotalBuildMs);
+}
+
+void FEngineBenchmark::RunVertexQuantize()
+{
+	UE_LOG_SYSTEM("Vertex Quantize Benchmark: %s (FNormalVertex %u bytes -> FCompressedVertex %u bytes)", COOKED_MESH_DATA_DIRECTORY,
+		static_cast<uint32>(sizeof(FNormalVertex)), static_cast<uint32>(sizeof(FCompressedVertex)));
+
+	double TotalEncodeMs = 0.0;
+	double TotalDecodeMs = 0.0;
+	uint64 TotalVertexBytes = 0;
+	uint64 TotalCompressedBytes = 0;
+	int32 MeshCount = 0;
+	int32 FailedMeshCount = 0;
+
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(COOKED_MESH_DATA_DIRECTORY))
+	{
+		if (!Entry.is_regular_file())
+		{
+			continue;
+		}
+
+		const FName SourcePath(Entry.path().generic_string());
+		const bool bIsObj = Entry.path().extension() == ".obj";
+		const bool bIsStaticFbx = Entry.path().extension() == ".fbx"
+			&& FFbxImporter::DetermineMeshType(SourcePath.ToString()) == EFbxMeshType::Static;
+		if (!bIsObj && !bIsStaticFbx)
+		{
+			continue;
+		}
+
+		// 압축하지 않은 임포트 결과를 원본으로 사용 (LOD는 정점과 무관하므로 생략)
+		std::unique_ptr<FStaticMesh> StaticMesh;
+		if (bIsObj)
+		{
+			FObjImporter::Configuration Config;
+			Config.bGenerateLODs = false;
+			Config.bCompressVertices = false;
+			StaticMesh = FObjManager::BuildObjStaticMeshAsset(SourcePath, Config);
+		}
+		else
+		{
+			FFbxImporter::Configuration Config;
+			Config.bGenerateLODs = false;
+			Config.bCompressVertices = false;
+			StaticMesh = FFbxManager::BuildFbxStaticMeshAsset(SourcePath, Config);
+		}
+
+		if (!StaticMesh || StaticMesh->Vertices.IsEmpty())
+		{
+			UE_LOG_WARNING("  %s: 임포트 실패, 건너뜀", SourcePath.ToString().c_str());
+			continue;
+		}
+
+		const TArray<FNormalVertex>& Vertices = StaticMesh->Vertices;
+		const uint32 VertexCount = static_cast<uint32>(Vertices.Num());
+
+		FScopeCycleCounter EncodeCounter;
+		const FVertexQuantization Quantization = FVertexQuantizer::ComputeQuantization(Vertices);
+		TArray<FCompressedVertex> CompressedVertices;
+		TArray<uint32> Colors;
+		FVertexQuantizer::Encode(Vertices, Quantization, CompressedVertices, Colors);
+		const double EncodeMs = EncodeCounter.Finish();
+
+		TArray<FNormalVertex> DecodedVertices;
+		DecodedVertices.SetNumUninitialized(VertexCount);
+		FScopeCycleCounter DecodeCounter;
+		FVertexQuantizer::Decode(CompressedVertices.GetData(), Colors.GetData(), VertexCount, Quantization, DecodedVertices.GetData());
+		const double DecodeMs = DecodeCounter.Finish();
+
+		// 위치와 UV는 단계 단위, 방향은 각도(도)로 측정
+		float MaxPositionError = 0.0f;
+		float MaxNormalDegrees = 0.0f;
+		float MaxTangentDegrees = 0.0f;
+		float MaxTexCoordError = 0.0f;
+		float MaxColorError = 0.0f;
+		int32 HandednessMismatchCount = 0;
+		int32 ZeroDirectionMismatchCount = 0;
+		for (uint32 i = 0; i < VertexCount; ++i)
+		{
+			const FNormalVertex& Source = Vertices[i];
+			const FNormalVertex& Decoded = DecodedVertices[i];
+
+			const float SourcePosition[3] = { Source.Position.X, Source.Position.Y, Source.Position.Z };
+			const float DecodedPosition[3] = { Decoded.Position.X, Decoded.Position.Y, Decoded.Position.Z };
+			const float Steps[3] = { Quantization.PositionStep.X, Quantization.PositionStep.Y, Quantization.PositionStep.Z };
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				if (Steps[Axis] > 0.0f)
+				{
+					MaxPositionError = std::max(MaxPositionError, std::abs(SourcePosition[Axis] - DecodedPosition[Axis]) / Steps[Axis]);
+				}
+			}
+
+			// 길이가 0인 방향(노멀/탄젠트 없음)은 비교하지 않는다
+			const auto ComputeDegrees = [](const FVector& A, const FVector& B)
+			{
+				const float LengthA = A.Length();
+				if (LengthA < MATH_EPSILON)
+				{
+					return 0.0f;
+				}
+				const float Cosine = std::clamp(A.Dot(B) / (LengthA * std::max(B.Length(), MATH_EPSILON)), -1.0f, 1.0f);
+				return std::acos(Cosine) * ToDeg;
+			};
+			MaxNormalDegrees = std::max(MaxNormalDegrees, ComputeDegrees(Source.Normal, Decoded.Normal));
+			MaxTangentDegrees = std::max(MaxTangentDegrees, ComputeDegrees(
+				FVector(Source.Tangent.X, Source.Tangent.Y, Source.Tangent.Z), FVector(Decoded.Tangent.X, Decoded.Tangent.Y, Decoded.Tangent.Z)));
+			HandednessMismatchCount += (Source.Tangent.W < 0.0f) != (Decoded.Tangent.W < 0.0f) ? 1 : 0;
+
+			// 길이가 0인 노멀/탄젠트는 +Z 같은 임의의 방향이 아니라 0으로 돌아와야 한다
+			const FVector SourceTangent(Source.Tangent.X, Source.Tangent.Y, Source.Tangent.Z);
+			const FVector DecodedTangent(Decoded.Tangent.X, Decoded.Tangent.Y, Decoded.Tangent.Z);
+			ZeroDirectionMismatchCount += (Source.Normal.Length() == 0.0f) != (Decoded.Normal.Length() == 0.0f) ? 1 : 0;
+			ZeroDirectionMismatchCount += (SourceTangent.Length() == 0.0f) != (DecodedTangent.Length() == 0.0f) ? 1 : 0;
+
+			const float SourceTexCoord[2] = { Source.TexCoord.X, Source.TexCoord.Y };
+			const float DecodedTexCoord[2] = { Decoded.TexCoord.X, Decoded.TexCoord.Y };
+			const float TexCoordSteps[2] = { Quantization.TexCoordStep.X, Quantization.TexCoordStep.Y };
+			for (int32 Axis = 0; Axis < 2; ++Axis)
+			{
+				if (TexCoordSteps[Axis] > 0.0f)
+				{
+					MaxTexCoordError = std::max(MaxTexCoordError, std::abs(SourceTexCoord[Axis] - DecodedTexCoord[Axis]) / TexCoordSteps[Axis]);
+				}
+			}
+
+			MaxColorError = std::max({ MaxColorError,
+				std::abs(std::clamp(Source.Color.X, 0.0f, 1.0f) - Decoded.Color.X), std::abs(std::clamp(Source.Color.Y, 0.0f, 1.0f) - Decoded.Color.Y),
+				std::abs(std::clamp(Source.Color.Z, 0.0f, 1.0f) - Decoded.Color.Z), std::abs(std::clamp(Source.Color.W, 0.0f, 1.0f) - Decoded.Color.W) });
+		}
+
+		// 쿠킹 파일에서 읽은 정점을 다시 인코딩해도 같은 정점이 나와야 한다
+		FStaticMesh QuantizedMesh;
+		QuantizedMesh.Vertices = Vertices;
+		FVertexQuantizer::QuantizeStaticMesh(QuantizedMesh);
+		FVertexQuantizer::Encode(QuantizedMesh.Vertices, QuantizedMesh.VertexQuantization, CompressedVertices, Colors);
+		FVertexQuantizer::Decode(CompressedVertices.GetData(), Colors.GetData(), VertexCount, QuantizedMesh.VertexQuantization,
+			DecodedVertices.GetData());
+		const bool bIsStable = IsSameArray(QuantizedMesh.Vertices, DecodedVertices);
+
+		const uint64 VertexBytes = static_cast<uint64>(VertexCount) * sizeof(FNormalVertex);
+		const uint64 CompressedBytes = FVertexQuantizer::GetCompressedSize(VertexCount, Quantization.bHasVertexColors);
+		const bool bIsValid = MaxPositionError <= VERTEX_QUANTIZE_POSITION_TOLERANCE && MaxNormalDegrees <= VERTEX_QUANTIZE_MAX_DEGREES
+			&& MaxTangentDegrees <= VERTEX_QUANTIZE_MAX_DEGREES && HandednessMismatchCount == 0 && ZeroDirectionMismatchCount == 0
+			&& MaxTexCoordError <= VERTEX_QUANTIZE_POSITION_TOLERANCE
+			&& MaxColorError <= VERTEX_QUANTIZE_COLOR_TOLERANCE && bIsStable;
+
+		UE_LOG_INFO("  %s: %u verts%s | position %.3f steps, normal %.4f deg, tangent %.4f deg, handedness %d, zero dir %d, uv %.3f steps, color %.4f | %s",
+			SourcePath.ToString().c_str(), VertexCount, Quantization.bHasVertexColors ? " (vertex colors)" : "",
+			MaxPositionError, MaxNormalDegrees, MaxTangentDegrees, HandednessMismatchCount, ZeroDirectionMismatchCount, MaxTexCoordError, MaxColorError,
+			bIsStable ? "stable" : "NOT STABLE");
+		UE_LOG_INFO("    %.1f KB -> %.1f KB (%.1f%%) | encode %.2f ms, decode %.2f ms | %s",
+			VertexBytes / 1024.0, CompressedBytes / 1024.0, 100.0 * CompressedBytes / VertexBytes, EncodeMs, DecodeMs,
+			bIsValid ? "ok" : "EXCEEDS");
+
+		TotalEncodeMs += EncodeMs;
+		TotalDecodeMs += DecodeMs;
+		TotalVertexBytes += VertexBytes;
+		TotalCompressedBytes += CompressedBytes;
+		FailedMeshCount += bIsValid ? 0 : 1;
+		++MeshCount;
+	}
+
+	if (FailedMeshCount > 0)
+	{
+		UE_LOG_ERROR("Vertex Quantize Benchmark: %d / %d meshes exceed the error bounds", FailedMeshCount, MeshCount);
+	}
+	UE_LOG_SUCCESS("Vertex Quantize Benchmark: %d meshes | %.2f MB -> %.2f MB (%.1f%%) | encode %.2f ms, decode %.2f ms",
+		MeshCount, TotalVertexBytes / (1024.0 * 1024.0), TotalCompressedBytes / (1024.0 * 1024.0),
+		TotalVertexBytes > 0 ? 100.0 * TotalCompressedBytes / TotalVertexBytes : 0.0, TotalEncodeMs, TotalDecodeMs);
+}
+
+void FEngineBenchmark::RunOcclusionCulling()
+{
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (!Level || !Level->GetStaticOctree())
+	{
+		UE_LOG_WARNING("Occlusion Culling Benchmark: 레벨이 없습니다");
+		return;
+	}
+
+	// 레벨 바운드로 카메라 경로를 정한다
+	TArray<UPrimitiveComponent*> AllPrimitives;
+	FVector BoundsMin, BoundsMax;
+	if (!GetLevelPrimitiveBounds(Level, AllPrimitives, BoundsMin, BoundsMax))
+	{
+		UE_LOG_WARNING("Occlusion Culling Benchmark: 레벨에 프리미티브가 없습니다");
+		return;
+	}
+
+	const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+	const float HorizontalRadius = std::max(std::max(BoundsMax.X - BoundsMin.X, BoundsMax.Y - BoundsMin.Y) * 0.5f, 1.0f);
+	const float EyeHeight = BoundsMin.Z + (BoundsMax.Z - BoundsMin.Z) * OCCLUSION_PATH_HEIGHT_RATIO;
+	const float FarZ = (BoundsMax - BoundsMin).Length() * 2.0f + 1.0f;
+
+	UE_LOG_SYSTEM("Occlusion Culling Benchmark: %d primitives, %d occluder meshes max, %dx%d tiles of %dx%d, %d bins, %d threads",
+		AllPrimitives.Num(), COcclusionCuller::MAX_OCCLUDERS, COcclusionCuller::TILES_X, COcclusionCuller::TILES_Y,
+		COcclusionCuller::TILE_WIDTH, COcclusionCuller::TILE_HEIGHT, COcclusionCuller::BINS_X * COcclusionCuller::BINS_Y,
+		FTaskScheduler::GetInstance().GetThreadCount());
+
+	const char* PathNames[] = { "orbit", "fly-through" };
+	COcclusionCuller Culler;
+	ViewVolumeCuller FrustumCuller;
+	int32 TotalFrameCount = 0;
+	int32 TotalMismatchCount = 0;
+	int32 TotalViolationCount = 0;
+	double TotalSerialMs = 0.0;
+	double TotalParallelMs = 0.0;
+	int64 TotalTestedCount = 0;
+	int64 TotalOccludedCount = 0;
+
+	for (int32 PathIndex = 0; PathIndex < 2; ++PathIndex)
+	{
+		int64 FrustumVisibleCount = 0;
+		int64 TestedCount = 0;
+		int64 OccludedCount = 0;
+		int64 OccluderCount = 0;
+		int64 TriangleCount = 0;
+		double SetupMs = 0.0;
+		double SerialRasterMs = 0.0;
+		double ParallelRasterMs = 0.0;
+		double PyramidMs = 0.0;
+		double TestMs = 0.0;
+		int32 MismatchCount = 0;
+		int32 ViolationCount = 0;
+
+		for (int32 Frame = 0; Frame < OCCLUSION_PATH_FRAME_COUNT; ++Frame)
+		{
+			const float T = static_cast<float>(Frame) / OCCLUSION_PATH_FRAME_COUNT;
+			FVector Eye;
+			FVector Target;
+			if (PathIndex == 0)
+			{
+				// 레벨 중심을 바라보며 한 바퀴
+				const float Angle = T * 2.0f * PI;
+				Eye = FVector(Center.X + std::cos(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO,
+					Center.Y + std::sin(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO, EyeHeight);
+				Target = FVector(Center.X, Center.Y, EyeHeight);
+			}
+			else
+			{
+				// 레벨을 X 방향으로 가로지르며 진행 방향을 바라봄
+				Eye = FVector(BoundsMin.X + (BoundsMax.X - BoundsMin.X) * T, Center.Y, EyeHeight);
+				Target = Eye + FVector(1.0f, 0.0f, 0.0f);
+			}
+
+			const FCameraConstants Camera = MakeBenchmarkCamera(Eye, Target, FarZ);
+			FrustumCuller.Cull(Level->GetStaticOctree(), Level->GetDynamicPrimitiveTree(), Camera);
+			const TArray<UPrimitiveComponent*>& FrustumVisible = FrustumCuller.GetRenderableObjects();
+
+			// 1 스레드
+			Culler.SetParallelRasterization(false);
+			Culler.InitializeCuller(Camera.View, Camera.Projection);
+			const TArray<UPrimitiveComponent*> SerialVisible = Culler.PerformCulling(FrustumVisible, Eye);
+			const TArray<float> SerialTileDepths = Culler.GetTileDepths();
+			const double FrameSerialRasterMs = Culler.GetStats().RasterMs;
+
+			// bin 병렬
+			Culler.SetParallelRasterization(true);
+			Culler.InitializeCuller(Camera.View, Camera.Projection);
+			const TArray<UPrimitiveComponent*> ParallelVisible = Culler.PerformCulling(FrustumVisible, Eye);
+			const FOcclusionCullingStats& Stats = Culler.GetStats();
+
+			MismatchCount += IsSameArray(SerialTileDepths, Culler.GetTileDepths()) && IsSameArray(SerialVisible, ParallelVisible) ? 0 : 1;
+			ViolationCount += CountOcclusionDepthViolations(Culler);
+
+			FrustumVisibleCount += FrustumVisible.Num();
+			TestedCount += Stats.TestedCount;
+			OccludedCount += Stats.OccludedCount;
+			OccluderCount += Stats.OccluderCount;
+			TriangleCount += Stats.TriangleCount;
+			SetupMs += Stats.SetupMs;
+			SerialRasterMs += FrameSerialRasterMs;
+			ParallelRasterMs += Stats.RasterMs;
+			PyramidMs += Stats.PyramidMs;
+			TestMs += Stats.TestMs;
+		}
+
+		const double FrameCount = OCCLUSION_PATH_FRAME_COUNT;
+		UE_LOG_INFO("  %s: %d frames | %.1f in frustum, %.1f tested, %.1f occluded (%.1f%%) | %.1f occluders, %.0f tris",
+			PathNames[PathIndex], OCCLUSION_PATH_FRAME_COUNT, FrustumVisibleCount / FrameCount, TestedCount / FrameCount,
+			OccludedCount / FrameCount, TestedCount > 0 ? 100.0 * OccludedCount / TestedCount : 0.0,
+			OccluderCount / FrameCount, TriangleCount / FrameCount);
+		UE_LOG_INFO("    per frame: setup %.3f ms, raster %.3f ms (1 thread) vs %.3f ms (bins, x%.2f), pyramid %.3f ms, test %.3f ms | %d mismatches, %d non-conservative tiles",
+			SetupMs / FrameCount, SerialRasterMs / FrameCount, ParallelRasterMs / FrameCount,
+			ParallelRasterMs > 0.0 ? SerialRasterMs / ParallelRasterMs : 0.0, PyramidMs / FrameCount, TestMs / FrameCount,
+			MismatchCount, ViolationCount);
+
+		TotalFrameCount += OCCLUSION_PATH_FRAME_COUNT;
+		TotalMismatchCount += MismatchCount;
+		TotalViolationCount += ViolationCount;
+		TotalSerialMs += SetupMs + SerialRasterMs + PyramidMs + TestMs;
+		TotalParallelMs += SetupMs + ParallelRasterMs + PyramidMs + TestMs;
+		TotalTestedCount += TestedCount;
+		TotalOccludedCount += OccludedCount;
+	}
+
+	if (TotalMismatchCount > 0 || TotalViolationCount > 0)
+	{
+		UE_LOG_ERROR("Occlusion Culling Benchmark: %d frames differ between 1 thread and bins, %d tiles are not conservative",
+			TotalMismatchCount, TotalViolationCount);
+	}
+	UE_LOG_SUCCESS("Occlusion Culling Benchmark: %d frames | %.1f%% of tested meshes occluded | %.3f ms (1 thread) vs %.3f ms (bins) per frame",
+		TotalFrameCount, TotalTestedCount > 0 ? 100.0 * TotalOccludedCount / TotalTestedCount : 0.0,
+		TotalSerialMs / TotalFrameCount, TotalParallelMs / TotalFrameCount);
+}
+
+void FEngineBenchmark::RunFrustumCulling()
+{
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (!Level || !Level->GetStaticOctree())
+	{
+		UE_LOG_WARNING("Frustum Culling Benchmark: 레벨이 없습니다");
+		return;
+	}
+
+	TArray<UPrimitiveComponent*> AllPrimitives;
+	FVector BoundsMin, BoundsMax;
+	if (!GetLevelPrimitiveBounds(Level, AllPrimitives, BoundsMin, BoundsMax))
+	{
+		UE_LOG_WARNING("Frustum Culling Benchmark: 레벨에 프리미티브가 없습니다");
+		return;
+	}
+
+	const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+	const float HorizontalRadius = std::max(std::max(BoundsMax.X - BoundsMin.X, BoundsMax.Y - BoundsMin.Y) * 0.5f, 1.0f);
+	const float EyeHeight = BoundsMin.Z + (BoundsMax.Z - BoundsMin.Z) * OCCLUSION_PATH_HEIGHT_RATIO;
+	const float FarZ = (BoundsMax - BoundsMin).Length() * 2.0f + 1.0f;
+
+	UE_LOG_SYSTEM("Frustum Culling Benchmark: %d primitives (%d static, %d dynamic), %d frames x %d views",
+		AllPrimitives.Num(), Level->GetStaticOctree()->GetElementCount(),
+		Level->GetDynamicPrimitiveTree() ? Level->GetDynamicPrimitiveTree()->GetProxyCount() : 0,
+		FRUSTUM_FRAME_COUNT, FRUSTUM_VIEW_COUNT);
+
+	TArray<FCameraConstants> Views;
+	Views.SetNum(FRUSTUM_VIEW_COUNT);
+	TArray<ViewVolumeCuller> SingleCullers;
+	SingleCullers.SetNum(FRUSTUM_VIEW_COUNT);
+	TArray<ViewVolumeCuller> BatchedCullers;
+	TArray<TArray<UPrimitiveComponent*>> ScalarResults;
+	ScalarResults.SetNum(FRUSTUM_VIEW_COUNT);
+
+	double ScalarMs = 0.0;
+	double SingleMs = 0.0;
+	double BatchedMs = 0.0;
+	int32 MismatchCount = 0;
+	FViewCullingStats TotalStats;
+
+	for (int32 Frame = 0; Frame < FRUSTUM_FRAME_COUNT; ++Frame)
+	{
+		for (int32 ViewIndex = 0; ViewIndex < FRUSTUM_VIEW_COUNT; ++ViewIndex)
+		{
+			const float Angle = (static_cast<float>(Frame) / FRUSTUM_FRAME_COUNT + static_cast<float>(ViewIndex) / FRUSTUM_VIEW_COUNT) * 2.0f * PI;
+			const FVector Eye(Center.X + std::cos(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO,
+				Center.Y + std::sin(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO, EyeHeight);
+			Views[ViewIndex] = MakeBenchmarkCamera(Eye, FVector(Center.X, Center.Y, EyeHeight), FarZ);
+		}
+
+		// 1. 스칼라 트리 순회
+		FScopeCycleCounter ScalarCounter;
+		for (int32 ViewIndex = 0; ViewIndex < FRUSTUM_VIEW_COUNT; ++ViewIndex)
+		{
+			FFrustum Frustum;
+			ScalarResults[ViewIndex].Empty();
+			if (ViewVolumeCuller::BuildFrustum(Views[ViewIndex], Frustum))
+			{
+				CullFrustumScalar(Level, Frustum, ScalarResults[ViewIndex]);
+			}
+		}
+		ScalarMs += ScalarCounter.Finish();
+
+		// 2. SoA SIMD, 뷰마다 따로
+		FScopeCycleCounter SingleCounter;
+		for (int32 ViewIndex = 0; ViewIndex < FRUSTUM_VIEW_COUNT; ++ViewIndex)
+		{
+			SingleCullers[ViewIndex].Cull(Level->GetStaticOctree(), Level->GetDynamicPrimitiveTree(), Views[ViewIndex]);
+		}
+		SingleMs += SingleCounter.Finish();
+
+		// 3. SoA SIMD, 모든 뷰를 한 번에
+		FScopeCycleCounter BatchedCounter;
+		ViewVolumeCuller::CullViews(Level->GetStaticOctree(), Level->GetDynamicPrimitiveTree(), Views, BatchedCullers);
+		BatchedMs += BatchedCounter.Finish();
+
+		for (int32 ViewIndex = 0; ViewIndex < FRUSTUM_VIEW_COUNT; ++ViewIndex)
+		{
+			const TArray<UPrimitiveComponent*>& SingleResult = SingleCullers[ViewIndex].GetRenderableObjects();
+			MismatchCount += IsSamePrimitiveSet(ScalarResults[ViewIndex], SingleResult)
+				&& IsSamePrimitiveSet(SingleResult, BatchedCullers[ViewIndex].GetRenderableObjects()) ? 0 : 1;
+
+			const FViewCullingStats& Stats = BatchedCullers[ViewIndex].GetStats();
+			TotalStats.NodeTestCount += Stats.NodeTestCount;
+			TotalStats.BoxTestCount += Stats.BoxTestCount;
+			TotalStats.AcceptedByNodeCount += Stats.AcceptedByNodeCount;
+			TotalStats.VisibleCount += Stats.VisibleCount;
+			TotalStats.CulledCount += Stats.CulledCount;
+		}
+	}
+
+	const double ViewCount = static_cast<double>(FRUSTUM_FRAME_COUNT) * FRUSTUM_VIEW_COUNT;
+	UE_LOG_INFO("  per view: %.1f node tests, %.1f box tests (SIMD), %.1f accepted by node, %.1f visible, %.1f culled",
+		TotalStats.NodeTestCount / ViewCount, TotalStats.BoxTestCount / ViewCount, TotalStats.AcceptedByNodeCount / ViewCount,
+		TotalStats.VisibleCount / ViewCount, TotalStats.CulledCount / ViewCount);
+	UE_LOG_INFO("  per frame (%d views): scalar %.3f ms | SoA one by one %.3f ms (x%.2f) | SoA batched %.3f ms (x%.2f)",
+		FRUSTUM_VIEW_COUNT, ScalarMs / FRUSTUM_FRAME_COUNT, SingleMs / FRUSTUM_FRAME_COUNT,
+		SingleMs > 0.0 ? ScalarMs / SingleMs : 0.0, BatchedMs / FRUSTUM_FRAME_COUNT, BatchedMs > 0.0 ? ScalarMs / BatchedMs : 0.0);
+
+	if (MismatchCount > 0)
+	{
+		UE_LOG_ERROR("Frustum Culling Benchmark: %d of %d views differ from the scalar reference", MismatchCount, static_cast<int32>(ViewCount));
+		return;
+	}
+	UE_LOG_SUCCESS("Frustum Culling Benchmark: all %d views match the scalar reference", static_cast<int32>(ViewCount));
+}
+
+void FEngineBenchmark::RunMultiViewCulling()
+{
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (!Level || !Level->GetStaticOctree())
+	{
+		UE_LOG_WARNING("MultiView Culling Benchmark: 레벨이 없습니다");
+		return;
+	}
+
+	TArray<UPrimitiveComponent*> AllPrimitives;
+	FVector BoundsMin, BoundsMax;
+	if (!GetLevelPrimitiveBounds(Level, AllPrimitives, BoundsMin, BoundsMax))
+	{
+		UE_LOG_WARNING("MultiView Culling Benchmark: 레벨에 프리미티브가 없습니다");
+		return;
+	}
+
+	const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+	const float HorizontalRadius = std::max(std::max(BoundsMax.X - BoundsMin.X, BoundsMax.Y - BoundsMin.Y) * 0.5f, 1.0f);
+	const float EyeHeight = BoundsMin.Z + (BoundsMax.Z - BoundsMin.Z) * OCCLUSION_PATH_HEIGHT_RATIO;
+	const float FarZ = (BoundsMax - BoundsMin).Length() * 2.0f + 1.0f;
+
+	UE_LOG_SYSTEM("MultiView Culling Benchmark: %d primitives, %d frames x %d views (%d cameras, %d cascades, %d point light faces)",
+		AllPrimitives.Num(), FRUSTUM_FRAME_COUNT, MULTIVIEW_VIEW_COUNT, FRUSTUM_VIEW_COUNT, MULTIVIEW_CASCADE_COUNT,
+		MULTIVIEW_POINT_FACE_COUNT);
+
+	// 포인트 라이트는 레벨 중심에 고정 (FShadowMapPass::CalculatePointLightViewProj와 같은 면 순서)
+	const FVector PointLightPosition(Center.X, Center.Y, EyeHeight);
+	const float PointLightRadius = HorizontalRadius * MULTIVIEW_POINT_LIGHT_RADIUS_RATIO;
+	const FMatrix PointLightProjection = FMatrix::CreatePerspectiveFovLH(PI / 2.0f, 1.0f, 1.0f, std::max(PointLightRadius, 2.0f));
+	const FVector FaceDirections[MULTIVIEW_POINT_FACE_COUNT] = {
+		FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1) };
+	const FVector FaceUps[MULTIVIEW_POINT_FACE_COUNT] = {
+		FVector(0, 1, 0), FVector(0, 1, 0), FVector(0, 0, -1), FVector(0, 0, 1), FVector(0, 1, 0), FVector(0, 1, 0) };
+
+	// 위에서 비스듬히 내려오는 방향광
+	FVector LightDirection(0.3f, 0.2f, -1.0f);
+	LightDirection.Normalize();
+	const float LevelDiagonal = (BoundsMax - BoundsMin).Length() + 1.0f;
+
+	TArray<FCameraConstants> Views;
+	Views.SetNum(MULTIVIEW_VIEW_COUNT);
+	TArray<ViewVolumeCuller> SingleCullers;
+	SingleCullers.SetNum(MULTIVIEW_VIEW_COUNT);
+	FMultiViewCuller SharedCuller;
+	TArray<UPrimitiveComponent*> SharedResult;
+
+	double SingleMs = 0.0;
+	double SharedMs = 0.0;
+	int32 MismatchCount = 0;
+	FViewCullingStats SingleTotalStats;
+	FViewCullingStats SharedTotalStats;
+
+	for (int32 Frame = 0; Frame < FRUSTUM_FRAME_COUNT; ++Frame)
+	{
+		for (int32 ViewIndex = 0; ViewIndex < FRUSTUM_VIEW_COUNT; ++ViewIndex)
+		{
+			const float Angle = (static_cast<float>(Frame) / FRUSTUM_FRAME_COUNT + static_cast<float>(ViewIndex) / FRUSTUM_VIEW_COUNT) * 2.0f * PI;
+			const FVector Eye(Center.X + std::cos(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO,
+				Center.Y + std::sin(Angle) * HorizontalRadius * OCCLUSION_PATH_ORBIT_RADIUS_RATIO, EyeHeight);
+			Views[ViewIndex] = MakeBenchmarkCamera(Eye, FVector(Center.X, Center.Y, EyeHeight), FarZ);
+		}
+
+		// 첫 시점을 중심으로 두 배씩 넓어지는 직교 캐스케이드
+		const FVector CascadeCenter = Views[0].ViewWorldLocation;
+		const FMatrix CascadeView = FMatrix::CreateLookAtLH(CascadeCenter - LightDirection * LevelDiagonal, CascadeCenter, FVector(1, 0, 0));
+		for (int32 Cascade = 0; Cascade < MULTIVIEW_CASCADE_COUNT; ++Cascade)
+		{
+			const float HalfWidth = HorizontalRadius * 0.25f * static_cast<float>(1 << Cascade);
+			FCameraConstants& View = Views[FRUSTUM_VIEW_COUNT + Cascade];
+			View.View = CascadeView;
+			View.Projection = FMatrix::CreateOrthoLH(-HalfWidth, HalfWidth, -HalfWidth, HalfWidth, 0.0f, LevelDiagonal * 2.0f);
+		}
+
+		for (int32 Face = 0; Face < MULTIVIEW_POINT_FACE_COUNT; ++Face)
+		{
+			FCameraConstants& View = Views[FRUSTUM_VIEW_COUNT + MULTIVIEW_CASCADE_COUNT + Face];
+			View.View = FMatrix::CreateLookAtLH(PointLightPosition, PointLightPosition + FaceDirections[Face], FaceUps[Face]);
+			View.Projection = PointLightProjection;
+		}
+
+		// 1. 뷰마다 ViewVolumeCuller 하나 (트리를 뷰 수만큼 순회)
+		FScopeCycleCounter SingleCounter;
+		for (int32 ViewIndex = 0; ViewIndex < MULTIVIEW_VIEW_COUNT; ++ViewIndex)
+		{
+			SingleCullers[ViewIndex].Cull(Level->GetStaticOctree(), Level->GetDynamicPrimitiveTree(), Views[ViewIndex]);
+		}
+		SingleMs += SingleCounter.Finish();
+
+		// 2. 모든 뷰를 FMultiViewCuller 한 번으로 (트리 한 번 순회 + 뷰별 비트셋)
+		FScopeCycleCounter SharedCounter;
+		SharedCuller.Reset();
+		for (int32 ViewIndex = 0; ViewIndex < MULTIVIEW_VIEW_COUNT; ++ViewIndex)
+		{
+			SharedCuller.AddView(Views[ViewIndex].View * Views[ViewIndex].Projection);
+		}
+		SharedCuller.Cull(Level->GetStaticOctree(), Level->GetDynamicPrimitiveTree());
+		SharedMs += SharedCounter.Finish();
+
+		for (int32 ViewIndex = 0; ViewIndex < MULTIVIEW_VIEW_COUNT; ++ViewIndex)
+		{
+			SharedResult.Empty();
+			SharedCuller.GetVisiblePrimitives(ViewIndex, SharedResult);
+			MismatchCount += IsSamePrimitiveSet(SingleCullers[ViewIndex].GetRenderableObjects(), SharedResult) ? 0 : 1;
+
+			const FViewCullingStats& SingleStats = SingleCullers[ViewIndex].GetStats();
+			SingleTotalStats.NodeTestCount += SingleStats.NodeTestCount;
+			SingleTotalStats.BoxTestCount += SingleStats.BoxTestCount;
+			SingleTotalStats.VisibleCount += SingleStats.VisibleCount;
+
+			const FViewCullingStats& SharedStats = SharedCuller.GetStats(ViewIndex);
+			SharedTotalStats.NodeTestCount += SharedStats.NodeTestCount;
+			SharedTotalStats.BoxTestCount += SharedStats.BoxTestCount;
+			SharedTotalStats.AcceptedByNodeCount += SharedStats.AcceptedByNodeCount;
+			SharedTotalStats.VisibleCount += SharedStats.VisibleCount;
+			SharedTotalStats.CulledCount += SharedStats.CulledCount;
+		}
+	}
+
+	const double ViewCount = static_cast<double>(FRUSTUM_FRAME_COUNT) * MULTIVIEW_VIEW_COUNT;
+	UE_LOG_INFO("  per view: %.1f node tests, %.1f box tests, %.1f accepted by node, %.1f visible, %.1f culled",
+		SharedTotalStats.NodeTestCount / ViewCount, SharedTotalStats.BoxTestCount / ViewCount,
+		SharedTotalStats.AcceptedByNodeCount / ViewCount, SharedTotalStats.VisibleCount / ViewCount,
+		SharedTotalStats.CulledCount / ViewCount);
+	UE_LOG_INFO("  per frame (%d views): one culler per view %.3f ms | shared multi-view pass %.3f ms (x%.2f)",
+		MULTIVIEW_VIEW_COUNT, SingleMs / FRUSTUM_FRAME_COUNT, SharedMs / FRUSTUM_FRAME_COUNT,
+		SharedMs > 0.0 ? SingleMs / SharedMs : 0.0);
+
+	if (MismatchCount > 0 || SingleTotalStats.NodeTestCount != SharedTotalStats.NodeTestCount
+		|| SingleTotalStats.BoxTestCount != SharedTotalStats.BoxTestCount)
+	{
+		UE_LOG_ERROR("MultiView Culling Benchmark: %d of %d views differ from one culler per view (node tests %d vs %d, box tests %d vs %d)",
+			MismatchCount, static_cast<int32>(ViewCount), SingleTotalStats.NodeTestCount, SharedTotalStats.NodeTestCount,
+			SingleTotalStats.BoxTestCount, SharedTotalStats.BoxTestCount);
+		return;
+	}
+	UE_LOG_SUCCESS("MultiView Culling Benchmark: all %d views match one culler per view", static_cast<int32>(ViewCount));
+}
+
+void FEngineBenchmark::RunDrawList()
+{
+	UE_LOG_SYSTEM("Draw List Benchmark: %d primitives, %d meshes, %d materials, up to %d sections per primitive",
+		DRAWLIST_PRIMITIVE_COUNT, DRAWLIST_MESH_COUNT, DRAWLIST_MATERIAL_COUNT, DRAWLIST_MAX_SECTION_COUNT);
+
+	// 메시마다 섹션 수와 섹션별 머티리얼을 정해 두고, 프리미티브는 메시를 골라 그 섹션을 그대로 쓴다
+	std::mt19937 Random(1234);
+	TArray<int32> MeshSectionCounts;
+	TArray<uint32> MeshSectionMaterials;
+	MeshSectionCounts.SetNum(DRAWLIST_MESH_COUNT);
+	MeshSectionMaterials.SetNum(DRAWLIST_MESH_COUNT * DRAWLIST_MAX_SECTION_COUNT);
+	for (int32 Mesh = 0; Mesh < DRAWLIST_MESH_COUNT; ++Mesh)
+	{
+		MeshSectionCounts[Mesh] = 1 + static_cast<int32>(Random() % DRAWLIST_MAX_SECTION_COUNT);
+		for (int32 Section = 0; Section < DRAWLIST_MAX_SECTION_COUNT; ++Section)
+		{
+			MeshSectionMaterials[Mesh * DRAWLIST_MAX_SECTION_COUNT + Section] = 1 + Random() % DRAWLIST_MATERIAL_COUNT;
+		}
+	}
+
+	FMeshDrawList DrawList;
+	TArray<FMeshDrawItem> Items;
+	std::uniform_real_distribution<float> DepthDistribution(0.0f, 10000.0f);
+	for (int32 Primitive = 0; Primitive < DRAWLIST_PRIMITIVE_COUNT; ++Primitive)
+	{
+		FMeshDrawItem Item;
+		Item.MeshId = Random() % DRAWLIST_MESH_COUNT;
+		Item.PrimitiveId = Primitive;
+		Item.Depth = DepthDistribution(Random);
+		for (int32 Section = 0; Section < MeshSectionCounts[Item.MeshId]; ++Section)
+		{
+			Item.MaterialId = MeshSectionMaterials[Item.MeshId * DRAWLIST_MAX_SECTION_COUNT + Section];
+			Item.StartIndex = Items.Num(); // 정렬 결과 검증용으로 원래 순서를 싣는다
+			Item.IndexCount = 3;
+			Items.Add(Item);
+		}
+	}
+
+	double UnsortedMs = 0.0;
+	double SortedMs = 0.0;
+	double StdSortMs = 0.0;
+	FMeshDrawListStats UnsortedStats;
+	FMeshDrawListStats SortedStats;
+	TArray<uint64> Keys;
+	for (int32 Iteration = 0; Iteration < DRAWLIST_ITERATION_COUNT; ++Iteration)
+	{
+		DrawList.Reset();
+		for (const FMeshDrawItem& Item : Items)
+		{
+			DrawList.AddDraw(Item);
+		}
+
+		// 1. 추가한 순서 그대로 (기존 패스처럼 컴포넌트 순서로 바인딩)
+		FScopeCycleCounter UnsortedCounter;
+		DrawList.Build(false);
+		UnsortedMs += UnsortedCounter.Finish();
+		UnsortedStats = DrawList.GetStats();
+
+		// 2. 키 생성 + radix 정렬 + 명령 생성
+		FScopeCycleCounter SortedCounter;
+		DrawList.Build(true);
+		SortedMs += SortedCounter.Finish();
+		SortedStats = DrawList.GetStats();
+
+		// 3. 참고: 같은 키를 std::sort로 정렬하는 시간
+		Keys.SetNum(Items.Num());
+		FScopeCycleCounter StdSortCounter;
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			Keys[Index] = FMeshDrawList::MakeSortKey(Items[Index]);
+		}
+		std::sort(Keys.begin(), Keys.end());
+		StdSortMs += StdSortCounter.Finish();
+	}
+
+	// 정렬 결과가 키 기준 안정 정렬과 같은지 검사
+	TArray<int32> ReferenceOrder;
+	ReferenceOrder.SetNum(Items.Num());
+	std::iota(ReferenceOrder.begin(), ReferenceOrder.end(), 0);
+	std::stable_sort(ReferenceOrder.begin(), ReferenceOrder.end(), [&Items](int32 A, int32 B)
+	{
+		return FMeshDrawList::MakeSortKey(Items[A]) < FMeshDrawList::MakeSortKey(Items[B]);
+	});
+
+	int32 MismatchCount = 0;
+	const TArray<FMeshDrawCommand>& Commands = DrawList.GetCommands();
+	for (int32 Index = 0; Index < Commands.Num(); ++Index)
+	{
+		MismatchCount += Commands[Index].StartIndex == static_cast<uint32>(ReferenceOrder[Index]) ? 0 : 1;
+	}
+
+	auto LogStats = [](const char* Label, const FMeshDrawListStats& Stats)
+	{
+		UE_LOG_INFO("  %s: %d draws | material %d, mesh %d, primitive %d changes | %d of %d state binds skipped",
+			Label, Stats.DrawCount, Stats.MaterialChangeCount, Stats.MeshChangeCount,
+			Stats.PrimitiveChangeCount, Stats.GetSkippedStateChangeCount(), Stats.DrawCount * MESH_DRAW_STATE_COUNT);
+	};
+	LogStats("submission order", UnsortedStats);
+	LogStats("sorted", SortedStats);
+	UE_LOG_INFO("  build per frame: submission order %.3f ms | radix sorted %.3f ms | std::sort of keys alone %.3f ms",
+		UnsortedMs / DRAWLIST_ITERATION_COUNT, SortedMs / DRAWLIST_ITERATION_COUNT, StdSortMs / DRAWLIST_ITERATION_COUNT);
+
+	if (MismatchCount > 0)
+	{
+		UE_LOG_ERROR("Draw List Benchmark: %d of %d commands differ from std::stable_sort order", MismatchCount, Commands.Num());
+		return;
+	}
+	UE_LOG_SUCCESS("Draw List Benchmark: radix order matches std::stable_sort, %d fewer state changes than submission order",
+		SortedStats.GetSkippedStateChangeCount() - UnsortedStats.GetSkippedStateChangeCount());
+}
+
+void FEngineBenchmark::RunNameTable()
+{
+	FNameTable& NameTable = FNameTable::GetInstance();
+	FTaskScheduler& Scheduler = FTaskScheduler::GetInstance();
+	const int32 WorkerCount = Scheduler.IsRunning() ? Scheduler.GetThreadCount() : 1;
+
+	// 실제 클래스 이름처럼 대소문자가 섞인 기본 이름
+	TArray<FString> ClassNames;
+	TArray<FName> ClassFNames;
+	for (int32 Index = 0; Index < NAME_CLASS_COUNT; ++Index)
+	{
+		ClassNames.Add("UNameBenchActor" + to_string(Index));
+		ClassFNames.Add(FName(ClassNames[Index]));
+	}
+
+	UE_LOG_SYSTEM("Name Table Benchmark: %d class names, %d spawns, %d lookups", NAME_CLASS_COUNT, NAME_SPAWN_COUNT, NAME_LOOKUP_COUNT);
+
+	// 1. 스폰: 기존 방식은 문자열 이름을 매번 만들고, 새 방식은 클래스 FName에서 바로 번호를 붙인다
+	FLegacyNameTable LegacyTable;
+	size_t LegacyLength = 0;
+	FScopeCycleCounter LegacySpawnCounter;
+	for (int32 Index = 0; Index < NAME_SPAWN_COUNT; ++Index)
+	{
+		LegacyLength += LegacyTable.GetUniqueNameString(ClassNames[Index % NAME_CLASS_COUNT]).size();
+	}
+	const double LegacySpawnMs = LegacySpawnCounter.Finish();
+
+	TArray<FName> SingleNames(NAME_SPAWN_COUNT);
+	FScopeCycleCounter SingleSpawnCounter;
+	for (int32 Index = 0; Index < NAME_SPAWN_COUNT; ++Index)
+	{
+		SingleNames[Index] = NameTable.GetUniqueNameFromBase(ClassFNames[Index % NAME_CLASS_COUNT]);
+	}
+	const double SingleSpawnMs = SingleSpawnCounter.Finish();
+
+	TArray<FName> ParallelNames(NAME_SPAWN_COUNT);
+	FScopeCycleCounter ParallelSpawnCounter;
+	Scheduler.ParallelFor(NAME_SPAWN_COUNT, NAME_CHUNK_SIZE, [&](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			ParallelNames[Index] = NameTable.GetUniqueNameFromBase(ClassFNames[Index % NAME_CLASS_COUNT]);
+		}
+	});
+	const double ParallelSpawnMs = ParallelSpawnCounter.Finish();
+
+	// 2. 문자열 조회: 이미 등록된 이름을 const char*로 찾는다 (기존 방식은 FString 생성 + 소문자 복사 + 락)
+	TArray<const char*> LookupStrings;
+	for (const FString& ClassName : ClassNames)
+	{
+		LookupStrings.Add(ClassName.c_str());
+	}
+
+	int64 LegacyIndexSum = 0;
+	FScopeCycleCounter LegacyLookupCounter;
+	for (int32 Index = 0; Index < NAME_LOOKUP_COUNT; ++Index)
+	{
+		LegacyIndexSum += LegacyTable.FindOrAddName(LookupStrings[Index % NAME_CLASS_COUNT]).first;
+	}
+	const double LegacyLookupMs = LegacyLookupCounter.Finish();
+
+	int64 IndexSum = 0;
+	FScopeCycleCounter LookupCounter;
+	for (int32 Index = 0; Index < NAME_LOOKUP_COUNT; ++Index)
+	{
+		IndexSum += FName(LookupStrings[Index % NAME_CLASS_COUNT]).GetComparisonIndex();
+	}
+	const double LookupMs = LookupCounter.Finish();
+
+	// 3. ToString
+	size_t StringLength = 0;
+	FScopeCycleCounter ToStringCounter;
+	for (const FName& Name : ParallelNames)
+	{
+		StringLength += Name.ToString().size();
+	}
+	const double ToStringMs = ToStringCounter.Finish();
+
+	UE_LOG_INFO("  spawn: legacy %.1f ns/name | FName pool 1 thread %.1f ns/name | %d threads %.1f ns/name",
+		LegacySpawnMs * 1.0e6 / NAME_SPAWN_COUNT, SingleSpawnMs * 1.0e6 / NAME_SPAWN_COUNT,
+		WorkerCount, ParallelSpawnMs * 1.0e6 / NAME_SPAWN_COUNT);
+	UE_LOG_INFO("  lookup: legacy %.1f ns | FName(const char*) %.1f ns | ToString %.1f ns (checksum %lld/%lld, %zu/%zu chars)",
+		LegacyLookupMs * 1.0e6 / NAME_LOOKUP_COUNT, LookupMs * 1.0e6 / NAME_LOOKUP_COUNT, ToStringMs * 1.0e6 / NAME_SPAWN_COUNT,
+		static_cast<long long>(LegacyIndexSum), static_cast<long long>(IndexSum), LegacyLength, StringLength);
+
+	// 단일 스레드와 병렬 스폰이 만든 이름이 모두 달라야 한다
+	TArray<uint64> NameKeys;
+	NameKeys.Reserve(NAME_SPAWN_COUNT * 2);
+	for (const TArray<FName>* Names : { &SingleNames, &ParallelNames })
+	{
+		for (const FName& Name : *Names)
+		{
+			NameKeys.Add(static_cast<uint64>(Name.GetComparisonIndex()) << 32 | static_cast<uint32>(Name.GetUniqueNumber()));
+		}
+	}
+	NameKeys.Sort([](uint64 A, uint64 B) { return A < B; });
+
+	int32 DuplicateCount = 0;
+	for (int32 Index = 1; Index < NameKeys.Num(); ++Index)
+	{
+		DuplicateCount += NameKeys[Index] == NameKeys[Index - 1] ? 1 : 0;
+	}
+
+	if (DuplicateCount > 0)
+	{
+		UE_LOG_ERROR("Name Table Benchmark: %d duplicate names out of %d", DuplicateCount, NameKeys.Num());
+		return;
+	}
+	UE_LOG_SUCCESS("Name Table Benchmark: %d unique names, spawn %.1fx faster than legacy (1 thread)",
+		NameKeys.Num(), SingleSpawnMs > 0.0 ? LegacySpawnMs / SingleSpawnMs : 0.0);
+}
+
+void FEngineBenchmark::RunFrameAllocation()
+{
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<int32> IndexDistribution(1, 99999);
+
+	TArray<int32> Values(ALLOC_PRIMITIVE_COUNT);
+	for (int32& Value : Values)
+	{
+		Value = IndexDistribution(Random);
+	}
+
+	// "v/vt/vn" 형태의 짧은 토큰 (SSO 범위라 문자열 자체는 힙을 쓰지 않는다)
+	TArray<FString> FaceTokens;
+	for (int32 Index = 0; Index < ALLOC_FACE_COUNT * ALLOC_FACE_CORNER_COUNT; ++Index)
+	{
+		FaceTokens.Add(to_string(IndexDistribution(Random)) + "/" + to_string(IndexDistribution(Random) % 100) + "/" + to_string(Index % 100));
+	}
+
+	UE_LOG_SYSTEM("Frame Allocation Benchmark: %d frames, %d gathered values + %d faces x %d tokens per frame",
+		ALLOC_FRAME_COUNT, ALLOC_PRIMITIVE_COUNT, ALLOC_FACE_COUNT, ALLOC_FACE_CORNER_COUNT);
+
+	// 콘솔 명령은 프레임 배열이 살아 있지 않은 시점에 실행되므로 여기서 프레임 경계를 흉내 내도 안전하다
+	FFrameMemory& FrameMemory = FFrameMemory::GetInstance();
+	FrameMemory.EndFrame();
+
+	auto MeasureFrames = [&](auto&& BuildFrame, int64& OutChecksum, uint64& OutAllocationCount)
+	{
+		OutChecksum = 0;
+		OutAllocationCount = 0;
+		FScopeCycleCounter Counter;
+		for (int32 Frame = 0; Frame < ALLOC_FRAME_COUNT; ++Frame)
+		{
+			const uint64 StartCount = CumulativeAllocationCount.load(std::memory_order_relaxed);
+			OutChecksum += BuildFrame();
+			OutAllocationCount += CumulativeAllocationCount.load(std::memory_order_relaxed) - StartCount;
+			FrameMemory.EndFrame();
+		}
+		return Counter.Finish();
+	};
+
+	int64 HeapChecksum = 0;
+	uint64 HeapAllocationCount = 0;
+	const double HeapMs = MeasureFrames([&]()
+	{
+		return BuildFrameTemporaries<TArray<int32>, TArray<FString>>(Values, FaceTokens);
+	}, HeapChecksum, HeapAllocationCount);
+
+	int64 FrameChecksum = 0;
+	uint64 FrameAllocationCount = 0;
+	const double FrameMs = MeasureFrames([&]()
+	{
+		return BuildFrameTemporaries<TFrameArray<int32>, TArray<FString, TInlineAllocator<ALLOC_FACE_CORNER_COUNT>>>(Values, FaceTokens);
+	}, FrameChecksum, FrameAllocationCount);
+
+	const FFrameMemoryStats& FrameStats = FrameMemory.GetLastFrameStats();
+	UE_LOG_INFO("  heap TArray: %.1f allocs/frame, %.3f ms/frame", static_cast<double>(HeapAllocationCount) / ALLOC_FRAME_COUNT, HeapMs / ALLOC_FRAME_COUNT);
+	UE_LOG_INFO("  TFrameArray + TInlineAllocator<%d>: %.1f allocs/frame, %.3f ms/frame | frame memory %.1f KB used of %.1f KB, %u overflows",
+		ALLOC_FACE_CORNER_COUNT, static_cast<double>(FrameAllocationCount) / ALLOC_FRAME_COUNT, FrameMs / ALLOC_FRAME_COUNT,
+		FrameStats.UsedBytes / 1024.0, FrameStats.Capacity / 1024.0, FrameStats.OverflowCount);
+
+	if (HeapChecksum != FrameChecksum)
+	{
+		UE_LOG_ERROR("Frame Allocation Benchmark: checksum mismatch (%lld vs %lld)", static_cast<long long>(HeapChecksum), static_cast<long long>(FrameChecksum));
+		return;
+	}
+	UE_LOG_SUCCESS("Frame Allocation Benchmark: results match, %llu -> %llu heap allocations over %d frames",
+		static_cast<unsigned long long>(HeapAllocationCount), static_cast<unsigned long long>(FrameAllocationCount), ALLOC_FRAME_COUNT);
+}
+
+void FEngineBenchmark::RunHashTable()
+{
+	std::mt19937 Random(1234);
+
+	// FName: 에셋 캐시처럼 경로 문자열에서 만든 이름
+	TArray<FName> NameKeys;
+	NameKeys.Reserve(HASHMAP_KEY_COUNT * 2);
+	for (int32 Index = 0; Index < HASHMAP_KEY_COUNT * 2; ++Index)
+	{
+		NameKeys.Add(FName("Data/HashBench/Asset_" + to_string(Index) + ".obj"));
+	}
+
+	// UPrimitiveComponent*: 테이블은 포인터를 역참조하지 않으므로 컴포넌트 크기 간격의 주소를 키로 쓴다
+	TArray<uint8> ComponentStorage(static_cast<size_t>(HASHMAP_KEY_COUNT) * 2 * sizeof(UPrimitiveComponent));
+	TArray<UPrimitiveComponent*> ComponentKeys;
+	ComponentKeys.Reserve(HASHMAP_KEY_COUNT * 2);
+	for (int32 Index = 0; Index < HASHMAP_KEY_COUNT * 2; ++Index)
+	{
+		ComponentKeys.Add(reinterpret_cast<UPrimitiveComponent*>(ComponentStorage.GetData() + static_cast<size_t>(Index) * sizeof(UPrimitiveComponent)));
+	}
+	std::shuffle(ComponentKeys.begin(), ComponentKeys.end(), Random);
+
+	// 약한 참조 쌍: 핸들이 필요하므로 살아 있는 컴포넌트끼리 짝을 짓는다
+	TArray<UPrimitiveComponent*> LiveComponents;
+	for (TObjectIterator<UPrimitiveComponent> It; It; ++It)
+	{
+		LiveComponents.Add(*It);
+	}
+	TArray<FWeakComponentPair> PairKeys;
+	for (int32 IndexA = 0; IndexA < LiveComponents.Num() && PairKeys.Num() < HASHMAP_KEY_COUNT * 2; ++IndexA)
+	{
+		for (int32 IndexB = IndexA + 1; IndexB < LiveComponents.Num() && PairKeys.Num() < HASHMAP_KEY_COUNT * 2; ++IndexB)
+		{
+			PairKeys.Emplace(LiveComponents[IndexA], LiveComponents[IndexB]);
+		}
+	}
+	std::shuffle(PairKeys.begin(), PairKeys.end(), Random);
+
+	UE_LOG_SYSTEM("Hash Table Benchmark: %d keys inserted + %d missing keys looked up, %d rounds (node -> flat, ns per operation)",
+		HASHMAP_KEY_COUNT, HASHMAP_KEY_COUNT, HASHMAP_ROUND_COUNT);
+
+	bool bAllMatch = true;
+	bAllMatch &= CompareHashTables<TMap<FName, int32>, TFlatMap<FName, int32>>("TMap<FName, int32>", NameKeys, Random);
+	bAllMatch &= CompareHashTables<TMap<UPrimitiveComponent*, int32>, TFlatMap<UPrimitiveComponent*, int32>>("TMap<UPrimitiveComponent*, int32>", ComponentKeys, Random);
+	bAllMatch &= CompareHashTables<TSet<UPrimitiveComponent*>, TFlatSet<UPrimitiveComponent*>>("TSet<UPrimitiveComponent*>", ComponentKeys, Random);
+	if (PairKeys.Num() >= 4)
+	{
+		bAllMatch &= CompareHashTables<TMap<FWeakComponentPair, int32, FWeakComponentPairHasher>, TFlatMap<FWeakComponentPair, int32, FWeakComponentPairHasher>>(
+			"TMap<weak pair, int32>", PairKeys, Random);
+	}
+	else
+	{
+		UE_LOG_WARNING("  weak pointer pair: 레벨에 프리미티브 컴포넌트가 부족해 건너뜀");
+	}
+
+	if (!bAllMatch)
+	{
+		UE_LOG_ERROR("Hash Table Benchmark: results differ between node and flat tables");
+		return;
+	}
+	UE_LOG_SUCCESS("Hash Table Benchmark: node and flat tables agree on every key type");
+}
+
+void FEngineBenchmark::RunObjectPool()
+{
+	constexpr int32 ClassCount = static_cast<int32>(std::size(ChurnSpawnFunctions));
+
+	// 두 경로가 같은 순서로 같은 클래스를 스폰/파괴하도록 순서를 미리 뽑아 둔다
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<int32> ClassDistribution(0, ClassCount - 1);
+	TArray<int32> SpawnClasses;
+	TArray<int32> DestroyOrder;
+	for (int32 Index = 0; Index < OBJPOOL_ROUND_COUNT * OBJPOOL_BURST_COUNT * 3 / 2; ++Index)
+	{
+		SpawnClasses.Add(ClassDistribution(Random));
+	}
+	for (int32 Round = 0; Round < OBJPOOL_ROUND_COUNT; ++Round)
+	{
+		TArray<int32> Order(OBJPOOL_BURST_COUNT);
+		std::iota(Order.begin(), Order.end(), 0);
+		std::shuffle(Order.begin(), Order.end(), Random);
+		DestroyOrder.Append(Order.GetData(), OBJPOOL_BURST_COUNT / 2);
+	}
+
+	TArray<UClass*> Classes = { USceneComponent::StaticClass(), USphereComponent::StaticClass(), UBoxComponent::StaticClass(), UObject::StaticClass() };
+	auto GetLiveCount = [&Classes]()
+	{
+		uint32 LiveCount = 0;
+		for (UClass* Class : Classes)
+		{
+			LiveCount += Class->GetObjectPool() ? Class->GetObjectPool()->GetStats().LiveCount : 0;
+		}
+		return LiveCount;
+	};
+
+	UE_LOG_SYSTEM("Object Pool Benchmark: %d rounds x (%d spawns, %d destroys + respawns, destroy all), %d classes",
+		OBJPOOL_ROUND_COUNT, OBJPOOL_BURST_COUNT, OBJPOOL_BURST_COUNT / 2, ClassCount);
+
+	auto RunChurn = [&](bool bInPooled, uint64& OutAllocationCount)
+	{
+		TArray<UObject*> Objects;
+		Objects.Reserve(OBJPOOL_BURST_COUNT);
+		int32 SpawnCursor = 0;
+		int32 DestroyCursor = 0;
+
+		const uint64 StartAllocationCount = CumulativeAllocationCount.load(std::memory_order_relaxed);
+		FScopeCycleCounter Counter;
+		for (int32 Round = 0; Round < OBJPOOL_ROUND_COUNT; ++Round)
+		{
+			for (int32 Index = 0; Index < OBJPOOL_BURST_COUNT; ++Index)
+			{
+				Objects.Add(ChurnSpawnFunctions[SpawnClasses[SpawnCursor++]](bInPooled));
+			}
+
+			// 절반을 흩어진 위치에서 파괴하고 그 자리에 다시 스폰
+			for (int32 Index = 0; Index < OBJPOOL_BURST_COUNT / 2; ++Index)
+			{
+				UObject*& Slot = Objects[DestroyOrder[DestroyCursor++]];
+				delete Slot;
+				Slot = ChurnSpawnFunctions[SpawnClasses[SpawnCursor++]](bInPooled);
+			}
+
+			for (UObject* Object : Objects)
+			{
+				delete Object;
+			}
+			Objects.Reset();
+		}
+		const double ElapsedMs = Counter.Finish();
+		OutAllocationCount = CumulativeAllocationCount.load(std::memory_order_relaxed) - StartAllocationCount;
+		return ElapsedMs;
+	};
+
+	const uint32 LiveCountBefore = GetLiveCount();
+
+	uint64 HeapAllocationCount = 0;
+	const double HeapMs = RunChurn(false, HeapAllocationCount);
+	uint64 PoolAllocationCount = 0;
+	const double PoolMs = RunChurn(true, PoolAllocationCount);
+
+	const double ObjectCount = static_cast<double>(OBJPOOL_ROUND_COUNT) * OBJPOOL_BURST_COUNT * 3 / 2;
+	UE_LOG_INFO("  heap new:      %.3f ms (%.1f ns/object), %llu heap allocations",
+		HeapMs, HeapMs * 1000000.0 / ObjectCount, static_cast<unsigned long long>(HeapAllocationCount));
+	UE_LOG_INFO("  UClass pools:  %.3f ms (%.1f ns/object), %llu heap allocations",
+		PoolMs, PoolMs * 1000000.0 / ObjectCount, static_cast<unsigned long long>(PoolAllocationCount));
+	for (UClass* Class : Classes)
+	{
+		if (const FObjectPool* Pool = Class->GetObjectPool())
+		{
+			const FObjectPoolStats Stats = Pool->GetStats();
+			UE_LOG_INFO("  %-18s slot %u bytes, %u slabs x %u slots, peak %u live",
+				Class->GetName().ToString().c_str(), Stats.SlotSize, Stats.SlabCount, Stats.SlotsPerSlab, Stats.PeakCount);
+		}
+	}
+
+	const uint32 LiveCountAfter = GetLiveCount();
+	if (LiveCountAfter != LiveCountBefore)
+	{
+		UE_LOG_ERROR("Object Pool Benchmark: live count changed (%u -> %u), objects leaked or double freed", LiveCountBefore, LiveCountAfter);
+		return;
+	}
+	UE_LOG_SUCCESS("Object Pool Benchmark: every pooled object returned to its pool, %.2fx faster than heap new", HeapMs / std::max(PoolMs, 0.001));
+}
+
+void FEngineBenchmark::RunCast()
+{
+	// 레벨에 있는 객체에 여러 종류의 컴포넌트를 더해 모집단을 만든다
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<int32> ClassDistribution(0, static_cast<int32>(std::size(ChurnSpawnFunctions)) - 1);
+	TArray<UObject*> SpawnedObjects;
+	SpawnedObjects.Reserve(CAST_SPAWN_COUNT);
+	for (int32 Index = 0; Index < CAST_SPAWN_COUNT; ++Index)
+	{
+		SpawnedObjects.Add(ChurnSpawnFunctions[ClassDistribution(Random)](true));
+	}
+
+	TArray<UObject*> Population;
+	for (TObjectIterator<UObject> It; It; ++It)
+	{
+		Population.Add(*It);
+	}
+
+	// 모집단에서 무작위로 뽑아 클래스가 섞인 순서로 Cast한다
+	std::uniform_int_distribution<int32> ObjectDistribution(0, Population.Num() - 1);
+	TArray<UObject*> Objects;
+	Objects.Reserve(CAST_OBJECT_COUNT);
+	for (int32 Index = 0; Index < CAST_OBJECT_COUNT; ++Index)
+	{
+		Objects.Add(Population[ObjectDistribution(Random)]);
+	}
+
+	TArray<UClass*> AllClasses = UClass::FindClasses(UObject::StaticClass());
+	UE_LOG_SYSTEM("Cast Benchmark: %d casts x %d rounds from %d live objects, %d classes (walk -> range)",
+		CAST_OBJECT_COUNT, CAST_ROUND_COUNT, Population.Num(), AllClasses.Num());
+
+	bool bAllMatch = true;
+	bAllMatch &= MeasureCast<AActor>("AActor", Objects);
+	bAllMatch &= MeasureCast<USceneComponent>("USceneComponent", Objects);
+	bAllMatch &= MeasureCast<UPrimitiveComponent>("UPrimitiveComponent", Objects);
+	bAllMatch &= MeasureCast<UShapeComponent>("UShapeComponent", Objects);
+	bAllMatch &= MeasureCast<UStaticMeshComponent>("UStaticMeshComponent", Objects);
+	bAllMatch &= MeasureCast<ULightComponent>("ULightComponent", Objects);
+
+	// 등록된 모든 클래스 쌍에서 구간 판정이 부모 따라가기와 같은지 검사
+	int32 MismatchCount = 0;
+	for (UClass* Class : AllClasses)
+	{
+		for (UClass* SuperClass : AllClasses)
+		{
+			if (Class->IsChildOf(SuperClass) != IsChildOfByWalk(Class, SuperClass))
+			{
+				if (MismatchCount++ == 0)
+				{
+					UE_LOG_ERROR("  %s IsChildOf %s: range and walk disagree", Class->GetName().ToString().c_str(), SuperClass->GetName().ToString().c_str());
+				}
+			}
+		}
+	}
+
+	for (UObject* Object : SpawnedObjects)
+	{
+		delete Object;
+	}
+
+	if (!bAllMatch || MismatchCount > 0)
+	{
+		UE_LOG_ERROR("Cast Benchmark: %d of %d class pairs disagree", MismatchCount, AllClasses.Num() * AllClasses.Num());
+		return;
+	}
+	UE_LOG_SUCCESS("Cast Benchmark: range check agrees with the parent walk on all %d class pairs", AllClasses.Num() * AllClasses.Num());
+}
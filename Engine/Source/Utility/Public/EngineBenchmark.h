@@ -0,0 +1,147 @@
+/**
+ * @file EngineBenchmark.h
+ * @brief 엔진 내부 자료구조와 알고리즘의 성능을 측정하는 벤치마크 모음
+ *
+ * 콘솔의 "bench <name>" 명령으로 실행되며, 측정 결과는 콘솔 로그로 출력됩니다.
+ * 렌더링과 무관한 CPU 측 작업만 측정합니다.
+ */
+
+#pragma once
+
+/**
+ * @class FEngineBenchmark
+ * @brief 벤치마크 실행을 위한 정적 유틸리티 클래스
+ */
+class FEngineBenchmark
+{
+public:
+	/**
+	 * @brief 이름으로 벤치마크를 실행
+	 * @param InName 벤치마크 이름 (소문자)
+	 * @return 해당 이름의 벤치마크가 존재하면 true
+	 */
+	static bool Run(const FString& InName);
+
+	/**
+	 * @brief 실행 가능한 벤치마크 목록을 콘솔에 출력
+	 */
+	static void PrintAvailable();
+
+private:
+	/**
+	 * @brief 로드된 모든 스태틱 메시에 대해 incremental BVH 빌드와 SAH BVH 빌드의 시간 및 cost 비교
+	 */
+	static void RunBVHBuild();
+
+	/**
+	 * @brief 로드된 모든 스태틱 메시에 대해 후보 삼각형 수집 순회, closest-hit 순회, 4-ray 패킷 순회 시간 비교
+	 */
+	static void RunBVHRaycast();
+
+	/**
+	 * @brief 무작위 shape pair에 대해 overlap narrow phase를 단일/다중 스레드로 실행해 시간을 비교하고,
+	 *        상태가 바뀐 결과(이벤트) 순서가 같은지 검사
+	 */
+	static void RunOverlapNarrowphase();
+
+	/**
+	 * @brief 로드된 모든 스켈레탈 메시를 무작위 포즈로 스키닝해 기존 스칼라 경로와 SIMD 경로(단일/다중 스레드)의 시간 및 오차 비교
+	 */
+	static void RunSkinning();
+
+	/**
+	 * @brief DefaultSkeletalMesh.fbx를 비튼 포즈로 linear blend / dual quaternion 스키닝해 영향 본당 시간,
+	 *        레퍼런스 포즈 재현 오차, 두 결과의 차이와 메시 부피 변화를 비교
+	 */
+	static void RunDualQuatSkinning();
+
+	/**
+	 * @brief 로드된 모든 애니메이션 시퀀스를 여러 인스턴스가 서로 다른 시점으로 재생한다고 가정하고
+	 *        본당 샘플링 시간(단일/다중 스레드)과 압축률을 측정
+	 */
+	static void RunAnimSampling();
+
+	/**
+	 * @brief Data 폴더의 스태틱 메시(OBJ, 스태틱 FBX)마다 원본 임포트(cold), 기존 중간 캐시(objbin/fbxbin) 임포트,
+	 *        쿠킹 파일 로드(warm) 시간을 비교하고 결과가 같은지 검사
+	 */
+	static void RunCookedMeshLoad();
+
+	/**
+	 * @brief Data 폴더의 OBJ 파일마다 단일 스레드와 조각 병렬 파싱의 처리량(MB/s)을 비교하고
+	 *        결과가 같은지 검사 (objbin 캐시는 사용하지 않음)
+	 */
+	static void RunObjParse();
+
+	/**
+	 * @brief Data 폴더의 스태틱 메시(OBJ, 스태틱 FBX)마다 최적화하지 않은 임포트 결과와 FMeshOptimizer를 거친 결과의
+	 *        ACMR, ATVR, 정점 overfetch를 시뮬레이션해 비교하고 삼각형 집합이 같은지 검사
+	 */
+	static void RunMeshOptimize();
+
+	/**
+	 * @brief Data 폴더의 스태틱 메시(OBJ, 스태틱 FBX)마다 LOD 체인을 만들고 LOD별 삼각형 감소율, quadric 오차와
+	 *        원본 정점에서 측정한 최대 편차, ScreenSize, 새로 생긴 열린 edge를 검사
+	 */
+	static void RunStaticMeshLOD();
+
+	/**
+	 * @brief Data 폴더의 스태틱 메시(OBJ, 스태틱 FBX)마다 정점을 FCompressedVertex로 인코딩/디코딩해
+	 *        위치/노멀/탄젠트/UV/색 오차와 handedness, 재인코딩 안정성, 정점 크기 감소를 검사
+	 */
+	static void RunVertexQuantize();
+
+	/**
+	 * @brief 현재 레벨의 바운드로 정한 고정 카메라 경로(궤도, 가로지르기)를 재생하며 오클루전 컬링을 1 스레드와 bin 병렬로
+	 *        실행해 단계별 시간, 가려진 메시 비율, 두 결과의 일치 여부, 픽셀 단위 래스터라이즈 대비 타일 깊이의 보수성을 검사
+	 */
+	static void RunOcclusionCulling();
+
+	/**
+	 * @brief 현재 레벨을 궤도로 도는 4개 시점에 대해 스칼라 트리 순회, SoA SIMD 뷰별 컬링, SoA SIMD 일괄 컬링의
+	 *        시간과 뷰별 검사/컬링 수를 비교하고 세 결과가 같은지 검사
+	 */
+	static void RunFrustumCulling();
+
+	/**
+	 * @brief 분할 뷰포트 시점 4개, 직교 캐스케이드 4개, 포인트 라이트 6면을 뷰마다 ViewVolumeCuller로 컬링할 때와
+	 *        FMultiViewCuller 한 번으로 컬링할 때의 시간과 검사 수를 비교하고 결과가 같은지 검사
+	 */
+	static void RunMultiViewCulling();
+
+	/**
+	 * @brief 합성한 스태틱 메시 draw로 FMeshDrawList의 radix 정렬 시간을 std::sort와 비교하고,
+	 *        추가한 순서와 정렬한 순서의 상태 변경 수를 비교. 정렬 순서가 키 기준 안정 정렬과 같은지 검사
+	 */
+	static void RunDrawList();
+
+	/**
+	 * @brief 몇 개의 클래스 이름으로 오브젝트를 대량 스폰할 때의 이름 생성 비용을 기존 락 + TMap 방식과 비교하고,
+	 *        1 스레드와 모든 스레드에서 만든 이름이 하나도 겹치지 않는지 검사
+	 */
+	static void RunNameTable();
+
+	/**
+	 * @brief 프레임마다 만드는 임시 배열을 힙 TArray로 만들 때와 TFrameArray/TInlineAllocator로 만들 때의
+	 *        프레임당 힙 할당 수(CumulativeAllocationCount 증가량)와 시간을 비교하고 결과가 같은지 검사
+	 */
+	static void RunFrameAllocation();
+
+	/**
+	 * @brief FName, UPrimitiveComponent*, 약한 참조 쌍 키로 노드 기반 TMap/TSet과 오픈 어드레싱 TFlatMap/TFlatSet의
+	 *        넣기/조회/제거/순회 시간을 비교하고 결과가 같은지 검사
+	 */
+	static void RunHashTable();
+
+	/**
+	 * @brief 컴포넌트 묶음을 반복해서 스폰/파괴할 때 힙 new와 UClass별 슬랩 풀의 시간과 힙 할당 수를 비교하고,
+	 *        끝난 뒤 풀의 live 수가 처음과 같은지 검사
+	 */
+	static void RunObjectPool();
+
+	/**
+	 * @brief 클래스가 섞인 객체 배열에서 부모를 따라가는 판정과 클래스 트리 구간 판정(Cast<T>)의 시간을 비교하고,
+	 *        등록된 모든 클래스 쌍에서 두 판정이 같은지 검사
+	 */
+	static void RunCast();
+};